@@ -45,6 +45,8 @@ extern int gpio_demo(void *, ...);
 extern int gpio_isr_test(void *, ...);
 extern int pwm_demo(void *, ...);
 extern int crypt_hard_demo(void *, ...);
+extern int crypt_bench_demo(void *, ...);
+extern int crypt_conform_demo(void *, ...);
 extern int wm_7816_demo(void *, ...);
 extern int rsa_demo(void *, ...);
 extern int slave_spi_demo(void *, ...);
@@ -215,6 +217,14 @@ struct demo_console_info_t  console_tbl[] =
     {"t-crypt",   	crypt_hard_demo,	0x0,    0, "Test Encryption/Decryption API"},
 #endif
 
+#if DEMO_CRYPT_BENCH
+    {"t-cryptbench",	crypt_bench_demo,	0x0,    0, "Benchmark SHA-256/SHA-1/MD5/CRC throughput and signed image verification"},
+#endif
+
+#if DEMO_CRYPT_CONFORM
+    {"t-cryptconf",	crypt_conform_demo,	0x0,    0, "Check AES/DES/RC4/CRC/SHA1/MD5/exptmod against known answers and report cycles per byte"},
+#endif
+
 #if DEMO_RSA
     {"t-rsa",   	rsa_demo,	0x0,    0, "Test RSA Encryption/Decryption API"},
 #endif
@@ -0,0 +1,352 @@
+#include <string.h>
+#include "wm_include.h"
+#include "wm_crypto_hard.h"
+#include "wm_demo.h"
+
+#if DEMO_CRYPT_BENCH
+#include "mbedtls/sha256.h"
+#include "mbedtls/rsa.h"
+#include "mbedtls/ecp.h"
+
+/*
+ * Throughput of the digests we can use to check an image (SHA-256 in
+ * software, SHA-1/MD5/CRC32 on the crypto engine), followed by the cost of
+ * verifying a 256KB image signed with RSA-2048 and with ECDSA P-256.
+ *
+ * Every case runs for at least BENCH_MIN_TICKS, the per call overhead of
+ * init/final is included so the small sizes show what a TLS record costs.
+ */
+#define BENCH_BUF_SIZE      4096
+#define BENCH_MIN_TICKS     (HZ)
+#define BENCH_IMG_CHUNKS    64
+
+/*
+ * The test image is BENCH_IMG_CHUNKS copies of the 4KB pattern
+ * buf[i] = i * 7 + 3, signed offline with the keys below.
+ * SHA-256(image) = fc605e60859112505546770ab850bfbf0243484140b42d1f6ae9556bbaa7784e
+ */
+#define IMG_RSA_N   "D3CB9E5BE65D9EB319DB10C6505C16D4" \
+                    "6EFACE5FBDD247B6FD077211B770945E" \
+                    "A86E6598F3C848A9FB4A6950F766AB39" \
+                    "38ECAD36AC09D4DE6BA792210FEC84FE" \
+                    "56CD10A87B08729A68647C31D3904D6D" \
+                    "F024D6DAFC5E8517C10D287C4359DF57" \
+                    "41F29A5AE61ED9128F5CC3831F8C4DA8" \
+                    "2B162432970B46F62697C81D2CAE2A39" \
+                    "AF4FDB83AA4171F66F5B009E69BDFE3C" \
+                    "81864C5434892442BA810A35072E7B74" \
+                    "50B6579823C1AFCD3501206D6D14A187" \
+                    "BFA39338AB269D0E8D641BDCD56BFBD4" \
+                    "229E7E4002354927BAF95297D59D2E82" \
+                    "0E561AFC8DC1EA1B3151A6A52C0642E3" \
+                    "177A1EA59AEBB11A3AD7D1FF443BA375" \
+                    "9B2855958B1E2C4B65A9C8F16B633EC1"
+
+#define IMG_RSA_E   "10001"
+
+#define IMG_RSA_SIG "09B7868DE38E4DA61F1F25F579A0DC37" \
+                    "6074FE76034FA63471411D59866506E6" \
+                    "AA9A1AC0758883071178672DDC4ABDDD" \
+                    "F640C91C0FB8DF72BA9EBA2989A0F1DF" \
+                    "09760520ADFA948856BAA012B819D855" \
+                    "1C188DF40CAB9103B1D7C93A575E085D" \
+                    "1E0955750728F81155D4CE5A1D879DA0" \
+                    "C08F3D786E8FF9C7572FE68EF3572EE6" \
+                    "6C50B05EAFA76CBFA85848D4A01DCF98" \
+                    "5E9DAF47F879B5D054BED3F3253DFA3E" \
+                    "8809A528FFA2E05C08BB204E7B9B069B" \
+                    "F266DED39B48E829AD0690CDB3CFC8A4" \
+                    "44A97AC1AE13CB8D5CCEE7735B7D1FBC" \
+                    "3A73F155E6F664DBB1364E3A6DA001E0" \
+                    "772F1D44F8A3AA48083DAFB68EC9F20D" \
+                    "F4E1B66CACF2AD80144B0B1E419BA03E"
+
+#define IMG_EC_QX   "797B590D20289BAE469A449F9963193B" \
+                    "1F976C49EB017F9196BBC54F86C30768"
+#define IMG_EC_QY   "F9C7F5D7C37DBE94F42D549FBAF86787" \
+                    "36433BDACFD5B55406B5D6443E470F2B"
+#define IMG_EC_R    "066B113C8DD53ECF5F0DE714B6A731FD" \
+                    "34E5866C2A09586D119CCD64B1FC2F96"
+#define IMG_EC_S    "4815A7A01335863859AC87E740EF6AD2" \
+                    "DF5075BF695A57BFE7AB8491C2EF03A6"
+
+typedef void (*bench_digest_fn)(const u8 *in, u32 len, u8 *out);
+
+static const u32 bench_sizes[] = {64, 256, 1024, BENCH_BUF_SIZE};
+
+static void bench_sha256(const u8 *in, u32 len, u8 *out)
+{
+	mbedtls_sha256_ret(in, len, out, 0);
+}
+
+static void bench_sha1(const u8 *in, u32 len, u8 *out)
+{
+	psDigestContext_t ctx;
+
+	tls_crypto_sha1_init(&ctx);
+	tls_crypto_sha1_update(&ctx, in, len);
+	tls_crypto_sha1_final(&ctx, out);
+}
+
+static void bench_md5(const u8 *in, u32 len, u8 *out)
+{
+	psDigestContext_t ctx;
+
+	tls_crypto_md5_init(&ctx);
+	tls_crypto_md5_update(&ctx, in, len);
+	tls_crypto_md5_final(&ctx, out);
+}
+
+static void bench_crc32(const u8 *in, u32 len, u8 *out)
+{
+	psCrcContext_t ctx;
+
+	tls_crypto_crc_init(&ctx, 0xFFFFFFFF, CRYPTO_CRC_TYPE_32, 3);
+	tls_crypto_crc_update(&ctx, (unsigned char *)in, len);
+	tls_crypto_crc_final(&ctx, (u32 *)out);
+}
+
+static const struct {
+	const char *name;
+	bench_digest_fn fn;
+} bench_digests[] = {
+	{"sha256 (sw)", bench_sha256},
+	{"sha1 (hw)",   bench_sha1},
+	{"md5 (hw)",    bench_md5},
+	{"crc32 (hw)",  bench_crc32},
+};
+
+/* known answers from FIPS 180-2, then one-shot against odd sized updates */
+static int bench_sha256_check(const u8 *buf)
+{
+	static const u8 abc_sum[32] = {
+		0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41, 0x40, 0xDE, 0x5D, 0xAE, 0x22, 0x23,
+		0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17, 0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD};
+	static const u8 two_block_sum[32] = {
+		0x24, 0x8D, 0x6A, 0x61, 0xD2, 0x06, 0x38, 0xB8, 0xE5, 0xC0, 0x26, 0x93, 0x0C, 0x3E, 0x60, 0x39,
+		0xA3, 0x3C, 0xE4, 0x59, 0x64, 0xFF, 0x21, 0x67, 0xF6, 0xEC, 0xED, 0xD4, 0x19, 0xDB, 0x06, 0xC1};
+	const char *two_block = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+	mbedtls_sha256_context ctx;
+	u8 sum1[32];
+	u8 sum2[32];
+	u32 off;
+	u32 step;
+
+	mbedtls_sha256_ret((const u8 *)"abc", 3, sum1, 0);
+	if (memcmp(sum1, abc_sum, 32))
+		return -1;
+
+	mbedtls_sha256_ret((const u8 *)two_block, strlen(two_block), sum1, 0);
+	if (memcmp(sum1, two_block_sum, 32))
+		return -1;
+
+	mbedtls_sha256_ret(buf, BENCH_BUF_SIZE, sum1, 0);
+	mbedtls_sha256_init(&ctx);
+	mbedtls_sha256_starts_ret(&ctx, 0);
+	for (off = 0, step = 1; off < BENCH_BUF_SIZE; off += step, step += 63)
+	{
+		if (step > BENCH_BUF_SIZE - off)
+			step = BENCH_BUF_SIZE - off;
+		mbedtls_sha256_update_ret(&ctx, buf + off, step);
+	}
+	mbedtls_sha256_finish_ret(&ctx, sum2);
+	mbedtls_sha256_free(&ctx);
+
+	return memcmp(sum1, sum2, 32) ? -1 : 0;
+}
+
+static void bench_throughput(const u8 *buf)
+{
+	u8 out[32];
+	u32 start;
+	u32 ticks;
+	u32 bytes;
+	int i;
+	int j;
+
+	printf("%-12s", "bytes");
+	for (j = 0; j < sizeof(bench_sizes) / sizeof(bench_sizes[0]); j++)
+		printf("%10u", bench_sizes[j]);
+	printf("   (KB/s)\n");
+
+	for (i = 0; i < sizeof(bench_digests) / sizeof(bench_digests[0]); i++)
+	{
+		printf("%-12s", bench_digests[i].name);
+		for (j = 0; j < sizeof(bench_sizes) / sizeof(bench_sizes[0]); j++)
+		{
+			bytes = 0;
+			start = tls_os_get_time();
+			do
+			{
+				bench_digests[i].fn(buf, bench_sizes[j], out);
+				bytes += bench_sizes[j];
+				ticks = tls_os_get_time() - start;
+			} while (ticks < BENCH_MIN_TICKS);
+
+			printf("%10u", (u32)((u64)bytes * HZ / ticks / 1024));
+		}
+		printf("\n");
+	}
+}
+
+/* ECDSA_C is not built in, the verification equation is evaluated directly */
+static int bench_ecdsa_verify(mbedtls_ecp_group *grp, const u8 *hash,
+                              const mbedtls_ecp_point *Q,
+                              const mbedtls_mpi *r, const mbedtls_mpi *s)
+{
+	int ret;
+	mbedtls_mpi e, w, u1, u2;
+	mbedtls_ecp_point R;
+
+	mbedtls_mpi_init(&e);
+	mbedtls_mpi_init(&w);
+	mbedtls_mpi_init(&u1);
+	mbedtls_mpi_init(&u2);
+	mbedtls_ecp_point_init(&R);
+
+	MBEDTLS_MPI_CHK(mbedtls_mpi_read_binary(&e, hash, 32));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_inv_mod(&w, s, &grp->N));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&u1, &e, &w));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_mod_mpi(&u1, &u1, &grp->N));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&u2, r, &w));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_mod_mpi(&u2, &u2, &grp->N));
+	MBEDTLS_MPI_CHK(mbedtls_ecp_muladd(grp, &R, &u1, &grp->G, &u2, Q));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_mod_mpi(&R.X, &R.X, &grp->N));
+
+	if (mbedtls_mpi_cmp_mpi(&R.X, r) != 0)
+		ret = -1;
+
+cleanup:
+	mbedtls_mpi_free(&e);
+	mbedtls_mpi_free(&w);
+	mbedtls_mpi_free(&u1);
+	mbedtls_mpi_free(&u2);
+	mbedtls_ecp_point_free(&R);
+
+	return ret;
+}
+
+static void bench_image_verify(const u8 *buf)
+{
+	mbedtls_sha256_context sha;
+	mbedtls_rsa_context rsa;
+	mbedtls_ecp_group grp;
+	mbedtls_ecp_point Q;
+	mbedtls_mpi r, s;
+	u8 hash[32];
+	u8 sig[256];
+	u32 start;
+	u32 ticks;
+	u32 n;
+	int ret;
+
+	mbedtls_sha256_init(&sha);
+	mbedtls_rsa_init(&rsa, MBEDTLS_RSA_PKCS_V15, 0);
+	mbedtls_ecp_group_init(&grp);
+	mbedtls_ecp_point_init(&Q);
+	mbedtls_mpi_init(&r);
+	mbedtls_mpi_init(&s);
+
+	start = tls_os_get_time();
+	mbedtls_sha256_starts_ret(&sha, 0);
+	for (n = 0; n < BENCH_IMG_CHUNKS; n++)
+		mbedtls_sha256_update_ret(&sha, buf, BENCH_BUF_SIZE);
+	mbedtls_sha256_finish_ret(&sha, hash);
+	ticks = tls_os_get_time() - start;
+	printf("image %uKB sha256: %u ms\n", BENCH_IMG_CHUNKS * BENCH_BUF_SIZE / 1024,
+	       ticks * 1000 / HZ);
+
+	if ((ret = mbedtls_mpi_read_string(&rsa.N, 16, IMG_RSA_N)) != 0 ||
+	    (ret = mbedtls_mpi_read_string(&rsa.E, 16, IMG_RSA_E)) != 0 ||
+	    (ret = mbedtls_mpi_read_string(&r, 16, IMG_RSA_SIG)) != 0 ||
+	    (ret = mbedtls_mpi_write_binary(&r, sig, sizeof(sig))) != 0)
+	{
+		printf("rsa key load err: -0x%04X\n", -ret);
+		goto OUT;
+	}
+	rsa.len = mbedtls_mpi_size(&rsa.N);
+
+	n = 0;
+	start = tls_os_get_time();
+	do
+	{
+		ret = mbedtls_rsa_pkcs1_verify(&rsa, NULL, NULL, MBEDTLS_RSA_PUBLIC,
+		                               MBEDTLS_MD_SHA256, 32, hash, sig);
+		n++;
+		ticks = tls_os_get_time() - start;
+	} while (ret == 0 && ticks < BENCH_MIN_TICKS);
+	if (ret != 0)
+	{
+		printf("rsa2048 verify fail: -0x%04X\n", -ret);
+		goto OUT;
+	}
+	printf("rsa2048 pkcs1 verify: %u us\n", ticks * (1000000 / HZ) / n);
+
+	if ((ret = mbedtls_ecp_group_load(&grp, MBEDTLS_ECP_DP_SECP256R1)) != 0 ||
+	    (ret = mbedtls_ecp_point_read_string(&Q, 16, IMG_EC_QX, IMG_EC_QY)) != 0 ||
+	    (ret = mbedtls_mpi_read_string(&r, 16, IMG_EC_R)) != 0 ||
+	    (ret = mbedtls_mpi_read_string(&s, 16, IMG_EC_S)) != 0)
+	{
+		printf("ecdsa key load err: -0x%04X\n", -ret);
+		goto OUT;
+	}
+
+	n = 0;
+	start = tls_os_get_time();
+	do
+	{
+		ret = bench_ecdsa_verify(&grp, hash, &Q, &r, &s);
+		n++;
+		ticks = tls_os_get_time() - start;
+	} while (ret == 0 && ticks < BENCH_MIN_TICKS);
+	if (ret != 0)
+	{
+		printf("ecdsa p256 verify fail: -0x%04X\n", -ret);
+		goto OUT;
+	}
+	printf("ecdsa p256 verify: %u us\n", ticks * (1000000 / HZ) / n);
+
+OUT:
+	mbedtls_sha256_free(&sha);
+	mbedtls_rsa_free(&rsa);
+	mbedtls_ecp_group_free(&grp);
+	mbedtls_ecp_point_free(&Q);
+	mbedtls_mpi_free(&r);
+	mbedtls_mpi_free(&s);
+}
+
+int crypt_bench_demo(void)
+{
+	u8 *buf;
+	int i;
+
+	buf = tls_mem_alloc(BENCH_BUF_SIZE);
+	if (buf == NULL)
+	{
+		printf("malloc err\n");
+		return WM_FAILED;
+	}
+
+	for (i = 0; i < BENCH_BUF_SIZE; i++)
+	{
+		buf[i] = i * 7 + 3;
+	}
+
+	tls_crypto_init();
+
+	if (bench_sha256_check(buf))
+	{
+		printf("sha256 check fail\n");
+		tls_mem_free(buf);
+		return WM_FAILED;
+	}
+
+	bench_throughput(buf);
+	bench_image_verify(buf);
+
+	tls_mem_free(buf);
+
+	return WM_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,737 @@
+#include <string.h>
+#include "wm_include.h"
+#include "wm_crypto_hard.h"
+#include "wm_crypto_hard_mbed.h"
+#include "wm_cpu.h"
+#include "wm_demo.h"
+
+#if DEMO_CRYPT_CONFORM
+#include "mbedtls/bignum.h"
+
+/*
+ * Conformance of the crypto engine wrappers against published vectors
+ * (FIPS 197/SP 800-38A for AES, FIPS 81 for DES, RFC 6229 for RC4,
+ * FIPS 180 for SHA-1, RFC 1321 for MD5, the CRC catalogue check values),
+ * the hardware exptmod against known answers, edge cases and the software
+ * bignum on random operands, then the cost of each in CPU cycles.
+ *
+ * Every input is copied to RAM first as the engine DMA does not read flash.
+ */
+#define CONF_BUF_SIZE       4096
+#ifndef CONF_MIN_TICKS
+#define CONF_MIN_TICKS      (HZ)     /* shortest timed loop, the host build runs shorter ones */
+#endif
+#define CONF_RANDOM_ROUNDS  2
+
+enum conf_cipher
+{
+	CONF_AES,
+	CONF_DES,
+	CONF_3DES,
+	CONF_RC4,
+};
+
+struct conf_cipher_vec
+{
+	const char *name;
+	enum conf_cipher alg;
+	CRYPTO_MODE mode;
+	const u8 *key;
+	u32 keylen;
+	const u8 *iv;
+	const u8 *pt;
+	const u8 *ct;
+	u32 len;
+};
+
+static const u8 aes_key[16] = {
+	0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C};
+static const u8 aes_cbc_iv[16] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
+static const u8 aes_ctr_iv[16] = {
+	0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF};
+static const u8 aes_pt[64] = {
+	0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+	0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+	0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+	0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10};
+static const u8 aes_ecb_ct[64] = {
+	0x3A, 0xD7, 0x7B, 0xB4, 0x0D, 0x7A, 0x36, 0x60, 0xA8, 0x9E, 0xCA, 0xF3, 0x24, 0x66, 0xEF, 0x97,
+	0xF5, 0xD3, 0xD5, 0x85, 0x03, 0xB9, 0x69, 0x9D, 0xE7, 0x85, 0x89, 0x5A, 0x96, 0xFD, 0xBA, 0xAF,
+	0x43, 0xB1, 0xCD, 0x7F, 0x59, 0x8E, 0xCE, 0x23, 0x88, 0x1B, 0x00, 0xE3, 0xED, 0x03, 0x06, 0x88,
+	0x7B, 0x0C, 0x78, 0x5E, 0x27, 0xE8, 0xAD, 0x3F, 0x82, 0x23, 0x20, 0x71, 0x04, 0x72, 0x5D, 0xD4};
+static const u8 aes_cbc_ct[64] = {
+	0x76, 0x49, 0xAB, 0xAC, 0x81, 0x19, 0xB2, 0x46, 0xCE, 0xE9, 0x8E, 0x9B, 0x12, 0xE9, 0x19, 0x7D,
+	0x50, 0x86, 0xCB, 0x9B, 0x50, 0x72, 0x19, 0xEE, 0x95, 0xDB, 0x11, 0x3A, 0x91, 0x76, 0x78, 0xB2,
+	0x73, 0xBE, 0xD6, 0xB8, 0xE3, 0xC1, 0x74, 0x3B, 0x71, 0x16, 0xE6, 0x9E, 0x22, 0x22, 0x95, 0x16,
+	0x3F, 0xF1, 0xCA, 0xA1, 0x68, 0x1F, 0xAC, 0x09, 0x12, 0x0E, 0xCA, 0x30, 0x75, 0x86, 0xE1, 0xA7};
+static const u8 aes_ctr_ct[64] = {
+	0x87, 0x4D, 0x61, 0x91, 0xB6, 0x20, 0xE3, 0x26, 0x1B, 0xEF, 0x68, 0x64, 0x99, 0x0D, 0xB6, 0xCE,
+	0x98, 0x06, 0xF6, 0x6B, 0x79, 0x70, 0xFD, 0xFF, 0x86, 0x17, 0x18, 0x7B, 0xB9, 0xFF, 0xFD, 0xFF,
+	0x5A, 0xE4, 0xDF, 0x3E, 0xDB, 0xD5, 0xD3, 0x5E, 0x5B, 0x4F, 0x09, 0x02, 0x0D, 0xB0, 0x3E, 0xAB,
+	0x1E, 0x03, 0x1D, 0xDA, 0x2F, 0xBE, 0x03, 0xD1, 0x79, 0x21, 0x70, 0xA0, 0xF3, 0x00, 0x9C, 0xEE};
+
+/* "Now is the time for all " */
+static const u8 des_pt[24] = {
+	0x4E, 0x6F, 0x77, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+	0x69, 0x6D, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20};
+static const u8 des_key[24] = {
+	0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x23, 0x45, 0x67, 0x89,
+	0xAB, 0xCD, 0xEF, 0x01, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x01, 0x23};
+static const u8 des_iv[8] = {0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF};
+static const u8 des_ecb_ct[24] = {
+	0x3F, 0xA4, 0x0E, 0x8A, 0x98, 0x4D, 0x48, 0x15, 0x6A, 0x27, 0x17, 0x87,
+	0xAB, 0x88, 0x83, 0xF9, 0x89, 0x3D, 0x51, 0xEC, 0x4B, 0x56, 0x3B, 0x53};
+static const u8 des_cbc_ct[24] = {
+	0xE5, 0xC7, 0xCD, 0xDE, 0x87, 0x2B, 0xF2, 0x7C, 0x43, 0xE9, 0x34, 0x00,
+	0x8C, 0x38, 0x9C, 0x0F, 0x68, 0x37, 0x88, 0x49, 0x9A, 0x7C, 0x05, 0xF6};
+static const u8 des3_ecb_ct[24] = {
+	0x31, 0x4F, 0x83, 0x27, 0xFA, 0x7A, 0x09, 0xA8, 0x43, 0x62, 0x76, 0x0C,
+	0xC1, 0x3B, 0xA7, 0xDA, 0xFF, 0x55, 0xC5, 0xF8, 0x0F, 0xAA, 0xAC, 0x45};
+static const u8 des3_cbc_ct[24] = {
+	0xF3, 0xC0, 0xFF, 0x02, 0x6C, 0x02, 0x30, 0x89, 0x65, 0x6F, 0xBB, 0x16,
+	0x9D, 0xEF, 0x7E, 0xDB, 0x30, 0xBA, 0x36, 0x07, 0x5D, 0x6F, 0x01, 0x76};
+
+/* RFC 6229, keystream at offsets 0 and 16; the engine only takes 128 and 256 bit keys */
+static const u8 rc4_zero[32];
+static const u8 rc4_key128[16] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10};
+static const u8 rc4_key256[32] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+	0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20};
+static const u8 rc4_ks128[32] = {
+	0x9A, 0xC7, 0xCC, 0x9A, 0x60, 0x9D, 0x1E, 0xF7, 0xB2, 0x93, 0x28, 0x99, 0xCD, 0xE4, 0x1B, 0x97,
+	0x52, 0x48, 0xC4, 0x95, 0x90, 0x14, 0x12, 0x6A, 0x6E, 0x8A, 0x84, 0xF1, 0x1D, 0x1A, 0x9E, 0x1C};
+static const u8 rc4_ks256[32] = {
+	0xEA, 0xA6, 0xBD, 0x25, 0x88, 0x0B, 0xF9, 0x3D, 0x3F, 0x5D, 0x1E, 0x4C, 0xA2, 0x61, 0x1D, 0x91,
+	0xCF, 0xA4, 0x5C, 0x9F, 0x7E, 0x71, 0x4B, 0x54, 0xBD, 0xFA, 0x80, 0x02, 0x7C, 0xB1, 0x43, 0x80};
+
+static const struct conf_cipher_vec conf_ciphers[] = {
+	{"aes128-ecb", CONF_AES,  CRYPTO_MODE_ECB, aes_key,    16, NULL,       aes_pt,   aes_ecb_ct,  64},
+	{"aes128-cbc", CONF_AES,  CRYPTO_MODE_CBC, aes_key,    16, aes_cbc_iv, aes_pt,   aes_cbc_ct,  64},
+	{"aes128-ctr", CONF_AES,  CRYPTO_MODE_CTR, aes_key,    16, aes_ctr_iv, aes_pt,   aes_ctr_ct,  64},
+	{"des-ecb",    CONF_DES,  CRYPTO_MODE_ECB, des_key,     8, NULL,       des_pt,   des_ecb_ct,  24},
+	{"des-cbc",    CONF_DES,  CRYPTO_MODE_CBC, des_key,     8, des_iv,     des_pt,   des_cbc_ct,  24},
+	{"3des-ecb",   CONF_3DES, CRYPTO_MODE_ECB, des_key,    24, NULL,       des_pt,   des3_ecb_ct, 24},
+	{"3des-cbc",   CONF_3DES, CRYPTO_MODE_CBC, des_key,    24, des_iv,     des_pt,   des3_cbc_ct, 24},
+	{"rc4-128",    CONF_RC4,  CRYPTO_MODE_ECB, rc4_key128, 16, NULL,       rc4_zero, rc4_ks128,   32},
+	{"rc4-256",    CONF_RC4,  CRYPTO_MODE_ECB, rc4_key256, 32, NULL,       rc4_zero, rc4_ks256,   32},
+};
+
+/* check values over "123456789"; the engine applies no final xor, xorout is done here */
+static const struct
+{
+	const char *name;
+	CRYPTO_CRC_TYPE type;
+	u8 mode;
+	u32 init;
+	u32 xorout;
+	u32 check;
+} conf_crcs[] = {
+	{"crc8-smbus",  CRYPTO_CRC_TYPE_8,         0,                              0x00,       0x00,       0xF4},
+	{"crc16-modbus", CRYPTO_CRC_TYPE_16_MODBUS, INPUT_REFLECT | OUTPUT_REFLECT, 0xFFFF,     0x0000,     0x4B37},
+	{"crc16-ccitt", CRYPTO_CRC_TYPE_16_CCITT,  0,                              0xFFFF,     0x0000,     0x29B1},
+	{"crc32",       CRYPTO_CRC_TYPE_32,        INPUT_REFLECT | OUTPUT_REFLECT, 0xFFFFFFFF, 0xFFFFFFFF, 0xCBF43926},
+};
+
+static const char conf_two_block[] = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+static const char conf_md5_80[] = "1234567890123456789012345678901234567890"
+                                  "1234567890123456789012345678901234567890";
+
+static const u8 sha1_abc[20] = {
+	0xA9, 0x99, 0x3E, 0x36, 0x47, 0x06, 0x81, 0x6A, 0xBA, 0x3E,
+	0x25, 0x71, 0x78, 0x50, 0xC2, 0x6C, 0x9C, 0xD0, 0xD8, 0x9D};
+static const u8 sha1_two_block[20] = {
+	0x84, 0x98, 0x3E, 0x44, 0x1C, 0x3B, 0xD2, 0x6E, 0xBA, 0xAE,
+	0x4A, 0xA1, 0xF9, 0x51, 0x29, 0xE5, 0xE5, 0x46, 0x70, 0xF1};
+static const u8 md5_abc[16] = {
+	0x90, 0x01, 0x50, 0x98, 0x3C, 0xD2, 0x4F, 0xB0, 0xD6, 0x96, 0x3F, 0x7D, 0x28, 0xE1, 0x7F, 0x72};
+static const u8 md5_80[16] = {
+	0x57, 0xED, 0xF4, 0xA2, 0x2B, 0xE3, 0xC9, 0x55, 0xAC, 0x49, 0xDA, 0x2E, 0x21, 0x07, 0xB6, 0x7A};
+
+/* X = A^E mod N with full length random operands, computed offline */
+#define CONF_EXP1024_N  "E3A110384E9F5D87DAB53949557FC203" \
+                        "76D1E82D0D46C9C5BA994C3A51321B35" \
+                        "1AA205A8FD3A7284C1C68FDD536F1DBF" \
+                        "15FC92205AD6C5C969F85B742A61B70D" \
+                        "B6D55CAC2B4F36459C6901DD949B5F90" \
+                        "78E378160332EFAA6BBE19A6908059AE" \
+                        "2085838CDB644D17D1C7587E224E646B" \
+                        "915F2CCEA25BFF694B5FD55E5ABB771D"
+#define CONF_EXP1024_A  "6264F9624E98ADC7151677177FA86BCA" \
+                        "C96DD5CC44C8D7AAE3BB79C8225DEF2A" \
+                        "3076520B7E07ACDDBC2D1A5375E03515" \
+                        "E165EF62EF1CE55E2A5D795E56EBBD00" \
+                        "39CCADE691B4A62AB62DCD502336999A" \
+                        "3CE5B5E3EAA8EA0CFA95DFFC1C0F875F" \
+                        "EA80C3DF0155FE9ACA4770F9D75D8D38" \
+                        "C90D0E851A5B39E72BE4119B3BB9D4FF"
+#define CONF_EXP1024_E  "5F974AA16A9DECC5A629A56959CAFF63" \
+                        "91521692599D666A5D20126EC77584C8" \
+                        "9B64B58A9EF76398D581324FD0DD06E0" \
+                        "6126F852D5A5F6003854D6C9965E58E1" \
+                        "1590296C2D793F02B1FC7528B7FDB0A5" \
+                        "3497524B92F50853A3613230528B85ED" \
+                        "F6DE6C5BD7B6AA4FBA85111CDCDE6CD3" \
+                        "941EF0EA2E554DA2ED0F1024B6090017"
+#define CONF_EXP1024_X  "5AD4AD59D308CDC47C3CD76FB6077556" \
+                        "38642551174B08FCA5A493460E339EF9" \
+                        "B9B205D5D568551B09B66ACD1DABDDE8" \
+                        "3B7B8E20A3F7DC772BCF9213CCEFACD3" \
+                        "E8CA9966E3FF283DBBE10FDF123CEEF7" \
+                        "BB0C49865C68A7069AB784B855119DC8" \
+                        "2735CEAA73E056B2E4873808582EC108" \
+                        "92074AC5C59BA76BD3F62C1EC0F02115"
+
+#define CONF_EXP2048_N  "9F85E87267AF2BF9A83F1B5B327ECA01" \
+                        "DF1FD6E21976355454C04B9B7F2ED793" \
+                        "9E9A5C1A0BA3B5046FAFDC11461A540A" \
+                        "992732FA26428CCE14EF36ECCAA7AED7" \
+                        "FBC21081F197D22EC187B73AF83F0E5F" \
+                        "87C7256F64F53F0CCA128319C7EEA491" \
+                        "B1E7EE37C4275AA0AF65CDC50E076C54" \
+                        "ABDB39AEA3138576FA0C13F2BCC373B5" \
+                        "77E1AD91191736E26B249F6A159CABE7" \
+                        "CE12A8FE8838D38C58F6378A051A67A3" \
+                        "9A1C457B9AC8F2B12E03287C8693379D" \
+                        "1E3199EEC38B9C62163C051FC456F8B0" \
+                        "85A5EBBE1504252E9EA0C695B9C03FC3" \
+                        "98CFA304D7D1D8211E38BCFA95393EC3" \
+                        "690F78AF8ECF111555B0D1473E0E3281" \
+                        "95EBE048113C9B0C0CB3E829560D33A1"
+#define CONF_EXP2048_A  "5C813C075BF089E373348D49DC080640" \
+                        "DBEF1B5C061DF547C8436A6E1AB32E77" \
+                        "1BBA947896DA1151837AF117E7AF88F9" \
+                        "D4D93DE32D4892C09C6477B9B019E07A" \
+                        "8C1D7F397429407CA40760DA294C60A8" \
+                        "F652DBA858CB932E2B11224DE4529285" \
+                        "4F717CC533E3E68187234BAB65724004" \
+                        "2A7DF1B7F8A962B75F33D6530CFE4A02" \
+                        "F4DFBB40597FF4D34A3658D3E88EA6ED" \
+                        "CC02426CD38D463719F165158D4144E2" \
+                        "A0DE72F0430E89C5CC516FA17F540B3E" \
+                        "DDAED82B684CDABBAE9DB3A4A241B2AA" \
+                        "B5B8FA1F40F692913F68878A5DFD6FD7" \
+                        "EF1B436DE1AE8BB794B293C5806232F6" \
+                        "C2C892D08766DFDC7EF7AEF066C77DE4" \
+                        "5661358F5D3A9664D4B035E38AE59098"
+#define CONF_EXP2048_E  "F25007EA9679A6629D8956732D364276" \
+                        "A59AA83309B5AD14A9BE4DE445C4A1A0" \
+                        "9228A154856C4D3EF983FB22C8DFCCC8" \
+                        "1B0D51A7131BFA547D770A1899B8B456" \
+                        "F54E0C43058100B676EE6C6B53F349F5" \
+                        "74FB30319A22F9B2668C7EDA9A957163" \
+                        "5E1A2F800A11403CF69BA368AA330681" \
+                        "DEC4D22E7EF8CFF5539C4D3D85354129" \
+                        "15A469998F2FC749576B6B1DBC49927A" \
+                        "F204172CEA084757CA75013919F94E8B" \
+                        "EB10423443026794BCBED6287B220E3C" \
+                        "D4A17CC7DEAA190F33AF85FA0C3A2CE8" \
+                        "675DA80FA26F8355B62A40F874E1B8C2" \
+                        "2C01E81A86058048525079F02D2D0720" \
+                        "01A8C8A063982B81611DE98B33D66014" \
+                        "C39DB79F770D3D599FAF5BDCAF838FDB"
+#define CONF_EXP2048_X  "8EA126B608C78BBBDB55175B1E03FA40" \
+                        "F34E9F6C33ED905FCEF233A3406622A0" \
+                        "B0A7C2AB8ABC5C9FA681D60EB77A93F2" \
+                        "F85F43D72DFC077740B1592E9C6A87DC" \
+                        "AFD994970C1D62CB6C0439A0936F08F6" \
+                        "2E6B769E2D977B024697AE5DC31C7179" \
+                        "64EC4E53F55ECB1549500015772CEB5A" \
+                        "9563AA62C483FBBFA6BC0A0B28BFEC59" \
+                        "8327186A0CC42E603EC443EBB29A7298" \
+                        "4B372A2E07084B2E9F64DBAF23E51C82" \
+                        "B8A0BDB97CD895F9B0A5D765F6AC1CDE" \
+                        "07A9C90FFC8C68AFDC495A5A40F733D1" \
+                        "171BB63FB97B751287D62CF5F33E17D7" \
+                        "C01548E325D84D13578894ADB8437DC2" \
+                        "264DF35DAD0603EFC289F0AE380EC52E" \
+                        "D31A73C401712EA21CE651BD4D62D813"
+
+static const struct
+{
+	const char *n;
+	const char *a;
+	const char *e;
+	const char *x;
+} conf_exps[] = {
+	{CONF_EXP1024_N, CONF_EXP1024_A, CONF_EXP1024_E, CONF_EXP1024_X},
+	{CONF_EXP2048_N, CONF_EXP2048_A, CONF_EXP2048_E, CONF_EXP2048_X},
+};
+
+static const u32 conf_exp_bits[] = {256, 512, 1024, 1536, 2048};
+
+static u32 conf_fail;
+
+static void conf_report(const char *name, int ok)
+{
+	printf("%-24s %s\n", name, ok ? "ok" : "FAIL");
+	if (!ok)
+		conf_fail++;
+}
+
+static void conf_cipher_run(const struct conf_cipher_vec *v, u8 *in, u8 *out, u32 len, CRYPTO_WAY way)
+{
+	psCipherContext_t ctx;
+
+	switch (v->alg)
+	{
+	case CONF_AES:
+		tls_crypto_aes_init(&ctx, v->iv, v->key, v->keylen, v->mode);
+		tls_crypto_aes_encrypt_decrypt(&ctx, in, out, len, way);
+		break;
+	case CONF_DES:
+		tls_crypto_des_init(&ctx, v->iv, v->key, v->keylen, v->mode);
+		tls_crypto_des_encrypt_decrypt(&ctx, in, out, len, way);
+		break;
+	case CONF_3DES:
+		tls_crypto_3des_init(&ctx, v->iv, v->key, v->keylen, v->mode);
+		tls_crypto_3des_encrypt_decrypt(&ctx, in, out, len, way);
+		break;
+	case CONF_RC4:
+		tls_crypto_rc4_init(&ctx, v->key, v->keylen);
+		tls_crypto_rc4(&ctx, in, out, len);
+		break;
+	}
+}
+
+/* encrypt, decrypt, and both again in place */
+static void conf_check_ciphers(u8 *buf, u8 *out)
+{
+	const struct conf_cipher_vec *v;
+	int ok;
+	int i;
+
+	for (i = 0; i < sizeof(conf_ciphers) / sizeof(conf_ciphers[0]); i++)
+	{
+		v = &conf_ciphers[i];
+
+		memcpy(buf, v->pt, v->len);
+		conf_cipher_run(v, buf, out, v->len, CRYPTO_WAY_ENCRYPT);
+		ok = !memcmp(out, v->ct, v->len);
+
+		memcpy(buf, v->ct, v->len);
+		conf_cipher_run(v, buf, out, v->len, CRYPTO_WAY_DECRYPT);
+		ok = ok && !memcmp(out, v->pt, v->len);
+
+		memcpy(buf, v->pt, v->len);
+		conf_cipher_run(v, buf, buf, v->len, CRYPTO_WAY_ENCRYPT);
+		ok = ok && !memcmp(buf, v->ct, v->len);
+		conf_cipher_run(v, buf, buf, v->len, CRYPTO_WAY_DECRYPT);
+		ok = ok && !memcmp(buf, v->pt, v->len);
+
+		conf_report(v->name, ok);
+	}
+}
+
+static u32 conf_crc(CRYPTO_CRC_TYPE type, u8 mode, u32 init, u8 *in, u32 len)
+{
+	psCrcContext_t ctx;
+	u32 crc;
+
+	tls_crypto_crc_init(&ctx, init, type, mode);
+	tls_crypto_crc_update(&ctx, in, len);
+	tls_crypto_crc_final(&ctx, &crc);
+
+	return crc;
+}
+
+/* known answers, then one update against odd sized ones */
+static void conf_check_crcs(u8 *buf)
+{
+	psCrcContext_t ctx;
+	u32 crc;
+	u32 off;
+	u32 step;
+	int ok;
+	int i;
+
+	for (i = 0; i < sizeof(conf_crcs) / sizeof(conf_crcs[0]); i++)
+	{
+		memcpy(buf, "123456789", 9);
+		crc = conf_crc(conf_crcs[i].type, conf_crcs[i].mode, conf_crcs[i].init, buf, 9);
+		ok = (crc ^ conf_crcs[i].xorout) == conf_crcs[i].check;
+
+		for (off = 0; off < CONF_BUF_SIZE; off++)
+			buf[off] = off * 7 + 3;
+		crc = conf_crc(conf_crcs[i].type, conf_crcs[i].mode, conf_crcs[i].init, buf, CONF_BUF_SIZE);
+		tls_crypto_crc_init(&ctx, conf_crcs[i].init, conf_crcs[i].type, conf_crcs[i].mode);
+		for (off = 0, step = 1; off < CONF_BUF_SIZE; off += step, step += 63)
+		{
+			if (step > CONF_BUF_SIZE - off)
+				step = CONF_BUF_SIZE - off;
+			tls_crypto_crc_update(&ctx, buf + off, step);
+		}
+		ok = ok && ctx.state == crc;
+
+		conf_report(conf_crcs[i].name, ok);
+	}
+}
+
+static void conf_sha1(const u8 *in, u32 len, u8 *out)
+{
+	psDigestContext_t ctx;
+
+	tls_crypto_sha1_init(&ctx);
+	tls_crypto_sha1_update(&ctx, in, len);
+	tls_crypto_sha1_final(&ctx, out);
+}
+
+static void conf_md5(const u8 *in, u32 len, u8 *out)
+{
+	psDigestContext_t ctx;
+
+	tls_crypto_md5_init(&ctx);
+	tls_crypto_md5_update(&ctx, in, len);
+	tls_crypto_md5_final(&ctx, out);
+}
+
+static void conf_check_digests(u8 *buf)
+{
+	psDigestContext_t ctx;
+	u8 sum1[20];
+	u8 sum2[20];
+	u32 off;
+	u32 step;
+	int ok;
+
+	for (off = 0; off < CONF_BUF_SIZE; off++)
+		buf[off] = off * 7 + 3;
+
+	conf_sha1((const u8 *)"abc", 3, sum1);
+	ok = !memcmp(sum1, sha1_abc, 20);
+	conf_sha1((const u8 *)conf_two_block, strlen(conf_two_block), sum1);
+	ok = ok && !memcmp(sum1, sha1_two_block, 20);
+	conf_sha1(buf, CONF_BUF_SIZE, sum1);
+	tls_crypto_sha1_init(&ctx);
+	for (off = 0, step = 1; off < CONF_BUF_SIZE; off += step, step += 63)
+	{
+		if (step > CONF_BUF_SIZE - off)
+			step = CONF_BUF_SIZE - off;
+		tls_crypto_sha1_update(&ctx, buf + off, step);
+	}
+	tls_crypto_sha1_final(&ctx, sum2);
+	ok = ok && !memcmp(sum1, sum2, 20);
+	conf_report("sha1", ok);
+
+	conf_md5((const u8 *)"abc", 3, sum1);
+	ok = !memcmp(sum1, md5_abc, 16);
+	conf_md5((const u8 *)conf_md5_80, strlen(conf_md5_80), sum1);
+	ok = ok && !memcmp(sum1, md5_80, 16);
+	conf_md5(buf, CONF_BUF_SIZE, sum1);
+	tls_crypto_md5_init(&ctx);
+	for (off = 0, step = 1; off < CONF_BUF_SIZE; off += step, step += 63)
+	{
+		if (step > CONF_BUF_SIZE - off)
+			step = CONF_BUF_SIZE - off;
+		tls_crypto_md5_update(&ctx, buf + off, step);
+	}
+	tls_crypto_md5_final(&ctx, sum2);
+	ok = ok && !memcmp(sum1, sum2, 16);
+	conf_report("md5", ok);
+}
+
+static int conf_rng(void *p_rng, unsigned char *out, size_t len)
+{
+	return tls_crypto_random_fast(out, len);
+}
+
+/* hardware result against the expected one, or against the software bignum when X is NULL */
+static int conf_exp_one(const mbedtls_mpi *A, const mbedtls_mpi *E, const mbedtls_mpi *N,
+                        const mbedtls_mpi *X)
+{
+	mbedtls_mpi hw, sw;
+	int ret;
+
+	mbedtls_mpi_init(&hw);
+	mbedtls_mpi_init(&sw);
+
+	MBEDTLS_MPI_CHK(tls_crypto_mbedtls_exptmod(&hw, A, E, N));
+	if (X == NULL)
+	{
+		MBEDTLS_MPI_CHK(mbedtls_mpi_exp_mod(&sw, A, E, N, NULL));
+		X = &sw;
+	}
+	ret = mbedtls_mpi_cmp_mpi(&hw, X) ? -1 : 0;
+
+cleanup:
+	mbedtls_mpi_free(&hw);
+	mbedtls_mpi_free(&sw);
+
+	return ret;
+}
+
+/* 0, 1 and N - 1 to an odd power, and A^1, through both the single and the batch path */
+static int conf_exp_edges(const mbedtls_mpi *N)
+{
+	mbedtls_mpi A[4], X[4], E, one;
+	int ret;
+	int i;
+
+	for (i = 0; i < 4; i++)
+	{
+		mbedtls_mpi_init(&A[i]);
+		mbedtls_mpi_init(&X[i]);
+	}
+	mbedtls_mpi_init(&E);
+	mbedtls_mpi_init(&one);
+
+	MBEDTLS_MPI_CHK(mbedtls_mpi_lset(&E, 65537));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_lset(&one, 1));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_lset(&A[0], 0));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_lset(&A[1], 1));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_sub_int(&A[2], N, 1));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_fill_random(&A[3], mbedtls_mpi_size(N), conf_rng, NULL));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_mod_mpi(&A[3], &A[3], N));
+
+	for (i = 0; i < 3; i++)
+	{
+		if ((ret = conf_exp_one(&A[i], &E, N, &A[i])) != 0)
+			goto cleanup;
+	}
+	if ((ret = conf_exp_one(&A[3], &one, N, &A[3])) != 0)
+		goto cleanup;
+
+	MBEDTLS_MPI_CHK(tls_crypto_mbedtls_exptmod_batch(X, A, 4, &E, N));
+	for (i = 0; i < 4; i++)
+	{
+		if ((ret = conf_exp_one(&A[i], &E, N, &X[i])) != 0)
+			goto cleanup;
+	}
+
+cleanup:
+	for (i = 0; i < 4; i++)
+	{
+		mbedtls_mpi_free(&A[i]);
+		mbedtls_mpi_free(&X[i]);
+	}
+	mbedtls_mpi_free(&E);
+	mbedtls_mpi_free(&one);
+
+	return ret;
+}
+
+/* random modulus, base and full length exponent of the given size, hardware against software */
+static int conf_exp_random(u32 bits)
+{
+	mbedtls_mpi A, E, N;
+	int ret;
+
+	mbedtls_mpi_init(&A);
+	mbedtls_mpi_init(&E);
+	mbedtls_mpi_init(&N);
+
+	MBEDTLS_MPI_CHK(mbedtls_mpi_fill_random(&N, bits / 8, conf_rng, NULL));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_set_bit(&N, bits - 1, 1));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_set_bit(&N, 0, 1));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_fill_random(&A, bits / 8, conf_rng, NULL));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_mod_mpi(&A, &A, &N));
+	MBEDTLS_MPI_CHK(mbedtls_mpi_fill_random(&E, bits / 8, conf_rng, NULL));
+	if ((ret = conf_exp_one(&A, &E, &N, NULL)) == 0)
+		ret = conf_exp_edges(&N);
+
+cleanup:
+	mbedtls_mpi_free(&A);
+	mbedtls_mpi_free(&E);
+	mbedtls_mpi_free(&N);
+
+	return ret;
+}
+
+static void conf_check_exptmod(void)
+{
+	mbedtls_mpi A, E, N, X;
+	char name[24];
+	int ret;
+	int i;
+	int j;
+
+	mbedtls_mpi_init(&A);
+	mbedtls_mpi_init(&E);
+	mbedtls_mpi_init(&N);
+	mbedtls_mpi_init(&X);
+
+	for (i = 0; i < sizeof(conf_exps) / sizeof(conf_exps[0]); i++)
+	{
+		if ((ret = mbedtls_mpi_read_string(&N, 16, conf_exps[i].n)) == 0 &&
+		    (ret = mbedtls_mpi_read_string(&A, 16, conf_exps[i].a)) == 0 &&
+		    (ret = mbedtls_mpi_read_string(&E, 16, conf_exps[i].e)) == 0 &&
+		    (ret = mbedtls_mpi_read_string(&X, 16, conf_exps[i].x)) == 0)
+			ret = conf_exp_one(&A, &E, &N, &X);
+		sprintf(name, "exptmod-%u kat", (u32)mbedtls_mpi_bitlen(&N));
+		conf_report(name, ret == 0);
+	}
+
+	for (i = 0; i < sizeof(conf_exp_bits) / sizeof(conf_exp_bits[0]); i++)
+	{
+		ret = 0;
+		for (j = 0; j < CONF_RANDOM_ROUNDS && ret == 0; j++)
+			ret = conf_exp_random(conf_exp_bits[i]);
+		sprintf(name, "exptmod-%u", conf_exp_bits[i]);
+		conf_report(name, ret == 0);
+	}
+
+	mbedtls_mpi_free(&A);
+	mbedtls_mpi_free(&E);
+	mbedtls_mpi_free(&N);
+	mbedtls_mpi_free(&X);
+}
+
+/* cycles per byte, in tenths */
+static u32 conf_cpb10(u32 ticks, u32 bytes)
+{
+	tls_sys_clk sysclk;
+
+	tls_sys_clk_get(&sysclk);
+	return (u32)((u64)ticks * sysclk.cpuclk * UNIT_MHZ * 10 / HZ / bytes);
+}
+
+static void conf_perf_crc32(const u8 *in, u32 len, u8 *out)
+{
+	conf_crc(CRYPTO_CRC_TYPE_32, INPUT_REFLECT | OUTPUT_REFLECT, 0xFFFFFFFF, (u8 *)in, len);
+}
+
+typedef void (*conf_digest_fn)(const u8 *in, u32 len, u8 *out);
+
+static const struct {
+	const char *name;
+	conf_digest_fn fn;
+} conf_perf_digests[] = {
+	{"crc32", conf_perf_crc32},
+	{"sha1",  conf_sha1},
+	{"md5",   conf_md5},
+};
+
+static void conf_perf(u8 *buf, u8 *out)
+{
+	static const u32 sizes[] = {64, 1024, CONF_BUF_SIZE};
+	const int nciphers = sizeof(conf_ciphers) / sizeof(conf_ciphers[0]);
+	const int ndigests = sizeof(conf_perf_digests) / sizeof(conf_perf_digests[0]);
+	u32 start;
+	u32 ticks;
+	u32 bytes;
+	u32 cpb;
+	int i;
+	int j;
+
+	printf("%-12s", "bytes");
+	for (j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++)
+		printf("%10u", sizes[j]);
+	printf("   (cycles/byte)\n");
+
+	/* the ciphers, one row per mode and key size, then the digests */
+	for (i = 0; i < nciphers + ndigests; i++)
+	{
+		if (i < nciphers && i > 0 && conf_ciphers[i].alg == CONF_RC4 && conf_ciphers[i - 1].alg == CONF_RC4)
+			continue;
+		printf("%-12s", i < nciphers ? conf_ciphers[i].name : conf_perf_digests[i - nciphers].name);
+		for (j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++)
+		{
+			bytes = 0;
+			start = tls_os_get_time();
+			do
+			{
+				if (i < nciphers)
+					conf_cipher_run(&conf_ciphers[i], buf, out, sizes[j], CRYPTO_WAY_ENCRYPT);
+				else
+					conf_perf_digests[i - nciphers].fn(buf, sizes[j], out);
+				bytes += sizes[j];
+				ticks = tls_os_get_time() - start;
+			} while (ticks < CONF_MIN_TICKS);
+
+			cpb = conf_cpb10(ticks, bytes);
+			printf("%8u.%u", cpb / 10, cpb % 10);
+		}
+		printf("\n");
+	}
+}
+
+/* one public (e = 65537) and one full length exponent per key size */
+static void conf_perf_exptmod(void)
+{
+	mbedtls_mpi A, E, N, X;
+	tls_sys_clk sysclk;
+	u32 start;
+	u32 ticks;
+	u32 n;
+	int ret;
+	int i;
+	int pub;
+
+	mbedtls_mpi_init(&A);
+	mbedtls_mpi_init(&E);
+	mbedtls_mpi_init(&N);
+	mbedtls_mpi_init(&X);
+	tls_sys_clk_get(&sysclk);
+
+	for (i = 0; i < sizeof(conf_exps) / sizeof(conf_exps[0]); i++)
+	{
+		for (pub = 1; pub >= 0; pub--)
+		{
+			MBEDTLS_MPI_CHK(mbedtls_mpi_read_string(&N, 16, conf_exps[i].n));
+			MBEDTLS_MPI_CHK(mbedtls_mpi_read_string(&A, 16, conf_exps[i].a));
+			if (pub)
+				MBEDTLS_MPI_CHK(mbedtls_mpi_lset(&E, 65537));
+			else
+				MBEDTLS_MPI_CHK(mbedtls_mpi_read_string(&E, 16, conf_exps[i].e));
+
+			n = 0;
+			start = tls_os_get_time();
+			do
+			{
+				MBEDTLS_MPI_CHK(tls_crypto_mbedtls_exptmod(&X, &A, &E, &N));
+				n++;
+				ticks = tls_os_get_time() - start;
+			} while (ticks < CONF_MIN_TICKS);
+
+			printf("exptmod-%u %-8s %8u us %10u kcycles\n", (u32)mbedtls_mpi_bitlen(&N),
+			       pub ? "e=65537" : "e=full", ticks * (1000000 / HZ) / n,
+			       ticks * (1000000 / HZ) / n * sysclk.cpuclk / 1000);
+		}
+	}
+
+cleanup:
+	if (ret != 0)
+		printf("exptmod err: -0x%04X\n", -ret);
+	mbedtls_mpi_free(&A);
+	mbedtls_mpi_free(&E);
+	mbedtls_mpi_free(&N);
+	mbedtls_mpi_free(&X);
+}
+
+int crypt_conform_demo(void)
+{
+	u8 *buf;
+	u8 *out;
+
+	buf = tls_mem_alloc(CONF_BUF_SIZE);
+	out = tls_mem_alloc(CONF_BUF_SIZE);
+	if (buf == NULL || out == NULL)
+	{
+		printf("malloc err\n");
+		if (buf != NULL)
+			tls_mem_free(buf);
+		if (out != NULL)
+			tls_mem_free(out);
+		return WM_FAILED;
+	}
+
+	tls_crypto_init();
+
+	conf_fail = 0;
+	conf_check_ciphers(buf, out);
+	conf_check_crcs(buf);
+	conf_check_digests(buf);
+	conf_check_exptmod();
+	printf("%u failed\n", conf_fail);
+
+	conf_perf(buf, out);
+	conf_perf_exptmod();
+
+	tls_mem_free(buf);
+	tls_mem_free(out);
+
+	return conf_fail ? WM_FAILED : WM_SUCCESS;
+}
+
+#endif
@@ -42,6 +42,11 @@
 //Encryption&Decryption demo
 #define DEMO_ENCRYPT				(DEMO_ON && DEMO_CONSOLE)
 
+//digest throughput and signed image verification benchmark
+#define DEMO_CRYPT_BENCH			(DEMO_ON && DEMO_CONSOLE)
+//crypto engine known answer tests and cycles per byte
+#define DEMO_CRYPT_CONFORM			(DEMO_ON && DEMO_CONSOLE)
+
 //rsa demo
 #define DEMO_RSA					(DEMO_ON && DEMO_CONSOLE)
 
@@ -73,6 +73,7 @@ typedef struct _mqtt_demo_context
 	int (*connect)(struct _mqtt_demo_context *ctx, const struct sockaddr *name, socklen_t namelen,char *hostname);
 	int (*close_mqtt)(struct _mqtt_demo_context *ctx);
 	int (*send_packet)(int socket_info, const void *buf, unsigned int count);
+	int (*sendv_packet)(int socket_info, const mqtt_iovec_t *iov, int iovcnt);
 	int (*read_packet)(struct _mqtt_demo_context *ctx, uint8_t *buf, int buf_len, int sec, int us);
 	int mqtt_demo_mqtt_keepalive;
 	tls_os_timer_t *mqtt_demo_heartbeat_timer;
@@ -389,6 +390,21 @@ static int mqtt_tcp_send_packet(int socket_info, const void *buf, unsigned int c
     mqtt_demo_context_t *ctx = (mqtt_demo_context_t *)socket_info;
     return send(ctx->mqtt_demo_socket_id, buf, count, 0);
 }
+static int mqtt_tcp_sendv_packet(int socket_info, const mqtt_iovec_t *iov, int iovcnt)
+{
+    mqtt_demo_context_t *ctx = (mqtt_demo_context_t *)socket_info;
+    struct iovec vec[4];
+    int i;
+
+    if (iovcnt > 4)
+        return -1;
+    for (i = 0; i < iovcnt; i++)
+    {
+        vec[i].iov_base = (void *)iov[i].base;
+        vec[i].iov_len = iov[i].len;
+    }
+    return writev(ctx->mqtt_demo_socket_id, vec, iovcnt);
+}
 static int mqtt_tcp_read_packet(mqtt_demo_context_t *ctx, uint8_t *buf, int buf_len, int sec, int us)
 {
     int ret = 0;
@@ -442,7 +458,7 @@ static int mqtt_demo_recv_parse(mqtt_demo_context_t *ctx, int sec, int us)
 
     // now we have the full fixed header in mqtt_demo_packet_buffer
     // parse it for remaining length and number of bytes
-    uint16_t rem_len = mqtt_parse_rem_len(ctx->mqtt_demo_packet_buffer);
+    uint32_t rem_len = mqtt_parse_rem_len(ctx->mqtt_demo_packet_buffer);
     uint8_t rem_len_bytes = mqtt_num_rem_len_bytes(ctx->mqtt_demo_packet_buffer);
 
     //packet_length = mqtt_demo_packet_buffer[1] + 2; // Remaining length + fixed header length
@@ -500,6 +516,7 @@ static int mqtt_demo_init_socket(mqtt_demo_context_t *ctx, const char *hostname,
     mqtt_set_alive(&ctx->mqtt_demo_mqtt_broker, ctx->mqtt_demo_mqtt_keepalive);
     ctx->mqtt_demo_mqtt_broker.socketid = (int)ctx;
     ctx->mqtt_demo_mqtt_broker.mqttsend = ctx->send_packet;
+    ctx->mqtt_demo_mqtt_broker.mqttsendv = ctx->sendv_packet;
     //wm_printf("socket id = %d\n", mqtt_demo_socket_id);
     return 0;
 }
@@ -673,6 +690,7 @@ static void mqtt_demo_task(void *p)
 			ctx->connect = mqtt_tcp_connect;
 			ctx->close_mqtt = mqtt_tcp_close_socket;
 			ctx->send_packet = mqtt_tcp_send_packet;
+			ctx->sendv_packet = mqtt_tcp_sendv_packet;
 			ctx->read_packet = mqtt_tcp_read_packet;
 			ctx->server_port = MQTT_DEMO_SERVER_PORT_TCP;
 			break;
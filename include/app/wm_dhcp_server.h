@@ -55,6 +55,16 @@ s8 tls_dhcps_start(void);
  */
 void tls_dhcps_stop(void);
 
+/**
+ * @brief          This function is used to set the number of IP addresses
+                   the DHCP server hands out
+ * @param[in]      num    size of the address pool, 8 by default
+ * @retval         0      success
+ * @retval         other  invalid size
+ * @note           Takes effect at the next tls_dhcps_start
+ */
+s8 tls_dhcps_set_pool_size(u16 num);
+
 /**
  * @brief          This function is used to get station's IP address by
                    MAC address
@@ -51,7 +51,8 @@ typedef void tls_ssl_key_t;
  * @retval         0     success
  * @retval         other failed
  *
- * @note           None
+ * @note           Also sets up the session cache that lets returning clients
+ *                 resume their session instead of doing a full handshake
  */
 int tls_ssl_server_init(void * arg);
 
@@ -142,7 +143,7 @@ void tls_ssl_server_close_conn(tls_ssl_t *ssl, int s);
  * @retval         0         success
  * @retval         other     failed
  *
- * @note           None
+ * @note           The session cache is freed as well
  */
 int tls_ssl_server_close(tls_ssl_key_t * keys);
 
@@ -1177,7 +1177,7 @@ __STATIC_INLINE void csi_dcache_invalid_range (uint32_t *addr, int32_t dsize)
 {
 #if (__DCACHE_PRESENT == 1U)
     int32_t op_size = dsize;
-    uint32_t op_addr = (uint32_t)addr & CACHE_CIR_INV_ADDR_Msk;
+    uint32_t op_addr = (unsigned long)addr & CACHE_CIR_INV_ADDR_Msk;
     int32_t linesize = 16;
 
     op_addr |= _VAL2FLD(CACHE_CIR_INV_ONE, 1);
@@ -1222,7 +1222,7 @@ __STATIC_INLINE void csi_dcache_clean_range (uint32_t *addr, int32_t dsize)
 {
 #if (__DCACHE_PRESENT == 1)
     int32_t op_size = dsize;
-    uint32_t op_addr = (uint32_t)addr & CACHE_CIR_INV_ADDR_Msk;
+    uint32_t op_addr = (unsigned long)addr & CACHE_CIR_INV_ADDR_Msk;
     int32_t linesize = 16;
 
     op_addr |= _VAL2FLD(CACHE_CIR_CLR_ONE, 1);
@@ -1267,7 +1267,7 @@ __STATIC_INLINE void csi_dcache_clean_invalid_range (uint32_t *addr, int32_t dsi
 {
 #if (__DCACHE_PRESENT == 1U)
     int32_t op_size = dsize;
-    uint32_t op_addr = (uint32_t)addr & CACHE_CIR_INV_ADDR_Msk;
+    uint32_t op_addr = (unsigned long)addr & CACHE_CIR_INV_ADDR_Msk;
     int32_t linesize = 16;
 
     op_addr |= _VAL2FLD(CACHE_CIR_CLR_ONE, 1) | _VAL2FLD(CACHE_CIR_INV_ONE, 1);
@@ -26,10 +26,10 @@
 #define HSPI_RX_CMD_MSG     1
 #define HSPI_RX_DATA_MSG    2
 
-/**spi/sdio buffer*/
-#define HSPI_TXBUF_NUM              2
+/**spi/sdio buffer, the whole partition below must fit in SLAVE_HSPI_MAX_SIZE*/
+#define HSPI_TXBUF_NUM              4
 #define HSPI_TX_DESC_NUM            HSPI_TXBUF_NUM
-#define HSPI_RXBUF_NUM              3
+#define HSPI_RXBUF_NUM              6
 #define HSPI_RX_DESC_NUM            HSPI_RXBUF_NUM
 #define HSPI_TXBUF_SIZE             1500
 #define HSPI_RXBUF_SIZE             1500
@@ -50,13 +50,13 @@
 #endif
 /** HSPI tx desc zone */
 #define HSPI_TX_DESC_BASE_ADDR      ((u32)(HSPI_TXBUF_BASE_ADDR + HSPI_TXBUF_TOTAL_SIZE))
-#define HSPI_TX_DESC_TOTAL_SIZE     (HSPI_TX_DESC_SIZE * HSPI_TX_DESC_NUM)	//28*3=84
+#define HSPI_TX_DESC_TOTAL_SIZE     (HSPI_TX_DESC_SIZE * HSPI_TX_DESC_NUM)	//24*4=96
 /** HSPI rxbuf zone */
 #define HSPI_RXBUF_BASE_ADDR        ((u32)(HSPI_TX_DESC_BASE_ADDR + HSPI_TX_DESC_TOTAL_SIZE))
-#define HSPI_RXBUF_TOTAL_SIZE       (HSPI_RXBUF_NUM * HSPI_RXBUF_SIZE)	//4500
+#define HSPI_RXBUF_TOTAL_SIZE       (HSPI_RXBUF_NUM * HSPI_RXBUF_SIZE)	//9000
 /** HSPI rx desc zone */
 #define HSPI_RX_DESC_BASE_ADDR      ((u32)(HSPI_RXBUF_BASE_ADDR + HSPI_RXBUF_TOTAL_SIZE))
-#define HSPI_RX_DESC_TOTAL_SIZE     (HSPI_RX_DESC_SIZE * HSPI_RX_DESC_NUM)	//36
+#define HSPI_RX_DESC_TOTAL_SIZE     (HSPI_RX_DESC_SIZE * HSPI_RX_DESC_NUM)	//72
 
 #define SDIO_CIS_SIZE (0x80)
 #define SDIO_CMD_RXBUF_SIZE          256
@@ -65,6 +65,7 @@
 #define SDIO_CIS0_ADDR              (HSPI_RX_DESC_BASE_ADDR + HSPI_RX_DESC_TOTAL_SIZE)	//128
 #define SDIO_CIS1_ADDR              (SDIO_CIS0_ADDR + SDIO_CIS_SIZE)						//128
 #define SDIO_CMD_RXBUF_ADDR          (SDIO_CIS1_ADDR + SDIO_CIS_SIZE)
+#define SDIO_CMD_RXBUF_END           (SDIO_CMD_RXBUF_ADDR + SDIO_CMD_RXBUF_SIZE)
 
 
 #define CIS_FUN0_ADDR				((u32)SDIO_CIS0_ADDR)
@@ -131,6 +132,10 @@ struct tls_slave_hspi {
 
     struct tls_hspi_rx_desc   *curr_rx_desc;    /**< Downlink data management */
 
+    u8 rx_coal_frames;                          /**< downlink frames in one pass that defer the next pass */
+
+    u32 rx_coal_msecs;                          /**< ms the next pass is deferred by, 0: off */
+
 #if HSPI_TX_MEM_MALLOC
 	u8 txdoneflag;		                        /**< tx done falg*/
 #endif
@@ -242,6 +247,41 @@ void tls_hspi_tx_data_callback_register(s16 (*tx_data_callback)(char *buf));
  */
 int tls_hspi_tx_data(char *txbuf, int len);
 
+/**
+ * @brief          This function is used to mask hspi/sdio interrupts.
+ *
+ * @param[in]      int_src		SDIO_WP_INT_SRC_XXX bits to mask.
+ *
+ * @return         None
+ *
+ * @note           A masked source is still latched, tls_hspi_irq_unmask() can clear it first.
+ */
+void tls_hspi_irq_mask(u32 int_src);
+
+/**
+ * @brief          This function is used to unmask hspi/sdio interrupts.
+ *
+ * @param[in]      int_src		SDIO_WP_INT_SRC_XXX bits to unmask.
+ * @param[in]      clear		TRUE to drop what was latched while masked.
+ *
+ * @return         None
+ *
+ * @note           None
+ */
+void tls_hspi_irq_unmask(u32 int_src, bool clear);
+
+/**
+ * @brief          This function is used to set the downlink interrupt coalescing.
+ *
+ * @param[in]      frames		a pass handling at least this many frames keeps the interrupt masked.
+ * @param[in]      msecs		the next pass then runs after this many ms, 0 disables coalescing.
+ *
+ * @return         None
+ *
+ * @note           Coalescing trades up to msecs of latency for fewer interrupts when the host streams small frames.
+ */
+void tls_hspi_set_rx_coalesce(u8 frames, u32 msecs);
+
 /**
  * @}
  */
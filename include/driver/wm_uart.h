@@ -299,6 +299,8 @@ typedef struct tls_uart_port
 
     u8 hw_stopped;
 
+    u8 rx_hold;                         /**< the unread bytes are still referenced, a full ring drops new bytes instead of old ones */
+
     tls_os_sem_t *tx_sem;
 
     char *buf_ptr;
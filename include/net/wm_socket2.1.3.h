@@ -138,6 +138,20 @@ typedef err_t (*socket_accept_fn)(u8 skt_num, err_t err);
 */
 typedef void(*socket_state_changed_fn)(u8 skt_num, u8 event, u8 state);
 
+/**
+* @brief This Function prototype for the callback of tls_socket_send_ref. Called from the tcpip
+*                   thread when the peer acknowledged data sent by reference, the memory may
+*                   then be reused.
+*
+* @param[in] skt_num   Is the socket number that returned by tls_socket_create function.
+*
+* @param[in] len       Number of bytes acknowledged, in the order they were sent. 0 when the
+*                      connection went away, the data not acknowledged until then is released too.
+*
+* @param[in] arg       Is the argument given to tls_socket_send_ref.
+*/
+typedef void(*socket_acked_fn)(u8 skt_num, u32 len, void *arg);
+
 enum tls_socket_protocol{
     SOCKET_PROTO_TCP,      /* TCP Protocol    */
     SOCKET_PROTO_UDP,     /* UDP Protocol   */
@@ -192,6 +206,28 @@ int tls_socket_create(struct tls_socket_desc * skd);
 */
 int tls_socket_send(u8 skt_num, void *pdata, u16 len);
 
+/**
+* @brief This function is called by your application code to send data by a connected TCP client
+*           socket without copying it. The data must stay unchanged until acked reports it, and
+*           tls_socket_send must not be used on the socket meanwhile. When the socket is closed
+*           with such data outstanding the connection is reset.
+*
+* @param[in] skt_num      Is the socket number that returned by tls_socket_create function.
+*
+* @param[in] pdata          Is a pointer to the data which need to be send by the socket.
+*
+* @param[in] len              The data's length.
+*
+* @param[in] acked          Is called as the peer acknowledges the data.
+*
+* @param[in] arg              Is passed to acked.
+*
+* @retval	 number of bytes taken, 0 if the send buffer is full, try again after acked was called.
+*              ERR_ARG   If the socket is not a TCP client, tls_socket_send has to be used.
+*              negative number   If an error was detected.
+*/
+int tls_socket_send_ref(u8 skt_num, void *pdata, u16 len, socket_acked_fn acked, void *arg);
+
 /**
 * @brief This function is called by your application code to close the socket, and the related resources would be released.
 *
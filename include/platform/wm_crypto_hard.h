@@ -257,6 +257,46 @@ typedef union
 
 #endif
 
+/** Scatter-gather segment of an asynchronous crypto job */
+typedef struct
+{
+    unsigned char *in;      /**< input data */
+    unsigned char *out;     /**< output data, unused for CRC, SHA1 and MD5 */
+    u32 len;                /**< length in bytes, at most 0xFFFF */
+} tls_crypto_sg_t;
+
+struct tls_crypto_job;
+
+/** Completion callback of an asynchronous crypto job, called in interrupt context */
+typedef void (*tls_crypto_job_cb)(struct tls_crypto_job *job, void *arg);
+
+/** Asynchronous crypto job, see tls_crypto_job_submit */
+struct tls_crypto_job
+{
+    CRYPTO_METHOD method;       /**< AES, DES, 3DES, RC4, CRC, SHA1 or MD5 */
+    CRYPTO_WAY way;             /**< ciphers only */
+    union
+    {
+        psCipherContext_t *cipher;
+        psCrcContext_t *crc;
+        psDigestContext_t *md;
+    } ctx;                      /**< context set up by the matching init function */
+    const tls_crypto_sg_t *sg;  /**< segments, processed as one stream */
+    u32 sg_num;                 /**< number of segments */
+    tls_crypto_job_cb cb;       /**< completion callback, may be NULL */
+    void *arg;                  /**< argument of the callback */
+    volatile int status;        /**< CRYPTO_JOB_PENDING, then ERR_CRY_OK */
+
+    /* owned by the driver while the job is queued */
+    struct tls_crypto_job *next;
+    u32 sg_idx;
+    u32 offset;
+    u32 iv[4];
+    u32 next_iv[4];
+};
+
+#define CRYPTO_JOB_PENDING  1
+
 struct wm_crypto_ctx
 {
 	volatile u8 rsa_complete;
@@ -340,6 +380,33 @@ int tls_crypto_random_bytes(unsigned char *out, u32 len);
  */
 int tls_crypto_trng(unsigned char *out, u32 len);
 
+/**
+ * @brief          	This function is used to get random bytes from a CTR_DRBG
+ *				keyed with the hardware AES and seeded from the TRNG.
+ *
+ * @param[in]   	out 			Pointer to the output of random bytes.
+ * @param[in]   	len 			The random bytes length.
+ *
+ * @retval  		0  			success
+ * @retval  		other   		failed
+ *
+ * @note           	Requests of up to 32 bytes are served from a buffer without
+ *				taking any lock. Must not be called from an interrupt handler.
+ */
+int tls_crypto_random_fast(unsigned char *out, u32 len);
+
+/**
+ * @brief          	This function is used to get a 32 bit random number, see
+ *				tls_crypto_random_fast.
+ *
+ * @param[in]   	None
+ *
+ * @retval  		random number
+ *
+ * @note           	Must not be called from an interrupt handler.
+ */
+u32 tls_crypto_random_u32(void);
+
 
 /**
  * @brief          	This function initializes a RC4 encryption algorithm,  
@@ -635,6 +702,39 @@ int tls_crypto_exptmod(hstm_int *a, hstm_int *e, hstm_int *n, hstm_int *res);
  */
 int tls_crypto_init(void);
 
+/**
+ * @brief			This function queues an asynchronous crypto job.
+ *				The engine runs the segments of the job back to back from its interrupt,
+ *				then goes on with the next queued job, so the caller is free to run meanwhile.
+ *
+ * @param[in]		job		Pointer to the job, it must stay valid until completion.
+ *
+ * @retval		0		success, the job is queued
+ * @retval		other	failed, invalid job
+ *
+ * @note			Cipher jobs chain the IV (CBC), the counter (CTR) or the RC4 key stream across
+ *				segments and write the IV or counter back to the context on completion. Like
+ *				tls_crypto_rc4(), an RC4 job starts the key stream from the key. Segments of block
+ *				ciphers must be multiples of the block size (except the last one in CTR mode),
+ *				SHA1/MD5 jobs take multiples of 64 bytes and need a context without
+ *				buffered bytes (they only update the state and length, the final is left to the caller).
+ *				The job holds the engine lock while the queue runs, synchronous calls wait for it.
+ *				Must not be called from interrupt context, except from the completion callback of a job.
+ */
+int tls_crypto_job_submit(struct tls_crypto_job *job);
+
+/**
+ * @brief			This function runs a crypto job and blocks the calling task, without spinning, until it completes.
+ *
+ * @param[in]		job		Pointer to the job, its callback is overwritten.
+ *
+ * @retval		0		success
+ * @retval		other	failed
+ *
+ * @note			Must not be called from interrupt context.
+ */
+int tls_crypto_job_run(struct tls_crypto_job *job);
+
 /**
  * @}
  */
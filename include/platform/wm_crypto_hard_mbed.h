@@ -8,6 +8,20 @@
 
 int tls_crypto_mbedtls_exptmod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *E, const mbedtls_mpi *N);
 
+/* X[i] = A[i]^E mod N for count values in one session of the multiplier, 0 <= A[i] < N.
+ * For public keys only: the Montgomery constants of N are kept for the next call with the
+ * same modulus. X and A may be the same array. */
+int tls_crypto_mbedtls_exptmod_batch( mbedtls_mpi *X, const mbedtls_mpi *A, size_t count,
+                                      const mbedtls_mpi *E, const mbedtls_mpi *N );
+
+/* Modular multiplications on the RSA Montgomery multiplier: open it for an odd modulus N
+ * (up to MAX_HARD_EXPTMOD_BITLEN bits), run any number of mulmods, then close it.
+ * The multiplier stays locked in between. A and B must be in [0, N). Closing after a
+ * failed open does nothing. */
+int tls_crypto_mbedtls_mont_open( const mbedtls_mpi *N );
+int tls_crypto_mbedtls_mont_mulmod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *B );
+void tls_crypto_mbedtls_mont_close( void );
+
 
 #endif
 
@@ -16,6 +16,7 @@
 #ifndef WM_MEM_H
 #define WM_MEM_H
 
+#include <stddef.h>
 #include "csi_config.h"
 #include "wm_type_def.h"
 
@@ -83,7 +84,7 @@ int  is_safe_addr_debug(void* p, u32 len, char* file, int line);
 void * mem_alloc_debug(u32 size);
 void mem_free_debug(void *p);
 void * mem_realloc_debug(void *mem_address, u32 size);
-void *mem_calloc_debug(u32 length, u32 size);
+void *mem_calloc_debug(size_t length, size_t size);
 
 /**
  * @defgroup System_APIs System APIs
@@ -13,6 +13,9 @@
 
 /*see gcc_csky.ld in directory ld/w800,__heap_end must be bigger than 0x20028000
 if __heap_end is lower than 0x20028000,then SLAVE_HSPI_SDIO_ADDR must be changed to 0x20028000 or bigger.
+__heap_end is 0x20038000, so that with the 16KB HSPI/SDIO partition the Wi-Fi buffers still start at
+0x2003C000 and have up to SYS_REBOOT_REASON_ADDRESS for 7 tx and 3 rx buffers; a bigger partition
+must come out of the heap as well.
 */
 extern unsigned int __heap_end;
 extern unsigned int __heap_start;
@@ -21,7 +24,7 @@ extern unsigned int __heap_start;
 #define SLAVE_HSPI_SDIO_ADDR        ((unsigned int)(&__heap_end))
 
 #if TLS_CONFIG_HS_SPI
-#define SLAVE_HSPI_MAX_SIZE         (0x2000)
+#define SLAVE_HSPI_MAX_SIZE         (0x4000)
 #else
 #define SLAVE_HSPI_MAX_SIZE         (0x0)
 #endif
@@ -899,7 +899,7 @@ typedef volatile unsigned int TLS_REG;    /* Hardware register definition */
  */
 static __inline void tls_reg_write32(unsigned int reg, unsigned int val)
 {
-    *(TLS_REG *)reg = val;
+    *(TLS_REG *)(unsigned long)reg = val;
 }
 
 
@@ -914,7 +914,7 @@ static __inline void tls_reg_write32(unsigned int reg, unsigned int val)
  */
 static __inline unsigned int tls_reg_read32(unsigned int reg)
 {
-    unsigned int val = *(TLS_REG *)reg;
+    unsigned int val = *(TLS_REG *)(unsigned long)reg;
     return val;
 }
 
@@ -935,9 +935,9 @@ static __inline void tls_bitband_write(volatile unsigned int addr, unsigned int
 {
 	unsigned int temp;
 
-	temp = (M32(addr) & ~(1 << bit)) | (val << bit);
+	temp = (M32((unsigned long)addr) & ~(1 << bit)) | (val << bit);
 
-	*((volatile unsigned int * )addr) = temp;
+	*((volatile unsigned int * )(unsigned long)addr) = temp;
 }
 
 /**
@@ -955,9 +955,9 @@ static __inline unsigned int tls_bitband_read(volatile unsigned int addr, unsign
 {
 	unsigned int temp;
 
-	temp = (M32(addr) >> bit) & 0x1;
+	temp = (M32((unsigned long)addr) >> bit) & 0x1;
 
-	return *((volatile unsigned int *)temp);
+	return *((volatile unsigned int *)(unsigned long)temp);
 }
 
 
@@ -87,9 +87,20 @@ void RSA_F_IRQHandler(void)
     RSACON = 0x00;
     g_crypto_ctx.rsa_complete = 1;
 }
+/* asynchronous job queue, see tls_crypto_job_submit */
+static struct tls_crypto_job *crypto_job_head;
+static struct tls_crypto_job *crypto_job_tail;
+static volatile u8 crypto_job_busy;
+static void crypto_job_irq(void);
+
 void CRYPTION_IRQHandler(void)
 {
     tls_reg_write32(HR_CRYPTO_SEC_STS, 0x10000);
+    if (crypto_job_busy)
+    {
+        crypto_job_irq();
+        return;
+    }
     g_crypto_ctx.gpsec_complete = 1;
 }
 
@@ -172,6 +183,51 @@ void tls_crypto_set_iv(void *iv, int ivlen)
     }
 }
 
+/* Longest run the engine takes at once, the length field of HR_CRYPTO_SEC_CFG is 16 bits */
+#define CRYPTO_MAX_RUN      0xFFFF
+
+/* Start the engine and wait for its interrupt */
+static void crypto_gpsec_run(void)
+{
+    g_crypto_ctx.gpsec_complete = 0;
+    tls_reg_write32(HR_CRYPTO_SEC_CTRL, 0x1);//start crypto
+    while (!g_crypto_ctx.gpsec_complete)
+    {
+
+    }
+    g_crypto_ctx.gpsec_complete = 0;
+}
+
+/* IV of the run following the len bytes just processed: the last ciphertext block for CBC
+   (next_iv holds it when decrypting, as the input may have been overwritten), the counter
+   advanced by the number of blocks for CTR */
+static void crypto_iv_next(u32 *iv, const u32 *next_iv, const unsigned char *out, u32 len,
+                           u32 block, CRYPTO_MODE mode, CRYPTO_WAY way)
+{
+    unsigned char *ctr = (unsigned char *)iv;
+    u32 n, sum;
+    int i;
+
+    if (mode == CRYPTO_MODE_CBC)
+    {
+        if (way == CRYPTO_WAY_ENCRYPT)
+            memcpy(iv, out + len - block, block);
+        else
+            memcpy(iv, next_iv, block);
+    }
+    else if (mode == CRYPTO_MODE_CTR)
+    {
+        /* big endian counter */
+        n = len / block;
+        for (i = block - 1; i >= 0 && n; i--)
+        {
+            sum = ctr[i] + (n & 0xFF);
+            ctr[i] = (unsigned char)sum;
+            n = (n >> 8) + (sum >> 8);
+        }
+    }
+}
+
 /**
  * @brief          	This function is used to stop random produce.
  *
@@ -348,6 +404,220 @@ int tls_crypto_random_bytes_range(unsigned char *out, u32 len, u32 range)
 	return ERR_CRY_OK;
 }
 
+/*
+ * CTR_DRBG of SP 800-90A with AES-128, no derivation function and a 32 bit counter field,
+ * which is exactly what the CTR mode of the engine computes. It is seeded from the TRNG and
+ * reseeded after DRBG_RESEED_REQUESTS generate requests or DRBG_RESEED_SECONDS, whichever
+ * comes first.
+ *
+ * Small requests are served from a pool of output bytes taken in a short critical section,
+ * so they cost neither the engine nor a semaphore; the pool is refilled under drbg.lock.
+ */
+#define DRBG_KEYLEN             16
+#define DRBG_SEEDLEN            32
+#define DRBG_RESEED_REQUESTS    4096
+#define DRBG_RESEED_SECONDS     600
+#define DRBG_MAX_REQUEST        1024    /* bytes per generate request */
+#define DRBG_POOL_SIZE          256
+#define DRBG_POOL_MAX_DRAW      32      /* larger requests go to the generator directly */
+
+static struct
+{
+    u8 key[DRBG_KEYLEN];
+    u8 v[AES_BLOCKLEN];
+    u8 seeded;
+    u32 requests;
+    u32 seed_time;
+    psCipherContext_t aes;
+#ifndef CONFIG_KERNEL_NONE
+    tls_os_sem_t *lock;
+#endif
+    u32 pool_pos;                       /* bytes of the pool already handed out */
+    u8 pool[DRBG_POOL_SIZE];
+} drbg = {.pool_pos = DRBG_POOL_SIZE};
+
+static void drbg_lock(void)
+{
+#ifndef CONFIG_KERNEL_NONE
+    if (drbg.lock)
+        tls_os_sem_acquire(drbg.lock, 0);
+#endif
+}
+
+static void drbg_unlock(void)
+{
+#ifndef CONFIG_KERNEL_NONE
+    if (drbg.lock)
+        tls_os_sem_release(drbg.lock);
+#endif
+}
+
+/* len bytes (a multiple of the block size) of AES_K(V + 1) || AES_K(V + 2) ..., V is advanced
+   past the last block. Runs are split where the counter field wraps, so the width of the
+   engine's own counter does not matter. */
+static void drbg_keystream(unsigned char *out, u32 len)
+{
+    u32 ctr, n;
+
+    memset(out, 0, len);
+    while (len > 0)
+    {
+        ctr = ((u32)drbg.v[12] << 24) | ((u32)drbg.v[13] << 16) | ((u32)drbg.v[14] << 8) | drbg.v[15];
+        ctr++;
+        STORE32H(ctr, drbg.v + 12);
+        n = len;
+        if (ctr != 0 && n / AES_BLOCKLEN > 0u - ctr)
+            n = (0u - ctr) * AES_BLOCKLEN;
+
+        tls_crypto_aes_init(&drbg.aes, drbg.v, drbg.key, DRBG_KEYLEN, CRYPTO_MODE_CTR);
+        tls_crypto_aes_encrypt_decrypt(&drbg.aes, out, out, n, CRYPTO_WAY_ENCRYPT);
+
+        ctr += n / AES_BLOCKLEN - 1;
+        STORE32H(ctr, drbg.v + 12);
+        out += n;
+        len -= n;
+    }
+}
+
+/* CTR_DRBG_Update, data is DRBG_SEEDLEN bytes or NULL for all zero */
+static void drbg_update(const u8 *data)
+{
+    u8 temp[DRBG_SEEDLEN];
+    int i;
+
+    drbg_keystream(temp, DRBG_SEEDLEN);
+    if (data)
+    {
+        for (i = 0; i < DRBG_SEEDLEN; i++)
+            temp[i] ^= data[i];
+    }
+    memcpy(drbg.key, temp, DRBG_KEYLEN);
+    memcpy(drbg.v, temp + DRBG_KEYLEN, AES_BLOCKLEN);
+    memset(temp, 0, sizeof(temp));
+}
+
+/* instantiate on first use, reseed when the interval is over; called with drbg.lock held */
+static void drbg_check_seed(void)
+{
+    u8 entropy[DRBG_SEEDLEN];
+
+    if (drbg.seeded && drbg.requests < DRBG_RESEED_REQUESTS &&
+        tls_os_get_time() - drbg.seed_time < DRBG_RESEED_SECONDS * HZ)
+        return;
+
+    if (!drbg.seeded)
+    {
+        memset(drbg.key, 0, DRBG_KEYLEN);
+        memset(drbg.v, 0, AES_BLOCKLEN);
+    }
+    tls_crypto_trng(entropy, DRBG_SEEDLEN);
+    drbg_update(entropy);
+    memset(entropy, 0, sizeof(entropy));
+
+    drbg.seeded = 1;
+    drbg.requests = 0;
+    drbg.seed_time = tls_os_get_time();
+}
+
+/* CTR_DRBG_Generate without additional input; called with drbg.lock held */
+static void drbg_generate(unsigned char *out, u32 len)
+{
+    u8 block[AES_BLOCKLEN];
+    u32 n;
+
+    while (len > 0)
+    {
+        drbg_check_seed();
+        n = min(len, DRBG_MAX_REQUEST);
+        if (n >= AES_BLOCKLEN)
+            drbg_keystream(out, n & ~(AES_BLOCKLEN - 1));
+        if (n & (AES_BLOCKLEN - 1))
+        {
+            drbg_keystream(block, AES_BLOCKLEN);
+            memcpy(out + (n & ~(AES_BLOCKLEN - 1)), block, n & (AES_BLOCKLEN - 1));
+        }
+        drbg_update(NULL);
+        drbg.requests++;
+        out += n;
+        len -= n;
+    }
+    memset(block, 0, sizeof(block));
+}
+
+/* take up to len bytes from the pool, returns the number taken */
+static u32 drbg_pool_take(unsigned char *out, u32 len)
+{
+    u32 cpu_sr;
+    u32 n;
+
+    cpu_sr = tls_os_set_critical();
+    n = min(len, DRBG_POOL_SIZE - drbg.pool_pos);
+    memcpy(out, drbg.pool + drbg.pool_pos, n);
+    /* handed out bytes are wiped so they can not leak later */
+    memset(drbg.pool + drbg.pool_pos, 0, n);
+    drbg.pool_pos += n;
+    tls_os_release_critical(cpu_sr);
+
+    return n;
+}
+
+/**
+ * @brief          	This function is used to get random bytes from the DRBG.
+ *
+ * @param[in]   	out 			Pointer to the output of random bytes.
+ * @param[in]   	len 			The random bytes length.
+ *
+ * @retval  		0  			success
+ * @retval  		other   		failed
+ *
+ * @note           	Must not be called from an interrupt handler.
+ */
+int tls_crypto_random_fast(unsigned char *out, u32 len)
+{
+    u32 n;
+
+    if (len > DRBG_POOL_MAX_DRAW)
+    {
+        drbg_lock();
+        drbg_generate(out, len);
+        drbg_unlock();
+        return ERR_CRY_OK;
+    }
+
+    n = drbg_pool_take(out, len);
+    while (n < len)
+    {
+        drbg_lock();
+        /* another task may have refilled the pool while we waited; the pool is only
+           written once it is empty, when nobody reads it */
+        if (drbg.pool_pos == DRBG_POOL_SIZE)
+        {
+            drbg_generate(drbg.pool, DRBG_POOL_SIZE);
+            drbg.pool_pos = 0;
+        }
+        drbg_unlock();
+        n += drbg_pool_take(out + n, len - n);
+    }
+    return ERR_CRY_OK;
+}
+
+/**
+ * @brief          	This function is used to get a 32 bit random number from the DRBG.
+ *
+ * @param[in]   	None
+ *
+ * @retval  		random number
+ *
+ * @note           	Must not be called from an interrupt handler.
+ */
+u32 tls_crypto_random_u32(void)
+{
+    u32 val;
+
+    tls_crypto_random_fast((unsigned char *)&val, sizeof(val));
+    return val;
+}
+
 
 /**
  * @brief          	This function initializes a RC4 encryption algorithm,
@@ -396,26 +666,31 @@ int tls_crypto_rc4(psCipherContext_t *ctx, unsigned char *in, unsigned char *out
     unsigned int sec_cfg;
     unsigned char *key = ctx->arc4.state;
     u32 keylen = ctx->arc4.byteCount;
+    u32 n;
+    int first = 1;
 	tls_crypto_sem_lock();
     tls_open_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
     tls_crypto_set_key(key, keylen);
-    tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned int)in);
-    tls_reg_write32(HR_CRYPTO_DEST_ADDR, (unsigned int)out);
-    sec_cfg = (CRYPTO_METHOD_RC4 << 16) | (1 << SOFT_RESET_RC4) | (len & 0xFFFF);
-    if(keylen == 32)
-    {
-        sec_cfg |= (1 << 31);
-    }
-    tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
-    CRYPTO_LOG("[%d]:rc4[%d] start\n", sys_count, len);
-    g_crypto_ctx.gpsec_complete = 0;
-    tls_reg_write32(HR_CRYPTO_SEC_CTRL, 0x1);//start crypto
-    while (!g_crypto_ctx.gpsec_complete)
+    while (len > 0)
     {
-
+        n = min(len, CRYPTO_MAX_RUN);
+        tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned long)in);
+        tls_reg_write32(HR_CRYPTO_DEST_ADDR, (unsigned long)out);
+        /* only the first run resets the engine, later ones continue its key stream */
+        sec_cfg = (CRYPTO_METHOD_RC4 << 16) | (first << SOFT_RESET_RC4) | (n & 0xFFFF);
+        if(keylen == 32)
+        {
+            sec_cfg |= (1 << 31);
+        }
+        tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
+        CRYPTO_LOG("[%d]:rc4[%d] start\n", sys_count, n);
+        crypto_gpsec_run();
+        CRYPTO_LOG("[%d]:rc4 end status: %x\n", sys_count, tls_reg_read32(HR_CRYPTO_SEC_STS));
+        first = 0;
+        in += n;
+        out += n;
+        len -= n;
     }
-    g_crypto_ctx.gpsec_complete = 0;
-    CRYPTO_LOG("[%d]:rc4 end status: %x\n", sys_count, tls_reg_read32(HR_CRYPTO_SEC_STS));
     tls_close_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
 	tls_crypto_sem_unlock();
     return ERR_CRY_OK;
@@ -474,27 +749,36 @@ int tls_crypto_aes_encrypt_decrypt(psCipherContext_t *ctx, unsigned char *in, un
     unsigned int sec_cfg;
     u32 keylen = 16;
     unsigned char *key = (unsigned char *)ctx->aes.key.skey;
-    unsigned char *IV = ctx->aes.IV;
     CRYPTO_MODE cbc = (CRYPTO_MODE)(ctx->aes.key.type & 0xFF);
+    u32 iv[4], next_iv[4];
+    u32 n;
+
+    memcpy(iv, ctx->aes.IV, AES_IVLEN);
 	tls_crypto_sem_lock();
     tls_open_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
     tls_crypto_set_key(key, keylen);
-    tls_crypto_set_iv(IV, 16);
-
-    tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned int)in);
-    tls_reg_write32(HR_CRYPTO_DEST_ADDR, (unsigned int)out);
-    sec_cfg = (CRYPTO_METHOD_AES << 16) | (1 << SOFT_RESET_AES) | (dec << 20) | (cbc << 21) | (len & 0xFFFF);
-    tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
-    CRYPTO_LOG("[%d]:aes[%d] %s %s start\n", sys_count, len, dec == CRYPTO_WAY_ENCRYPT ? "ENCRYPT" : "DECRYPT",
-               cbc == CRYPTO_MODE_ECB ? "ECB" : (cbc == CRYPTO_MODE_CBC ? "CBC" : (cbc == CRYPTO_MODE_CTR ? "CTR" : "MAC")));
-    g_crypto_ctx.gpsec_complete = 0;
-    tls_reg_write32(HR_CRYPTO_SEC_CTRL, 0x1);//start crypto
-    while (!g_crypto_ctx.gpsec_complete)
+    while (len > 0)
     {
-
+        /* the key stays loaded, only the chained IV is written for each run */
+        n = min(len, CRYPTO_MAX_RUN & ~(AES_BLOCKLEN - 1));
+        tls_crypto_set_iv(iv, 16);
+        if (cbc == CRYPTO_MODE_CBC && dec == CRYPTO_WAY_DECRYPT)
+            memcpy(next_iv, in + n - AES_BLOCKLEN, AES_BLOCKLEN);
+
+        tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned long)in);
+        tls_reg_write32(HR_CRYPTO_DEST_ADDR, (unsigned long)out);
+        sec_cfg = (CRYPTO_METHOD_AES << 16) | (1 << SOFT_RESET_AES) | (dec << 20) | (cbc << 21) | (n & 0xFFFF);
+        tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
+        CRYPTO_LOG("[%d]:aes[%d] %s %s start\n", sys_count, n, dec == CRYPTO_WAY_ENCRYPT ? "ENCRYPT" : "DECRYPT",
+                   cbc == CRYPTO_MODE_ECB ? "ECB" : (cbc == CRYPTO_MODE_CBC ? "CBC" : (cbc == CRYPTO_MODE_CTR ? "CTR" : "MAC")));
+        crypto_gpsec_run();
+        CRYPTO_LOG("[%d]:aes end %d\n", sys_count, tls_reg_read32(HR_CRYPTO_SEC_STS) & 0xFFFF);
+
+        crypto_iv_next(iv, next_iv, out, n, AES_BLOCKLEN, cbc, dec);
+        in += n;
+        out += n;
+        len -= n;
     }
-    g_crypto_ctx.gpsec_complete = 0;
-    CRYPTO_LOG("[%d]:aes end %d\n", sys_count, tls_reg_read32(HR_CRYPTO_SEC_STS) & 0xFFFF);
     tls_close_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
 	tls_crypto_sem_unlock();
     return ERR_CRY_OK;
@@ -552,27 +836,36 @@ int tls_crypto_3des_encrypt_decrypt(psCipherContext_t *ctx, unsigned char *in, u
 {
     unsigned int sec_cfg;
     u32 keylen = DES3_KEY_LEN;
-    unsigned char *key = (unsigned char *)(unsigned char *)ctx->des3.key.ek[0];
-    unsigned char *IV = ctx->des3.IV;
+    unsigned char *key = (unsigned char *)ctx->des3.key.ek[0];
     CRYPTO_MODE cbc = (CRYPTO_MODE)(ctx->des3.key.ek[1][0] & 0xFF);
+    u32 iv[2], next_iv[2];
+    u32 n;
+
+    memcpy(iv, ctx->des3.IV, DES3_IV_LEN);
 	tls_crypto_sem_lock();
     tls_open_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
     tls_crypto_set_key(key, keylen);
-    tls_crypto_set_iv(IV, DES3_IV_LEN);
-    tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned int)in);
-    tls_reg_write32(HR_CRYPTO_DEST_ADDR, (unsigned int)out);
-    sec_cfg = (CRYPTO_METHOD_3DES << 16) | (1 << SOFT_RESET_DES) | (dec << 20) | (cbc << 21) | (len & 0xFFFF);
-    tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
-    CRYPTO_LOG("[%d]:3des[%d] %s %s start\n", sys_count, len, dec == CRYPTO_WAY_ENCRYPT ? "ENCRYPT" : "DECRYPT",
-               cbc == CRYPTO_MODE_ECB ? "ECB" : "CBC");
-    g_crypto_ctx.gpsec_complete = 0;
-    tls_reg_write32(HR_CRYPTO_SEC_CTRL, 0x1);//start crypto
-    while (!g_crypto_ctx.gpsec_complete)
+    while (len > 0)
     {
-
+        n = min(len, CRYPTO_MAX_RUN & ~(DES3_IV_LEN - 1));
+        tls_crypto_set_iv(iv, DES3_IV_LEN);
+        if (cbc == CRYPTO_MODE_CBC && dec == CRYPTO_WAY_DECRYPT)
+            memcpy(next_iv, in + n - DES3_IV_LEN, DES3_IV_LEN);
+
+        tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned long)in);
+        tls_reg_write32(HR_CRYPTO_DEST_ADDR, (unsigned long)out);
+        sec_cfg = (CRYPTO_METHOD_3DES << 16) | (1 << SOFT_RESET_DES) | (dec << 20) | (cbc << 21) | (n & 0xFFFF);
+        tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
+        CRYPTO_LOG("[%d]:3des[%d] %s %s start\n", sys_count, n, dec == CRYPTO_WAY_ENCRYPT ? "ENCRYPT" : "DECRYPT",
+                   cbc == CRYPTO_MODE_ECB ? "ECB" : "CBC");
+        crypto_gpsec_run();
+        CRYPTO_LOG("[%d]:3des end %d\n", sys_count, tls_reg_read32(HR_CRYPTO_SEC_STS) & 0xFFFF);
+
+        crypto_iv_next(iv, next_iv, out, n, DES3_IV_LEN, cbc, dec);
+        in += n;
+        out += n;
+        len -= n;
     }
-    g_crypto_ctx.gpsec_complete = 0;
-    CRYPTO_LOG("[%d]:3des end %d\n", sys_count, tls_reg_read32(HR_CRYPTO_SEC_STS) & 0xFFFF);
     tls_close_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
 	tls_crypto_sem_unlock();
     return ERR_CRY_OK;
@@ -631,31 +924,37 @@ int tls_crypto_des_encrypt_decrypt(psCipherContext_t *ctx, unsigned char *in, un
     unsigned int sec_cfg;
     u32 keylen = DES_KEY_LEN;
     unsigned char *key = (unsigned char *)ctx->des3.key.ek[0];
-    unsigned char *IV = ctx->des3.IV;
     CRYPTO_MODE cbc = (CRYPTO_MODE)(ctx->des3.key.ek[1][0] & 0xFF);
-    //uint32_t *IV32 = (uint32_t *)IV;
+    u32 iv[2], next_iv[2];
+    u32 n;
 
+    memcpy(iv, ctx->des3.IV, DES3_IV_LEN);
 	tls_crypto_sem_lock();
     tls_open_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
     tls_crypto_set_key(key, keylen);
-    tls_crypto_set_iv(IV, DES3_IV_LEN);
-    tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned int)in);
-    tls_reg_write32(HR_CRYPTO_DEST_ADDR, (unsigned int)out);
-    sec_cfg = (CRYPTO_METHOD_DES << 16) | (1 << SOFT_RESET_DES) | (dec << 20) | (cbc << 21) | (len & 0xFFFF);
-    tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
-    CRYPTO_LOG("[%d]:des[%d] %s %s start\n", sys_count, len, dec == CRYPTO_WAY_ENCRYPT ? "ENCRYPT" : "DECRYPT",
-               cbc == CRYPTO_MODE_ECB ? "ECB" : "CBC");
-    g_crypto_ctx.gpsec_complete = 0;
-    tls_reg_write32(HR_CRYPTO_SEC_CTRL, 0x1);//start crypto
-    while (!g_crypto_ctx.gpsec_complete)
+    while (len > 0)
     {
-
+        n = min(len, CRYPTO_MAX_RUN & ~(DES3_IV_LEN - 1));
+        tls_crypto_set_iv(iv, DES3_IV_LEN);
+        if (cbc == CRYPTO_MODE_CBC && dec == CRYPTO_WAY_DECRYPT)
+            memcpy(next_iv, in + n - DES3_IV_LEN, DES3_IV_LEN);
+
+        tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned long)in);
+        tls_reg_write32(HR_CRYPTO_DEST_ADDR, (unsigned long)out);
+        sec_cfg = (CRYPTO_METHOD_DES << 16) | (1 << SOFT_RESET_DES) | (dec << 20) | (cbc << 21) | (n & 0xFFFF);
+        tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
+        CRYPTO_LOG("[%d]:des[%d] %s %s start\n", sys_count, n, dec == CRYPTO_WAY_ENCRYPT ? "ENCRYPT" : "DECRYPT",
+                   cbc == CRYPTO_MODE_ECB ? "ECB" : "CBC");
+        crypto_gpsec_run();
+        CRYPTO_LOG("[%d]:des end %d\n", sys_count, tls_reg_read32(HR_CRYPTO_SEC_STS) & 0xFFFF);
+
+        crypto_iv_next(iv, next_iv, out, n, DES3_IV_LEN, cbc, dec);
+        in += n;
+        out += n;
+        len -= n;
     }
-    g_crypto_ctx.gpsec_complete = 0;
-    CRYPTO_LOG("[%d]:des end %d\n", sys_count, tls_reg_read32(HR_CRYPTO_SEC_STS) & 0xFFFF);
     tls_close_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
 	tls_crypto_sem_unlock();
-
     return ERR_CRY_OK;
 }
 
@@ -684,6 +983,33 @@ int tls_crypto_crc_init(psCrcContext_t *ctx, u32 key, CRYPTO_CRC_TYPE crc_type,
     return ERR_CRY_OK;
 }
 
+static u32 crypto_crc_key(psCrcContext_t *ctx)
+{
+    u8 ch_crc = 16;
+
+    if(!(ctx->mode & OUTPUT_REFLECT))
+        return ctx->state;
+
+    switch(ctx->type)
+    {
+    case CRYPTO_CRC_TYPE_8:
+        ch_crc = 8;
+        break;
+    case CRYPTO_CRC_TYPE_16_MODBUS:
+        ch_crc = 16;
+        break;
+    case CRYPTO_CRC_TYPE_16_CCITT:
+        ch_crc = 16;
+        break;
+    case CRYPTO_CRC_TYPE_32:
+        ch_crc = 32;
+        break;
+    default:
+        break;
+    }
+    return Reflect(ctx->state, ch_crc);
+}
+
 /**
  * @brief			This function updates the CRC value with a variable length bytes.
  *				This function may be called as many times as necessary, so the message may be processed in blocks.
@@ -700,47 +1026,24 @@ int tls_crypto_crc_init(psCrcContext_t *ctx, u32 key, CRYPTO_CRC_TYPE crc_type,
 int tls_crypto_crc_update(psCrcContext_t *ctx, unsigned char *in, u32 len)
 {
     unsigned int sec_cfg;
+    u32 n;
 	tls_crypto_sem_lock();
     tls_open_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
-    sec_cfg =  (CRYPTO_METHOD_CRC << 16) | (ctx->type << 21) | (ctx->mode << 23) | (len & 0xFFFF);
-    tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
-    if(ctx->mode & OUTPUT_REFLECT)
-    {
-        u8 ch_crc = 16;
-        u32 state = 0;
-        switch(ctx->type)
-        {
-        case CRYPTO_CRC_TYPE_8:
-            ch_crc = 8;
-            break;
-        case CRYPTO_CRC_TYPE_16_MODBUS:
-            ch_crc = 16;
-            break;
-        case CRYPTO_CRC_TYPE_16_CCITT:
-            ch_crc = 16;
-            break;
-        case CRYPTO_CRC_TYPE_32:
-            ch_crc = 32;
-            break;
-        default:
-            break;
-        }
-        state = Reflect(ctx->state, ch_crc);
-        tls_reg_write32(HR_CRYPTO_CRC_KEY, state);
-    }
-    else
-        tls_reg_write32(HR_CRYPTO_CRC_KEY, ctx->state);
-
-    tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned int)in);
-    g_crypto_ctx.gpsec_complete = 0;
-    tls_reg_write32(HR_CRYPTO_SEC_CTRL, 0x1);//start crypto
-    while (!g_crypto_ctx.gpsec_complete)
+    while (len > 0)
     {
-
+        /* each run starts from the result of the previous one */
+        n = min(len, CRYPTO_MAX_RUN);
+        sec_cfg =  (CRYPTO_METHOD_CRC << 16) | (ctx->type << 21) | (ctx->mode << 23) | (n & 0xFFFF);
+        tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
+        tls_reg_write32(HR_CRYPTO_CRC_KEY, crypto_crc_key(ctx));
+
+        tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned long)in);
+        crypto_gpsec_run();
+        ctx->state = tls_reg_read32(HR_CRYPTO_CRC_RESULT);
+        tls_reg_write32(HR_CRYPTO_SEC_CTRL, 0x4);//clear crc fifo
+        in += n;
+        len -= n;
     }
-    g_crypto_ctx.gpsec_complete = 0;
-    ctx->state = tls_reg_read32(HR_CRYPTO_CRC_RESULT);
-    tls_reg_write32(HR_CRYPTO_SEC_CTRL, 0x4);//clear crc fifo
     tls_close_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
 	tls_crypto_sem_unlock();
     return ERR_CRY_OK;
@@ -770,7 +1073,7 @@ static void hd_sha1_compress(psDigestContext_t *md)
     int i = 0;
 	tls_crypto_sem_lock();
     tls_open_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
-    tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned int)md->u.sha1.buf);
+    tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned long)md->u.sha1.buf);
 
     sec_cfg = (CRYPTO_METHOD_SHA1 << 16) | (64 & 0xFFFF); // TODO
     tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
@@ -965,7 +1268,7 @@ static void hd_md5_compress(psDigestContext_t *md)
     unsigned int sec_cfg, val, i;
 	tls_crypto_sem_lock();
     tls_open_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
-    tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned int)md->u.md5.buf);
+    tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned long)md->u.md5.buf);
     sec_cfg = (CRYPTO_METHOD_MD5 << 16) |  (64 & 0xFFFF);
     tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
     tls_reg_write32(HR_CRYPTO_SHA1_DIGEST0, md->u.md5.state[0]);
@@ -1452,6 +1755,300 @@ int tls_crypto_exptmod(hstm_int *a, hstm_int *e, hstm_int *n, hstm_int *res)
 }
 
 
+static u32 crypto_job_block_size(struct tls_crypto_job *job)
+{
+    switch (job->method)
+    {
+    case CRYPTO_METHOD_AES:
+        return 16;
+    case CRYPTO_METHOD_DES:
+    case CRYPTO_METHOD_3DES:
+        return DES3_IV_LEN;
+    case CRYPTO_METHOD_SHA1:
+    case CRYPTO_METHOD_MD5:
+        return 64;
+    default:
+        return 1;
+    }
+}
+
+static CRYPTO_MODE crypto_job_mode(struct tls_crypto_job *job)
+{
+    if (job->method == CRYPTO_METHOD_AES)
+        return (CRYPTO_MODE)(job->ctx.cipher->aes.key.type & 0xFF);
+    else if (job->method == CRYPTO_METHOD_DES || job->method == CRYPTO_METHOD_3DES)
+        return (CRYPTO_MODE)(job->ctx.cipher->des3.key.ek[1][0] & 0xFF);
+    return CRYPTO_MODE_ECB;
+}
+
+/* Program the engine for the current segment (or 64-byte block of a digest job) and start it */
+static void crypto_job_start(struct tls_crypto_job *job)
+{
+    const tls_crypto_sg_t *sg = &job->sg[job->sg_idx];
+    psCipherContext_t *ctx = job->ctx.cipher;
+    CRYPTO_MODE mode = crypto_job_mode(job);
+    u32 block = crypto_job_block_size(job);
+    unsigned int sec_cfg = 0;
+    int i;
+
+    switch (job->method)
+    {
+    case CRYPTO_METHOD_AES:
+        tls_crypto_set_key(ctx->aes.key.skey, 16);
+        tls_crypto_set_iv(job->iv, 16);
+        sec_cfg = (CRYPTO_METHOD_AES << 16) | (1 << SOFT_RESET_AES) | (job->way << 20) | (mode << 21) | (sg->len & 0xFFFF);
+        break;
+    case CRYPTO_METHOD_DES:
+    case CRYPTO_METHOD_3DES:
+        tls_crypto_set_key(ctx->des3.key.ek[0], job->method == CRYPTO_METHOD_DES ? DES_KEY_LEN : DES3_KEY_LEN);
+        tls_crypto_set_iv(job->iv, DES3_IV_LEN);
+        sec_cfg = (job->method << 16) | (1 << SOFT_RESET_DES) | (job->way << 20) | (mode << 21) | (sg->len & 0xFFFF);
+        break;
+    case CRYPTO_METHOD_RC4:
+        tls_crypto_set_key(ctx->arc4.state, ctx->arc4.byteCount);
+        /* as in tls_crypto_rc4(), only the first run resets the engine, the key stream
+           continues over the segments */
+        sec_cfg = (CRYPTO_METHOD_RC4 << 16) | ((job->sg_idx == 0) << SOFT_RESET_RC4) | (sg->len & 0xFFFF);
+        if (ctx->arc4.byteCount == 32)
+            sec_cfg |= (1 << 31);
+        break;
+    case CRYPTO_METHOD_CRC:
+        sec_cfg = (CRYPTO_METHOD_CRC << 16) | (job->ctx.crc->type << 21) | (job->ctx.crc->mode << 23) | (sg->len & 0xFFFF);
+        break;
+    case CRYPTO_METHOD_SHA1:
+    case CRYPTO_METHOD_MD5:
+        sec_cfg = (job->method << 16) | 64;
+        break;
+    default:
+        break;
+    }
+
+    /* in place CBC decryption overwrites the ciphertext the next IV comes from */
+    if (mode == CRYPTO_MODE_CBC && job->way == CRYPTO_WAY_DECRYPT)
+        memcpy(job->next_iv, sg->in + sg->len - block, block);
+
+    tls_reg_write32(HR_CRYPTO_SRC_ADDR, (unsigned long)(sg->in + job->offset));
+    tls_reg_write32(HR_CRYPTO_DEST_ADDR, (unsigned long)sg->out);
+    tls_reg_write32(HR_CRYPTO_SEC_CFG, sec_cfg);
+    if (job->method == CRYPTO_METHOD_CRC)
+    {
+        tls_reg_write32(HR_CRYPTO_CRC_KEY, crypto_crc_key(job->ctx.crc));
+    }
+    else if (job->method == CRYPTO_METHOD_SHA1)
+    {
+        for (i = 0; i < 5; i++)
+            tls_reg_write32(HR_CRYPTO_SHA1_DIGEST0 + (4 * i), job->ctx.md->u.sha1.state[i]);
+    }
+    else if (job->method == CRYPTO_METHOD_MD5)
+    {
+        for (i = 0; i < 4; i++)
+            tls_reg_write32(HR_CRYPTO_SHA1_DIGEST0 + (4 * i), job->ctx.md->u.md5.state[i]);
+    }
+    tls_reg_write32(HR_CRYPTO_SEC_CTRL, 0x1);//start crypto
+}
+
+/* Collect the result of the block or segment that just completed, returns 1 when the segment is done */
+static int crypto_job_segment_done(struct tls_crypto_job *job)
+{
+    const tls_crypto_sg_t *sg = &job->sg[job->sg_idx];
+    CRYPTO_MODE mode = crypto_job_mode(job);
+    u32 block = crypto_job_block_size(job);
+    u32 n;
+    int i;
+
+    switch (job->method)
+    {
+    case CRYPTO_METHOD_CRC:
+        job->ctx.crc->state = tls_reg_read32(HR_CRYPTO_CRC_RESULT);
+        tls_reg_write32(HR_CRYPTO_SEC_CTRL, 0x4);//clear crc fifo
+        return 1;
+    case CRYPTO_METHOD_SHA1:
+    case CRYPTO_METHOD_MD5:
+        if (job->method == CRYPTO_METHOD_SHA1)
+        {
+            for (i = 0; i < 5; i++)
+                job->ctx.md->u.sha1.state[i] = tls_reg_read32(HR_CRYPTO_SHA1_DIGEST0 + (4 * i));
+        }
+        else
+        {
+            for (i = 0; i < 4; i++)
+                job->ctx.md->u.md5.state[i] = tls_reg_read32(HR_CRYPTO_SHA1_DIGEST0 + (4 * i));
+        }
+        /* sha1 and md5 share the length layout */
+#ifdef HAVE_NATIVE_INT64
+        job->ctx.md->u.sha1.length += 512;
+#else
+        n = (job->ctx.md->u.sha1.lengthLo + 512) & 0xFFFFFFFFL;
+        if (n < job->ctx.md->u.sha1.lengthLo)
+        {
+            job->ctx.md->u.sha1.lengthHi++;
+        }
+        job->ctx.md->u.sha1.lengthLo = n;
+#endif /* HAVE_NATIVE_INT64 */
+        job->offset += 64;
+        if (job->offset < sg->len)
+            return 0;
+        job->offset = 0;
+        return 1;
+    default:
+        break;
+    }
+
+    crypto_iv_next(job->iv, job->next_iv, sg->out, sg->len, block, mode, job->way);
+    return 1;
+}
+
+static void crypto_job_irq(void)
+{
+    struct tls_crypto_job *job = crypto_job_head;
+
+    if (job == NULL)
+        return;
+
+    if (!crypto_job_segment_done(job))
+    {
+        crypto_job_start(job);
+        return;
+    }
+    if (++job->sg_idx < job->sg_num)
+    {
+        crypto_job_start(job);
+        return;
+    }
+
+    if (job->method == CRYPTO_METHOD_AES)
+        memcpy(job->ctx.cipher->aes.IV, job->iv, AES_IVLEN);
+    else if (job->method == CRYPTO_METHOD_DES || job->method == CRYPTO_METHOD_3DES)
+        memcpy(job->ctx.cipher->des3.IV, job->iv, DES3_IV_LEN);
+
+    crypto_job_head = job->next;
+    if (crypto_job_head == NULL)
+        crypto_job_tail = NULL;
+    job->status = ERR_CRY_OK;
+    /* the queue stays busy during the callback, so that it can submit the next job */
+    if (job->cb)
+        job->cb(job, job->arg);
+
+    if (crypto_job_head)
+    {
+        crypto_job_start(crypto_job_head);
+        return;
+    }
+    crypto_job_busy = 0;
+    tls_close_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
+    tls_crypto_sem_unlock();
+}
+
+static int crypto_job_check(struct tls_crypto_job *job)
+{
+    CRYPTO_MODE mode;
+    u32 block, i;
+
+    if (job == NULL || job->sg == NULL || job->sg_num == 0 || job->ctx.cipher == NULL)
+        return ERR_FAILURE;
+
+    switch (job->method)
+    {
+    case CRYPTO_METHOD_AES:
+    case CRYPTO_METHOD_DES:
+    case CRYPTO_METHOD_3DES:
+    case CRYPTO_METHOD_RC4:
+    case CRYPTO_METHOD_CRC:
+        break;
+    case CRYPTO_METHOD_SHA1:
+        if (job->ctx.md->u.sha1.curlen != 0)
+            return ERR_FAILURE;
+        break;
+    case CRYPTO_METHOD_MD5:
+        if (job->ctx.md->u.md5.curlen != 0)
+            return ERR_FAILURE;
+        break;
+    default:
+        return ERR_FAILURE;
+    }
+
+    mode = crypto_job_mode(job);
+    block = crypto_job_block_size(job);
+    for (i = 0; i < job->sg_num; i++)
+    {
+        if (job->sg[i].in == NULL || job->sg[i].len == 0 || job->sg[i].len > 0xFFFF)
+            return ERR_FAILURE;
+        if (job->method != CRYPTO_METHOD_CRC && job->method != CRYPTO_METHOD_SHA1 &&
+            job->method != CRYPTO_METHOD_MD5 && job->sg[i].out == NULL)
+            return ERR_FAILURE;
+        if (job->sg[i].len % block && !(mode == CRYPTO_MODE_CTR && i == job->sg_num - 1))
+            return ERR_FAILURE;
+    }
+    return ERR_CRY_OK;
+}
+
+int tls_crypto_job_submit(struct tls_crypto_job *job)
+{
+    u32 cpu_sr;
+
+    if (crypto_job_check(job) != ERR_CRY_OK)
+        return ERR_FAILURE;
+
+    job->next = NULL;
+    job->sg_idx = 0;
+    job->offset = 0;
+    job->status = CRYPTO_JOB_PENDING;
+    if (job->method == CRYPTO_METHOD_AES)
+        memcpy(job->iv, job->ctx.cipher->aes.IV, AES_IVLEN);
+    else if (job->method == CRYPTO_METHOD_DES || job->method == CRYPTO_METHOD_3DES)
+        memcpy(job->iv, job->ctx.cipher->des3.IV, DES3_IV_LEN);
+
+    cpu_sr = tls_os_set_critical();
+    if (crypto_job_busy)
+    {
+        /* chained from the interrupt once the jobs ahead are done */
+        if (crypto_job_tail)
+            crypto_job_tail->next = job;
+        else
+            crypto_job_head = job;
+        crypto_job_tail = job;
+        tls_os_release_critical(cpu_sr);
+        return ERR_CRY_OK;
+    }
+    tls_os_release_critical(cpu_sr);
+
+    /* the queue owns the engine until it drains, the interrupt then releases the lock */
+    tls_crypto_sem_lock();
+    tls_open_peripheral_clock(TLS_PERIPHERAL_TYPE_GPSEC);
+    cpu_sr = tls_os_set_critical();
+    crypto_job_head = crypto_job_tail = job;
+    crypto_job_busy = 1;
+    crypto_job_start(job);
+    tls_os_release_critical(cpu_sr);
+
+    return ERR_CRY_OK;
+}
+
+#ifndef CONFIG_KERNEL_NONE
+static void crypto_job_wake(struct tls_crypto_job *job, void *arg)
+{
+    tls_os_sem_release((tls_os_sem_t *)arg);
+}
+
+int tls_crypto_job_run(struct tls_crypto_job *job)
+{
+    tls_os_sem_t *done = NULL;
+    int ret;
+
+    if (tls_os_sem_create(&done, 0) != TLS_OS_SUCCESS)
+        return ERR_FAILURE;
+
+    job->cb = crypto_job_wake;
+    job->arg = done;
+    ret = tls_crypto_job_submit(job);
+    if (ret == ERR_CRY_OK)
+        tls_os_sem_acquire(done, 0);
+    tls_os_sem_delete(done);
+
+    return ret;
+}
+#endif
+
 /**
  * @brief			This function initializes the encryption module.
  *
@@ -1475,6 +2072,12 @@ int tls_crypto_init(void)
         TLS_DBGPRT_ERR("create semaphore @gpsec_lock fail!\n");
         return -1;
     }
+    err = tls_os_sem_create(&drbg.lock, 1);
+    if (err != TLS_OS_SUCCESS)
+    {
+        TLS_DBGPRT_ERR("create semaphore @drbg.lock fail!\n");
+        return -1;
+    }
 #endif
     tls_irq_enable(RSA_IRQn);
     tls_irq_enable(CRYPTION_IRQn);
@@ -190,11 +190,53 @@ static void rsaCalMc(u32 *mc, const u32 in)
     *mc =  ~y + 1;
 }
 
-int tls_crypto_mbedtls_exptmod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *E, const mbedtls_mpi *N )
+/******************************************************************************
+square and multiply over the bits of E: the running value starts in A, the
+base in B (both in Montgomery form); returns 1 if the result ended up in D
+******************************************************************************/
+static u8 rsaMonMulExp(const mbedtls_mpi *E)
 {
     int i = 0;
-    u32 k = 0, mc = 0, dp0;
-    volatile u8 monmulFlag = 0;
+    u8 monmulFlag = 0;
+
+    for(i = mbedtls_mpi_bitlen(E) - 1; i >= 0; i--)
+    {
+        //montMulMod(&Y, &Y, n, &Y);
+        //if(pstm_get_bit(e, i))
+        //	montMulMod(&Y, &X, n, &Y);
+        if(monmulFlag == 0)
+        {
+            rsaMonMulAA();
+            monmulFlag = 1;
+        }
+        else
+        {
+            rsaMonMulDD();
+            monmulFlag = 0;
+        }
+
+        if(mbedtls_mpi_get_bit(E, i))
+        {
+            if(monmulFlag == 0)
+            {
+                rsaMonMulAB();
+                monmulFlag = 1;
+            }
+            else
+            {
+                rsaMonMulBD();
+                monmulFlag = 0;
+            }
+        }
+    }
+
+    return monmulFlag;
+}
+
+int tls_crypto_mbedtls_exptmod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *E, const mbedtls_mpi *N )
+{
+    u32 mc = 0, dp0;
+    u8 monmulFlag = 0;
     mbedtls_mpi R, X1, Y;
 //	mbedtls_mpi T;
 	int ret = 0;
@@ -234,42 +276,7 @@ int tls_crypto_mbedtls_exptmod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbed
     rsaMulModWrite('B', &X1);
     rsaMulModWrite('A', &Y);
 	
-    k = mbedtls_mpi_bitlen(E);
-	//printf("mbedtls e bit len %d\n", k);
-    for(i = k - 1; i >= 0; i--)
-    {
-        //montMulMod(&Y, &Y, n, &Y);
-        //if(pstm_get_bit(e, i))
-        //	montMulMod(&Y, &X, n, &Y);
-        if(monmulFlag == 0)
-        {
-            rsaMonMulAA();
-            monmulFlag = 1;
-			//rsaMulModDump('D');
-        }
-        else
-        {
-            rsaMonMulDD();
-            monmulFlag = 0;
-			//rsaMulModDump('A');
-        }
-
-        if(mbedtls_mpi_get_bit(E, i))
-        {
-            if(monmulFlag == 0)
-            {
-                rsaMonMulAB();
-                monmulFlag = 1;
-				//rsaMulModDump('D');
-            }
-            else
-            {
-                rsaMonMulBD();
-                monmulFlag = 0;
-				//rsaMulModDump('A');
-            }
-        }
-    }
+    monmulFlag = rsaMonMulExp(E);
     MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R, 1 ) );
     rsaMulModWrite('B', &R);
     //montMulMod(&Y, &R, n, res);
@@ -296,6 +303,206 @@ cleanup:
     return ret;
 }
 
+static u32 mont_rr[64];     /* R^2 mod N, R = 2^(32 * RSAN), in multiplier word order */
+static u8 mont_opened;      /* the lock and clock are held, mont_close() releases them */
+
+static void rsaMulModLoad(u32 *buf, const mbedtls_mpi *a)
+{
+    size_t n = a->n < RSAN ? a->n : RSAN;
+
+    if (n)
+        memcpy(buf, a->p, n * ciL);
+    memset(buf + n, 0, (RSAN - n) * ciL);
+}
+
+int tls_crypto_mbedtls_mont_open( const mbedtls_mpi *N )
+{
+    size_t len = (mbedtls_mpi_bitlen(N) + biL - 1) / biL;
+    u32 mc = 0;
+    mbedtls_mpi RR;
+    int ret = 0;
+
+    if (len == 0 || len * biL > MAX_HARD_EXPTMOD_BITLEN || mbedtls_mpi_get_bit(N, 0) == 0)
+        return MBEDTLS_ERR_MPI_BAD_INPUT_DATA;
+
+    mbedtls_mpi_init(&RR);
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &RR, 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &RR, 2 * len * biL ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &RR, &RR, N ) );
+
+    tls_open_peripheral_clock(TLS_PERIPHERAL_TYPE_RSA);
+#ifndef CONFIG_KERNEL_NONE
+    tls_fls_sem_lock();
+#endif
+
+    rsaCalMc(&mc, (u32)N->p[0]);
+    rsaMonMulSetLen((const u32)len);
+    rsaMonMulWriteMc(mc);
+    rsaMulModLoad(mont_rr, N);
+    rsaMonMulWriteM(mont_rr);
+    rsaMulModLoad(mont_rr, &RR);
+    mont_opened = 1;
+cleanup:
+    mbedtls_mpi_free(&RR);
+    return ret;
+}
+
+/* X = A * B mod N: the first pass leaves A * B * R^-1 (or A * R), the second one multiplies
+ * by R^2 (or B) to get rid of the Montgomery factor again */
+int tls_crypto_mbedtls_mont_mulmod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *B )
+{
+    u32 buf[64];
+    int ret = 0;
+
+    rsaMulModLoad(buf, A);
+    rsaMonMulWriteA(buf);
+    if (A == B)
+    {
+        rsaMonMulAA();
+        rsaMonMulWriteB(mont_rr);
+    }
+    else
+    {
+        rsaMonMulWriteB(mont_rr);
+        rsaMonMulAB();
+        rsaMulModLoad(buf, B);
+        rsaMonMulWriteB(buf);
+    }
+    rsaMonMulBD();
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, RSAN ) );
+    rsaMonMulReadA((u32 *)X->p);
+    memset(X->p + RSAN, 0, (X->n - RSAN) * ciL);
+    X->s = 1;
+cleanup:
+    return ret;
+}
+
+/* also called after a failed open (mbedtls_internal_ecp_free() runs on every exit path),
+ * which has taken neither the lock nor the clock */
+void tls_crypto_mbedtls_mont_close( void )
+{
+    if (!mont_opened)
+        return;
+    mont_opened = 0;
+    memset(mont_rr, 0, sizeof(mont_rr));
+#ifndef CONFIG_KERNEL_NONE
+    tls_fls_sem_unlock();
+#endif
+    tls_close_peripheral_clock(TLS_PERIPHERAL_TYPE_RSA);
+}
+
+/* Montgomery constants of the last public modulus seen by tls_crypto_mbedtls_exptmod_batch,
+ * in multiplier word order. Only public moduli end up here, the private key operations go
+ * through tls_crypto_mbedtls_exptmod and leave nothing behind. */
+static struct {
+    u32 len;
+    u32 mc;
+    u32 n[64];
+    u32 r[64];              /* R mod N */
+    u32 rr[64];             /* R^2 mod N */
+} mont_pub;
+
+/* load N into the multiplier, reusing mont_pub when N is the cached modulus */
+static int rsaMonMulLoadPub(const mbedtls_mpi *N, u32 len)
+{
+    u32 buf[64];
+    mbedtls_mpi RR;
+    int ret = 0;
+
+    rsaMonMulSetLen(len);
+    rsaMulModLoad(buf, N);
+    if (mont_pub.len == len && memcmp(mont_pub.n, buf, len * sizeof(u32)) == 0)
+    {
+        rsaMonMulWriteMc(mont_pub.mc);
+        rsaMonMulWriteM(mont_pub.n);
+        return 0;
+    }
+
+    mont_pub.len = 0;
+    mbedtls_mpi_init(&RR);
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &RR, 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &RR, 2 * len * biL ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &RR, &RR, N ) );
+
+    memcpy(mont_pub.n, buf, len * sizeof(u32));
+    rsaMulModLoad(mont_pub.rr, &RR);
+    rsaCalMc(&mont_pub.mc, mont_pub.n[0]);
+    rsaMonMulWriteMc(mont_pub.mc);
+    rsaMonMulWriteM(mont_pub.n);
+
+    /* R = R^2 * 1 * R^-1 */
+    memset(buf, 0, len * sizeof(u32));
+    buf[0] = 1;
+    rsaMonMulWriteA(mont_pub.rr);
+    rsaMonMulWriteB(buf);
+    rsaMonMulAB();
+    rsaMonMulReadD(mont_pub.r);
+    mont_pub.len = len;
+cleanup:
+    mbedtls_mpi_free(&RR);
+    return ret;
+}
+
+int tls_crypto_mbedtls_exptmod_batch( mbedtls_mpi *X, const mbedtls_mpi *A, size_t count,
+                                      const mbedtls_mpi *E, const mbedtls_mpi *N )
+{
+    u32 buf[64];
+    u32 len = (mbedtls_mpi_bitlen(N) + biL - 1) / biL;
+    size_t j;
+    int ret = 0;
+
+    if (len == 0 || len * biL > MAX_HARD_EXPTMOD_BITLEN || mbedtls_mpi_get_bit(N, 0) == 0)
+        return MBEDTLS_ERR_MPI_BAD_INPUT_DATA;
+
+    tls_open_peripheral_clock(TLS_PERIPHERAL_TYPE_RSA);
+#ifndef CONFIG_KERNEL_NONE
+    tls_fls_sem_lock();
+#endif
+
+    MBEDTLS_MPI_CHK( rsaMonMulLoadPub(N, len) );
+
+    for (j = 0; j < count; j++)
+    {
+        if (mbedtls_mpi_cmp_int(&A[j], 0) < 0 || mbedtls_mpi_cmp_mpi(&A[j], N) >= 0)
+        {
+            ret = MBEDTLS_ERR_MPI_BAD_INPUT_DATA;
+            goto cleanup;
+        }
+
+        /* base: A * R^2 * R^-1 = A * R, moved to B; running value: R (Montgomery 1) in A */
+        rsaMulModLoad(buf, &A[j]);
+        rsaMonMulWriteA(buf);
+        rsaMonMulWriteB(mont_pub.rr);
+        rsaMonMulAB();
+        rsaMonMulReadD(buf);
+        rsaMonMulWriteB(buf);
+        rsaMonMulWriteA(mont_pub.r);
+
+        memset(buf, 0, len * sizeof(u32));
+        buf[0] = 1;
+        if (rsaMonMulExp(E) == 0)
+        {
+            rsaMonMulWriteB(buf);
+            rsaMonMulAB();
+            MBEDTLS_MPI_CHK( rsaMulModRead('D', &X[j]) );
+        }
+        else
+        {
+            rsaMonMulWriteB(buf);
+            rsaMonMulBD();
+            MBEDTLS_MPI_CHK( rsaMulModRead('A', &X[j]) );
+        }
+    }
+cleanup:
+#ifndef CONFIG_KERNEL_NONE
+    tls_fls_sem_unlock();
+#endif
+    tls_close_peripheral_clock(TLS_PERIPHERAL_TYPE_RSA);
+
+    return ret;
+}
+
 #if 0
 #if 1
 typedef s32 psPool_t;
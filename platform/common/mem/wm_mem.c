@@ -702,7 +702,7 @@ void * mem_realloc_debug(void *mem_address, u32 size)
 	return mem_re_addr;
 }
 
-void *mem_calloc_debug(u32 n, u32 size)
+void *mem_calloc_debug(size_t n, size_t size)
 {
     u32 cpu_sr = 0;
     u32 *buffer = NULL;
@@ -178,7 +178,8 @@ ATTRIBUTE_ISR void HSPI_IRQHandler(void)
 
 ATTRIBUTE_ISR void SDIOA_IRQHandler(void)
 {
-	u32 int_src = tls_reg_read32(HR_SDIO_INT_SRC);
+	/* masked sources stay latched, they are polled by their owner */
+	u32 int_src = tls_reg_read32(HR_SDIO_INT_SRC) & ~tls_reg_read32(HR_SDIO_INT_MASK);
 	csi_kernel_intrpt_enter();
 	if(int_src & SDIO_WP_INT_SRC_CMD_DOWN)
 	{
@@ -207,6 +208,32 @@ void hspi_free_rxdesc(struct tls_hspi_rx_desc *rx_desc)
 }
 
 
+void tls_hspi_irq_mask(u32 int_src)
+{
+    u32 cpu_sr;
+
+    cpu_sr = tls_os_set_critical();
+    tls_reg_write32(HR_SDIO_INT_MASK, tls_reg_read32(HR_SDIO_INT_MASK) | int_src);
+    tls_os_release_critical(cpu_sr);
+}
+
+void tls_hspi_irq_unmask(u32 int_src, bool clear)
+{
+    u32 cpu_sr;
+
+    cpu_sr = tls_os_set_critical();
+    if (clear)
+        tls_reg_write32(HR_SDIO_INT_SRC, int_src);
+    tls_reg_write32(HR_SDIO_INT_MASK, tls_reg_read32(HR_SDIO_INT_MASK) & ~int_src);
+    tls_os_release_critical(cpu_sr);
+}
+
+void tls_hspi_set_rx_coalesce(u8 frames, u32 msecs)
+{
+    g_slave_hspi.rx_coal_frames = frames;
+    g_slave_hspi.rx_coal_msecs = msecs;
+}
+
 void hspi_regs_cfg(void)
 {
     tls_reg_write32(HR_HSPI_CLEAR_FIFO, 0x1);   /* Clear data up&down interrput
@@ -270,6 +297,12 @@ int tls_slave_spi_init(void)
 {
     struct tls_slave_hspi *hspi;
 
+    if (SDIO_CMD_RXBUF_END > SLAVE_HSPI_SDIO_ADDR + SLAVE_HSPI_MAX_SIZE)
+    {
+        printf("\nhspi buffers exceed SLAVE_HSPI_MAX_SIZE\n");
+        return -1;
+    }
+
     hspi = &g_slave_hspi;
     memset(hspi, 0, sizeof(struct tls_slave_hspi));
 
@@ -525,35 +525,36 @@ void tls_set_uart_rx_status(int uart_no, int status)
     u32 cpu_sr;
     struct tls_uart_port *port;
 
-    if (TLS_UART_1 == uart_no)
+    // UART1~4 can lend their ring in transparent mode
+    if (uart_no < TLS_UART_1 || uart_no > TLS_UART_4)
+        return;
+
+    port = &uart_port[uart_no];
+    if ((TLS_UART_RX_DISABLE == port->rxstatus
+         && TLS_UART_RX_DISABLE == status)
+        || (TLS_UART_RX_ENABLE == port->rxstatus
+            && TLS_UART_RX_ENABLE == status))
+        return;
+
+    if (TLS_UART_RX_DISABLE == status)
     {
-        port = &uart_port[1];
-        if ((TLS_UART_RX_DISABLE == port->rxstatus
-             && TLS_UART_RX_DISABLE == status)
-            || (TLS_UART_RX_ENABLE == port->rxstatus
-                && TLS_UART_RX_ENABLE == status))
-            return;
-
-        if (TLS_UART_RX_DISABLE == status)
-        {
-            if ((TLS_UART_FLOW_CTRL_HARDWARE == port->opts.flow_ctrl)
-                && (TLS_UART_FLOW_CTRL_HARDWARE == port->fcStatus))
-            {
-                cpu_sr = tls_os_set_critical();
-                // 关rxfifo trigger level interrupt和overrun error
-                port->regs->UR_INTM |= ((0x1 << 2) | (0x01 << 8));
-                port->rxstatus = TLS_UART_RX_DISABLE;
-                tls_os_release_critical(cpu_sr);
-            }
-        }
-        else
+        if ((TLS_UART_FLOW_CTRL_HARDWARE == port->opts.flow_ctrl)
+            && (TLS_UART_FLOW_CTRL_HARDWARE == port->fcStatus))
         {
             cpu_sr = tls_os_set_critical();
-            uart_port[1].regs->UR_INTM &= ~((0x1 << 2) | (0x01 << 8));
-            port->rxstatus = TLS_UART_RX_ENABLE;
+            // 关rxfifo trigger level interrupt和overrun error
+            port->regs->UR_INTM |= ((0x1 << 2) | (0x01 << 8));
+            port->rxstatus = TLS_UART_RX_DISABLE;
             tls_os_release_critical(cpu_sr);
         }
     }
+    else
+    {
+        cpu_sr = tls_os_set_critical();
+        port->regs->UR_INTM &= ~((0x1 << 2) | (0x01 << 8));
+        port->rxstatus = TLS_UART_RX_ENABLE;
+        tls_os_release_critical(cpu_sr);
+    }
 }
 
 ATTRIBUTE_ISR void UART0_IRQHandler(void)
@@ -672,7 +673,14 @@ ATTRIBUTE_ISR void UART1_IRQHandler(void)
         
         if (CIRC_SPACE(recv->head, recv->tail, TLS_UART_RX_BUF_SIZE) <= RX_CACHE_LIMIT)
         {
-            recv->tail = (recv->tail + RX_CACHE_LIMIT) & (TLS_UART_RX_BUF_SIZE - 1);
+            if (!port->rx_hold)
+            {
+                recv->tail = (recv->tail + RX_CACHE_LIMIT) & (TLS_UART_RX_BUF_SIZE - 1);
+            }
+            else if (TLS_UART_FLOW_CTRL_HARDWARE == port->fcStatus)
+            {
+                tls_set_uart_rx_status(port->uart_no, TLS_UART_RX_DISABLE);
+            }
         }
 
         if (intr_src & UART_RX_ERR_INT_FLAG)
@@ -691,6 +699,10 @@ ATTRIBUTE_ISR void UART1_IRQHandler(void)
 	        while (rx_fifocnt-- > 0)
 	        {
 	            ch = (u8) port->regs->UR_RXW;
+	            if (port->rx_hold && 0 == CIRC_SPACE(recv->head, recv->tail, TLS_UART_RX_BUF_SIZE))
+	            {
+	                continue;
+	            }
 	            recv->buf[recv->head] = ch;
 	            recv->head = (recv->head + 1) & (TLS_UART_RX_BUF_SIZE - 1);
 				if(port->rx_callback != NULL && rx_byte_cb_flag)
@@ -784,7 +796,14 @@ ATTRIBUTE_ISR void UART2_4_IRQHandler(void)
         
         if (CIRC_SPACE(recv->head, recv->tail, TLS_UART_RX_BUF_SIZE) <= RX_CACHE_LIMIT)
         {
-            recv->tail = (recv->tail + RX_CACHE_LIMIT) & (TLS_UART_RX_BUF_SIZE - 1);
+            if (!port->rx_hold)
+            {
+                recv->tail = (recv->tail + RX_CACHE_LIMIT) & (TLS_UART_RX_BUF_SIZE - 1);
+            }
+            else if (TLS_UART_FLOW_CTRL_HARDWARE == port->fcStatus)
+            {
+                tls_set_uart_rx_status(port->uart_no, TLS_UART_RX_DISABLE);
+            }
         }
         
         while (rx_fifocnt-- > 0)
@@ -796,6 +815,10 @@ ATTRIBUTE_ISR void UART2_4_IRQHandler(void)
                 TLS_DBGPRT_INFO("\nrx err=%x,c=%d,ch=%x\n", intr_src, rx_fifocnt, ch);
                 continue;
             }
+            if (port->rx_hold && 0 == CIRC_SPACE(recv->head, recv->tail, TLS_UART_RX_BUF_SIZE))
+            {
+                continue;
+            }
             recv->buf[recv->head] = ch;
             recv->head = (recv->head + 1) & (TLS_UART_RX_BUF_SIZE - 1);
             if(port->rx_callback != NULL && rx_byte_cb_flag)
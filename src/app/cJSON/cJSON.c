@@ -46,10 +46,22 @@ static int cJSON_strcasecmp(const char *s1,const char *s2)
 
 //static void *(*cJSON_malloc)(size_t sz) = malloc;
 //static void (*cJSON_free)(void *ptr) = free;
+
 #define cJSON_malloc tls_mem_alloc
 #define cJSON_free tls_mem_free
-#define cJSON_strdup strdup
-#if 0
+
+/* Parser allocations: from arena, or from the heap when arena is 0. */
+static void *cJSON_arena_alloc(cJSON_Arena *arena,size_t sz)
+{
+	char *ptr;
+	if (!arena) return cJSON_malloc(sz);
+	sz=(sz+7)&~7;	/* keep doubles aligned */
+	if (sz>arena->size-arena->used) return 0;	/* no fallback to the heap: the arena must free everything */
+	ptr=arena->base+arena->used;
+	arena->used+=sz;
+	return ptr;
+}
+
 static char* cJSON_strdup(const char* str)
 {
       size_t len;
@@ -60,6 +72,38 @@ static char* cJSON_strdup(const char* str)
       memcpy(copy,str,len);
       return copy;
 }
+
+int cJSON_ArenaInit(cJSON_Arena *arena,void *buf,unsigned int size)
+{
+	char *base;
+	memset(arena,0,sizeof(cJSON_Arena));
+	if (!buf)
+	{
+		buf=tls_mem_alloc(size);
+		if (!buf) return -1;
+		arena->block=buf;
+	}
+	base=(char*)(((unsigned long)buf+7)&~7UL);
+	if (size<(unsigned int)(base-(char*)buf)+sizeof(cJSON))	/* not even one item after the alignment */
+	{
+		if (arena->block) tls_mem_free(arena->block);
+		arena->block=0;
+		return -1;
+	}
+	arena->base=base;
+	arena->size=size-(base-(char*)buf);
+	return 0;
+}
+
+void cJSON_ArenaReset(cJSON_Arena *arena)	{arena->used=0;}
+
+void cJSON_ArenaFree(cJSON_Arena *arena)
+{
+	if (arena->block) tls_mem_free(arena->block);
+	memset(arena,0,sizeof(cJSON_Arena));
+}
+
+#if 0
 void cJSON_InitHooks(cJSON_Hooks* hooks)
 {
     if (!hooks) { /* Reset hooks */
@@ -80,6 +124,14 @@ static cJSON *cJSON_New_Item(void)
 	return node;
 }
 
+/* Parser constructor: arena items are marked so that cJSON_Delete leaves them to their arena. */
+static cJSON *cJSON_New_Parsed_Item(cJSON_Arena *arena)
+{
+	cJSON* node = (cJSON*)cJSON_arena_alloc(arena,sizeof(cJSON));
+	if (node) {memset(node,0,sizeof(cJSON));if (arena) node->type=cJSON_InArena|cJSON_NameInArena;}
+	return node;
+}
+
 /* Delete a cJSON structure. */
 void cJSON_Delete(cJSON *c)
 {
@@ -88,9 +140,9 @@ void cJSON_Delete(cJSON *c)
 	{
 		next=c->next;
 		if (!(c->type&cJSON_IsReference) && c->child) cJSON_Delete(c->child);
-		if (!(c->type&cJSON_IsReference) && c->valuestring) cJSON_free(c->valuestring);
-		if (c->string) cJSON_free(c->string);
-		cJSON_free(c);
+		if (!(c->type&(cJSON_IsReference|cJSON_InArena)) && c->valuestring) cJSON_free(c->valuestring);
+		if (!(c->type&cJSON_NameInArena) && c->string) cJSON_free(c->string);
+		if (!(c->type&cJSON_InArena)) cJSON_free(c);
 		c=next;
 	}
 }
@@ -113,7 +165,7 @@ static const char *parse_number(cJSON *item,const char *num)
 	
 	item->valuedouble=n;
 	item->valueint=(int)n;
-	item->type=cJSON_Number;
+	item->type|=cJSON_Number;
 	return num;
 }
 
@@ -155,14 +207,14 @@ static unsigned parse_hex4(const char *str)
 
 /* Parse the input text into an unescaped cstring, and populate item. */
 static const unsigned char firstByteMark[7] = { 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC };
-static const char *parse_string(cJSON *item,const char *str)
+static const char *parse_string(cJSON *item,const char *str,cJSON_Arena *arena)
 {
 	const char *ptr=str+1;char *ptr2;char *out;int len=0;unsigned uc,uc2;
 	if (*str!='\"') {ep=str;return 0;}	/* not a string! */
 	
 	while (*ptr!='\"' && *ptr && ++len) if (*ptr++ == '\\') ptr++;	/* Skip escaped quotes. */
 	
-	out=(char*)cJSON_malloc(len+1);	/* This is how long we need for the string, roughly. */
+	out=(char*)cJSON_arena_alloc(arena,len+1);	/* This is how long we need for the string, roughly. */
 	if (!out) return 0;
 	
 	ptr=str+1;ptr2=out;
@@ -210,7 +262,7 @@ static const char *parse_string(cJSON *item,const char *str)
 	*ptr2=0;
 	if (*ptr=='\"') ptr++;
 	item->valuestring=out;
-	item->type=cJSON_String;
+	item->type|=cJSON_String;
 	return ptr;
 }
 
@@ -253,50 +305,57 @@ static char *print_string_ptr(const char *str)
 static char *print_string(cJSON *item)	{return print_string_ptr(item->valuestring);}
 
 /* Predeclare these prototypes. */
-static const char *parse_value(cJSON *item,const char *value);
+static const char *parse_value(cJSON *item,const char *value,cJSON_Arena *arena);
 static char *print_value(cJSON *item,int depth,int fmt);
-static const char *parse_array(cJSON *item,const char *value);
+static const char *parse_array(cJSON *item,const char *value,cJSON_Arena *arena);
 static char *print_array(cJSON *item,int depth,int fmt);
-static const char *parse_object(cJSON *item,const char *value);
+static const char *parse_object(cJSON *item,const char *value,cJSON_Arena *arena);
 static char *print_object(cJSON *item,int depth,int fmt);
 
 /* Utility to jump whitespace and cr/lf */
 static const char *skip(const char *in) {while (in && *in && (unsigned char)*in<=32) in++; return in;}
 
 /* Parse an object - create a new root, and populate. */
-cJSON *cJSON_ParseWithOpts(const char *value,const char **return_parse_end,int require_null_terminated)
+static cJSON *parse_root(const char *value,const char **return_parse_end,int require_null_terminated,cJSON_Arena *arena)
 {
 	const char *end=0;
-	cJSON *c=cJSON_New_Item();
+	unsigned int used=arena?arena->used:0;
+	cJSON *c=cJSON_New_Parsed_Item(arena);
 	ep=0;
 	if (!c) return 0;       /* memory fail */
 
-	end=parse_value(c,skip(value));
-	if (!end)	{cJSON_Delete(c);return 0;}	/* parse failure. ep is set. */
-
+	end=parse_value(c,skip(value),arena);
 	/* if we require null-terminated JSON without appended garbage, skip and then check for a null terminator */
-	if (require_null_terminated) {end=skip(end);if (*end) {cJSON_Delete(c);ep=end;return 0;}}
+	if (end && require_null_terminated) {end=skip(end);if (*end) {ep=end;end=0;}}
+	if (!end)	/* parse failure. ep is set. */
+	{
+		if (arena) arena->used=used;	/* drop the partial tree */
+		else cJSON_Delete(c);
+		return 0;
+	}
 	if (return_parse_end) *return_parse_end=end;
 	return c;
 }
+cJSON *cJSON_ParseWithOpts(const char *value,const char **return_parse_end,int require_null_terminated) {return parse_root(value,return_parse_end,require_null_terminated,0);}
 /* Default options for cJSON_Parse */
 cJSON *cJSON_Parse(const char *value) {return cJSON_ParseWithOpts(value,0,0);}
+cJSON *cJSON_ParseInArena(cJSON_Arena *arena,const char *value) {return parse_root(value,0,0,arena);}
 
 /* Render a cJSON item/entity/structure to text. */
 char *cJSON_Print(cJSON *item)				{return print_value(item,0,1);}
 char *cJSON_PrintUnformatted(cJSON *item)	{return print_value(item,0,0);}
 
 /* Parser core - when encountering text, process appropriately. */
-static const char *parse_value(cJSON *item,const char *value)
+static const char *parse_value(cJSON *item,const char *value,cJSON_Arena *arena)
 {
 	if (!value)						return 0;	/* Fail on null. */
-	if (!strncmp(value,"null",4))	{ item->type=cJSON_NULL;  return value+4; }
-	if (!strncmp(value,"false",5))	{ item->type=cJSON_False; return value+5; }
-	if (!strncmp(value,"true",4))	{ item->type=cJSON_True; item->valueint=1;	return value+4; }
-	if (*value=='\"')				{ return parse_string(item,value); }
+	if (!strncmp(value,"null",4))	{ item->type|=cJSON_NULL;  return value+4; }
+	if (!strncmp(value,"false",5))	{ item->type|=cJSON_False; return value+5; }
+	if (!strncmp(value,"true",4))	{ item->type|=cJSON_True; item->valueint=1;	return value+4; }
+	if (*value=='\"')				{ return parse_string(item,value,arena); }
 	if (*value=='-' || (*value>='0' && *value<='9'))	{ return parse_number(item,value); }
-	if (*value=='[')				{ return parse_array(item,value); }
-	if (*value=='{')				{ return parse_object(item,value); }
+	if (*value=='[')				{ return parse_array(item,value,arena); }
+	if (*value=='{')				{ return parse_object(item,value,arena); }
 
 	ep=value;return 0;	/* failure. */
 }
@@ -320,26 +379,26 @@ static char *print_value(cJSON *item,int depth,int fmt)
 }
 
 /* Build an array from input text. */
-static const char *parse_array(cJSON *item,const char *value)
+static const char *parse_array(cJSON *item,const char *value,cJSON_Arena *arena)
 {
 	cJSON *child;
 	if (*value!='[')	{ep=value;return 0;}	/* not an array! */
 
-	item->type=cJSON_Array;
+	item->type|=cJSON_Array;
 	value=skip(value+1);
 	if (*value==']') return value+1;	/* empty array. */
 
-	item->child=child=cJSON_New_Item();
+	item->child=child=cJSON_New_Parsed_Item(arena);
 	if (!item->child) return 0;		 /* memory fail */
-	value=skip(parse_value(child,skip(value)));	/* skip any spacing, get the value. */
+	value=skip(parse_value(child,skip(value),arena));	/* skip any spacing, get the value. */
 	if (!value) return 0;
 
 	while (*value==',')
 	{
 		cJSON *new_item;
-		if (NULL == (new_item=cJSON_New_Item())) return 0; 	/* memory fail */
+		if (NULL == (new_item=cJSON_New_Parsed_Item(arena))) return 0; 	/* memory fail */
 		child->next=new_item;new_item->prev=child;child=new_item;
-		value=skip(parse_value(child,skip(value+1)));
+		value=skip(parse_value(child,skip(value+1),arena));
 		if (!value) return 0;	/* memory fail */
 	}
 
@@ -406,34 +465,34 @@ static char *print_array(cJSON *item,int depth,int fmt)
 }
 
 /* Build an object from the text. */
-static const char *parse_object(cJSON *item,const char *value)
+static const char *parse_object(cJSON *item,const char *value,cJSON_Arena *arena)
 {
 	cJSON *child;
 	if (*value!='{')	{ep=value;return 0;}	/* not an object! */
 	
-	item->type=cJSON_Object;
+	item->type|=cJSON_Object;
 	value=skip(value+1);
 	if (*value=='}') return value+1;	/* empty array. */
 	
-	item->child=child=cJSON_New_Item();
+	item->child=child=cJSON_New_Parsed_Item(arena);
 	if (!item->child) return 0;
-	value=skip(parse_string(child,skip(value)));
+	value=skip(parse_string(child,skip(value),arena));
 	if (!value) return 0;
-	child->string=child->valuestring;child->valuestring=0;
+	child->string=child->valuestring;child->valuestring=0;child->type&=~255;
 	if (*value!=':') {ep=value;return 0;}	/* fail! */
-	value=skip(parse_value(child,skip(value+1)));	/* skip any spacing, get the value. */
+	value=skip(parse_value(child,skip(value+1),arena));	/* skip any spacing, get the value. */
 	if (!value) return 0;
 	
 	while (*value==',')
 	{
 		cJSON *new_item;
-		if (NULL == (new_item=cJSON_New_Item()))	return 0; /* memory fail */
+		if (NULL == (new_item=cJSON_New_Parsed_Item(arena)))	return 0; /* memory fail */
 		child->next=new_item;new_item->prev=child;child=new_item;
-		value=skip(parse_string(child,skip(value+1)));
+		value=skip(parse_string(child,skip(value+1),arena));
 		if (!value) return 0;
-		child->string=child->valuestring;child->valuestring=0;
+		child->string=child->valuestring;child->valuestring=0;child->type&=~255;
 		if (*value!=':') {ep=value;return 0;}	/* fail! */
-		value=skip(parse_value(child,skip(value+1)));	/* skip any spacing, get the value. */
+		value=skip(parse_value(child,skip(value+1),arena));	/* skip any spacing, get the value. */
 		if (!value) return 0;
 	}
 	
@@ -517,11 +576,11 @@ cJSON *cJSON_GetObjectItem(cJSON *object,const char *string)	{cJSON *c=object->c
 /* Utility for array list handling. */
 static void suffix_object(cJSON *prev,cJSON *item) {prev->next=item;item->prev=prev;}
 /* Utility for handling references. */
-static cJSON *create_reference(cJSON *item) {cJSON *ref=cJSON_New_Item();if (!ref) return 0;memcpy(ref,item,sizeof(cJSON));ref->string=0;ref->type|=cJSON_IsReference;ref->next=ref->prev=0;return ref;}
+static cJSON *create_reference(cJSON *item) {cJSON *ref=cJSON_New_Item();if (!ref) return 0;memcpy(ref,item,sizeof(cJSON));ref->string=0;ref->type=(ref->type|cJSON_IsReference)&~(cJSON_InArena|cJSON_NameInArena);ref->next=ref->prev=0;return ref;}
 
 /* Add item to array/object. */
 void   cJSON_AddItemToArray(cJSON *array, cJSON *item)						{cJSON *c=array->child;if (!item) return; if (!c) {array->child=item;} else {while (c && c->next) c=c->next; suffix_object(c,item);}}
-void   cJSON_AddItemToObject(cJSON *object,const char *string,cJSON *item)	{if (!item) return; if (item->string) cJSON_free(item->string);item->string=cJSON_strdup(string);cJSON_AddItemToArray(object,item);}
+void   cJSON_AddItemToObject(cJSON *object,const char *string,cJSON *item)	{if (!item) return; if (item->string && !(item->type&cJSON_NameInArena)) cJSON_free(item->string);item->type&=~cJSON_NameInArena;item->string=cJSON_strdup(string);cJSON_AddItemToArray(object,item);}
 void	cJSON_AddItemReferenceToArray(cJSON *array, cJSON *item)						{cJSON_AddItemToArray(array,create_reference(item));}
 void	cJSON_AddItemReferenceToObject(cJSON *object,const char *string,cJSON *item)	{cJSON_AddItemToObject(object,string,create_reference(item));}
 
@@ -535,7 +594,7 @@ void   cJSON_DeleteItemFromObject(cJSON *object,const char *string) {cJSON_Delet
 void   cJSON_ReplaceItemInArray(cJSON *array,int which,cJSON *newitem)		{cJSON *c=array->child;while (c && which>0) c=c->next,which--;if (!c) return;
 	newitem->next=c->next;newitem->prev=c->prev;if (newitem->next) newitem->next->prev=newitem;
 	if (c==array->child) array->child=newitem; else newitem->prev->next=newitem;c->next=c->prev=0;cJSON_Delete(c);}
-void   cJSON_ReplaceItemInObject(cJSON *object,const char *string,cJSON *newitem){int i=0;cJSON *c=object->child;while(c && cJSON_strcasecmp(c->string,string))i++,c=c->next;if(c){newitem->string=cJSON_strdup(string);cJSON_ReplaceItemInArray(object,i,newitem);}}
+void   cJSON_ReplaceItemInObject(cJSON *object,const char *string,cJSON *newitem){int i=0;cJSON *c=object->child;while(c && cJSON_strcasecmp(c->string,string))i++,c=c->next;if(c){newitem->type&=~cJSON_NameInArena;newitem->string=cJSON_strdup(string);cJSON_ReplaceItemInArray(object,i,newitem);}}
 
 /* Create basic types: */
 cJSON *cJSON_CreateNull(void)					{cJSON *item=cJSON_New_Item();if(item)item->type=cJSON_NULL;return item;}
@@ -563,7 +622,7 @@ cJSON *cJSON_Duplicate(cJSON *item,int recurse)
 	newitem=cJSON_New_Item();
 	if (!newitem) return 0;
 	/* Copy over all vars */
-	newitem->type=item->type&(~cJSON_IsReference),newitem->valueint=item->valueint,newitem->valuedouble=item->valuedouble;
+	newitem->type=item->type&(~(cJSON_IsReference|cJSON_InArena|cJSON_NameInArena)),newitem->valueint=item->valueint,newitem->valuedouble=item->valuedouble;
 	if (item->valuestring)	{newitem->valuestring=cJSON_strdup(item->valuestring);	if (!newitem->valuestring)	{cJSON_Delete(newitem);return 0;}}
 	if (item->string)		{newitem->string=cJSON_strdup(item->string);			if (!newitem->string)		{cJSON_Delete(newitem);return 0;}}
 	/* If non-recursive, then we're done! */
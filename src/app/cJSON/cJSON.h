@@ -38,6 +38,8 @@ extern "C"
 #define cJSON_Object 6
 	
 #define cJSON_IsReference 256
+#define cJSON_InArena 512			/* Item and its value string live in an arena (cJSON_ParseInArena). */
+#define cJSON_NameInArena 1024		/* The item's name lives in an arena. */
 
 /* The cJSON structure: */
 typedef struct cJSON {
@@ -62,6 +64,24 @@ typedef struct cJSON_Hooks {
 extern void cJSON_InitHooks(cJSON_Hooks* hooks);
 #endif
 
+/* Arena: a single block that items are carved from, so that a whole document is freed in one call. */
+typedef struct cJSON_Arena {
+	char *base;
+	unsigned int size;
+	unsigned int used;
+	void *block;				/* Allocated by cJSON_ArenaInit, freed by cJSON_ArenaFree. */
+} cJSON_Arena;
+
+/* Set up an arena on buf (size bytes), or on a block allocated here when buf is 0. Returns 0 on success, -1 when the block cannot be had or is too small. */
+extern int cJSON_ArenaInit(cJSON_Arena *arena,void *buf,unsigned int size);
+/* Release every item of the arena at once and stop using it. */
+extern void cJSON_ArenaFree(cJSON_Arena *arena);
+/* Release every item of the arena at once, the arena can be used again. */
+extern void cJSON_ArenaReset(cJSON_Arena *arena);
+/* cJSON_Parse into arena: every item of the tree is marked cJSON_InArena. There is no fallback to the heap once the arena is full.
+   cJSON_Delete walks the tree but leaves arena items to the arena, so heap items added to it are still freed. */
+extern cJSON *cJSON_ParseInArena(cJSON_Arena *arena,const char *value);
+
 /* Supply a block of JSON, and this returns a cJSON object you can interrogate. Call cJSON_Delete when finished. */
 extern cJSON *cJSON_Parse(const char *value);
 /* Render a cJSON entity to text for transfer/storage. Free the char* when finished. */
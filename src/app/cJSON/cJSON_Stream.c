@@ -0,0 +1,411 @@
+/*
+  Copyright (c) 2009 Dave Gamble
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+*/
+
+/* Streaming JSON tokenizer and writer. */
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+#include <limits.h>
+#include "cJSON_Stream.h"
+
+/* Tokenizer states. */
+#define ST_VALUE			0	/* value expected */
+#define ST_VALUE_OR_CLOSE	1	/* after '[' */
+#define ST_KEY				2	/* after ',' in an object */
+#define ST_KEY_OR_CLOSE		3	/* after '{' */
+#define ST_COLON			4
+#define ST_NEXT				5	/* after a value: ',' or closing bracket */
+#define ST_STRING			6
+#define ST_ESCAPE			7
+#define ST_UNICODE			8
+#define ST_NUMBER			9
+#define ST_LITERAL			10
+#define ST_DONE				11
+#define ST_ERROR			12
+
+#define IS_SPACE(c)	((unsigned char)(c)<=32)
+#define IN_OBJECT(n,d)	((n)&(1u<<((d)-1)))
+
+static const unsigned char firstByteMark[7] = { 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC };
+
+void cJSON_StreamInit(cJSON_Stream *s,cJSON_TokenFn token,void *ctx)
+{
+	memset(s,0,sizeof(cJSON_Stream));
+	s->token=token;s->ctx=ctx;
+	s->state=ST_VALUE;
+}
+
+static int stream_push(cJSON_Stream *s,char c)
+{
+	if (s->len>=CJSON_STREAM_TOKEN_MAX) return -1;	/* token too long */
+	s->buf[s->len++]=c;
+	return 0;
+}
+
+static int stream_emit(cJSON_Stream *s,int type)
+{
+	int ret;
+	s->buf[s->len]=0;
+	ret=s->token(s->ctx,type,s->buf,s->len,s->depth);
+	s->len=0;
+	return ret?-1:0;
+}
+
+/* A complete value was read at the current depth. */
+static void stream_value_done(cJSON_Stream *s)	{s->state=s->depth?ST_NEXT:ST_DONE;}
+
+static int stream_open(cJSON_Stream *s,int object)
+{
+	if (s->depth>=CJSON_STREAM_MAX_DEPTH) return -1;
+	if (stream_emit(s,object?cJSON_TokObjectStart:cJSON_TokArrayStart)) return -1;
+	if (object) s->nesting|=1u<<s->depth; else s->nesting&=~(1u<<s->depth);
+	s->depth++;
+	s->state=object?ST_KEY_OR_CLOSE:ST_VALUE_OR_CLOSE;
+	return 0;
+}
+
+static int stream_close(cJSON_Stream *s,int object)
+{
+	if (!s->depth || !IN_OBJECT(s->nesting,s->depth)!=!object) return -1;	/* mismatched bracket */
+	s->depth--;
+	if (stream_emit(s,object?cJSON_TokObjectEnd:cJSON_TokArrayEnd)) return -1;
+	stream_value_done(s);
+	return 0;
+}
+
+static int stream_value(cJSON_Stream *s,char c)
+{
+	switch (c)
+	{
+		case '{':	return stream_open(s,1);
+		case '[':	return stream_open(s,0);
+		case ']':	if (s->state!=ST_VALUE_OR_CLOSE) return -1; return stream_close(s,0);
+		case '\"':	s->in_key=0;s->state=ST_STRING;return 0;
+		case 't': case 'f': case 'n':	s->state=ST_LITERAL;return stream_push(s,c);
+	}
+	if (c=='-' || (c>='0' && c<='9'))	{s->state=ST_NUMBER;return stream_push(s,c);}
+	return -1;
+}
+
+/* Append a code point as UTF-8. */
+static int stream_utf8(cJSON_Stream *s,unsigned uc)
+{
+	char out[4];int len,i;
+	len=4;if (uc<0x80) len=1;else if (uc<0x800) len=2;else if (uc<0x10000) len=3;
+	for (i=len-1;i>0;i--) {out[i]=(char)((uc|0x80)&0xBF);uc>>=6;}
+	out[0]=(char)(uc|firstByteMark[len]);
+	for (i=0;i<len;i++) if (stream_push(s,out[i])) return -1;
+	return 0;
+}
+
+static int stream_unicode(cJSON_Stream *s)
+{
+	unsigned uc=s->uc;
+	if (uc>=0xD800 && uc<=0xDBFF)	{s->surrogate=uc;return 0;}	/* first half of a UTF16 surrogate pair */
+	if (uc>=0xDC00 && uc<=0xDFFF)
+	{
+		if (!s->surrogate) return -1;
+		uc=0x10000 + (((s->surrogate&0x3FF)<<10) | (uc&0x3FF));
+	}
+	s->surrogate=0;
+	if (uc==0) return -1;
+	return stream_utf8(s,uc);
+}
+
+/* Number and literal tokens end at the first character that is not part of them. */
+static int stream_end_scalar(cJSON_Stream *s)
+{
+	int type;
+	if (s->state==ST_NUMBER) type=cJSON_TokNumber;
+	else
+	{
+		s->buf[s->len]=0;
+		if (!strcmp(s->buf,"true")) type=cJSON_TokTrue;
+		else if (!strcmp(s->buf,"false")) type=cJSON_TokFalse;
+		else if (!strcmp(s->buf,"null")) type=cJSON_TokNull;
+		else return -1;
+	}
+	if (stream_emit(s,type)) return -1;
+	stream_value_done(s);
+	return 0;
+}
+
+static int stream_char(cJSON_Stream *s,char c)
+{
+	switch (s->state)
+	{
+		case ST_VALUE:
+		case ST_VALUE_OR_CLOSE:
+			if (IS_SPACE(c)) return 0;
+			return stream_value(s,c);
+		case ST_KEY:
+		case ST_KEY_OR_CLOSE:
+			if (IS_SPACE(c)) return 0;
+			if (c=='\"')	{s->in_key=1;s->state=ST_STRING;return 0;}
+			if (c=='}' && s->state==ST_KEY_OR_CLOSE) return stream_close(s,1);
+			return -1;
+		case ST_COLON:
+			if (IS_SPACE(c)) return 0;
+			if (c!=':') return -1;
+			s->state=ST_VALUE;
+			return 0;
+		case ST_NEXT:
+			if (IS_SPACE(c)) return 0;
+			if (c==',')	{s->state=IN_OBJECT(s->nesting,s->depth)?ST_KEY:ST_VALUE;return 0;}
+			if (c=='}' || c==']') return stream_close(s,c=='}');
+			return -1;
+		case ST_STRING:
+			if (c=='\"')
+			{
+				if (s->surrogate) return -1;
+				if (s->in_key)	{s->state=ST_COLON;return stream_emit(s,cJSON_TokKey);}
+				if (stream_emit(s,cJSON_TokString)) return -1;
+				stream_value_done(s);
+				return 0;
+			}
+			if (c=='\\')	{s->state=ST_ESCAPE;return 0;}
+			if ((unsigned char)c<32 || s->surrogate) return -1;
+			return stream_push(s,c);
+		case ST_ESCAPE:
+			s->state=ST_STRING;
+			if (s->surrogate && c!='u') return -1;
+			switch (c)
+			{
+				case 'b': return stream_push(s,'\b');
+				case 'f': return stream_push(s,'\f');
+				case 'n': return stream_push(s,'\n');
+				case 'r': return stream_push(s,'\r');
+				case 't': return stream_push(s,'\t');
+				case '\"': case '\\': case '/': return stream_push(s,c);
+				case 'u': s->state=ST_UNICODE;s->hex=0;s->uc=0;return 0;
+			}
+			return -1;
+		case ST_UNICODE:
+			if (c>='0' && c<='9') s->uc=(s->uc<<4)+(c-'0');
+			else if (c>='A' && c<='F') s->uc=(s->uc<<4)+10+(c-'A');
+			else if (c>='a' && c<='f') s->uc=(s->uc<<4)+10+(c-'a');
+			else return -1;
+			if (++s->hex<4) return 0;
+			s->state=ST_STRING;
+			return stream_unicode(s);
+		case ST_NUMBER:
+			if ((c>='0' && c<='9') || c=='.' || c=='e' || c=='E' || c=='+' || c=='-') return stream_push(s,c);
+			if (stream_end_scalar(s)) return -1;
+			return stream_char(s,c);
+		case ST_LITERAL:
+			if (c>='a' && c<='z') return stream_push(s,c);
+			if (stream_end_scalar(s)) return -1;
+			return stream_char(s,c);
+		case ST_DONE:
+			return IS_SPACE(c)?0:-1;
+	}
+	return -1;
+}
+
+int cJSON_StreamFeed(cJSON_Stream *s,const char *data,unsigned int len)
+{
+	while (len--)
+	{
+		if (s->state==ST_ERROR) return -1;
+		if (stream_char(s,*data++)) {s->state=ST_ERROR;return -1;}
+	}
+	return 0;
+}
+
+int cJSON_StreamFinish(cJSON_Stream *s)
+{
+	if ((s->state==ST_NUMBER || s->state==ST_LITERAL) && !s->depth)
+	{
+		if (stream_end_scalar(s)) s->state=ST_ERROR;
+	}
+	return s->state==ST_DONE?0:-1;
+}
+
+
+void cJSON_WriterInit(cJSON_Writer *w,char *buf,unsigned int size,cJSON_FlushFn flush,void *ctx)
+{
+	memset(w,0,sizeof(cJSON_Writer));
+	w->buf=buf;w->flush=flush;w->ctx=ctx;
+	w->size=flush?size:(size?size-1:0);	/* keep room for the NUL */
+}
+
+static void writer_put(cJSON_Writer *w,const char *data,unsigned int len)
+{
+	unsigned int n;
+	w->total+=len;
+	while (len && !w->error)
+	{
+		if (w->len==w->size)
+		{
+			if (!w->flush || w->flush(w->ctx,w->buf,w->len)<0) {w->error=1;return;}
+			w->len=0;
+		}
+		n=w->size-w->len;if (n>len) n=len;
+		memcpy(w->buf+w->len,data,n);
+		w->len+=n;data+=n;len-=n;
+	}
+}
+
+/* Separator before a value: a comma unless it is the first of its level. */
+static void writer_value(cJSON_Writer *w)
+{
+	unsigned int bit;
+	if (w->after_key)	{w->after_key=0;return;}
+	if (!w->depth) return;
+	bit=1u<<(w->depth-1);
+	if (w->nesting&bit)	{w->error=1;return;}	/* value without a key in an object */
+	if (w->more&bit) writer_put(w,",",1);
+	w->more|=bit;
+}
+
+static void writer_string(cJSON_Writer *w,const char *str)
+{
+	const char *run;char esc[8];
+	writer_put(w,"\"",1);
+	run=str;
+	while (str && *str)
+	{
+		unsigned char token=(unsigned char)*str;
+		if (token>31 && token!='\"' && token!='\\') {str++;continue;}
+		writer_put(w,run,str-run);
+		switch (token)
+		{
+			case '\\':	writer_put(w,"\\\\",2);	break;
+			case '\"':	writer_put(w,"\\\"",2);	break;
+			case '\b':	writer_put(w,"\\b",2);	break;
+			case '\f':	writer_put(w,"\\f",2);	break;
+			case '\n':	writer_put(w,"\\n",2);	break;
+			case '\r':	writer_put(w,"\\r",2);	break;
+			case '\t':	writer_put(w,"\\t",2);	break;
+			default: sprintf(esc,"\\u%04x",token);writer_put(w,esc,6);	break;
+		}
+		run=++str;
+	}
+	if (str) writer_put(w,run,str-run);
+	writer_put(w,"\"",1);
+}
+
+static void writer_open(cJSON_Writer *w,int object)
+{
+	unsigned int bit;
+	writer_value(w);
+	if (w->depth>=CJSON_STREAM_MAX_DEPTH) {w->error=1;return;}
+	bit=1u<<w->depth;
+	if (object) w->nesting|=bit; else w->nesting&=~bit;
+	w->more&=~bit;
+	w->depth++;
+	writer_put(w,object?"{":"[",1);
+}
+
+static void writer_close(cJSON_Writer *w,int object)
+{
+	if (!w->depth || !IN_OBJECT(w->nesting,w->depth)!=!object || w->after_key) {w->error=1;return;}
+	w->depth--;
+	writer_put(w,object?"}":"]",1);
+}
+
+void cJSON_WriteObjectStart(cJSON_Writer *w)	{writer_open(w,1);}
+void cJSON_WriteObjectEnd(cJSON_Writer *w)		{writer_close(w,1);}
+void cJSON_WriteArrayStart(cJSON_Writer *w)		{writer_open(w,0);}
+void cJSON_WriteArrayEnd(cJSON_Writer *w)		{writer_close(w,0);}
+
+void cJSON_WriteKey(cJSON_Writer *w,const char *key)
+{
+	unsigned int bit;
+	if (!w->depth || !IN_OBJECT(w->nesting,w->depth) || w->after_key) {w->error=1;return;}
+	bit=1u<<(w->depth-1);
+	if (w->more&bit) writer_put(w,",",1);
+	w->more|=bit;
+	writer_string(w,key);
+	writer_put(w,":",1);
+	w->after_key=1;
+}
+
+void cJSON_WriteString(cJSON_Writer *w,const char *string)	{writer_value(w);writer_string(w,string);}
+void cJSON_WriteBool(cJSON_Writer *w,int b)					{writer_value(w);if (b) writer_put(w,"true",4); else writer_put(w,"false",5);}
+void cJSON_WriteNull(cJSON_Writer *w)						{writer_value(w);writer_put(w,"null",4);}
+
+void cJSON_WriteInt(cJSON_Writer *w,int num)
+{
+	char str[21];
+	writer_value(w);
+	writer_put(w,str,sprintf(str,"%d",num));
+}
+
+/* Same rendering as print_number() in cJSON.c. */
+void cJSON_WriteNumber(cJSON_Writer *w,double d)
+{
+	char str[64];int len;
+	if (d<=INT_MAX && d>=INT_MIN && fabs(((double)(int)d)-d)<=DBL_EPSILON)	{cJSON_WriteInt(w,(int)d);return;}
+	if (fabs(floor(d)-d)<=DBL_EPSILON && fabs(d)<1.0e60)	len=snprintf(str,sizeof(str),"%.0f",d);
+	else if (fabs(d)<1.0e-6 || fabs(d)>1.0e9)				len=snprintf(str,sizeof(str),"%e",d);
+	else													len=snprintf(str,sizeof(str),"%f",d);
+	if (len<0 || len>=(int)sizeof(str)) {w->error=1;return;}
+	writer_value(w);
+	writer_put(w,str,len);
+}
+
+void cJSON_WriteItem(cJSON_Writer *w,cJSON *item)
+{
+	cJSON *child;
+	if (!item) {w->error=1;return;}
+	switch ((item->type)&255)
+	{
+		case cJSON_NULL:	cJSON_WriteNull(w);	break;
+		case cJSON_False:	cJSON_WriteBool(w,0);	break;
+		case cJSON_True:	cJSON_WriteBool(w,1);	break;
+		case cJSON_Number:	if (fabs(((double)item->valueint)-item->valuedouble)<=DBL_EPSILON) cJSON_WriteInt(w,item->valueint); else cJSON_WriteNumber(w,item->valuedouble);	break;
+		case cJSON_String:	cJSON_WriteString(w,item->valuestring);	break;
+		case cJSON_Array:
+			cJSON_WriteArrayStart(w);
+			for (child=item->child;child && !w->error;child=child->next) cJSON_WriteItem(w,child);
+			cJSON_WriteArrayEnd(w);
+			break;
+		case cJSON_Object:
+			cJSON_WriteObjectStart(w);
+			for (child=item->child;child && !w->error;child=child->next) {cJSON_WriteKey(w,child->string);cJSON_WriteItem(w,child);}
+			cJSON_WriteObjectEnd(w);
+			break;
+		default:	w->error=1;	break;
+	}
+}
+
+int cJSON_WriterFinish(cJSON_Writer *w)
+{
+	if (w->depth || w->after_key) w->error=1;
+	if (!w->error)
+	{
+		if (w->flush)	{if (w->len && w->flush(w->ctx,w->buf,w->len)<0) w->error=1;w->len=0;}
+		else if (w->buf) w->buf[w->len]=0;
+	}
+	return w->error?-1:(int)w->total;
+}
+
+int cJSON_PrintToBuffer(cJSON *item,char *buf,int size)
+{
+	cJSON_Writer w;
+	if (!buf || size<=0) return -1;
+	cJSON_WriterInit(&w,buf,size,0,0);
+	cJSON_WriteItem(&w,item);
+	return cJSON_WriterFinish(&w);
+}
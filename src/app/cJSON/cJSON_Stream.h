@@ -0,0 +1,123 @@
+/*
+  Copyright (c) 2009 Dave Gamble
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+*/
+
+/* Streaming JSON: a tokenizer fed with chunks of text that reports each token
+   through a callback, and a writer that renders into a fixed buffer, handing it
+   to a flush callback (e.g. a socket send) whenever it fills up. Neither keeps
+   the document in memory. */
+
+#ifndef cJSON_Stream__h
+#define cJSON_Stream__h
+
+#include "cJSON.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifndef CJSON_STREAM_TOKEN_MAX
+#define CJSON_STREAM_TOKEN_MAX 256	/* Longest string/key/number token, after unescaping. */
+#endif
+#define CJSON_STREAM_MAX_DEPTH 32	/* Nesting limit of the tokenizer and the writer. */
+
+/* Token types: */
+#define cJSON_TokObjectStart 0
+#define cJSON_TokObjectEnd 1
+#define cJSON_TokArrayStart 2
+#define cJSON_TokArrayEnd 3
+#define cJSON_TokKey 4
+#define cJSON_TokString 5
+#define cJSON_TokNumber 6		/* str is the number text, e.g. for atoi/strtod. */
+#define cJSON_TokTrue 7
+#define cJSON_TokFalse 8
+#define cJSON_TokNull 9
+
+/* Called for every token. str is NUL terminated (len excludes the NUL) and only valid during the call;
+   depth is the nesting level of the token. A non-zero return stops the tokenizer. */
+typedef int (*cJSON_TokenFn)(void *ctx,int type,const char *str,unsigned int len,int depth);
+
+typedef struct cJSON_Stream {
+	cJSON_TokenFn token;
+	void *ctx;
+	unsigned char state;
+	unsigned char depth;
+	unsigned char in_key;
+	unsigned char hex;			/* \u digits read so far */
+	unsigned int nesting;		/* One bit per level, set for objects. */
+	unsigned int uc,surrogate;
+	unsigned int len;
+	char buf[CJSON_STREAM_TOKEN_MAX+1];
+} cJSON_Stream;
+
+/* Start a new document. */
+extern void cJSON_StreamInit(cJSON_Stream *s,cJSON_TokenFn token,void *ctx);
+/* Feed the next len bytes of text. Returns 0, or -1 on malformed text, an overlong token or when the callback stopped. */
+extern int cJSON_StreamFeed(cJSON_Stream *s,const char *data,unsigned int len);
+/* End of text. Returns 0 if exactly one complete value was read, -1 otherwise. */
+extern int cJSON_StreamFinish(cJSON_Stream *s);
+
+
+/* Receives the rendered text when the writer buffer is full and on cJSON_WriterFinish. Returns <0 on failure. */
+typedef int (*cJSON_FlushFn)(void *ctx,const char *data,unsigned int len);
+
+typedef struct cJSON_Writer {
+	char *buf;
+	unsigned int size;
+	unsigned int len;			/* Bytes in buf. */
+	unsigned int total;			/* Bytes rendered so far. */
+	cJSON_FlushFn flush;
+	void *ctx;
+	int depth;
+	unsigned int nesting;		/* One bit per level, set for objects. */
+	unsigned int more;			/* One bit per level, set once the level has an element. */
+	int after_key;
+	int error;
+} cJSON_Writer;
+
+/* Render into buf (size bytes). Without a flush callback the whole document must fit in buf. */
+extern void cJSON_WriterInit(cJSON_Writer *w,char *buf,unsigned int size,cJSON_FlushFn flush,void *ctx);
+extern void cJSON_WriteObjectStart(cJSON_Writer *w);
+extern void cJSON_WriteObjectEnd(cJSON_Writer *w);
+extern void cJSON_WriteArrayStart(cJSON_Writer *w);
+extern void cJSON_WriteArrayEnd(cJSON_Writer *w);
+/* Name of the next value, inside an object. */
+extern void cJSON_WriteKey(cJSON_Writer *w,const char *key);
+extern void cJSON_WriteString(cJSON_Writer *w,const char *string);
+extern void cJSON_WriteNumber(cJSON_Writer *w,double num);
+extern void cJSON_WriteInt(cJSON_Writer *w,int num);
+extern void cJSON_WriteBool(cJSON_Writer *w,int b);
+extern void cJSON_WriteNull(cJSON_Writer *w);
+/* Render a cJSON tree (unformatted) without building intermediate strings. */
+extern void cJSON_WriteItem(cJSON_Writer *w,cJSON *item);
+/* Flush what is left. Returns the total length rendered, or -1 if anything failed (buffer too small, flush error, bad nesting).
+   Without a flush callback the text in buf is NUL terminated. */
+extern int cJSON_WriterFinish(cJSON_Writer *w);
+
+/* cJSON_PrintUnformatted into a caller buffer. Returns the length, or -1 if it does not fit. */
+extern int cJSON_PrintToBuffer(cJSON *item,char *buf,int size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
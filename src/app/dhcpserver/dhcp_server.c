@@ -178,54 +178,265 @@ static bool _CheckMacIsValid(u8 *mac)
     return ret;
 }
 
+/* The lease table is indexed by MAC and by IP address (chained hash tables
+   of client indexes), idle entries are kept on a free and a history list,
+   and the REQUEST/BIND entries on a heap ordered by expiry, so that neither
+   a DHCP message nor the timer has to walk the whole table. */
+
+#define DHCPS_TIME_BEFORE(a, b)      ((int)((a) - (b)) < 0)
+
+static INT16U DhcpClientNum = DHCPS_HISTORY_CLIENT_NUM;
+
+static void _DhcpTickHandle(void * Arg);
+
+static bool _MacIsZero(const INT8U *MacAddr)
+{
+	return (memcmp(MacAddr, "\x00\x00\x00\x00\x00\x00", 6) == 0) ? TRUE : FALSE;
+}
+
+static INT16U _MacHash(const INT8U *MacAddr)
+{
+	return (MacAddr[5] ^ (MacAddr[4] << 4) ^ (MacAddr[3] << 8)) & DhcpServer->HashMask;
+}
+
+static INT16U _IpHash(const ip_addr_t *IpAddr)
+{
+	return ntohl(ip_addr_get_ip4_u32(IpAddr)) & DhcpServer->HashMask;
+}
+
+static INT16U _ClientIndex(PDHCP_CLIENT pClient)
+{
+	return (INT16U)(pClient - DhcpServer->Clients);
+}
+
+static PDHCP_CLIENT _ClientByIp(const ip_addr_t *IpAddr)
+{
+	INT16U i;
+	PDHCP_CLIENT pClient;
+
+	for(i = DhcpServer->IpHash[_IpHash(IpAddr)]; i != DHCPS_NO_CLIENT; i = pClient->IpNext)
+	{
+		pClient = &DhcpServer->Clients[i];
+		if(ip_addr_cmp(&pClient->IpAddr, IpAddr))
+		{
+			return pClient;
+		}
+	}
+	return NULL;
+}
+
+/* Put an entry on the free or history list if it is idle. */
+static void _ClientRelink(PDHCP_CLIENT pClient)
+{
+	if(pClient->Idle.next)
+	{
+		dl_list_del(&pClient->Idle);
+	}
+	if(pClient->State == DHCP_CLIENT_STATE_IDLE)
+	{
+		dl_list_add_tail(_MacIsZero(pClient->MacAddr) ? &DhcpServer->FreeList : &DhcpServer->HistoryList, &pClient->Idle);
+	}
+}
+
+/* Change the MAC address of an entry, NULL to clear it. */
+static void _ClientSetMac(PDHCP_CLIENT pClient, const INT8U *MacAddr)
+{
+	INT16U *pNext;
+	INT16U Index = _ClientIndex(pClient);
+
+	if(!_MacIsZero(pClient->MacAddr))
+	{
+		for(pNext = &DhcpServer->MacHash[_MacHash(pClient->MacAddr)]; *pNext != DHCPS_NO_CLIENT; pNext = &DhcpServer->Clients[*pNext].MacNext)
+		{
+			if(*pNext == Index)
+			{
+				*pNext = pClient->MacNext;
+				break;
+			}
+		}
+		pClient->MacNext = DHCPS_NO_CLIENT;
+	}
+
+	if(MacAddr)
+	{
+		MEMCPY(pClient->MacAddr, MacAddr, 6);
+	}
+	else
+	{
+		memset(pClient->MacAddr, 0, 6);
+	}
+
+	if(!_MacIsZero(pClient->MacAddr))
+	{
+		pNext = &DhcpServer->MacHash[_MacHash(pClient->MacAddr)];
+		pClient->MacNext = *pNext;
+		*pNext = Index;
+	}
+	_ClientRelink(pClient);
+}
+
+static void _HeapPlace(INT16U Pos, INT16U Index)
+{
+	DhcpServer->Heap[Pos] = Index;
+	DhcpServer->Clients[Index].HeapPos = Pos;
+}
+
+/* Move the entry at Pos up or down to its place in the heap. */
+static void _HeapSift(INT16U Pos)
+{
+	INT16U * Heap = DhcpServer->Heap;
+	INT16U Index = Heap[Pos];
+	INT32U Expire = DhcpServer->Clients[Index].Expire;
+	INT16U Parent, Child;
+
+	while(Pos > 0)
+	{
+		Parent = (Pos - 1) / 2;
+		if(!DHCPS_TIME_BEFORE(Expire, DhcpServer->Clients[Heap[Parent]].Expire))
+		{
+			break;
+		}
+		_HeapPlace(Pos, Heap[Parent]);
+		Pos = Parent;
+	}
+
+	while((Child = 2 * Pos + 1) < DhcpServer->HeapLen)
+	{
+		if((Child + 1 < DhcpServer->HeapLen) &&
+			DHCPS_TIME_BEFORE(DhcpServer->Clients[Heap[Child + 1]].Expire, DhcpServer->Clients[Heap[Child]].Expire))
+		{
+			Child++;
+		}
+		if(!DHCPS_TIME_BEFORE(DhcpServer->Clients[Heap[Child]].Expire, Expire))
+		{
+			break;
+		}
+		_HeapPlace(Pos, Heap[Child]);
+		Pos = Child;
+	}
+
+	_HeapPlace(Pos, Index);
+}
+
+static void _HeapSet(PDHCP_CLIENT pClient, INT32U Expire)
+{
+	pClient->Expire = Expire;
+	if(pClient->HeapPos == DHCPS_NO_CLIENT)
+	{
+		_HeapPlace(DhcpServer->HeapLen++, _ClientIndex(pClient));
+	}
+	_HeapSift(pClient->HeapPos);
+}
+
+static void _HeapRemove(PDHCP_CLIENT pClient)
+{
+	INT16U Pos = pClient->HeapPos;
+
+	if(Pos == DHCPS_NO_CLIENT)
+	{
+		return;
+	}
+	pClient->HeapPos = DHCPS_NO_CLIENT;
+	if(Pos != --DhcpServer->HeapLen)
+	{
+		_HeapPlace(Pos, DhcpServer->Heap[DhcpServer->HeapLen]);
+		_HeapSift(Pos);
+	}
+}
+
+/* Change the state of an entry and (re)arm its offer or lease timeout. */
+static void _ClientSetState(PDHCP_CLIENT pClient, DHCP_CLIENT_STATE State)
+{
+	pClient->State = State;
+	if(State == DHCP_CLIENT_STATE_REQUEST)
+	{
+		_HeapSet(pClient, sys_now() + DHCP_DEFFAULT_TIMEOUT * DHCP_TICK_TIME);
+	}
+	else if(State == DHCP_CLIENT_STATE_BIND)
+	{
+		_HeapSet(pClient, sys_now() + DhcpServer->LeaseTime * 1000);
+	}
+	else
+	{
+		_HeapRemove(pClient);
+	}
+	_ClientRelink(pClient);
+}
+
+/* Schedule the timer for the earliest expiry. */
+static void _DhcpTimerRestart(void)
+{
+	INT32U Delay;
+
+	sys_untimeout(_DhcpTickHandle, NULL);
+	if(DhcpServer->Enable && DhcpServer->HeapLen)
+	{
+		Delay = DhcpServer->Clients[DhcpServer->Heap[0]].Expire - sys_now();
+		if((int)Delay < 0)
+		{
+			Delay = 0;
+		}
+		sys_timeout(Delay, _DhcpTickHandle, NULL);
+	}
+}
+
+/* Bound clients that left the wireless network keep their address until
+   the lease runs out; take these addresses back when the pool is empty. */
+static void _ReclaimDepartedClients(void)
+{
+	INT16U i;
+	PDHCP_CLIENT pClient;
+
+	for(i = 0; i < DhcpServer->ClientNum; i++)
+	{
+		pClient = &DhcpServer->Clients[i];
+		if((pClient->State == DHCP_CLIENT_STATE_BIND) && (_CheckMacIsValid(pClient->MacAddr) == 0))
+		{
+			_ClientSetState(pClient, DHCP_CLIENT_STATE_IDLE);
+	//		_PostMsgToSysQ(pClient, SYSC_MSG_IP_RELEASE);
+		}
+	}
+}
+
 static void _DhcpTickHandle(void * Arg)
 {
-	INT8U i;
 	PDHCP_CLIENT pClient;
+	INT32U Now;
 
 	if (DhcpServer == NULL)
 	{
 		return;
 	}
 
-
 	if(DhcpServer->Enable == 0)
 	{
 		return;
 	}
-	
-	for(i = 0; i < DHCPS_HISTORY_CLIENT_NUM; i++)
+
+	Now = sys_now();
+	while(DhcpServer->HeapLen)
 	{
-		pClient = &DhcpServer->Clients[i];
+		pClient = &DhcpServer->Clients[DhcpServer->Heap[0]];
+		if(DHCPS_TIME_BEFORE(Now, pClient->Expire))
+		{
+			break;
+		}
+
 		if(pClient->State == DHCP_CLIENT_STATE_REQUEST)
 		{
-			if(pClient->Timeout && (--pClient->Timeout == 0))
-			{
-				/* Timeout for the client's request frame. */
-				memset(pClient->MacAddr, 0, 6);
-				pClient->State = DHCP_CLIENT_STATE_IDLE;
-			}
+			/* Timeout for the client's request frame. */
+			_ClientSetState(pClient, DHCP_CLIENT_STATE_IDLE);
+			_ClientSetMac(pClient, NULL);
 		}
-		else if(pClient->State == DHCP_CLIENT_STATE_BIND)
+		else
 		{
-#if 1		
-			if(pClient->Lease && (--pClient->Lease == 0))
-			{
-				/* The lease time over. */
-				pClient->State = DHCP_CLIENT_STATE_IDLE;
-		//		_PostMsgToSysQ(pClient, SYSC_MSG_IP_RELEASE);
-			}
-			else if(_CheckMacIsValid(pClient->MacAddr) == 0)
-			{
-				/* The client leave the wireless network. */
-				pClient->State = DHCP_CLIENT_STATE_IDLE;
-		//		_PostMsgToSysQ(pClient, SYSC_MSG_IP_RELEASE);
-			}
-#endif			
-		}	
+			/* The lease time over. */
+			_ClientSetState(pClient, DHCP_CLIENT_STATE_IDLE);
+	//		_PostMsgToSysQ(pClient, SYSC_MSG_IP_RELEASE);
+		}
 	}
-	
-	if(DhcpServer->Enable) sys_timeout(DHCP_TICK_TIME, _DhcpTickHandle, NULL);
+
+	_DhcpTimerRestart();
 }
 
 static INT8U _ParseDhcpOptions(PDHCP_MSG pMsg, INT8U * pMsgType, INT32U * pReqIpAddr, INT32U * pServerId)
@@ -282,7 +493,7 @@ static INT8U _ParseDhcpOptions(PDHCP_MSG pMsg, INT8U * pMsgType, INT32U * pReqIp
 
 static PDHCP_CLIENT _ClientTableLookup(INT8U * MacAddr, INT8U MsgType, INT32U ReqIpAddr, INT32U ServerId)
 {
-	INT8U i;
+	INT16U i;
 	INT8U IpUnavailable;
 	PDHCP_CLIENT pClient;
 	PDHCP_CLIENT pFreeClient;
@@ -305,47 +516,41 @@ static PDHCP_CLIENT _ClientTableLookup(INT8U * MacAddr, INT8U MsgType, INT32U Re
 		return NULL;
 	}
 
-	for(i = 0; i < DHCPS_HISTORY_CLIENT_NUM; i++)
+	for(i = DhcpServer->MacHash[_MacHash(MacAddr)]; i != DHCPS_NO_CLIENT; i = pClient->MacNext)
 	{
 		pClient = &DhcpServer->Clients[i];
+		if(memcmp(pClient->MacAddr, MacAddr, 6) != 0)
+		{
+			continue;
+		}
+
 		if(pClient->State == DHCP_CLIENT_STATE_IDLE)
-		{	
-			if((pMyHistoryClient == NULL) && (memcmp(pClient->MacAddr, MacAddr, 6) == 0))
+		{
+			if(pMyHistoryClient == NULL)
 			{
 				/* Get my history entry. */
 				pMyHistoryClient = pClient;
 			}
-
-			if((pReqClient == NULL) && ip_addr_cmp(&pClient->IpAddr, (ip_addr_t *)&ReqIpAddr) )
-			{
-				/* Get the idle entry that hold my requested ip address. */
-				pReqClient = pClient;
-			}
-
-			if((pFreeClient == NULL) && (memcmp(pClient->MacAddr, "\x00\x00\x00\x00\x00\x00", 6) == 0) )
-			{
-				/* Get the first free entry. */
-				pFreeClient = pClient;
-			}
-
-			if((pHistoryClient == NULL) && (memcmp(pClient->MacAddr, "\x00\x00\x00\x00\x00\x00", 6) != 0))
-			{
-				/* Get the first histoy entry that not belong to me. */
-				pHistoryClient = pClient;
-			}
 		}
 		else
 		{
-			if(memcmp(pClient->MacAddr, MacAddr, 6) == 0)
-			{
-				/* Is negotiating ip address or has negotiated now. */
-				pMyClient = pClient;
-			}
-			else if(ip_addr_cmp(&pClient->IpAddr, (ip_addr_t *)&ReqIpAddr))
-			{
-				/* The requested ip address is allocated. */
-				IpUnavailable = 1;
-			}
+			/* Is negotiating ip address or has negotiated now. */
+			pMyClient = pClient;
+		}
+	}
+
+	pClient = _ClientByIp((ip_addr_t *)&ReqIpAddr);
+	if(pClient)
+	{
+		if(pClient->State == DHCP_CLIENT_STATE_IDLE)
+		{
+			/* Get the idle entry that hold my requested ip address. */
+			pReqClient = pClient;
+		}
+		else if(memcmp(pClient->MacAddr, MacAddr, 6) != 0)
+		{
+			/* The requested ip address is allocated. */
+			IpUnavailable = 1;
 		}
 	}
 
@@ -355,14 +560,14 @@ static PDHCP_CLIENT _ClientTableLookup(INT8U * MacAddr, INT8U MsgType, INT32U Re
 			if(pMyClient)
 			{
 				/* Amazing!!The client restart the negotiation. */
-				pMyClient->State = DHCP_CLIENT_STATE_IDLE;
+				_ClientSetState(pMyClient, DHCP_CLIENT_STATE_IDLE);
 				
 				if(pReqClient)
 				{
 					/* The client request another ip address and that address is not allocated now. */
 					if(pMyClient->State != DHCP_CLIENT_STATE_BIND)
 					{
-						memset(pMyClient->MacAddr, 0, 6);
+						_ClientSetMac(pMyClient, NULL);
 					}
 					else
 					{
@@ -387,6 +592,14 @@ static PDHCP_CLIENT _ClientTableLookup(INT8U * MacAddr, INT8U MsgType, INT32U Re
 					3. a totally free ip address.
 					4. the other client's history ip address.
 				*/
+				if(!pReqClient && !pMyHistoryClient &&
+					dl_list_empty(&DhcpServer->FreeList) && dl_list_empty(&DhcpServer->HistoryList))
+				{
+					_ReclaimDepartedClients();
+				}
+				pFreeClient = dl_list_first(&DhcpServer->FreeList, DHCP_CLIENT, Idle);
+				/* The oldest histoy entry, not mine as pMyHistoryClient comes first. */
+				pHistoryClient = dl_list_first(&DhcpServer->HistoryList, DHCP_CLIENT, Idle);
 				if(pReqClient)
 				{
 					/* The client's request ip address. */
@@ -425,9 +638,9 @@ static PDHCP_CLIENT _ClientTableLookup(INT8U * MacAddr, INT8U MsgType, INT32U Re
 					
 					if(pMyClient->State != DHCP_CLIENT_STATE_BIND)
 					{
-						memset(pMyClient->MacAddr, 0, 6);
+						_ClientSetMac(pMyClient, NULL);
 					}
-					pMyClient->State = DHCP_CLIENT_STATE_IDLE;
+					_ClientSetState(pMyClient, DHCP_CLIENT_STATE_IDLE);
 				}
 				else
 				{
@@ -436,14 +649,14 @@ static PDHCP_CLIENT _ClientTableLookup(INT8U * MacAddr, INT8U MsgType, INT32U Re
 						/* The client request a new address that is not allocated. */
 						if(pMyClient->State != DHCP_CLIENT_STATE_BIND)
 						{
-							memset(pMyClient->MacAddr, 0, 6);
+							_ClientSetMac(pMyClient, NULL);
 						}
 						else
 						{
 						//	_PostMsgToSysQ(pMyClient, SYSC_MSG_IP_RELEASE);
 						}
 
-						pMyClient->State = DHCP_CLIENT_STATE_IDLE;
+						_ClientSetState(pMyClient, DHCP_CLIENT_STATE_IDLE);
 						if((ServerId == 0) || (ip_addr_get_ip4_u32(&DhcpServer->ServerIpAddr) == ServerId))						
 						{
 							/* The client request the new address and that is free, allocate it. */
@@ -493,13 +706,13 @@ static PDHCP_CLIENT _ClientTableLookup(INT8U * MacAddr, INT8U MsgType, INT32U Re
 			{
 				if(pMyClient->State != DHCP_CLIENT_STATE_BIND)
 				{
-					memset(pMyClient->MacAddr, 0, 6);
+					_ClientSetMac(pMyClient, NULL);
 				}
 				else
 				{
 				//	_PostMsgToSysQ(pClient, SYSC_MSG_IP_RELEASE);
 				}
-				pMyClient->State = DHCP_CLIENT_STATE_IDLE;
+				_ClientSetState(pMyClient, DHCP_CLIENT_STATE_IDLE);
 			}
 			pReturnClient = NULL;
 			break;
@@ -510,13 +723,13 @@ static PDHCP_CLIENT _ClientTableLookup(INT8U * MacAddr, INT8U MsgType, INT32U Re
 			{
 				if(pMyClient->State != DHCP_CLIENT_STATE_BIND)
 				{
-					memset(pMyClient->MacAddr, 0, 6);
+					_ClientSetMac(pMyClient, NULL);
 				}
 				else
 				{
 				//	_PostMsgToSysQ(pClient, SYSC_MSG_IP_RELEASE);
 				}
-				pMyClient->State = DHCP_CLIENT_STATE_IDLE;
+				_ClientSetState(pMyClient, DHCP_CLIENT_STATE_IDLE);
 			}
 			pReturnClient = NULL;
 			break;
@@ -530,7 +743,7 @@ static PDHCP_CLIENT _ClientTableLookup(INT8U * MacAddr, INT8U MsgType, INT32U Re
 	if(pReturnClient)
 	{
 		/* Updata the client's MAC address. */
-		MEMCPY(pReturnClient->MacAddr, MacAddr, 6);
+		_ClientSetMac(pReturnClient, MacAddr);
 	}
 
 	return pReturnClient;
@@ -752,20 +965,21 @@ static void _DHCPOfferGenAndSend(PDHCP_CLIENT pClient, INT8U * pClientMacAddr, I
 
 static void _CleanClientHistory(INT8U * pClientMacAddr)
 {
-	INT8U i;
+	INT16U i, Next;
 	PDHCP_CLIENT pClient;
 	if (DhcpServer == NULL)
 	{
 		return;
 	}
 
-	for(i = 0; i < DHCPS_HISTORY_CLIENT_NUM; i++)
+	for(i = DhcpServer->MacHash[_MacHash(pClientMacAddr)]; i != DHCPS_NO_CLIENT; i = Next)
 	{
 		pClient = &DhcpServer->Clients[i];
+		Next = pClient->MacNext;
 		if((pClient->State == DHCP_CLIENT_STATE_IDLE) && (memcmp(pClient->MacAddr, pClientMacAddr, 6) == 0))
 		{
 			/* Clean the history client's Mac address. */
-			memset(pClient->MacAddr, 0, 6);
+			_ClientSetMac(pClient, NULL);
 		}
 	}
 }
@@ -778,14 +992,13 @@ static void _DhcpClientSMEHandle(PDHCP_CLIENT pClient, INT8U MsgType, INT32U Xid
 			if(MsgType == DHCP_MSG_DISCOVER)
 			{
 				/* Receive the "DISCOVER" frame, switch the state to "SELECT". */
-				pClient->State = DHCP_CLIENT_STATE_SELECT;
+				_ClientSetState(pClient, DHCP_CLIENT_STATE_SELECT);
 			}
 			else if(MsgType == DHCP_MSG_REQUEST)
 			{
 				/* If the requested ip is not allocated, allocate it. */
 				_DHCPAckGenAndSend(pClient, pClient->MacAddr, Xid, Flags);
-				pClient->Lease = DHCP_DEFAULT_LEASE_TIME;
-				pClient->State = DHCP_CLIENT_STATE_BIND;
+				_ClientSetState(pClient, DHCP_CLIENT_STATE_BIND);
 				_CleanClientHistory(pClient->MacAddr);
 //				_PostMsgToSysQ(pClient, SYSC_MSG_IP_ALLOCATED);
 				break;
@@ -794,8 +1007,7 @@ static void _DhcpClientSMEHandle(PDHCP_CLIENT pClient, INT8U MsgType, INT32U Xid
 		case DHCP_CLIENT_STATE_SELECT:
 			/* Receive the "DISCOVER" frame, send "OFFER" to the client. */
 			_DHCPOfferGenAndSend(pClient, pClient->MacAddr, Xid, Flags);
-			pClient->Timeout = DHCP_DEFFAULT_TIMEOUT;
-			pClient->State = DHCP_CLIENT_STATE_REQUEST;
+			_ClientSetState(pClient, DHCP_CLIENT_STATE_REQUEST);
 			break;
 
 		case DHCP_CLIENT_STATE_REQUEST:
@@ -803,8 +1015,7 @@ static void _DhcpClientSMEHandle(PDHCP_CLIENT pClient, INT8U MsgType, INT32U Xid
 		case DHCP_CLIENT_STATE_BIND:
 			/* Send ACK to the client, if receive the "REQUEST" frame to select the offer or renew the DHCP lease. */
 			_DHCPAckGenAndSend(pClient, pClient->MacAddr, Xid, Flags);
-			pClient->Lease = DHCP_DEFAULT_LEASE_TIME;
-			pClient->State = DHCP_CLIENT_STATE_BIND;
+			_ClientSetState(pClient, DHCP_CLIENT_STATE_BIND);
 			_CleanClientHistory(pClient->MacAddr);
 			break;
 
@@ -815,7 +1026,7 @@ static void _DhcpClientSMEHandle(PDHCP_CLIENT pClient, INT8U MsgType, INT32U Xid
 
 ip_addr_t *DHCPS_GetIpByMac(const INT8U *MacAddr)
 {
-    INT8U i;
+    INT16U i;
     PDHCP_CLIENT pClient;
     ip_addr_t *IpAddr = NULL;
 	if (DhcpServer == NULL)
@@ -823,13 +1034,15 @@ ip_addr_t *DHCPS_GetIpByMac(const INT8U *MacAddr)
 		return NULL;
 	}
 
-    for(i = 0; i < DHCPS_HISTORY_CLIENT_NUM; i++)
+    for(i = DhcpServer->MacHash[_MacHash(MacAddr)]; i != DHCPS_NO_CLIENT; i = pClient->MacNext)
     {
         pClient = &DhcpServer->Clients[i];
         if (0 == compare_ether_addr(MacAddr, pClient->MacAddr))
         { 
             IpAddr = &pClient->IpAddr;
-            break;
+            /* Prefer the current address to a history one. */
+            if (pClient->State != DHCP_CLIENT_STATE_IDLE)
+                break;
         }
     }
 
@@ -838,25 +1051,15 @@ ip_addr_t *DHCPS_GetIpByMac(const INT8U *MacAddr)
 
 INT8U *DHCPS_GetMacByIp(const ip_addr_t *ipaddr)
 {
-    INT8U i;
     PDHCP_CLIENT pClient;
-    INT8U *macaddr = NULL;
 	if (DhcpServer == NULL)
 	{
 		return NULL;
 	}
 
-    for(i = 0; i < DHCPS_HISTORY_CLIENT_NUM; i++)
-    {
-        pClient = &DhcpServer->Clients[i];
-        if (pClient->IpAddr.addr == ipaddr->addr)
-        { 
-            macaddr = pClient->MacAddr;
-            break;
-        }
-    }
+    pClient = _ClientByIp(ipaddr);
 
-    return macaddr;
+    return pClient ? pClient->MacAddr : NULL;
 }
 
 /* numdns 0/1  --> dns 1/2 */
@@ -981,6 +1184,12 @@ void DHCPS_RecvCb(void *Arg, struct udp_pcb *Pcb, struct pbuf *P, ip_addr_t *Add
 		_DhcpClientSMEHandle(pClient, MsgType, Xid, ClientMacAddr, Flags);
 	}while(0);
 
+	/* The state machine may have changed the earliest expiry. */
+	if (DhcpServer)
+	{
+		_DhcpTimerRestart();
+	}
+
 	pbuf_free(P);
 #endif	
 }
@@ -1000,7 +1209,7 @@ void DHCPS_RecvCb(void *Arg, struct udp_pcb *Pcb, struct pbuf *P, ip_addr_t *Add
 -------------------------------------------------------------------------*/
 INT8S DHCPS_ClientDelete(INT8U * MacAddr)
 {
-	INT8U i;
+	INT16U i;
 	PDHCP_CLIENT pClient;
 
 	if (DhcpServer == NULL)
@@ -1018,7 +1227,7 @@ INT8S DHCPS_ClientDelete(INT8U * MacAddr)
 		return DHCPS_ERR_PARAM;
 	}
 	
-	for(i = 0; i < DHCPS_HISTORY_CLIENT_NUM; i++)
+	for(i = DhcpServer->MacHash[_MacHash(MacAddr)]; i != DHCPS_NO_CLIENT; i = pClient->MacNext)
 	{
 		pClient = &DhcpServer->Clients[i];
 		if((pClient->State != DHCP_CLIENT_STATE_IDLE) && (memcmp(pClient->MacAddr, MacAddr, 6) == 0))
@@ -1031,7 +1240,8 @@ INT8S DHCPS_ClientDelete(INT8U * MacAddr)
 			else
 			{
 				/* For bind client, delete it directly. */
-				pClient->State = DHCP_CLIENT_STATE_IDLE;
+				_ClientSetState(pClient, DHCP_CLIENT_STATE_IDLE);
+				_DhcpTimerRestart();
 				return DHCPS_ERR_SUCCESS;
 			}
 		}
@@ -1040,6 +1250,30 @@ INT8S DHCPS_ClientDelete(INT8U * MacAddr)
 	return DHCPS_ERR_NOT_FOUND;
 }
 
+/*-------------------------------------------------------------------------
+	Description:	
+		This function is used to set the number of addresses the DHCP Server hands out.
+	Arguments:
+		Num: Size of the address pool.
+	Return Value:
+		The DHCP Server error code:
+			DHCPS_ERR_SUCCESS - No error
+			DHCPS_ERR_PARAM - The input parameter error
+	Note:	
+		Takes effect when the server is started next. The pool is limited to the
+		addresses of the subnet other than the server's own.
+-------------------------------------------------------------------------*/
+INT8S DHCPS_SetPoolSize(INT16U Num)
+{
+	if((Num == 0) || (Num == DHCPS_NO_CLIENT))
+	{
+		return DHCPS_ERR_PARAM;
+	}
+
+	DhcpClientNum = Num;
+	return DHCPS_ERR_SUCCESS;
+}
+
 /*-------------------------------------------------------------------------
 	Description:	
 		This function is used to start DHCP Server for a network interface.
@@ -1050,12 +1284,14 @@ INT8S DHCPS_ClientDelete(INT8U * MacAddr)
 			DHCPS_ERR_SUCCESS - No error
 			DHCPS_ERR_MEM - Out of memory
 			DHCPS_ERR_LINKDOWN - The NI is inactive
+			DHCPS_ERR_PARAM - The subnet has no address to hand out
 	Note:	
 		The dhcp server must be started after the network interface was actived.
 -------------------------------------------------------------------------*/
 INT8S DHCPS_Start(struct netif *Netif)
 {
-	INT32U Val, Mask, tmp, i;
+	INT32U Val, Mask, Hosts, Host, i;
+	INT16U ClientNum, HashSize, Bucket;
 	PDHCP_CLIENT pClient;
 
 	/* Check the network interface is active now. */
@@ -1063,16 +1299,33 @@ INT8S DHCPS_Start(struct netif *Netif)
 	{
 		return DHCPS_ERR_LINKDOWN;
 	}
-	if (DhcpServer == NULL)
+
+	/* Host numbers 1 ~ Hosts of the subnet can be handed out, except the server's. */
+	Val = ntohl(ip_addr_get_ip4_u32(&Netif->ip_addr));
+	Mask = ntohl(ip_addr_get_ip4_u32(&Netif->netmask));
+	Hosts = (~Mask) - 1;
+	if(((~Mask) < 3) || ((Val & (~Mask)) == 0) || ((Val & (~Mask)) > Hosts))
+	{
+		return DHCPS_ERR_PARAM;
+	}
+	ClientNum = DhcpClientNum;
+	if(ClientNum > Hosts - 1)
 	{
-		DhcpServer = tls_mem_alloc(sizeof(*DhcpServer));
+		ClientNum = Hosts - 1;
 	}
+	for(HashSize = 1; HashSize < ClientNum; HashSize <<= 1);
 
-	if (DhcpMsg == NULL)
+	/* Restart with the current pool size. */
+	if (DhcpServer != NULL)
 	{
-		DhcpMsg = tls_mem_alloc(sizeof(*DhcpMsg));
+		DHCPS_Stop();
 	}
 
+	/* The server, its clients, the hash tables and the expiry heap in one block. */
+	DhcpServer = tls_mem_alloc(sizeof(*DhcpServer) + ClientNum * sizeof(DHCP_CLIENT) +
+	                           (2 * HashSize + ClientNum) * sizeof(INT16U));
+	DhcpMsg = tls_mem_alloc(sizeof(*DhcpMsg));
+
 	if (DhcpServer == NULL || DhcpMsg == NULL)
 	{
 		if (DhcpServer)
@@ -1087,14 +1340,20 @@ INT8S DHCPS_Start(struct netif *Netif)
 		}		
 		return DHCPS_ERR_MEM;
 	}
-	memset(DhcpServer, 0, sizeof(*DhcpServer));
+	memset(DhcpServer, 0, sizeof(*DhcpServer) + ClientNum * sizeof(DHCP_CLIENT));
+	DhcpServer->ClientNum = ClientNum;
+	DhcpServer->HashMask = HashSize - 1;
+	DhcpServer->Clients = (PDHCP_CLIENT)(DhcpServer + 1);
+	DhcpServer->MacHash = (INT16U *)(DhcpServer->Clients + ClientNum);
+	DhcpServer->IpHash = DhcpServer->MacHash + HashSize;
+	DhcpServer->Heap = DhcpServer->IpHash + HashSize;
+	memset(DhcpServer->MacHash, 0xFF, 2 * HashSize * sizeof(INT16U));
+	dl_list_init(&DhcpServer->FreeList);
+	dl_list_init(&DhcpServer->HistoryList);
 	
 	/* Calculate the start ip address of the server's ip pool. */	
-	Val = ntohl(ip_addr_get_ip4_u32(&Netif->ip_addr));
-	Mask = ntohl(ip_addr_get_ip4_u32(&Netif->netmask));	
-	tmp = (Val & (~Mask));
-	tmp = ((tmp + 1) % (~Mask)) ? ((tmp + 1) % (~Mask)) : 1;
-	Val = htonl((Val & Mask) | tmp);
+	Host = (Val & (~Mask)) % Hosts + 1;
+	Val = htonl((Val & Mask) | Host);
 	
 	/* Configure the DHCP Server. */
 	ip_addr_set(&DhcpServer->ServerIpAddr, &Netif->ip_addr);
@@ -1107,21 +1366,22 @@ INT8S DHCPS_Start(struct netif *Netif)
 	DhcpServer->LeaseTime = DHCP_DEFAULT_LEASE_TIME;
 	
 	/* Initialize the free DHCP clients. */
-	for(i = 0; i < DHCPS_HISTORY_CLIENT_NUM; i++)
+	for(i = 0; i < ClientNum; i++)
 	{
 		pClient = &DhcpServer->Clients[i];
 		/* Set the initial client state is "IDLE". */
 		pClient->State = DHCP_CLIENT_STATE_IDLE;
+		pClient->MacNext = DHCPS_NO_CLIENT;
+		pClient->HeapPos = DHCPS_NO_CLIENT;
+		dl_list_add_tail(&DhcpServer->FreeList, &pClient->Idle);
 		
-		/* Set the ip address to the client. */	
-		Val = ntohl(ip_addr_get_ip4_u32(&DhcpServer->StartIpAddr));		
-		tmp = (Val & (~Mask));
-		tmp = ((tmp + i) % (~Mask)) ? ((tmp + i) % (~Mask)) : 1;
-		Val = htonl((Val & Mask) | tmp);
+		/* Set the ip address to the client, wrapping around behind the server's. */	
+		Val = htonl((ntohl(ip_addr_get_ip4_u32(&DhcpServer->StartIpAddr)) & Mask) | ((Host - 1 + i) % Hosts + 1));
 		ip_addr_set(&pClient->IpAddr, (ip_addr_t *)&Val);
-		
-		/* Set the default lease time. */
-		pClient->Lease = DHCP_DEFAULT_LEASE_TIME;
+
+		Bucket = _IpHash(&pClient->IpAddr);
+		pClient->IpNext = DhcpServer->IpHash[Bucket];
+		DhcpServer->IpHash[Bucket] = i;
 	}
 	
 	/* Allocate a UDP PCB. */
@@ -1141,8 +1401,7 @@ INT8S DHCPS_Start(struct netif *Netif)
 	/* Set up the recv callback and argument. */
 	udp_recv(DhcpServer->Socket, (udp_recv_fn)DHCPS_RecvCb, Netif);
 	
-	/* Start the DHCP Server tick timer. */
-	sys_timeout(DHCP_TICK_TIME, _DhcpTickHandle, NULL);
+	/* The tick timer is armed for the first offer, see _DhcpTimerRestart. */
 	
 	/* Enable the DHCP Server. */
 	DhcpServer->Enable = 1;
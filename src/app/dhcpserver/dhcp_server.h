@@ -16,6 +16,7 @@
 
 #if TLS_CONFIG_AP
 #include "wm_sockets.h"
+#include "list.h"
 
 #define DHCPS_ERR_SUCCESS      0
 #define DHCPS_ERR_LINKDOWN      -1
@@ -25,7 +26,10 @@
 #define DHCPS_ERR_NOT_FOUND      -5
 #define DHCPS_ERR_INACTIVE      -6
 
-#define DHCPS_HISTORY_CLIENT_NUM      8
+#ifndef DHCPS_HISTORY_CLIENT_NUM
+#define DHCPS_HISTORY_CLIENT_NUM      8 /* Default size of the address pool, see DHCPS_SetPoolSize. */
+#endif
+#define DHCPS_NO_CLIENT      0xFFFF
 
 #define DHCP_DEFAULT_LEASE_TIME      7200 /* 2 Hours. */
 #define DHCP_DEFAULT_LEASE_TIME_MS      7200000 /* 7200000ms */
@@ -94,11 +98,14 @@ typedef enum __DHCP_CLIENT_STATE
 typedef struct __DHCP_CLIENT
 {
 	DHCP_CLIENT_STATE State;
-	INT32U Timeout;
+	INT32U Expire; /* sys_now() when the offer (REQUEST) or the lease (BIND) runs out. */
 	/* Attention!!! MUST BE __align(4) */
 	ip_addr_t IpAddr;
 	INT8U MacAddr[6];
-	INT32U Lease;
+	INT16U MacNext; /* Next client in the same MAC hash bucket. */
+	INT16U IpNext; /* Next client in the same IP hash bucket. */
+	INT16U HeapPos; /* Position in the expiry heap, DHCPS_NO_CLIENT when not in it. */
+	struct dl_list Idle; /* Entry of the free or history list while IDLE. */
 }DHCP_CLIENT, *PDHCP_CLIENT;
 
 typedef struct __DHCP_SERVER
@@ -113,7 +120,15 @@ typedef struct __DHCP_SERVER
 	ip_addr_t Dns1;
 	ip_addr_t Dns2;	
 	INT32U LeaseTime;
-	DHCP_CLIENT Clients[DHCPS_HISTORY_CLIENT_NUM];
+	INT16U ClientNum;
+	INT16U HashMask;
+	PDHCP_CLIENT Clients;
+	INT16U *MacHash; /* MAC address -> first client of the bucket. */
+	INT16U *IpHash; /* IP address -> first client of the bucket. */
+	INT16U *Heap; /* Clients in REQUEST or BIND state, earliest Expire first. */
+	INT16U HeapLen;
+	struct dl_list FreeList; /* Idle clients without MAC address. */
+	struct dl_list HistoryList; /* Idle clients remembering their last MAC address, oldest first. */
 }DHCP_SERVER, *PDHCP_SERVER;
 
 #define DHCPS_HADDR_SIZE      16
@@ -154,6 +169,7 @@ typedef struct __DHCP_MSG
 INT8S DHCPS_Start(struct netif *Netif);
 void DHCPS_Stop(void);
 INT8S DHCPS_ClientDelete(INT8U * MacAddr);
+INT8S DHCPS_SetPoolSize(INT16U Num);
 void DHCPS_RecvCb(void *Arg, struct udp_pcb *Pcb, struct pbuf *P, ip_addr_t *Addr, INT16U Port);
 void DHCPS_SetDns(INT8U numdns, INT32U dns);
 ip_addr_t *DHCPS_GetIpByMac(const INT8U *mac_addr);
@@ -71,102 +71,75 @@ static INT32S _DnsCompareName(INT8U * MyDns, INT8U * Query)
 	return ((*(--MyDns) == 0) ? 0 : 1);
 }
 
-static void _DNSNameErrGenAndSend(ip_addr_t *Addr, INT16U Port, PDNS_QUERY pDnsQuery, INT8U * QueryName, INT16U TansactionId)
+/* Message buffer for queries that do not arrive in one pbuf, and scratch
+   space for answers that are too long to be cached. Only used from the
+   tcpip thread. */
+static INT8U DnsMsgBuf[DNSS_MSG_LEN];
+static INT8U DnsReplyBuf[DNSS_MSG_LEN + DNSS_ANSWER_RR_LEN];
+
+/* Length of the uncompressed query name at Name, including the root label,
+   or 0 if it is malformed or runs past End. */
+static INT32U _DnsNameLen(INT8U * Name, INT8U * End)
 {
-	INT32U Len;
-	INT8U * Body;
-	PDNS_HEADER pDnsHeader;
-	struct pbuf * pDnsBuf;
-	INT8U * pDnsReply;
+	INT8U * p = Name;
 
-	Len = ((sizeof(DNS_HEADER) + (strlen((const char *)QueryName) + 1) + sizeof(DNS_QUERY) + 3)  >> 2) << 2;
-	pDnsReply = tls_mem_alloc(Len);
-	if(pDnsReply == NULL)
+	while(p < End)
 	{
-		return;
+		if(*p == 0)
+		{
+			return p + 1 - Name;
+		}
+		if((*p & 0xc0) != 0)
+		{
+			/* Compressed or extended label, not valid in a question. */
+			return 0;
+		}
+		p += *p + 1;
 	}
-	
-	pDnsHeader = (PDNS_HEADER)pDnsReply;
-	Body = (INT8U *)(pDnsHeader + 1);
-	Len = 0;
+	return 0;
+}
 
-	/* Header. */
-	pDnsHeader->TansactionId = TansactionId;
-	pDnsHeader->DnsFlag1 = DNS_FLAG1_RESPONSE;
-	pDnsHeader->DnsFlag2 = DNS_FLAG2_ERR_NAME;
-	pDnsHeader->Quentions = htons(1);
-	pDnsHeader->AnswerRR = 0;
-	pDnsHeader->AuthorityRR = 0;
-	pDnsHeader->AdditionalRR = 0;
-	Len += sizeof(DNS_HEADER);
-	
-	/* Querry. */
-	MEMCPY(Body, QueryName, strlen((const char *)QueryName) + 1);
-	Body += strlen((const char *)QueryName) + 1;
-	Len += strlen((const char *)QueryName) + 1;
-	MEMCPY(Body, pDnsQuery, sizeof(DNS_QUERY));
-	Len += sizeof(DNS_QUERY);
+static INT32U _DnsHash(INT8U * Data, INT32U Len)
+{
+	INT32U Hash = 2166136261u;
 
-	pDnsBuf = pbuf_alloc(PBUF_TRANSPORT, Len, PBUF_RAM);
-	if(pDnsBuf == NULL)
+	while(Len--)
 	{
-		tls_mem_free(pDnsReply);
-		return;
+		Hash = (Hash ^ *Data++) * 16777619u;
 	}
-	pbuf_take(pDnsBuf, (const void *) pDnsReply, Len);
-
-	/* Send to the client. */
-	udp_sendto(DnsServer.Socket, pDnsBuf, Addr, Port);
-	pbuf_free(pDnsBuf);
-	tls_mem_free(pDnsReply);
+	return Hash;
 }
 
-static void _DNSAnswerGenAndSend(ip_addr_t *Addr, INT16U Port, PDNS_QUERY pDnsQuery, INT8U * QueryName, INT16U TansactionId)
+/* Preencode the answer to a question (name and DNS_QUERY) into Reply, with transaction id 0. */
+static INT32U _DNSReplyGen(INT8U * Reply, INT8U * Question, INT32U QuestionLen)
 {
-	INT32U Len;
 	INT8U * Body;
 	INT32U ServerIpAddr;
 	PDNS_HEADER pDnsHeader;
 	DNS_ANSWER DnsAnswer;
-	struct pbuf * pDnsBuf;
-	INT8U * pDnsReply;
 	INT16U Tmp;
 
-	Len = ((sizeof(DNS_HEADER) + (strlen((const char *)QueryName) + 1) + sizeof(DNS_QUERY) + 2 + sizeof(DNS_ANSWER) + 2 + 4 + 3)  >> 2) << 2;
-	pDnsReply = tls_mem_alloc(Len);
-	if(pDnsReply == NULL)
-	{
-		return;
-	}
-	
-	pDnsHeader = (PDNS_HEADER)pDnsReply;
-	Body = (INT8U *)(pDnsHeader + 1);
-	Len = 0;
+	pDnsHeader = (PDNS_HEADER)Reply;
+	Body = Reply + sizeof(DNS_HEADER);
 
 	/* Header. */
-	pDnsHeader->TansactionId = TansactionId;
+	pDnsHeader->TansactionId = 0;
 	pDnsHeader->DnsFlag1 = DNS_FLAG1_RESPONSE;
 	pDnsHeader->DnsFlag2 = DNS_FLAG2_ERR_NONE;
 	pDnsHeader->Quentions = htons(1);
 	pDnsHeader->AnswerRR = htons(1);
 	pDnsHeader->AuthorityRR = 0;
 	pDnsHeader->AdditionalRR = 0;
-	Len += sizeof(DNS_HEADER);
-	
+
 	/* Querry. */
-	MEMCPY(Body, QueryName, strlen((const char *)QueryName) + 1);
-	Body += strlen((const char *)QueryName) + 1;
-	Len += strlen((const char *)QueryName) + 1;
-	MEMCPY(Body, pDnsQuery, sizeof(DNS_QUERY));
-	Body += sizeof(DNS_QUERY);
-	Len += sizeof(DNS_QUERY);
+	MEMCPY(Body, Question, QuestionLen);
+	Body += QuestionLen;
 
 	/* NAME: provided as offset to first occurence in response. */
 	Tmp = DNS_NAME_OFFSET | sizeof(DNS_HEADER);
 	Tmp = htons(Tmp);
 	MEMCPY(Body, &Tmp, sizeof(INT16U));
 	Body += sizeof(INT16U);
-	Len += sizeof(INT16U);
 
 	/* Answer. */
 	DnsAnswer.Type = htons(DNS_RRTYPE_A);
@@ -174,32 +147,109 @@ static void _DNSAnswerGenAndSend(ip_addr_t *Addr, INT16U Port, PDNS_QUERY pDnsQu
 	DnsAnswer.Ttl = htonl(DNS_DEFAULT_TTL);
 	MEMCPY(Body, &DnsAnswer, sizeof(DNS_ANSWER));
 	Body += sizeof(DNS_ANSWER);
-	Len += sizeof(DNS_ANSWER);
 
 	/* Length. */
 	Tmp = htons(4);
 	MEMCPY(Body, &Tmp, sizeof(INT16U));
 	Body += sizeof(INT16U);
-	Len += sizeof(INT16U);
 
 	/* IP Address. */
 	ServerIpAddr = ip_addr_get_ip4_u32(&DnsServer.HostIp);
 	MEMCPY(Body, &ServerIpAddr, 4);
 	Body += 4;
-	Len += 4;
-	
+
+	return Body - Reply;
+}
+
+/* Send a preencoded answer with the client's transaction id, or turned into a name error. */
+static void _DNSReplySend(ip_addr_t *Addr, INT16U Port, INT8U * Reply, INT32U Len, INT16U TansactionId, INT8U NameErr)
+{
+	PDNS_HEADER pDnsHeader;
+	struct pbuf * pDnsBuf;
+
+	if(NameErr)
+	{
+		/* Header and question only. */
+		Len -= DNSS_ANSWER_RR_LEN;
+	}
+
 	pDnsBuf = pbuf_alloc(PBUF_TRANSPORT, Len, PBUF_RAM);
 	if(pDnsBuf == NULL)
 	{
-		tls_mem_free(pDnsReply);
 		return;
 	}
-	pbuf_take(pDnsBuf, (const void *) pDnsReply, Len);
+	MEMCPY(pDnsBuf->payload, Reply, Len);
+
+	pDnsHeader = (PDNS_HEADER)pDnsBuf->payload;
+	pDnsHeader->TansactionId = TansactionId;
+	if(NameErr)
+	{
+		pDnsHeader->DnsFlag2 = DNS_FLAG2_ERR_NAME;
+		pDnsHeader->AnswerRR = 0;
+	}
 
 	/* Send to the client. */
 	udp_sendto(DnsServer.Socket, pDnsBuf, Addr, Port);
 	pbuf_free(pDnsBuf);
-	tls_mem_free(pDnsReply);
+}
+
+/* Token bucket per client address; new clients take over the entries in turn. */
+static INT8U _DnsRateAllow(ip_addr_t *Addr)
+{
+	DNS_CLIENT_RATE * pRate;
+	INT32U Now, Refill;
+	INT8U i;
+
+	Now = sys_now();
+	pRate = NULL;
+	for(i = 0; i < DNSS_RATE_CLIENT_NUM; i++)
+	{
+		if(ip_addr_cmp(&DnsServer.Rate[i].Ip, Addr))
+		{
+			pRate = &DnsServer.Rate[i];
+			break;
+		}
+	}
+
+	if(pRate == NULL)
+	{
+		pRate = &DnsServer.Rate[DnsServer.RateNext];
+		DnsServer.RateNext = (DnsServer.RateNext + 1) % DNSS_RATE_CLIENT_NUM;
+		ip_addr_set(&pRate->Ip, Addr);
+		pRate->Last = Now;
+		pRate->Tokens = DNSS_RATE_BURST;
+	}
+	else
+	{
+		Refill = (Now - pRate->Last) * DNSS_RATE_PER_SEC / 1000;
+		if(Refill >= DNSS_RATE_BURST)
+		{
+			pRate->Tokens = DNSS_RATE_BURST;
+			pRate->Last = Now;
+		}
+		else if(Refill > 0)
+		{
+			pRate->Tokens = (pRate->Tokens + Refill > DNSS_RATE_BURST) ? DNSS_RATE_BURST : (pRate->Tokens + Refill);
+			pRate->Last += Refill * 1000 / DNSS_RATE_PER_SEC;
+		}
+	}
+
+	if(pRate->Tokens == 0)
+	{
+		return 0;
+	}
+	pRate->Tokens--;
+	return 1;
+}
+
+static void _DnsCacheFlush(void)
+{
+	INT8U i;
+
+	for(i = 0; i < DNSS_CACHE_NUM; i++)
+	{
+		DnsServer.Cache[i].QuestionLen = 0;
+	}
 }
 
 /*   DNSS_RecvCb   */
@@ -227,15 +277,30 @@ void DNSS_RecvCb(void *Arg, struct udp_pcb *Pcb, struct pbuf *P, ip_addr_t *Addr
 	//INT16U nQuestions, nAnswers;
 	INT8U * pDnsName;
 	INT8U * pDnsMsg;
+	INT32U MsgLen, NameLen, QuestionLen, ReplyLen, Hash;
+	DNS_CACHE * pCache;
+	INT8U * pReply;
+	INT8U IsMyName;
+	INT8U i;
 
 	do
 	{
-		pDnsMsg = tls_mem_alloc(P->tot_len);
-		if(pDnsMsg == NULL)
+		MsgLen = P->tot_len;
+		if((MsgLen < sizeof(DNS_HEADER)) || (MsgLen > DNSS_MSG_LEN))
 		{
 			break;
 		}
-		pbuf_copy_partial(P, pDnsMsg, P->tot_len, 0);
+
+		/* Parse in place unless the query is split over several pbufs. */
+		if(P->len == MsgLen)
+		{
+			pDnsMsg = P->payload;
+		}
+		else
+		{
+			pbuf_copy_partial(P, DnsMsgBuf, MsgLen, 0);
+			pDnsMsg = DnsMsgBuf;
+		}
 		
 		pDnsHeader = (PDNS_HEADER)pDnsMsg;
 
@@ -249,11 +314,23 @@ void DNSS_RecvCb(void *Arg, struct udp_pcb *Pcb, struct pbuf *P, ip_addr_t *Addr
 			break;
 		}
 
+		/* Clients retrying in a tight loop only get their share. */
+		if(!_DnsRateAllow(Addr))
+		{
+			break;
+		}
+
 		/* Locate the dns name. */
 		pDnsName = (INT8U *)(pDnsHeader + 1);
+		NameLen = _DnsNameLen(pDnsName, pDnsMsg + MsgLen);
+		QuestionLen = NameLen + sizeof(DNS_QUERY);
+		if((NameLen == 0) || (pDnsName + QuestionLen > pDnsMsg + MsgLen))
+		{
+			break;
+		}
 
 		/* Get the query class and type. */
-		MEMCPY(&DnsQuery, (pDnsName + strlen((const char *)pDnsName) + 1), sizeof(DnsQuery));
+		MEMCPY(&DnsQuery, pDnsName + NameLen, sizeof(DnsQuery));
 
 		/* Check the query class and type. */
 		if((DnsQuery.Class != htons(DNS_RRCLASS_IN)) && (DnsQuery.Type != htons(DNS_RRTYPE_A)))
@@ -261,7 +338,46 @@ void DNSS_RecvCb(void *Arg, struct udp_pcb *Pcb, struct pbuf *P, ip_addr_t *Addr
 			break;
 		}
 
-		if ((_DnsCompareName(DnsServer.DnsName, pDnsName) != 0) &&
+		/* Look up the answer to this name, type and class. */
+		Hash = _DnsHash(pDnsName, QuestionLen);
+		pCache = NULL;
+		for(i = 0; i < DNSS_CACHE_NUM; i++)
+		{
+			if((DnsServer.Cache[i].QuestionLen == QuestionLen) && (DnsServer.Cache[i].Hash == Hash) &&
+				(memcmp(DnsServer.Cache[i].Reply + sizeof(DNS_HEADER), pDnsName, QuestionLen) == 0))
+			{
+				pCache = &DnsServer.Cache[i];
+				break;
+			}
+		}
+
+		if(pCache)
+		{
+			pReply = pCache->Reply;
+			ReplyLen = sizeof(DNS_HEADER) + QuestionLen + DNSS_ANSWER_RR_LEN;
+			IsMyName = pCache->IsMyName;
+		}
+		else
+		{
+			IsMyName = (_DnsCompareName(DnsServer.DnsName, pDnsName) == 0);
+			if(NameLen <= DNSS_CACHE_NAME_LEN)
+			{
+				pCache = &DnsServer.Cache[DnsServer.CacheNext];
+				DnsServer.CacheNext = (DnsServer.CacheNext + 1) % DNSS_CACHE_NUM;
+				pReply = pCache->Reply;
+				ReplyLen = _DNSReplyGen(pReply, pDnsName, QuestionLen);
+				pCache->Hash = Hash;
+				pCache->QuestionLen = QuestionLen;
+				pCache->IsMyName = IsMyName;
+			}
+			else
+			{
+				pReply = DnsReplyBuf;
+				ReplyLen = _DNSReplyGen(pReply, pDnsName, QuestionLen);
+			}
+		}
+
+		if (!IsMyName &&
 		    (3 != tls_wifi_get_oneshot_flag()))
 		{
 			/* Not my dns name, so notify the client name error. */
@@ -269,19 +385,15 @@ void DNSS_RecvCb(void *Arg, struct udp_pcb *Pcb, struct pbuf *P, ip_addr_t *Addr
             struct netif *netif = tls_get_netif();
             if (!netif_is_up(netif))
 #endif
-			_DNSNameErrGenAndSend(Addr, Port, &DnsQuery, pDnsName, pDnsHeader->TansactionId);
+			_DNSReplySend(Addr, Port, pReply, ReplyLen, pDnsHeader->TansactionId, 1);
 		}
 		else
 		{
 			/* My dns name, so send the answer to the client. */
-			_DNSAnswerGenAndSend(Addr, Port, &DnsQuery, pDnsName, pDnsHeader->TansactionId);
+			_DNSReplySend(Addr, Port, pReply, ReplyLen, pDnsHeader->TansactionId, 0);
 		}
 	}while(0);
 
-	if(pDnsMsg)
-	{
-		tls_mem_free(pDnsMsg);
-	}
 	pbuf_free(P);
 }
 
@@ -309,6 +421,7 @@ INT8S DNSS_Config(INT8U * DnsName)
 
 	memset(DnsServer.DnsName, 0, 32);
 	MEMCPY(DnsServer.DnsName, DnsName, strlen((const char *)DnsName));
+	_DnsCacheFlush();
 
 	return DNSS_ERR_SUCCESS;
 }
@@ -87,14 +87,6 @@ typedef unsigned int INT32U;
 #endif
 typedef signed int INT32S;
 
-typedef struct __DNS_SERVER
-{
-	struct udp_pcb * Socket;
-	INT8U DnsName[32];
-	/* Attention!!! MUST BE __align(4) */
-	ip_addr_t HostIp;
-}DNS_SERVER;
-
 typedef struct __DNS_HEADER
 {
 	INT16U TansactionId;
@@ -119,6 +111,46 @@ typedef struct __DNS_ANSWER
 	INT32U Ttl;
 }DNS_ANSWER, *PDNS_ANSWER;
 
+#define DNSS_MSG_LEN      512 /* Largest query handled, the UDP limit of RFC 1035. */
+/* Answer record behind the question: name pointer, DNS_ANSWER, length and address. */
+#define DNSS_ANSWER_RR_LEN      (2 + sizeof(DNS_ANSWER) + 2 + 4)
+
+#define DNSS_CACHE_NUM      8 /* Number of cached answers. */
+#define DNSS_CACHE_NAME_LEN      64 /* Longest query name that is cached. */
+
+#define DNSS_RATE_CLIENT_NUM      8 /* Number of clients that are rate limited separately. */
+#define DNSS_RATE_PER_SEC      10 /* Queries per second allowed for each client... */
+#define DNSS_RATE_BURST      20 /* ...and the burst on top of that. */
+
+typedef struct __DNS_CACHE
+{
+	INT32U Hash;
+	INT16U QuestionLen; /* Query name and DNS_QUERY, 0 for an unused entry. */
+	INT8U IsMyName;
+	/* Preencoded answer with transaction id 0: header, question, answer record. */
+	INT8U Reply[sizeof(DNS_HEADER) + DNSS_CACHE_NAME_LEN + sizeof(DNS_QUERY) + DNSS_ANSWER_RR_LEN];
+}DNS_CACHE;
+
+typedef struct __DNS_CLIENT_RATE
+{
+	/* Attention!!! MUST BE __align(4) */
+	ip_addr_t Ip;
+	INT32U Last; /* sys_now() of the last refill. */
+	INT16U Tokens;
+}DNS_CLIENT_RATE;
+
+typedef struct __DNS_SERVER
+{
+	struct udp_pcb * Socket;
+	INT8U DnsName[32];
+	/* Attention!!! MUST BE __align(4) */
+	ip_addr_t HostIp;
+	DNS_CACHE Cache[DNSS_CACHE_NUM];
+	INT8U CacheNext;
+	INT8U RateNext;
+	DNS_CLIENT_RATE Rate[DNSS_RATE_CLIENT_NUM];
+}DNS_SERVER;
+
 void DNSS_RecvCb(void *Arg, struct udp_pcb *Pcb, struct pbuf *P, ip_addr_t *Addr, INT16U Port);
 INT8S DNSS_Config(INT8U * DnsName);
 INT8S DNSS_Start(struct netif *Netif, INT8U * DnsName);
@@ -14,6 +14,7 @@
 #endif
 #include "HTTPClient.h"
 #include "wm_crypto_hard.h"
+#include "wm_internal_flash.h"
 #endif
 #if TLS_CONFIG_HTTP_CLIENT
 
@@ -800,11 +801,372 @@ static void ssl_client_debug( void *ctx, int level,
 }
 #endif
 
+#if defined(MBEDTLS_SSL_CLI_C)
+/*
+ * Client sessions (session id and, if the server issued one, the ticket) of the
+ * last servers we talked to, so that reconnects resume instead of doing a full
+ * handshake. Optionally mirrored to flash to survive deep sleep.
+ */
+#define HTTP_SSL_SESSION_NUM        2
+#define HTTP_SSL_SESSION_KEY_LEN    64
+#define HTTP_SSL_TICKET_MAX         512     /* longer tickets are only kept in RAM */
+#define HTTP_SSL_SESSION_MAGIC      0x53534C53
+
+typedef struct
+{
+	char key[HTTP_SSL_SESSION_KEY_LEN];     /* host name, or address:port of the server */
+	mbedtls_ssl_session session;
+	u8 valid;
+} http_ssl_session_t;
+
+/* flash image of a session */
+typedef struct
+{
+	u32 magic;
+	char key[HTTP_SSL_SESSION_KEY_LEN];
+	u32 start;
+	s32 ciphersuite;
+	s32 compression;
+	u32 id_len;
+	u8 id[32];
+	u8 master[48];
+	u32 verify_result;
+	u32 ticket_len;
+	u32 ticket_lifetime;
+	u8 mfl_code;
+	u8 trunc_hmac;
+	u8 encrypt_then_mac;
+	u8 reserved;
+	u8 ticket[HTTP_SSL_TICKET_MAX];
+} http_ssl_session_rec_t;
+
+static http_ssl_session_t http_ssl_sessions[HTTP_SSL_SESSION_NUM];
+static u8 http_ssl_session_next = 0;
+static u32 http_ssl_session_flash_addr = 0;
+static u32 http_ssl_session_flash_size = 0;
+static tls_os_sem_t *http_ssl_session_sem = NULL;
+
+static void http_ssl_session_lock(void)
+{
+	tls_os_sem_t *sem = NULL;
+	u32 cpu_sr;
+
+	if (http_ssl_session_sem == NULL)
+	{
+		if (tls_os_sem_create(&sem, 1) != TLS_OS_SUCCESS)
+			return;
+		cpu_sr = tls_os_set_critical();
+		if (http_ssl_session_sem == NULL)
+		{
+			http_ssl_session_sem = sem;
+			sem = NULL;
+		}
+		tls_os_release_critical(cpu_sr);
+		if (sem)
+			tls_os_sem_delete(sem);
+	}
+	tls_os_sem_acquire(http_ssl_session_sem, 0);
+}
+
+static void http_ssl_session_unlock(void)
+{
+	if (http_ssl_session_sem)
+		tls_os_sem_release(http_ssl_session_sem);
+}
+
+static void http_ssl_session_key(int fd, const char *hostname, char *key)
+{
+	struct sockaddr_in sin;
+	socklen_t len = sizeof(sin);
+	u8 *ip;
+
+	key[0] = '\0';
+	if (hostname && hostname[0])
+	{
+		strncpy(key, hostname, HTTP_SSL_SESSION_KEY_LEN - 1);
+		key[HTTP_SSL_SESSION_KEY_LEN - 1] = '\0';
+	}
+	else if (getpeername(fd, (struct sockaddr *)&sin, &len) == 0)
+	{
+		ip = (u8 *)&sin.sin_addr.s_addr;
+		sprintf(key, "%d.%d.%d.%d:%d", ip[0], ip[1], ip[2], ip[3], ntohs(sin.sin_port));
+	}
+}
+
+static http_ssl_session_t *http_ssl_session_find(const char *key)
+{
+	int i;
+
+	for (i = 0; i < HTTP_SSL_SESSION_NUM; i++)
+	{
+		if (http_ssl_sessions[i].valid && !strcmp(http_ssl_sessions[i].key, key))
+			return &http_ssl_sessions[i];
+	}
+	return NULL;
+}
+
+static void http_ssl_session_drop(http_ssl_session_t *entry)
+{
+	if (entry->valid)
+		mbedtls_ssl_session_free(&entry->session);
+	memset(entry, 0, sizeof(http_ssl_session_t));
+}
+
+static void http_ssl_session_save(void)
+{
+	http_ssl_session_rec_t *recs;
+	mbedtls_ssl_session *session;
+	int i;
+
+	if (!http_ssl_session_flash_size)
+		return;
+
+	recs = tls_mem_alloc(sizeof(http_ssl_session_rec_t) * HTTP_SSL_SESSION_NUM);
+	if (!recs)
+		return;
+	memset(recs, 0, sizeof(http_ssl_session_rec_t) * HTTP_SSL_SESSION_NUM);
+
+	for (i = 0; i < HTTP_SSL_SESSION_NUM; i++)
+	{
+		if (!http_ssl_sessions[i].valid)
+			continue;
+		session = &http_ssl_sessions[i].session;
+		recs[i].magic = HTTP_SSL_SESSION_MAGIC;
+		memcpy(recs[i].key, http_ssl_sessions[i].key, HTTP_SSL_SESSION_KEY_LEN);
+#if defined(MBEDTLS_HAVE_TIME)
+		recs[i].start = (u32)session->start;
+#endif
+		recs[i].ciphersuite = session->ciphersuite;
+		recs[i].compression = session->compression;
+		recs[i].id_len = session->id_len;
+		memcpy(recs[i].id, session->id, sizeof(recs[i].id));
+		memcpy(recs[i].master, session->master, sizeof(recs[i].master));
+		recs[i].verify_result = session->verify_result;
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+		if (session->ticket && session->ticket_len <= HTTP_SSL_TICKET_MAX)
+		{
+			recs[i].ticket_len = session->ticket_len;
+			recs[i].ticket_lifetime = session->ticket_lifetime;
+			memcpy(recs[i].ticket, session->ticket, session->ticket_len);
+		}
+#endif
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+		recs[i].mfl_code = session->mfl_code;
+#endif
+#if defined(MBEDTLS_SSL_TRUNCATED_HMAC)
+		recs[i].trunc_hmac = (u8)session->trunc_hmac;
+#endif
+#if defined(MBEDTLS_SSL_ENCRYPT_THEN_MAC)
+		recs[i].encrypt_then_mac = (u8)session->encrypt_then_mac;
+#endif
+	}
+
+	tls_fls_write(http_ssl_session_flash_addr, (u8 *)recs, sizeof(http_ssl_session_rec_t) * HTTP_SSL_SESSION_NUM);
+	memset(recs, 0, sizeof(http_ssl_session_rec_t) * HTTP_SSL_SESSION_NUM);
+	tls_mem_free(recs);
+}
+
+static void http_ssl_session_load(void)
+{
+	http_ssl_session_rec_t *rec;
+	mbedtls_ssl_session *session;
+	int i;
+
+	rec = tls_mem_alloc(sizeof(http_ssl_session_rec_t));
+	if (!rec)
+		return;
+
+	for (i = 0; i < HTTP_SSL_SESSION_NUM; i++)
+	{
+		http_ssl_session_drop(&http_ssl_sessions[i]);
+		if (tls_fls_read(http_ssl_session_flash_addr + i * sizeof(http_ssl_session_rec_t), (u8 *)rec,
+		                 sizeof(http_ssl_session_rec_t)) != TLS_FLS_STATUS_OK)
+			continue;
+		if (rec->magic != HTTP_SSL_SESSION_MAGIC || rec->id_len > sizeof(rec->id) ||
+		    rec->ticket_len > HTTP_SSL_TICKET_MAX)
+			continue;
+
+		session = &http_ssl_sessions[i].session;
+		mbedtls_ssl_session_init(session);
+#if defined(MBEDTLS_HAVE_TIME)
+		session->start = (mbedtls_time_t)rec->start;
+#endif
+		session->ciphersuite = rec->ciphersuite;
+		session->compression = rec->compression;
+		session->id_len = rec->id_len;
+		memcpy(session->id, rec->id, sizeof(session->id));
+		memcpy(session->master, rec->master, sizeof(session->master));
+		session->verify_result = rec->verify_result;
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+		if (rec->ticket_len)
+		{
+			session->ticket = mbedtls_calloc(1, rec->ticket_len);
+			if (session->ticket == NULL)
+			{
+				mbedtls_ssl_session_free(session);
+				continue;
+			}
+			memcpy(session->ticket, rec->ticket, rec->ticket_len);
+			session->ticket_len = rec->ticket_len;
+			session->ticket_lifetime = rec->ticket_lifetime;
+		}
+#endif
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+		session->mfl_code = rec->mfl_code;
+#endif
+#if defined(MBEDTLS_SSL_TRUNCATED_HMAC)
+		session->trunc_hmac = rec->trunc_hmac;
+#endif
+#if defined(MBEDTLS_SSL_ENCRYPT_THEN_MAC)
+		session->encrypt_then_mac = rec->encrypt_then_mac;
+#endif
+		memcpy(http_ssl_sessions[i].key, rec->key, HTTP_SSL_SESSION_KEY_LEN);
+		http_ssl_sessions[i].key[HTTP_SSL_SESSION_KEY_LEN - 1] = '\0';
+		http_ssl_sessions[i].valid = 1;
+	}
+
+	memset(rec, 0, sizeof(http_ssl_session_rec_t));
+	tls_mem_free(rec);
+}
+
+/* offer the saved session of this server, if any */
+static void http_ssl_session_resume(tls_ssl_t *ssl, const char *key)
+{
+	http_ssl_session_t *entry;
+
+	if (!key[0])
+		return;
+
+	http_ssl_session_lock();
+	entry = http_ssl_session_find(key);
+	if (entry)
+		mbedtls_ssl_set_session(&ssl->ssl, &entry->session);
+	http_ssl_session_unlock();
+}
+
+/* keep the session of a completed handshake, unless it is the one we already have */
+static void http_ssl_session_keep(tls_ssl_t *ssl, const char *key)
+{
+	http_ssl_session_t *entry;
+	mbedtls_ssl_session session;
+
+	if (!key[0])
+		return;
+
+	mbedtls_ssl_session_init(&session);
+	if (mbedtls_ssl_get_session(&ssl->ssl, &session) != 0)
+	{
+		mbedtls_ssl_session_free(&session);
+		return;
+	}
+#if defined(MBEDTLS_X509_CRT_PARSE_C)
+	/* not needed to resume */
+	if (session.peer_cert)
+	{
+		mbedtls_x509_crt_free(session.peer_cert);
+		mbedtls_free(session.peer_cert);
+		session.peer_cert = NULL;
+	}
+#endif
+
+	http_ssl_session_lock();
+	entry = http_ssl_session_find(key);
+	if (entry && entry->session.id_len == session.id_len &&
+	    !memcmp(entry->session.id, session.id, session.id_len) &&
+	    !memcmp(entry->session.master, session.master, sizeof(session.master))
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+	    && entry->session.ticket_len == session.ticket_len &&
+	    (!session.ticket_len || !memcmp(entry->session.ticket, session.ticket, session.ticket_len))
+#endif
+	   )
+	{
+		http_ssl_session_unlock();
+		mbedtls_ssl_session_free(&session);
+		return;
+	}
+
+	if (!entry)
+	{
+		entry = &http_ssl_sessions[http_ssl_session_next];
+		http_ssl_session_next = (http_ssl_session_next + 1) % HTTP_SSL_SESSION_NUM;
+	}
+	http_ssl_session_drop(entry);
+	strcpy(entry->key, key);
+	entry->session = session;
+	entry->valid = 1;
+	http_ssl_session_save();
+	http_ssl_session_unlock();
+}
+
+int HTTPWrapperSSLSessionPersist(unsigned int flash_addr, unsigned int flash_size)
+{
+	if (flash_size && flash_size < sizeof(http_ssl_session_rec_t) * HTTP_SSL_SESSION_NUM)
+		return -1;
+
+	http_ssl_session_lock();
+	http_ssl_session_flash_addr = flash_addr;
+	http_ssl_session_flash_size = flash_size;
+	if (flash_size)
+		http_ssl_session_load();
+	http_ssl_session_unlock();
+
+	return 0;
+}
+
+void HTTPWrapperSSLSessionClear(void)
+{
+	int i;
+
+	http_ssl_session_lock();
+	for (i = 0; i < HTTP_SSL_SESSION_NUM; i++)
+		http_ssl_session_drop(&http_ssl_sessions[i]);
+	http_ssl_session_save();
+	http_ssl_session_unlock();
+}
+#endif /* MBEDTLS_SSL_CLI_C */
+
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+static unsigned char http_ssl_mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_4096;
+#endif
+static unsigned int http_ssl_in_len = 0;
+
+int HTTPWrapperSSLBufferConfig(unsigned int max_frag_len, unsigned int in_len)
+{
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+	unsigned char mfl_code;
+
+	switch (max_frag_len)
+	{
+		case 0:    mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_NONE; break;
+		case 512:  mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_512;  break;
+		case 1024: mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_1024; break;
+		case 2048: mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_2048; break;
+		case 4096: mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_4096; break;
+		default:   return -1;
+	}
+#else
+	if (max_frag_len)
+		return -1;
+#endif
+	if (in_len > MBEDTLS_SSL_IN_CONTENT_LEN)
+		return -1;
+
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+	http_ssl_mfl_code = mfl_code;
+#endif
+	http_ssl_in_len = in_len;
+
+	return 0;
+}
+
 int HTTPWrapperSSLConnect(tls_ssl_t **ssl_p,int fd,const struct sockaddr *name,int namelen,char *hostname)
 {
 	int ret = MBEDTLS_EXIT_SUCCESS;
 	const char *pers = "ssl_client";
 	tls_ssl_t *ssl = NULL;
+#if defined(MBEDTLS_SSL_CLI_C)
+	char session_key[HTTP_SSL_SESSION_KEY_LEN];
+#endif
 
 	*ssl_p = NULL;
 
@@ -919,6 +1281,13 @@ int HTTPWrapperSSLConnect(tls_ssl_t **ssl_p,int fd,const struct sockaddr *name,i
 
 	mbedtls_ssl_conf_read_timeout( &ssl->conf, 5000 );
 
+	/* ask for short records and trim the buffers once the server agreed */
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+	mbedtls_ssl_conf_max_frag_len( &ssl->conf, http_ssl_mfl_code );
+#endif
+	mbedtls_ssl_conf_content_len( &ssl->conf, http_ssl_in_len, 0 );
+	mbedtls_ssl_conf_buf_shrink( &ssl->conf, MBEDTLS_SSL_BUF_SHRINK_ENABLED );
+
 	if( ( ret = mbedtls_ssl_setup( &ssl->ssl, &ssl->conf ) ) != 0 )
 	{
 		mbedtls_printf( " failed\n	! mbedtls_ssl_setup returned %d\n\n", ret );
@@ -934,6 +1303,11 @@ int HTTPWrapperSSLConnect(tls_ssl_t **ssl_p,int fd,const struct sockaddr *name,i
 	//mbedtls_ssl_set_bio( &ssl->ssl, &ssl->server_fd, mbedtls_net_send, mbedtls_net_recv, NULL );
 	mbedtls_ssl_set_bio( &ssl->ssl, &ssl->server_fd, mbedtls_net_send, mbedtls_net_recv, mbedtls_net_recv_timeout);
 
+#if defined(MBEDTLS_SSL_CLI_C)
+	http_ssl_session_key(fd, hostname, session_key);
+	http_ssl_session_resume(ssl, session_key);
+#endif
+
 	/*
 	 * 4. Handshake
 	 */
@@ -951,6 +1325,10 @@ int HTTPWrapperSSLConnect(tls_ssl_t **ssl_p,int fd,const struct sockaddr *name,i
 
 	mbedtls_printf( " ok\n" );
 
+#if defined(MBEDTLS_SSL_CLI_C)
+	http_ssl_session_keep(ssl, session_key);
+#endif
+
 	*ssl_p = ssl;
 
 	return 0;
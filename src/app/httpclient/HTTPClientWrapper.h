@@ -112,6 +112,20 @@ typedef struct _ssl_t
     int                                 HTTPWrapperSSLRecv              (tls_ssl_t *ssl,int s,char *buf, int len,int flags);
     int                                 HTTPWrapperSSLClose             (tls_ssl_t *ssl, int s);
     int                                 HTTPWrapperSSLRecvPending       (tls_ssl_t *ssl);
+#if TLS_CONFIG_USE_MBEDTLS && defined(MBEDTLS_SSL_CLI_C)
+    // Keep resumable client sessions in flash_size bytes of flash at flash_addr (0 size: RAM only),
+    // and load the ones stored there. The region holds session secrets in the clear.
+    int                                 HTTPWrapperSSLSessionPersist    (unsigned int flash_addr, unsigned int flash_size);
+    // Forget all client sessions, including the flash copy
+    void                                HTTPWrapperSSLSessionClear      (void);
+#endif
+#if TLS_CONFIG_USE_MBEDTLS
+    // Record size for later connections: request max_frag_len (512/1024/2048/4096, 0 = none,
+    // default 4096) from the server, which also bounds the send buffer after the handshake,
+    // and size the receive buffer for in_len byte records (0 = default, only safe below
+    // 16384 for servers known to honour the request).
+    int                                 HTTPWrapperSSLBufferConfig      (unsigned int max_frag_len, unsigned int in_len);
+#endif
 #endif
     // Global wrapper Functions
 #define                             IToA                            HTTPWrapperItoa
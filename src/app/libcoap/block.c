@@ -15,6 +15,10 @@
 #include "debug_libcoap.h"
 #include "block.h"
 
+#ifdef WITH_LWIP
+#include "wm_internal_flash.h"
+#endif /* WITH_LWIP */
+
 #if (COAP_MAX_PDU_SIZE - 6) < (1 << (COAP_MAX_BLOCK_SZX + 4))
 #error "COAP_MAX_BLOCK_SZX too large"
 #endif
@@ -137,4 +141,144 @@ coap_add_block(coap_pdu_t *pdu, unsigned int len, const unsigned char *data,
 		       min(len - start, (unsigned int)(1 << (block_szx + 4))),
 		       data + start);
 }
+
+int
+coap_add_block_stream(coap_pdu_t *request, coap_pdu_t *response,
+                      size_t total, coap_block_read_t read, void *arg) {
+  coap_block_t block;
+  size_t start, len;
+  unsigned char *data;
+  int res;
+
+  assert(response);
+  assert(response->data == NULL);
+
+  if (!request || !coap_get_block(request, COAP_OPTION_BLOCK2, &block)) {
+    if (total == 0)
+      return 1;
+    block.num = 0;
+    block.m = 0;
+    block.szx = COAP_MAX_BLOCK_SZX;
+    /* no need for a Block2 option when everything fits */
+    if (response->length + total + 1 <= response->max_size) {
+      len = total;
+      start = 0;
+      goto add_data;
+    }
+  }
+
+  if (block.szx > COAP_MAX_BLOCK_SZX) {
+    block.num <<= block.szx - COAP_MAX_BLOCK_SZX;
+    block.szx = COAP_MAX_BLOCK_SZX;
+  }
+
+  res = coap_write_block_opt(&block, COAP_OPTION_BLOCK2, response, total);
+  if (res < 0)
+    return res;
+
+  start = block.num << (block.szx + 4);
+  len = min(total - start, (size_t)1 << (block.szx + 4));
+
+ add_data:
+  if (response->length + len + 1 > response->max_size) {
+    warn("coap_add_block_stream: block too large for PDU\n");
+    return -3;
+  }
+
+  /* read the block straight into the PDU behind the payload marker */
+  data = (unsigned char *)response->hdr + response->length;
+  *data++ = COAP_PAYLOAD_START;
+  if (read(arg, start, data, len) != (int)len) {
+    debug("coap_add_block_stream: cannot read block at %u\n", (unsigned int)start);
+    return -4;
+  }
+
+  response->data = data;
+  response->length += len + 1;
+  return 1;
+}
+
+int
+coap_handle_block1(coap_pdu_t *request, coap_pdu_t *response,
+                   size_t max_size, coap_block_write_t write, void *arg) {
+  coap_block_t block;
+  size_t offset, len;
+  unsigned char *data;
+  unsigned char buf[4];
+  int has_block;
+
+  assert(request);
+  assert(response);
+
+  if (!coap_get_data(request, &len, &data)) {
+    len = 0;
+    data = NULL;
+  }
+
+  has_block = coap_get_block(request, COAP_OPTION_BLOCK1, &block);
+  if (!has_block) {
+    block.num = 0;
+    block.m = 0;
+    block.szx = 0;
+  }
+
+  if (has_block && block.szx == 7) {
+    response->hdr->code = COAP_RESPONSE_400;
+    return -1;
+  }
+
+  offset = block.num << (block.szx + 4);
+  if (has_block && block.m && len != (size_t)1 << (block.szx + 4)) {
+    /* only the last block may be shorter than the block size */
+    response->hdr->code = COAP_RESPONSE_400;
+    return -1;
+  }
+
+  if (offset + len > max_size) {
+    response->hdr->code = COAP_RESPONSE_CODE(413);
+    return -2;
+  }
+
+  if (write(arg, offset, data, len, !block.m) < 0) {
+    response->hdr->code = COAP_RESPONSE_500;
+    return -3;
+  }
+
+  if (has_block)
+    coap_add_option(response, COAP_OPTION_BLOCK1,
+                    coap_encode_var_bytes(buf, ((block.num << 4) |
+                                                (block.m << 3) |
+                                                block.szx)),
+                    buf);
+
+  response->hdr->code = block.m ? COAP_RESPONSE_CODE(231) : COAP_RESPONSE_CODE(204);
+  return 1;
+}
+
+#ifdef WITH_LWIP
+int
+coap_block_flash_read(void *arg, size_t offset, unsigned char *buf, size_t len) {
+  coap_block_flash_t *fl = (coap_block_flash_t *)arg;
+
+  if (offset + len > fl->size)
+    return -1;
+  if (tls_fls_read(fl->addr + offset, buf, len) != TLS_FLS_STATUS_OK)
+    return -1;
+  return len;
+}
+
+int
+coap_block_flash_write(void *arg, size_t offset, const unsigned char *buf,
+                       size_t len, int last) {
+  coap_block_flash_t *fl = (coap_block_flash_t *)arg;
+
+  if (offset + len > fl->size)
+    return -1;
+  if (len && tls_fls_write(fl->addr + offset, (unsigned char *)buf, len) != TLS_FLS_STATUS_OK)
+    return -1;
+  if (last)
+    fl->length = offset + len;
+  return len;
+}
+#endif /* WITH_LWIP */
 #endif /* WITHOUT_BLOCK  */
@@ -207,6 +207,19 @@ coap_print_addr(const struct coap_address_t *addr, unsigned char *buf, size_t le
   p += snprintf((char *)p, buf + len - p + 1, ":%d", port);
 
   return buf + len - p;
+#elif defined(WITH_LWIP)
+  unsigned char *p;
+  int n;
+
+  if (ipaddr_ntoa_r(&addr->addr, (char *)buf, len) == NULL)
+    return 0;
+
+  p = buf + strnlen((char *)buf, len);
+  n = snprintf((char *)p, buf + len - p, ":%d", addr->port);
+  if (n < 0 || n >= buf + len - p)
+    return 0;
+
+  return p + n - buf;
 #else /* HAVE_ARPA_INET_H */
 # if WITH_CONTIKI
   unsigned char *p = buf;
@@ -132,6 +132,90 @@ int coap_add_block(coap_pdu_t *pdu,
                    const unsigned char *data,
                    unsigned int block_num,
                    unsigned char block_szx);
+
+/**
+ * Reads @p len bytes of a resource, starting at @p offset, into @p buf.
+ *
+ * @return The number of bytes read or a negative value on error.
+ */
+typedef int (*coap_block_read_t)(void *arg, size_t offset,
+                                 unsigned char *buf, size_t len);
+
+/**
+ * Writes @p len bytes from @p buf to a resource at @p offset. @p last is set
+ * for the final block, after which the resource is @p offset + @p len bytes
+ * long.
+ *
+ * @return The number of bytes written or a negative value on error.
+ */
+typedef int (*coap_block_write_t)(void *arg, size_t offset,
+                                  const unsigned char *buf, size_t len,
+                                  int last);
+
+/**
+ * Adds the block of a @p total bytes long resource that is requested by the
+ * Block2 option of @p request to @p response, reading it with @p read
+ * directly into the PDU. Without a Block2 option the whole resource is added
+ * if it fits, otherwise the first block. Requested block sizes above
+ * COAP_MAX_BLOCK_SZX are reduced. No options must be added to @p response
+ * afterwards.
+ *
+ * @param request  The request, may be @c NULL for notifications.
+ * @param response The response to add the Block2 option and data to.
+ * @param total    The length of the resource.
+ * @param read     Reads the resource.
+ * @param arg      Passed to @p read.
+ *
+ * @return         @c 1 on success, or a negative value on error (-2 for a
+ *                 block beyond the end of the resource).
+ */
+int coap_add_block_stream(coap_pdu_t *request,
+                          coap_pdu_t *response,
+                          size_t total,
+                          coap_block_read_t read,
+                          void *arg);
+
+/**
+ * Stores the payload of a PUT/POST @p request, one Block1 block at a time,
+ * with @p write and sets the code of @p response: 2.31 Continue (with the
+ * Block1 option echoed) while more blocks follow, 2.04 Changed for the last
+ * one, or 4.00, 4.13 or 5.00 on error. Requests without a Block1 option are
+ * written in one go.
+ *
+ * @param request  The request.
+ * @param response The response.
+ * @param max_size The maximum length of the resource.
+ * @param write    Writes the resource.
+ * @param arg      Passed to @p write.
+ *
+ * @return         @c 1 on success, or a negative value on error.
+ */
+int coap_handle_block1(coap_pdu_t *request,
+                       coap_pdu_t *response,
+                       size_t max_size,
+                       coap_block_write_t write,
+                       void *arg);
+
+#ifdef WITH_LWIP
+/**
+ * A resource stored in a flash region, for use with coap_block_flash_read()
+ * and coap_block_flash_write().
+ */
+typedef struct {
+  unsigned int addr;      /**< start of the region */
+  unsigned int size;      /**< size of the region */
+  unsigned int length;    /**< length of the stored resource */
+} coap_block_flash_t;
+
+/** A coap_block_read_t for a coap_block_flash_t. */
+int coap_block_flash_read(void *arg, size_t offset, unsigned char *buf,
+                          size_t len);
+
+/** A coap_block_write_t for a coap_block_flash_t, sets its length. */
+int coap_block_flash_write(void *arg, size_t offset, const unsigned char *buf,
+                           size_t len, int last);
+#endif /* WITH_LWIP */
+
 /**@}*/
 
 #endif /* _COAP_BLOCK_H_ */
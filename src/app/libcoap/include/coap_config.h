@@ -25,4 +25,15 @@
 
 #define HAVE_MALLOC
 
+/* Number of PDUs (received, outgoing and awaiting acknowledgement) and of
+ * retransmission nodes that can exist at the same time. */
+#ifndef COAP_PDU_MAXCNT
+#define COAP_PDU_MAXCNT 6
+#endif
+
+/* Number of pbufs carrying outgoing PDUs, COAP_MAX_PDU_SIZE bytes each. */
+#ifndef COAP_PDU_BUF_MAXCNT
+#define COAP_PDU_BUF_MAXCNT 4
+#endif
+
 #endif /* _CONFIG_H_ */
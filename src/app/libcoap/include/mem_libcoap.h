@@ -87,6 +87,20 @@ coap_malloc_type(coap_memory_tag_t type , size_t size);
 
 void
 coap_free_type(coap_memory_tag_t type , void *p);
+
+#ifdef WITH_LWIP
+struct pbuf;
+
+/**
+ * Allocates a pbuf for an outgoing PDU of @p size bytes from a fixed pool
+ * of COAP_PDU_BUF_MAXCNT buffers. The buffer returns to the pool when the
+ * pbuf is freed.
+ *
+ * @param size The PDU size, at most COAP_MAX_PDU_SIZE.
+ * @return     The pbuf or @c NULL when the pool is exhausted.
+ */
+struct pbuf *coap_pdu_pbuf_alloc(size_t size);
+#endif /* WITH_LWIP */
 #endif
 
 
@@ -20,6 +20,12 @@
 #define COAP_RESOURCE_CHECK_TIME 2
 #endif /* COAP_RESOURCE_CHECK_TIME */
 
+#ifndef COAP_NOTIFY_MAX_PER_CHECK
+/** Maximum number of notifications sent by one coap_check_notify() call.
+ * Observers beyond that are notified by the next call. */
+#define COAP_NOTIFY_MAX_PER_CHECK 8
+#endif /* COAP_NOTIFY_MAX_PER_CHECK */
+
 #ifdef COAP_RESOURCES_NOHASH
 #  include "utlist.h"
 #else
@@ -348,7 +354,9 @@ int coap_delete_observer(coap_resource_t *resource,
 
 /**
  * Checks for all known resources, if they are dirty and notifies subscribed
- * observers.
+ * observers. All changes since the last call are sent as one batch of at most
+ * COAP_NOTIFY_MAX_PER_CHECK notifications; with lwIP this is called every
+ * COAP_RESOURCE_CHECK_TIME seconds by the context.
  */
 void coap_check_notify(coap_context_t *context);
 
@@ -32,6 +32,135 @@ coap_memory_init(void) {
 #define UNUSED_PARAM
 #endif /* __GNUC__ */
 
+#ifdef WITH_LWIP
+#include "net.h"
+#include "pdu.h"
+#include "coap_io.h"
+#include "debug_libcoap.h"
+#include <lwip/sys.h>
+
+/* The per-message objects (PDUs, retransmission nodes, received packets and
+ * the pbufs carrying outgoing PDUs) come from fixed pools so that a busy
+ * server does not grow or fragment the heap. Everything else is long-lived
+ * and stays on the heap. */
+
+struct coap_pdu_buf_t {
+  struct pbuf_custom pc;        /* first: the pbuf is cast back to the slot */
+  u8_t buf[LWIP_MEM_ALIGN_SIZE(PBUF_TRANSPORT) + COAP_MAX_PDU_SIZE];
+  u8_t used;                    /* after buf, which must stay word aligned */
+};
+
+static coap_pdu_t pdu_storage[COAP_PDU_MAXCNT];
+static u8_t pdu_used[COAP_PDU_MAXCNT];
+static coap_queue_t node_storage[COAP_PDU_MAXCNT];
+static u8_t node_used[COAP_PDU_MAXCNT];
+static coap_packet_t packet_storage;
+static u8_t packet_used;
+static struct coap_pdu_buf_t pdu_buf_storage[COAP_PDU_BUF_MAXCNT];
+
+static void *
+pool_alloc(void *storage, u8_t *used, int count, size_t size) {
+  int i;
+  SYS_ARCH_DECL_PROTECT(lev);
+
+  SYS_ARCH_PROTECT(lev);
+  for (i = 0; i < count; i++) {
+    if (!used[i]) {
+      used[i] = 1;
+      SYS_ARCH_UNPROTECT(lev);
+      return (u8_t *)storage + i * size;
+    }
+  }
+  SYS_ARCH_UNPROTECT(lev);
+  debug("coap_malloc_type: pool exhausted\n");
+  return NULL;
+}
+
+static void
+pool_free(void *storage, u8_t *used, size_t size, void *p) {
+  SYS_ARCH_DECL_PROTECT(lev);
+
+  SYS_ARCH_PROTECT(lev);
+  used[((u8_t *)p - (u8_t *)storage) / size] = 0;
+  SYS_ARCH_UNPROTECT(lev);
+}
+
+static void
+coap_pdu_buf_free(struct pbuf *p) {
+  struct coap_pdu_buf_t *slot = (struct coap_pdu_buf_t *)p;
+  SYS_ARCH_DECL_PROTECT(lev);
+
+  SYS_ARCH_PROTECT(lev);
+  slot->used = 0;
+  SYS_ARCH_UNPROTECT(lev);
+}
+
+struct pbuf *
+coap_pdu_pbuf_alloc(size_t size) {
+  struct coap_pdu_buf_t *slot = NULL;
+  int i;
+  SYS_ARCH_DECL_PROTECT(lev);
+
+  if (size > COAP_MAX_PDU_SIZE)
+    return NULL;
+
+  SYS_ARCH_PROTECT(lev);
+  for (i = 0; i < COAP_PDU_BUF_MAXCNT; i++) {
+    if (!pdu_buf_storage[i].used) {
+      slot = &pdu_buf_storage[i];
+      slot->used = 1;
+      break;
+    }
+  }
+  SYS_ARCH_UNPROTECT(lev);
+
+  if (!slot) {
+    debug("coap_pdu_pbuf_alloc: pool exhausted\n");
+    return NULL;
+  }
+
+  slot->pc.custom_free_function = coap_pdu_buf_free;
+  return pbuf_alloced_custom(PBUF_TRANSPORT, size, PBUF_RAM, &slot->pc,
+                             slot->buf, sizeof(slot->buf));
+}
+
+void *
+coap_malloc_type(coap_memory_tag_t type, size_t size) {
+  switch (type) {
+  case COAP_PDU:
+    return pool_alloc(pdu_storage, pdu_used, COAP_PDU_MAXCNT, sizeof(coap_pdu_t));
+  case COAP_NODE:
+    return pool_alloc(node_storage, node_used, COAP_PDU_MAXCNT, sizeof(coap_queue_t));
+  case COAP_PACKET:
+    return pool_alloc(&packet_storage, &packet_used, 1, sizeof(coap_packet_t));
+  default:
+    return tls_mem_alloc(size);
+  }
+}
+
+void
+coap_free_type(coap_memory_tag_t type, void *p) {
+  if (!p)
+    return;
+
+  switch (type) {
+  case COAP_PDU:
+    pool_free(pdu_storage, pdu_used, sizeof(coap_pdu_t), p);
+    break;
+  case COAP_NODE:
+    pool_free(node_storage, node_used, sizeof(coap_queue_t), p);
+    break;
+  case COAP_PACKET:
+    pool_free(&packet_storage, &packet_used, sizeof(coap_packet_t), p);
+    break;
+  default:
+    tls_mem_free(p);
+    break;
+  }
+}
+
+#else /* WITH_LWIP */
+
 void *
 coap_malloc_type(coap_memory_tag_t type UNUSED_PARAM, size_t size) {
   return tls_mem_alloc(size);
@@ -41,6 +170,7 @@ void
 coap_free_type(coap_memory_tag_t type UNUSED_PARAM, void *p) {
   tls_mem_free(p);
 }
+#endif /* WITH_LWIP */
 
 #else /* HAVE_MALLOC */
 
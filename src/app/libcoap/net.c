@@ -33,7 +33,7 @@
 #ifdef WITH_LWIP
 #include <lwip/pbuf.h>
 #include <lwip/udp.h>
-#include <lwip/timers.h>
+#include <lwip/timeouts.h>
 #endif
 
 #include "debug_libcoap.h"
@@ -133,6 +133,9 @@ coap_free_node(coap_queue_t *node) {
 
 static void coap_retransmittimer_execute(void *arg);
 static void coap_retransmittimer_restart(coap_context_t *ctx);
+#ifndef WITHOUT_OBSERVE
+static void coap_notifytimer_execute(void *arg);
+#endif /* WITHOUT_OBSERVE */
 
 static inline coap_queue_t *
 coap_malloc_node() {
@@ -386,6 +389,9 @@ coap_new_context(
   }
 #ifdef WITH_LWIP
   c->endpoint->context = c;
+#ifndef WITHOUT_OBSERVE
+  sys_timeout(COAP_RESOURCE_CHECK_TIME * 1000, coap_notifytimer_execute, (void*)c);
+#endif /* WITHOUT_OBSERVE */
 #endif
 
 #ifdef WITH_POSIX
@@ -427,6 +433,9 @@ coap_free_context(coap_context_t *context) {
 #ifdef WITH_LWIP
   context->sendqueue = NULL;
   coap_retransmittimer_restart(context);
+#ifndef WITHOUT_OBSERVE
+  sys_untimeout(coap_notifytimer_execute, (void*)context);
+#endif /* WITHOUT_OBSERVE */
 #endif
 
   coap_delete_all_resources(context);
@@ -1732,8 +1741,6 @@ PROCESS_THREAD(coap_retransmit_process, ev, data)
  * the restart function has to be called. nothing insurmountable, but it can
  * also be implemented when things have stabilized, and the performance
  * penality is minimal
- *
- * also, this completely ignores COAP_RESOURCE_CHECK_TIME.
  * */
 
 static void coap_retransmittimer_execute(void *arg)
@@ -1803,4 +1810,18 @@ static void coap_retransmittimer_restart(coap_context_t *ctx)
 		ctx->timer_configured = 1;
 	}
 }
+
+#ifndef WITHOUT_OBSERVE
+/* Resources marked dirty since the last run are notified here in one batch,
+ * so that several updates of a resource within COAP_RESOURCE_CHECK_TIME cost
+ * a single notification per observer. */
+static void coap_notifytimer_execute(void *arg)
+{
+	coap_context_t *ctx = (coap_context_t*)arg;
+
+	coap_check_notify(ctx);
+
+	sys_timeout(COAP_RESOURCE_CHECK_TIME * 1000, coap_notifytimer_execute, (void*)ctx);
+}
+#endif /* WITHOUT_OBSERVE */
 #endif
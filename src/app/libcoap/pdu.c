@@ -97,7 +97,7 @@ coap_pdu_init(unsigned char type, unsigned char code,
 #ifdef WITH_LWIP
   pdu = (coap_pdu_t*)coap_malloc_type(COAP_PDU, sizeof(coap_pdu_t));
   if (!pdu) return NULL;
-  p = pbuf_alloc(PBUF_TRANSPORT, size, PBUF_RAM);
+  p = coap_pdu_pbuf_alloc(size);
   if (p == NULL) {
     coap_free_type(COAP_PDU, pdu);
     pdu = NULL;
@@ -600,7 +600,8 @@ coap_delete_observer(coap_resource_t *resource, const coap_address_t *observer,
 }
 
 static void
-coap_notify_observers(coap_context_t *context, coap_resource_t *r) {
+coap_notify_observers(coap_context_t *context, coap_resource_t *r,
+                      unsigned int *budget) {
   coap_method_handler_t h;
   coap_subscription_t *obs;
   str token;
@@ -619,6 +620,14 @@ coap_notify_observers(coap_context_t *context, coap_resource_t *r) {
         /* running this resource due to partiallydirty, but this observation's notification was already enqueued */
         continue;
 
+      if (*budget == 0) {
+        /* this check's share of notifications is used up, the
+         * remaining observers are served by the next check */
+        obs->dirty = 1;
+        r->partiallydirty = 1;
+        continue;
+      }
+
       coap_tid_t tid = COAP_INVALID_TID;
       obs->dirty = 0;
       /* initialize response */
@@ -669,6 +678,8 @@ coap_notify_observers(coap_context_t *context, coap_resource_t *r) {
 	debug("coap_check_notify: sending failed, resource stays partially dirty\n");
         obs->dirty = 1;
         r->partiallydirty = 1;
+      } else {
+        (*budget)--;
       }
 
     }
@@ -681,9 +692,10 @@ coap_notify_observers(coap_context_t *context, coap_resource_t *r) {
 
 void
 coap_check_notify(coap_context_t *context) {
+  unsigned int budget = COAP_NOTIFY_MAX_PER_CHECK;
 
   RESOURCES_ITER(context->resources, r) {
-    coap_notify_observers(context, r);
+    coap_notify_observers(context, r, &budget);
   }
 }
 
@@ -267,7 +267,7 @@
  *            digests and ciphers instead.
  *
  */
-//#define MBEDTLS_AES_ALT /* w600/w800 hard key only 16bytes length */
+#define MBEDTLS_AES_ALT /* w600/w800 hard key only 16bytes length, other key sizes use the software fallback */
 #define MBEDTLS_ARC4_ALT
 #define MBEDTLS_DES_ALT
 #define MBEDTLS_MD5_ALT
@@ -324,7 +324,7 @@
 //#define MBEDTLS_MD5_PROCESS_ALT
 //#define MBEDTLS_RIPEMD160_PROCESS_ALT
 //#define MBEDTLS_SHA1_PROCESS_ALT
-//#define MBEDTLS_SHA256_PROCESS_ALT
+#define MBEDTLS_SHA256_PROCESS_ALT
 //#define MBEDTLS_SHA512_PROCESS_ALT
 //#define MBEDTLS_DES_SETKEY_ALT
 //#define MBEDTLS_DES_CRYPT_ECB_ALT
@@ -380,11 +380,11 @@
  * function.
  */
 /* Required for all the functions in this section */
-//#define MBEDTLS_ECP_INTERNAL_ALT
+#define MBEDTLS_ECP_INTERNAL_ALT
 /* Support for Weierstrass curves with Jacobi representation */
 //#define MBEDTLS_ECP_RANDOMIZE_JAC_ALT
-//#define MBEDTLS_ECP_ADD_MIXED_ALT
-//#define MBEDTLS_ECP_DOUBLE_JAC_ALT
+#define MBEDTLS_ECP_ADD_MIXED_ALT
+#define MBEDTLS_ECP_DOUBLE_JAC_ALT
 //#define MBEDTLS_ECP_NORMALIZE_JAC_MANY_ALT
 //#define MBEDTLS_ECP_NORMALIZE_JAC_ALT
 /* Support for curves with Montgomery arithmetic */
@@ -591,7 +591,7 @@
  *
  * Comment this macro to disable NIST curves optimisation.
  */
-//#define MBEDTLS_ECP_NIST_OPTIM
+#define MBEDTLS_ECP_NIST_OPTIM
 
 /**
  * \def MBEDTLS_ECDSA_DETERMINISTIC
@@ -1239,7 +1239,7 @@
  *
  * Comment this macro to disable support for the max_fragment_length extension
  */
-//#define MBEDTLS_SSL_MAX_FRAGMENT_LENGTH
+#define MBEDTLS_SSL_MAX_FRAGMENT_LENGTH
 
 /**
  * \def MBEDTLS_SSL_PROTO_SSL3
@@ -1385,7 +1385,7 @@
  *
  * Comment this macro to disable support for SSL session tickets
  */
-//#define MBEDTLS_SSL_SESSION_TICKETS
+#define MBEDTLS_SSL_SESSION_TICKETS
 
 /**
  * \def MBEDTLS_SSL_EXPORT_KEYS
@@ -1535,6 +1535,24 @@
  */
 //#define MBEDTLS_X509_RSASSA_PSS_SUPPORT
 
+/**
+ * \def MBEDTLS_SIG_VERIFY_CACHE
+ *
+ * Remember successful signature checks of certificates and CRLs for
+ * MBEDTLS_SIG_VERIFY_CACHE_TIMEOUT seconds, so that verifying the same chain
+ * again (repeated handshakes to the same server, OTA checks) skips the
+ * public key operations. Only the signatures are cached, validity periods,
+ * key usage and the profile are still checked every time.
+ *
+ * Module:  ports/sig_verify.c
+ * Caller:  library/x509_crt.c
+ *
+ * Requires: MBEDTLS_SHA256_C, MBEDTLS_PK_C
+ *
+ * Comment this macro to verify every signature from scratch.
+ */
+#define MBEDTLS_SIG_VERIFY_CACHE
+
 /**
  * \def MBEDTLS_ZLIB_SUPPORT
  *
@@ -2450,7 +2468,7 @@
  *
  * Requires: MBEDTLS_SSL_CACHE_C
  */
-//#define MBEDTLS_SSL_CACHE_C
+#define MBEDTLS_SSL_CACHE_C
 
 /**
  * \def MBEDTLS_SSL_COOKIE_C
@@ -2772,11 +2790,17 @@
 //#define MBEDTLS_PLATFORM_NV_SEED_WRITE_MACRO  mbedtls_platform_std_nv_seed_write /**< Default nv_seed_write function to use, can be undefined */
 
 /* SSL Cache options */
-//#define MBEDTLS_SSL_CACHE_DEFAULT_TIMEOUT       86400 /**< 1 day  */
-//#define MBEDTLS_SSL_CACHE_DEFAULT_MAX_ENTRIES      50 /**< Maximum entries in cache */
+#define MBEDTLS_SSL_CACHE_DEFAULT_TIMEOUT       86400 /**< 1 day  */
+#define MBEDTLS_SSL_CACHE_DEFAULT_MAX_ENTRIES       4 /**< Maximum entries in cache, each keeps a session (and the client certificate, if any) in RAM */
+
+/* Signature verification cache options */
+#define MBEDTLS_SIG_VERIFY_CACHE_TIMEOUT       3600 /**< Seconds a successful signature check is remembered */
+#define MBEDTLS_SIG_VERIFY_CACHE_MAX_ENTRIES      8 /**< Maximum entries in cache, 40 bytes each */
 
 /* SSL options */
 #define MBEDTLS_SSL_MAX_CONTENT_LEN             16384//8192 /**< Maxium fragment length in bytes, determines the size of each of the two internal I/O buffers. Especially when you encounter 0x7200 error, you can try to change it to a maximum of 16384 */
+#define MBEDTLS_SSL_IN_CONTENT_LEN              16384 /**< Largest record accepted, sizes the input buffer. Peers ignoring max_fragment_length send up to 16384 */
+#define MBEDTLS_SSL_OUT_CONTENT_LEN             MBEDTLS_SSL_MAX_CONTENT_LEN /**< Largest record or handshake message emitted, sizes the output buffer. Must hold the own certificate chain; use mbedtls_ssl_conf_buf_shrink() to trim it after the handshake */
 //#define MBEDTLS_SSL_DEFAULT_TICKET_LIFETIME     86400 /**< Lifetime of session tickets (if enabled) */
 //#define MBEDTLS_PSK_MAX_LEN               32 /**< Max size of TLS pre-shared keys, in bytes (default 256 bits) */
 //#define MBEDTLS_SSL_COOKIE_TIMEOUT        60 /**< Default expiration delay of DTLS cookies, in seconds if HAVE_TIME, or in number of cookies issued */
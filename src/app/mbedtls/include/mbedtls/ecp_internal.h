@@ -295,5 +295,20 @@ int mbedtls_internal_ecp_normalize_mxz( const mbedtls_ecp_group *grp,
 
 #endif /* MBEDTLS_ECP_INTERNAL_ALT */
 
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+/**
+ * \brief           Built-in comb table for the generator of the group.
+ *
+ * \param grp       The group.
+ * \param w         Set to the comb width the table was computed for.
+ *
+ * \return          The 2^(w-1) affine points ecp_precompute_comb() would
+ *                  produce for the generator, or NULL if there is none.
+ *                  The table is shared and must not be modified or freed.
+ */
+const mbedtls_ecp_point *mbedtls_ecp_comb_table( const mbedtls_ecp_group *grp,
+                                                 unsigned char *w );
+#endif
+
 #endif /* ecp_internal.h */
 
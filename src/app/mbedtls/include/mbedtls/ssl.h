@@ -189,6 +189,9 @@
 #define MBEDTLS_SSL_CERT_REQ_CA_LIST_ENABLED       1
 #define MBEDTLS_SSL_CERT_REQ_CA_LIST_DISABLED      0
 
+#define MBEDTLS_SSL_BUF_SHRINK_DISABLED         0
+#define MBEDTLS_SSL_BUF_SHRINK_ENABLED          1
+
 /*
  * Default range for DTLS retransmission timer value, in milliseconds.
  * RFC 6347 4.2.4.1 says from 1 second to 60 seconds.
@@ -223,6 +226,21 @@
 #define MBEDTLS_SSL_MAX_CONTENT_LEN         16384   /**< Size of the input / output buffer */
 #endif
 
+/*
+ * Maximum record payload accepted from / emitted to the peer. The two
+ * internal I/O buffers are sized from these separately; the incoming one
+ * has to hold the largest record the peer may send (2^14 unless a smaller
+ * Max Fragment Length was negotiated), the outgoing one only the largest
+ * handshake message or fragment we emit ourselves.
+ */
+#if !defined(MBEDTLS_SSL_IN_CONTENT_LEN)
+#define MBEDTLS_SSL_IN_CONTENT_LEN          MBEDTLS_SSL_MAX_CONTENT_LEN
+#endif
+
+#if !defined(MBEDTLS_SSL_OUT_CONTENT_LEN)
+#define MBEDTLS_SSL_OUT_CONTENT_LEN         MBEDTLS_SSL_MAX_CONTENT_LEN
+#endif
+
 /* \} name SECTION: Module settings */
 
 /*
@@ -710,6 +728,13 @@ struct mbedtls_ssl_config
     unsigned int dhm_min_bitlen;    /*!< min. bit length of the DHM prime   */
 #endif
 
+    size_t in_content_len;          /*!< incoming record payload limit,
+                                         0 for MBEDTLS_SSL_IN_CONTENT_LEN   */
+    size_t out_content_len;         /*!< outgoing record payload limit,
+                                         0 for MBEDTLS_SSL_OUT_CONTENT_LEN  */
+    void * (*f_buf_calloc)(size_t, size_t); /*!< I/O buffer allocator       */
+    void (*f_buf_free)(void *);     /*!< I/O buffer release                 */
+
     unsigned char max_major_ver;    /*!< max. major version used            */
     unsigned char max_minor_ver;    /*!< max. minor version used            */
     unsigned char min_major_ver;    /*!< min. major version used            */
@@ -758,6 +783,7 @@ struct mbedtls_ssl_config
     unsigned int cert_req_ca_list : 1;  /*!< enable sending CA list in
                                           Certificate Request messages?     */
 #endif
+    unsigned int buf_shrink : 1;    /*!< shrink I/O buffers after handshake */
 };
 
 
@@ -821,6 +847,7 @@ struct mbedtls_ssl_context
      * Record layer (incoming data)
      */
     unsigned char *in_buf;      /*!< input buffer                     */
+    size_t in_buf_len;          /*!< allocated size of in_buf         */
     unsigned char *in_ctr;      /*!< 64-bit incoming message counter
                                      TLS: maintained by us
                                      DTLS: read from peer             */
@@ -854,6 +881,7 @@ struct mbedtls_ssl_context
      * Record layer (outgoing data)
      */
     unsigned char *out_buf;     /*!< output buffer                    */
+    size_t out_buf_len;         /*!< allocated size of out_buf        */
     unsigned char *out_ctr;     /*!< 64-bit outgoing message counter  */
     unsigned char *out_hdr;     /*!< start of record header           */
     unsigned char *out_len;     /*!< two-bytes message length field   */
@@ -2123,6 +2151,57 @@ void mbedtls_ssl_conf_cert_req_ca_list( mbedtls_ssl_config *conf,
 int mbedtls_ssl_conf_max_frag_len( mbedtls_ssl_config *conf, unsigned char mfl_code );
 #endif /* MBEDTLS_SSL_MAX_FRAGMENT_LENGTH */
 
+/**
+ * \brief          Set the maximum record payload this configuration can
+ *                 receive and send, which sizes the two I/O buffers
+ *                 allocated by mbedtls_ssl_setup().
+ *                 (Default: MBEDTLS_SSL_IN_CONTENT_LEN and
+ *                 MBEDTLS_SSL_OUT_CONTENT_LEN)
+ *
+ * \note           A peer that does not honour the Max Fragment Length
+ *                 extension may send records of up to 2^14 bytes; reduce
+ *                 in_len below that only for peers known to negotiate it.
+ *                 out_len must still hold the largest handshake message
+ *                 sent, in particular the own certificate chain.
+ *
+ * \param conf     SSL configuration
+ * \param in_len   incoming limit, 0 for the compile-time default
+ * \param out_len  outgoing limit, 0 for the compile-time default
+ *
+ * \return         0 if successful or MBEDTLS_ERR_SSL_BAD_INPUT_DATA if a
+ *                 length exceeds the compile-time maximum
+ */
+int mbedtls_ssl_conf_content_len( mbedtls_ssl_config *conf,
+                                  size_t in_len, size_t out_len );
+
+/**
+ * \brief          Set the allocator used for the record I/O buffers, e.g.
+ *                 to place them in external RAM.
+ *                 (Default: mbedtls_calloc / mbedtls_free)
+ *
+ * \param conf     SSL configuration
+ * \param f_calloc allocation function, NULL for the default
+ * \param f_free   matching release function, NULL for the default
+ */
+void mbedtls_ssl_conf_buf_alloc( mbedtls_ssl_config *conf,
+                                 void * (*f_calloc)(size_t, size_t),
+                                 void (*f_free)(void *) );
+
+/**
+ * \brief          Shrink the I/O buffers once the handshake is over.
+ *                 The outgoing buffer is reduced to the maximum fragment
+ *                 length in use, the incoming one to the negotiated Max
+ *                 Fragment Length (if any). Both grow back to the
+ *                 configured size on mbedtls_ssl_session_reset().
+ *                 Ignored while renegotiation is enabled.
+ *                 (Default: MBEDTLS_SSL_BUF_SHRINK_DISABLED)
+ *
+ * \param conf     SSL configuration
+ * \param shrink   MBEDTLS_SSL_BUF_SHRINK_ENABLED or
+ *                 MBEDTLS_SSL_BUF_SHRINK_DISABLED
+ */
+void mbedtls_ssl_conf_buf_shrink( mbedtls_ssl_config *conf, int shrink );
+
 #if defined(MBEDTLS_SSL_TRUNCATED_HMAC)
 /**
  * \brief          Activate negotiation of truncated HMAC
@@ -149,13 +149,16 @@
 #define MBEDTLS_SSL_PADDING_ADD              0
 #endif
 
-#define MBEDTLS_SSL_PAYLOAD_LEN ( MBEDTLS_SSL_MAX_CONTENT_LEN    \
-                        + MBEDTLS_SSL_COMPRESSION_ADD            \
+#define MBEDTLS_SSL_PAYLOAD_OVERHEAD ( MBEDTLS_SSL_COMPRESSION_ADD    \
                         + MBEDTLS_MAX_IV_LENGTH                  \
                         + MBEDTLS_SSL_MAC_ADD                    \
                         + MBEDTLS_SSL_PADDING_ADD                \
                         )
 
+#define MBEDTLS_SSL_PAYLOAD_LEN ( MBEDTLS_SSL_MAX_CONTENT_LEN    \
+                        + MBEDTLS_SSL_PAYLOAD_OVERHEAD           \
+                        )
+
 /*
  * Check that we obey the standard's message size bounds
  */
@@ -168,6 +171,11 @@
 #error Bad configuration - protected record payload too large.
 #endif
 
+#if MBEDTLS_SSL_IN_CONTENT_LEN > MBEDTLS_SSL_MAX_CONTENT_LEN || \
+    MBEDTLS_SSL_OUT_CONTENT_LEN > MBEDTLS_SSL_MAX_CONTENT_LEN
+#error Bad configuration - in/out content larger than MBEDTLS_SSL_MAX_CONTENT_LEN.
+#endif
+
 /* Note: Even though the TLS record header is only 5 bytes
    long, we're internally using 8 bytes to store the
    implicit sequence number. */
@@ -176,6 +184,11 @@
 #define MBEDTLS_SSL_BUFFER_LEN  \
     ( ( MBEDTLS_SSL_HEADER_LEN ) + ( MBEDTLS_SSL_PAYLOAD_LEN ) )
 
+/* I/O buffer size needed for a given record content length */
+#define MBEDTLS_SSL_BUFFER_LEN_FOR( content_len )                       \
+    ( ( MBEDTLS_SSL_HEADER_LEN ) + ( content_len ) +                     \
+      ( MBEDTLS_SSL_PAYLOAD_OVERHEAD ) )
+
 /*
  * TLS extension flags (for extensions with outgoing ServerHello content
  * that need it (e.g. for RENEGOTIATION_INFO the server already knows because
@@ -593,6 +606,19 @@ void mbedtls_ssl_write_version( int major, int minor, int transport,
 void mbedtls_ssl_read_version( int *major, int *minor, int transport,
                        const unsigned char ver[2] );
 
+/*
+ * Record content that fits the I/O buffers currently allocated
+ */
+static inline size_t mbedtls_ssl_in_content_len( const mbedtls_ssl_context *ssl )
+{
+    return( ssl->in_buf_len - MBEDTLS_SSL_HEADER_LEN - MBEDTLS_SSL_PAYLOAD_OVERHEAD );
+}
+
+static inline size_t mbedtls_ssl_out_content_len( const mbedtls_ssl_context *ssl )
+{
+    return( ssl->out_buf_len - MBEDTLS_SSL_HEADER_LEN - MBEDTLS_SSL_PAYLOAD_OVERHEAD );
+}
+
 static inline size_t mbedtls_ssl_hdr_len( const mbedtls_ssl_context *ssl )
 {
 #if defined(MBEDTLS_SSL_PROTO_DTLS)
@@ -52,7 +52,20 @@
 #endif /* MBEDTLS_PLATFORM_C */
 #endif /* MBEDTLS_SELF_TEST */
 
-#if !defined(MBEDTLS_AES_ALT)
+#if defined(MBEDTLS_AES_ALT)
+/*
+ * The alternative implementation (ports/aes_alt.c) only hands 128-bit keys
+ * to the hardware: the key schedule and block functions below are built
+ * under the mbedtls_aes_sw_ names for its 192 and 256-bit fallback.
+ */
+#define mbedtls_aes_context             mbedtls_aes_sw_context
+#define mbedtls_aes_init                mbedtls_aes_sw_init
+#define mbedtls_aes_free                mbedtls_aes_sw_free
+#define mbedtls_aes_setkey_enc          mbedtls_aes_sw_setkey_enc
+#define mbedtls_aes_setkey_dec          mbedtls_aes_sw_setkey_dec
+#define mbedtls_internal_aes_encrypt    mbedtls_aes_sw_encrypt
+#define mbedtls_internal_aes_decrypt    mbedtls_aes_sw_decrypt
+#endif /* MBEDTLS_AES_ALT */
 
 /* Implementation that should never be optimized out by the compiler */
 static void mbedtls_zeroize( void *v, size_t n ) {
@@ -765,7 +778,7 @@ int mbedtls_internal_aes_encrypt( mbedtls_aes_context *ctx,
 }
 #endif /* !MBEDTLS_AES_ENCRYPT_ALT */
 
-#if !defined(MBEDTLS_DEPRECATED_REMOVED)
+#if !defined(MBEDTLS_DEPRECATED_REMOVED) && !defined(MBEDTLS_AES_ALT)
 void mbedtls_aes_encrypt( mbedtls_aes_context *ctx,
                           const unsigned char input[16],
                           unsigned char output[16] )
@@ -833,7 +846,7 @@ int mbedtls_internal_aes_decrypt( mbedtls_aes_context *ctx,
 }
 #endif /* !MBEDTLS_AES_DECRYPT_ALT */
 
-#if !defined(MBEDTLS_DEPRECATED_REMOVED)
+#if !defined(MBEDTLS_DEPRECATED_REMOVED) && !defined(MBEDTLS_AES_ALT)
 void mbedtls_aes_decrypt( mbedtls_aes_context *ctx,
                           const unsigned char input[16],
                           unsigned char output[16] )
@@ -842,6 +855,8 @@ void mbedtls_aes_decrypt( mbedtls_aes_context *ctx,
 }
 #endif /* !MBEDTLS_DEPRECATED_REMOVED */
 
+#if !defined(MBEDTLS_AES_ALT)
+
 /*
  * AES-ECB block encryption/decryption
  */
@@ -1057,6 +1072,16 @@ int mbedtls_aes_crypt_ctr( mbedtls_aes_context *ctx,
 
 #endif /* !MBEDTLS_AES_ALT */
 
+#if defined(MBEDTLS_AES_ALT)
+#undef mbedtls_aes_context
+#undef mbedtls_aes_init
+#undef mbedtls_aes_free
+#undef mbedtls_aes_setkey_enc
+#undef mbedtls_aes_setkey_dec
+#undef mbedtls_internal_aes_encrypt
+#undef mbedtls_internal_aes_decrypt
+#endif /* MBEDTLS_AES_ALT */
+
 #if defined(MBEDTLS_SELF_TEST)
 /*
  * AES test vectors from:
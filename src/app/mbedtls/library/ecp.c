@@ -65,8 +65,6 @@
 #define mbedtls_free       free
 #endif
 
-#include "mbedtls/ecp_internal.h"
-
 #if ( defined(__ARMCC_VERSION) || defined(_MSC_VER) ) && \
     !defined(inline) && !defined(__cplusplus)
 #define inline __inline
@@ -103,6 +101,9 @@ static unsigned long add_count, dbl_count, mul_count;
 #define ECP_MONTGOMERY
 #endif
 
+/* after the curve types, which select the prototypes it declares */
+#include "mbedtls/ecp_internal.h"
+
 /*
  * Curve types: internal for now, might be exposed later
  */
@@ -1358,6 +1359,7 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     size_t d;
     unsigned char k[COMB_MAX_D + 1];
     mbedtls_ecp_point *T;
+    const mbedtls_ecp_point *T_rom = NULL;
     mbedtls_mpi M, mm;
 
     mbedtls_mpi_init( &M );
@@ -1397,16 +1399,22 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     if( w >= grp->nbits )
         w = 2;
 
-    /* Other sizes that depend on w */
-    pre_len = 1U << ( w - 1 );
-    d = ( grp->nbits + w - 1 ) / w;
-
     /*
-     * Prepare precomputed points: if P == G we want to
-     * use grp->T if already initialized, or initialize it.
+     * Prepare precomputed points: if P == G we want to use the built-in
+     * table for this curve, whose wider window costs nothing to build,
+     * else grp->T if already initialized, or initialize it.
      */
     T = p_eq_g ? grp->T : NULL;
 
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+    if( p_eq_g && ( T_rom = mbedtls_ecp_comb_table( grp, &w ) ) != NULL )
+        T = (mbedtls_ecp_point *) T_rom;
+#endif
+
+    /* Other sizes that depend on w */
+    pre_len = 1U << ( w - 1 );
+    d = ( grp->nbits + w - 1 ) / w;
+
     if( T == NULL )
     {
         T = mbedtls_calloc( pre_len, sizeof( mbedtls_ecp_point ) );
@@ -1451,9 +1459,9 @@ cleanup:
     /* There are two cases where T is not stored in grp:
      * - P != G
      * - An intermediate operation failed before setting grp->T
-     * In either case, T must be freed.
+     * In either case, T must be freed, unless it is the built-in table.
      */
-    if( T != NULL && T != grp->T )
+    if( T != NULL && T != grp->T && T != T_rom )
     {
         for( i = 0; i < pre_len; i++ )
             mbedtls_ecp_point_free( &T[i] );
@@ -1695,7 +1703,7 @@ int mbedtls_ecp_mul( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
         return( ret );
 
 #if defined(MBEDTLS_ECP_INTERNAL_ALT)
-    if ( is_grp_capable = mbedtls_internal_ecp_grp_capable( grp )  )
+    if( ( is_grp_capable = mbedtls_internal_ecp_grp_capable( grp ) ) )
     {
         MBEDTLS_MPI_CHK( mbedtls_internal_ecp_init( grp ) );
     }
@@ -1826,7 +1834,7 @@ int mbedtls_ecp_muladd( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     MBEDTLS_MPI_CHK( mbedtls_ecp_mul_shortcuts( grp, R,   n, Q ) );
 
 #if defined(MBEDTLS_ECP_INTERNAL_ALT)
-    if (  is_grp_capable = mbedtls_internal_ecp_grp_capable( grp )  )
+    if( ( is_grp_capable = mbedtls_internal_ecp_grp_capable( grp ) ) )
     {
         MBEDTLS_MPI_CHK( mbedtls_internal_ecp_init( grp ) );
     }
@@ -693,7 +693,7 @@ int mbedtls_rsa_public( mbedtls_rsa_context *ctx,
 #if TLS_CONFIG_HARD_CRYPTO
 	if( mbedtls_mpi_bitlen(&ctx->N) <= MAX_HARD_EXPTMOD_BITLEN )
 	{
-		MBEDTLS_MPI_CHK( tls_crypto_mbedtls_exptmod( &T, &T, &ctx->E, &ctx->N) );
+		MBEDTLS_MPI_CHK( tls_crypto_mbedtls_exptmod_batch( &T, &T, 1, &ctx->E, &ctx->N ) );
 	}
 	else
 	{
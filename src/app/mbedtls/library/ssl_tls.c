@@ -1323,11 +1323,11 @@ static int ssl_encrypt_buf( mbedtls_ssl_context *ssl )
     MBEDTLS_SSL_DEBUG_BUF( 4, "before encrypt: output payload",
                       ssl->out_msg, ssl->out_msglen );
 
-    if( ssl->out_msglen > MBEDTLS_SSL_MAX_CONTENT_LEN )
+    if( ssl->out_msglen > mbedtls_ssl_out_content_len( ssl ) )
     {
         MBEDTLS_SSL_DEBUG_MSG( 1, ( "Record content %u too large, maximum %d",
                                     (unsigned) ssl->out_msglen,
-                                    MBEDTLS_SSL_MAX_CONTENT_LEN ) );
+                                    (int) mbedtls_ssl_out_content_len( ssl ) ) );
         return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
     }
 
@@ -1936,14 +1936,14 @@ static int ssl_decrypt_buf( mbedtls_ssl_context *ssl )
              * Padding is guaranteed to be incorrect if:
              *   1. padlen > ssl->in_msglen
              *
-             *   2. padding_idx > MBEDTLS_SSL_MAX_CONTENT_LEN +
+             *   2. padding_idx > mbedtls_ssl_in_content_len( ssl ) +
              *                     ssl->transform_in->maclen
              *
              * In both cases we reset padding_idx to a safe value (0) to
              * prevent out-of-buffer reads.
              */
             correct &= ( padlen <= ssl->in_msglen );
-            correct &= ( padding_idx <= MBEDTLS_SSL_MAX_CONTENT_LEN +
+            correct &= ( padding_idx <= mbedtls_ssl_in_content_len( ssl ) +
                                        ssl->transform_in->maclen );
 
             padding_idx *= correct;
@@ -2232,7 +2232,7 @@ static int ssl_compress_buf( mbedtls_ssl_context *ssl )
     ssl->transform_out->ctx_deflate.next_in = msg_pre;
     ssl->transform_out->ctx_deflate.avail_in = len_pre;
     ssl->transform_out->ctx_deflate.next_out = msg_post;
-    ssl->transform_out->ctx_deflate.avail_out = MBEDTLS_SSL_BUFFER_LEN - bytes_written;
+    ssl->transform_out->ctx_deflate.avail_out = ssl->out_buf_len - bytes_written;
 
     ret = deflate( &ssl->transform_out->ctx_deflate, Z_SYNC_FLUSH );
     if( ret != Z_OK )
@@ -2241,7 +2241,7 @@ static int ssl_compress_buf( mbedtls_ssl_context *ssl )
         return( MBEDTLS_ERR_SSL_COMPRESSION_FAILED );
     }
 
-    ssl->out_msglen = MBEDTLS_SSL_BUFFER_LEN -
+    ssl->out_msglen = ssl->out_buf_len -
                       ssl->transform_out->ctx_deflate.avail_out - bytes_written;
 
     MBEDTLS_SSL_DEBUG_MSG( 3, ( "after compression: msglen = %d, ",
@@ -2279,7 +2279,7 @@ static int ssl_decompress_buf( mbedtls_ssl_context *ssl )
     ssl->transform_in->ctx_inflate.next_in = msg_pre;
     ssl->transform_in->ctx_inflate.avail_in = len_pre;
     ssl->transform_in->ctx_inflate.next_out = msg_post;
-    ssl->transform_in->ctx_inflate.avail_out = MBEDTLS_SSL_BUFFER_LEN -
+    ssl->transform_in->ctx_inflate.avail_out = ssl->in_buf_len -
                                                header_bytes;
 
     ret = inflate( &ssl->transform_in->ctx_inflate, Z_SYNC_FLUSH );
@@ -2289,7 +2289,7 @@ static int ssl_decompress_buf( mbedtls_ssl_context *ssl )
         return( MBEDTLS_ERR_SSL_COMPRESSION_FAILED );
     }
 
-    ssl->in_msglen = MBEDTLS_SSL_BUFFER_LEN -
+    ssl->in_msglen = ssl->in_buf_len -
                      ssl->transform_in->ctx_inflate.avail_out - header_bytes;
 
     MBEDTLS_SSL_DEBUG_MSG( 3, ( "after decompression: msglen = %d, ",
@@ -2364,7 +2364,7 @@ int mbedtls_ssl_fetch_input( mbedtls_ssl_context *ssl, size_t nb_want )
         return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
     }
 
-    if( nb_want > MBEDTLS_SSL_BUFFER_LEN - (size_t)( ssl->in_hdr - ssl->in_buf ) )
+    if( nb_want > ssl->in_buf_len - (size_t)( ssl->in_hdr - ssl->in_buf ) )
     {
         MBEDTLS_SSL_DEBUG_MSG( 1, ( "requesting more data than fits" ) );
         return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
@@ -2447,7 +2447,7 @@ int mbedtls_ssl_fetch_input( mbedtls_ssl_context *ssl, size_t nb_want )
             ret = MBEDTLS_ERR_SSL_TIMEOUT;
         else
         {
-            len = MBEDTLS_SSL_BUFFER_LEN - ( ssl->in_hdr - ssl->in_buf );
+            len = ssl->in_buf_len - ( ssl->in_hdr - ssl->in_buf );
 
             if( ssl->state != MBEDTLS_SSL_HANDSHAKE_OVER )
                 timeout = ssl->handshake->retransmit_timeout;
@@ -2901,12 +2901,12 @@ int mbedtls_ssl_write_record( mbedtls_ssl_context *ssl )
         if( ssl->conf->transport == MBEDTLS_SSL_TRANSPORT_DATAGRAM )
         {
             /* Make room for the additional DTLS fields */
-            if( MBEDTLS_SSL_MAX_CONTENT_LEN - ssl->out_msglen < 8 )
+            if( mbedtls_ssl_out_content_len( ssl ) - ssl->out_msglen < 8 )
             {
                 MBEDTLS_SSL_DEBUG_MSG( 1, ( "DTLS handshake message too large: "
                               "size %u, maximum %u",
                                (unsigned) ( ssl->in_hslen - 4 ),
-                               (unsigned) ( MBEDTLS_SSL_MAX_CONTENT_LEN - 12 ) ) );
+                               (unsigned) ( mbedtls_ssl_out_content_len( ssl ) - 12 ) ) );
                 return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
             }
 
@@ -3119,7 +3119,7 @@ static int ssl_reassemble_dtls_handshake( mbedtls_ssl_context *ssl )
         MBEDTLS_SSL_DEBUG_MSG( 2, ( "initialize reassembly, total length = %d",
                             msg_len ) );
 
-        if( ssl->in_hslen > MBEDTLS_SSL_MAX_CONTENT_LEN )
+        if( ssl->in_hslen > mbedtls_ssl_in_content_len( ssl ) )
         {
             MBEDTLS_SSL_DEBUG_MSG( 1, ( "handshake message too large" ) );
             return( MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE );
@@ -3223,7 +3223,7 @@ static int ssl_reassemble_dtls_handshake( mbedtls_ssl_context *ssl )
         ssl->next_record_offset = new_remain - ssl->in_hdr;
         ssl->in_left = ssl->next_record_offset + remain_len;
 
-        if( ssl->in_left > MBEDTLS_SSL_BUFFER_LEN -
+        if( ssl->in_left > ssl->in_buf_len -
                            (size_t)( ssl->in_hdr - ssl->in_buf ) )
         {
             MBEDTLS_SSL_DEBUG_MSG( 1, ( "reassembled message too large for buffer" ) );
@@ -3598,7 +3598,7 @@ static int ssl_handle_possible_reconnect( mbedtls_ssl_context *ssl )
             ssl->conf->p_cookie,
             ssl->cli_id, ssl->cli_id_len,
             ssl->in_buf, ssl->in_left,
-            ssl->out_buf, MBEDTLS_SSL_MAX_CONTENT_LEN, &len );
+            ssl->out_buf, mbedtls_ssl_out_content_len( ssl ), &len );
 
     MBEDTLS_SSL_DEBUG_RET( 2, "ssl_check_dtls_clihlo_cookie", ret );
 
@@ -3695,7 +3695,7 @@ static int ssl_parse_record_header( mbedtls_ssl_context *ssl )
     }
 
     /* Check length against the size of our buffer */
-    if( ssl->in_msglen > MBEDTLS_SSL_BUFFER_LEN
+    if( ssl->in_msglen > ssl->in_buf_len
                          - (size_t)( ssl->in_msg - ssl->in_buf ) )
     {
         MBEDTLS_SSL_DEBUG_MSG( 1, ( "bad message length" ) );
@@ -4462,10 +4462,10 @@ int mbedtls_ssl_write_certificate( mbedtls_ssl_context *ssl )
     while( crt != NULL )
     {
         n = crt->raw.len;
-        if( n > MBEDTLS_SSL_MAX_CONTENT_LEN - 3 - i )
+        if( n > mbedtls_ssl_out_content_len( ssl ) - 3 - i )
         {
             MBEDTLS_SSL_DEBUG_MSG( 1, ( "certificate too large, %d > %d",
-                           i + 3 + n, MBEDTLS_SSL_MAX_CONTENT_LEN ) );
+                           i + 3 + n, (int) mbedtls_ssl_out_content_len( ssl ) ) );
             return( MBEDTLS_ERR_SSL_CERTIFICATE_TOO_LARGE );
         }
 
@@ -5363,6 +5363,11 @@ static void ssl_handshake_wrapup_free_hs_transform( mbedtls_ssl_context *ssl )
     MBEDTLS_SSL_DEBUG_MSG( 3, ( "<= handshake wrapup: final free" ) );
 }
 
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+/* Forward declaration */
+static void ssl_shrink_buffers( mbedtls_ssl_context *ssl );
+#endif
+
 void mbedtls_ssl_handshake_wrapup( mbedtls_ssl_context *ssl )
 {
     int resume = ssl->handshake->resume;
@@ -5420,6 +5425,11 @@ void mbedtls_ssl_handshake_wrapup( mbedtls_ssl_context *ssl )
 #endif
         ssl_handshake_wrapup_free_hs_transform( ssl );
 
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+    if( ssl->conf->buf_shrink == MBEDTLS_SSL_BUF_SHRINK_ENABLED )
+        ssl_shrink_buffers( ssl );
+#endif
+
     ssl->state++;
 
     MBEDTLS_SSL_DEBUG_MSG( 3, ( "<= handshake wrapup" ) );
@@ -5798,6 +5808,139 @@ void mbedtls_ssl_init( mbedtls_ssl_context *ssl )
     memset( ssl, 0, sizeof( mbedtls_ssl_context ) );
 }
 
+/*
+ * Record I/O buffers, sized per configuration and optionally allocated
+ * through the configured allocator
+ */
+static size_t ssl_conf_in_buf_len( const mbedtls_ssl_config *conf )
+{
+    return( MBEDTLS_SSL_BUFFER_LEN_FOR( conf->in_content_len != 0 ?
+                conf->in_content_len : MBEDTLS_SSL_IN_CONTENT_LEN ) );
+}
+
+static size_t ssl_conf_out_buf_len( const mbedtls_ssl_config *conf )
+{
+    return( MBEDTLS_SSL_BUFFER_LEN_FOR( conf->out_content_len != 0 ?
+                conf->out_content_len : MBEDTLS_SSL_OUT_CONTENT_LEN ) );
+}
+
+static unsigned char *ssl_buf_alloc( const mbedtls_ssl_config *conf,
+                                     size_t len )
+{
+    if( conf->f_buf_calloc != NULL )
+        return( conf->f_buf_calloc( 1, len ) );
+
+    return( mbedtls_calloc( 1, len ) );
+}
+
+static void ssl_buf_free( const mbedtls_ssl_config *conf,
+                          unsigned char *buf, size_t len )
+{
+    if( buf == NULL )
+        return;
+
+    mbedtls_zeroize( buf, len );
+
+    if( conf != NULL && conf->f_buf_free != NULL )
+        conf->f_buf_free( buf );
+    else
+        mbedtls_free( buf );
+}
+
+/*
+ * Move a record buffer to a new allocation of new_len bytes, keeping its
+ * head and rebasing the record pointers into it. The caller makes sure
+ * the data still in use fits.
+ */
+static int ssl_buf_resize( const mbedtls_ssl_config *conf,
+                           unsigned char **buf, size_t *buf_len,
+                           size_t new_len,
+                           unsigned char **ptrs[], size_t count )
+{
+    unsigned char *new_buf;
+    size_t i;
+
+    if( new_len == *buf_len )
+        return( 0 );
+
+    if( ( new_buf = ssl_buf_alloc( conf, new_len ) ) == NULL )
+    {
+        MBEDTLS_SSL_DEBUG_MSG( 1, ( "alloc(%d bytes) failed", new_len ) );
+        return( MBEDTLS_ERR_SSL_ALLOC_FAILED );
+    }
+
+    memcpy( new_buf, *buf, new_len < *buf_len ? new_len : *buf_len );
+
+    for( i = 0; i < count; i++ )
+    {
+        if( *ptrs[i] != NULL )
+            *ptrs[i] = new_buf + ( *ptrs[i] - *buf );
+    }
+
+    ssl_buf_free( conf, *buf, *buf_len );
+
+    *buf = new_buf;
+    *buf_len = new_len;
+
+    return( 0 );
+}
+
+static int ssl_resize_in_buf( mbedtls_ssl_context *ssl, size_t new_len )
+{
+    unsigned char **ptrs[] = { &ssl->in_ctr, &ssl->in_hdr, &ssl->in_len,
+                               &ssl->in_iv, &ssl->in_msg, &ssl->in_offt };
+
+    return( ssl_buf_resize( ssl->conf, &ssl->in_buf, &ssl->in_buf_len,
+                            new_len, ptrs, sizeof( ptrs ) / sizeof( ptrs[0] ) ) );
+}
+
+static int ssl_resize_out_buf( mbedtls_ssl_context *ssl, size_t new_len )
+{
+    unsigned char **ptrs[] = { &ssl->out_ctr, &ssl->out_hdr, &ssl->out_len,
+                               &ssl->out_iv, &ssl->out_msg };
+
+    return( ssl_buf_resize( ssl->conf, &ssl->out_buf, &ssl->out_buf_len,
+                            new_len, ptrs, sizeof( ptrs ) / sizeof( ptrs[0] ) ) );
+}
+
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+/*
+ * Once the handshake is over, only records up to the fragment lengths in
+ * force are exchanged, so trim the buffers down to those. Best effort: on
+ * allocation failure the current buffers are kept.
+ */
+static void ssl_shrink_buffers( mbedtls_ssl_context *ssl )
+{
+    size_t len, used;
+
+#if defined(MBEDTLS_SSL_RENEGOTIATION)
+    /* a renegotiation handshake would need the full buffers again */
+    if( ssl->conf->disable_renegotiation == MBEDTLS_SSL_RENEGOTIATION_ENABLED )
+        return;
+#endif
+
+    len = MBEDTLS_SSL_BUFFER_LEN_FOR( mbedtls_ssl_get_max_frag_len( ssl ) );
+    used = (size_t)( ssl->out_msg - ssl->out_buf ) + ssl->out_msglen;
+    if( len < ssl->out_buf_len && used <= len )
+        (void) ssl_resize_out_buf( ssl, len );
+
+    /* the peer may only send shorter records if it agreed to */
+    if( ssl->session == NULL ||
+        ssl->session->mfl_code == MBEDTLS_SSL_MAX_FRAG_LEN_NONE )
+        return;
+
+    len = MBEDTLS_SSL_BUFFER_LEN_FOR( mfl_code_to_length[ssl->session->mfl_code] );
+    used = (size_t)( ssl->in_msg - ssl->in_buf ) + ssl->in_msglen;
+    if( (size_t)( ssl->in_hdr - ssl->in_buf ) + ssl->in_left > used )
+        used = (size_t)( ssl->in_hdr - ssl->in_buf ) + ssl->in_left;
+    if( len < ssl->in_buf_len && used <= len )
+        (void) ssl_resize_in_buf( ssl, len );
+
+    MBEDTLS_SSL_DEBUG_MSG( 3, ( "I/O buffers: in %d, out %d bytes",
+                                ssl->in_buf_len, ssl->out_buf_len ) );
+}
+#endif /* MBEDTLS_SSL_MAX_FRAGMENT_LENGTH */
+
 /*
  * Setup an SSL context
  */
@@ -5805,7 +5948,8 @@ int mbedtls_ssl_setup( mbedtls_ssl_context *ssl,
                        const mbedtls_ssl_config *conf )
 {
     int ret;
-    const size_t len = MBEDTLS_SSL_BUFFER_LEN;
+    const size_t in_len = ssl_conf_in_buf_len( conf );
+    const size_t out_len = ssl_conf_out_buf_len( conf );
 
     ssl->conf = conf;
 
@@ -5814,13 +5958,16 @@ int mbedtls_ssl_setup( mbedtls_ssl_context *ssl,
      */
     ssl->in_buf = NULL;
     ssl->out_buf = NULL;
-    if( ( ssl-> in_buf = mbedtls_calloc( 1, len ) ) == NULL ||
-        ( ssl->out_buf = mbedtls_calloc( 1, len ) ) == NULL )
+    if( ( ssl-> in_buf = ssl_buf_alloc( conf, in_len ) ) == NULL ||
+        ( ssl->out_buf = ssl_buf_alloc( conf, out_len ) ) == NULL )
     {
-        MBEDTLS_SSL_DEBUG_MSG( 1, ( "alloc(%d bytes) failed", len ) );
+        MBEDTLS_SSL_DEBUG_MSG( 1, ( "alloc(%d + %d bytes) failed",
+                                    in_len, out_len ) );
         ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
         goto error;
     }
+    ssl->in_buf_len = in_len;
+    ssl->out_buf_len = out_len;
 
 #if defined(MBEDTLS_SSL_PROTO_DTLS)
     if( conf->transport == MBEDTLS_SSL_TRANSPORT_DATAGRAM )
@@ -5859,13 +6006,15 @@ int mbedtls_ssl_setup( mbedtls_ssl_context *ssl,
     return( 0 );
 
 error:
-    mbedtls_free( ssl->in_buf );
-    mbedtls_free( ssl->out_buf );
+    ssl_buf_free( conf, ssl->in_buf, in_len );
+    ssl_buf_free( conf, ssl->out_buf, out_len );
 
     ssl->conf = NULL;
 
     ssl->in_buf = NULL;
     ssl->out_buf = NULL;
+    ssl->in_buf_len = 0;
+    ssl->out_buf_len = 0;
 
     ssl->in_hdr = NULL;
     ssl->in_ctr = NULL;
@@ -5943,10 +6092,19 @@ static int ssl_session_reset_int( mbedtls_ssl_context *ssl, int partial )
     ssl->session_in = NULL;
     ssl->session_out = NULL;
 
-    memset( ssl->out_buf, 0, MBEDTLS_SSL_BUFFER_LEN );
+    /* grow back buffers trimmed after the previous handshake */
+    if( ( ret = ssl_resize_out_buf( ssl, ssl_conf_out_buf_len( ssl->conf ) ) ) != 0 )
+        return( ret );
+
+    memset( ssl->out_buf, 0, ssl->out_buf_len );
 
     if( partial == 0 )
-        memset( ssl->in_buf, 0, MBEDTLS_SSL_BUFFER_LEN );
+    {
+        if( ( ret = ssl_resize_in_buf( ssl, ssl_conf_in_buf_len( ssl->conf ) ) ) != 0 )
+            return( ret );
+
+        memset( ssl->in_buf, 0, ssl->in_buf_len );
+    }
 
 #if defined(MBEDTLS_SSL_HW_RECORD_ACCEL)
     if( mbedtls_ssl_hw_record_reset != NULL )
@@ -6567,6 +6725,34 @@ void mbedtls_ssl_conf_arc4_support( mbedtls_ssl_config *conf, char arc4 )
 }
 #endif
 
+int mbedtls_ssl_conf_content_len( mbedtls_ssl_config *conf,
+                                  size_t in_len, size_t out_len )
+{
+    if( in_len > MBEDTLS_SSL_IN_CONTENT_LEN ||
+        out_len > MBEDTLS_SSL_OUT_CONTENT_LEN )
+    {
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+    }
+
+    conf->in_content_len = in_len;
+    conf->out_content_len = out_len;
+
+    return( 0 );
+}
+
+void mbedtls_ssl_conf_buf_alloc( mbedtls_ssl_config *conf,
+                                 void * (*f_calloc)(size_t, size_t),
+                                 void (*f_free)(void *) )
+{
+    conf->f_buf_calloc = f_calloc;
+    conf->f_buf_free   = f_free;
+}
+
+void mbedtls_ssl_conf_buf_shrink( mbedtls_ssl_config *conf, int shrink )
+{
+    conf->buf_shrink = shrink;
+}
+
 #if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
 int mbedtls_ssl_conf_max_frag_len( mbedtls_ssl_config *conf, unsigned char mfl_code )
 {
@@ -6777,6 +6963,12 @@ size_t mbedtls_ssl_get_max_frag_len( const mbedtls_ssl_context *ssl )
      */
     max_len = mfl_code_to_length[ssl->conf->mfl_code];
 
+    /*
+     * Never more than the output buffer holds
+     */
+    if( mbedtls_ssl_out_content_len( ssl ) < max_len )
+        max_len = mbedtls_ssl_out_content_len( ssl );
+
     /*
      * Check if a smaller max length was negotiated
      */
@@ -7322,7 +7514,7 @@ static int ssl_write_real( mbedtls_ssl_context *ssl,
 #if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
     size_t max_len = mbedtls_ssl_get_max_frag_len( ssl );
 #else
-    size_t max_len = MBEDTLS_SSL_MAX_CONTENT_LEN;
+    size_t max_len = mbedtls_ssl_out_content_len( ssl );
 #endif /* MBEDTLS_SSL_MAX_FRAGMENT_LENGTH */
     if( len > max_len )
     {
@@ -7622,17 +7814,8 @@ void mbedtls_ssl_free( mbedtls_ssl_context *ssl )
 
     MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> free" ) );
 
-    if( ssl->out_buf != NULL )
-    {
-        mbedtls_zeroize( ssl->out_buf, MBEDTLS_SSL_BUFFER_LEN );
-        mbedtls_free( ssl->out_buf );
-    }
-
-    if( ssl->in_buf != NULL )
-    {
-        mbedtls_zeroize( ssl->in_buf, MBEDTLS_SSL_BUFFER_LEN );
-        mbedtls_free( ssl->in_buf );
-    }
+    ssl_buf_free( ssl->conf, ssl->out_buf, ssl->out_buf_len );
+    ssl_buf_free( ssl->conf, ssl->in_buf, ssl->in_buf_len );
 
 #if defined(MBEDTLS_ZLIB_SUPPORT)
     if( ssl->compress_buf != NULL )
@@ -40,29 +40,111 @@
 
 #if defined(MBEDTLS_AES_ALT)
 
+typedef struct
+{
+    psAesCbc_t hw;              /* key, IV and mode of the GPSEC engine */
+    mbedtls_aes_sw_context sw;  /* software key schedule, sw.nr is 0 for 128-bit keys */
+    int keyed;                  /* 0 until a key is set, and again after a rejected one */
+} aes_alt_context;
+
+#define AES_ALT_IS_HW(actx) ((actx)->sw.nr == 0)
+
+/*
+ * 32-bit integer manipulation macros (big endian)
+ */
+#ifndef GET_UINT32_BE
+#define GET_UINT32_BE(n,b,i)                            \
+{                                                       \
+    (n) = ( (uint32_t) (b)[(i)    ] << 24 )             \
+        | ( (uint32_t) (b)[(i) + 1] << 16 )             \
+        | ( (uint32_t) (b)[(i) + 2] <<  8 )             \
+        | ( (uint32_t) (b)[(i) + 3]       );            \
+}
+#endif
+
+static void aes_hw_crypt(aes_alt_context *actx, CRYPTO_MODE mode, int way,
+                         const unsigned char *input, unsigned char *output,
+                         size_t length)
+{
+    actx->hw.key.type = mode;
+    tls_crypto_aes_encrypt_decrypt((psCipherContext_t *)&actx->hw, (unsigned char *)input, output, length,
+                                   way == MBEDTLS_AES_ENCRYPT ? CRYPTO_WAY_ENCRYPT : CRYPTO_WAY_DECRYPT);
+}
+
+/* Add n blocks to the 128-bit big endian counter */
+static void aes_ctr_add(unsigned char nonce_counter[16], uint32_t n)
+{
+    int i;
+    uint32_t sum;
+
+    for (i = 15; i >= 0 && n; i--)
+    {
+        sum = nonce_counter[i] + (n & 0xFF);
+        nonce_counter[i] = (unsigned char)sum;
+        n = (n >> 8) + (sum >> 8);
+    }
+}
+
 void mbedtls_aes_init(mbedtls_aes_context *ctx)
 {
-    psCipherContext_t *pctx;
+    aes_alt_context *actx;
 
     if (ctx)
     {
-        pctx = tls_mem_alloc(sizeof(psCipherContext_t));
-        if (pctx)
+        actx = tls_mem_alloc(sizeof(aes_alt_context));
+        if (actx)
         {
-            memset(pctx, 0, sizeof(psCipherContext_t));
-            *ctx = (mbedtls_aes_context)pctx;
+            memset(actx, 0, sizeof(aes_alt_context));
         }
+        *ctx = (mbedtls_aes_context)actx;
     }
 }
 
 void mbedtls_aes_free(mbedtls_aes_context *ctx)
 {
-    if (ctx)
+    if (ctx && *ctx)
     {
+        mbedtls_aes_sw_free(&((aes_alt_context *)*ctx)->sw);
+        memset(*ctx, 0, sizeof(aes_alt_context));
         tls_mem_free(*ctx);
+        *ctx = NULL;
     }
 }
 
+static int aes_setkey(mbedtls_aes_context *ctx, const unsigned char *key,
+                      unsigned int keybits, int mode)
+{
+    int ret;
+    aes_alt_context *actx;
+
+    if (!ctx || !*ctx)
+        return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+
+    actx = (aes_alt_context *)*ctx;
+    actx->keyed = 0;
+    memset(actx->hw.key.skey, 0, sizeof(actx->hw.key.skey));
+    mbedtls_aes_sw_free(&actx->sw);
+    mbedtls_aes_sw_init(&actx->sw);
+
+    /* the engine only has a 128-bit key register */
+    if (keybits == 128)
+    {
+        memcpy(actx->hw.key.skey, key, 16);
+        actx->keyed = 1;
+        return 0;
+    }
+
+    if (mode == MBEDTLS_AES_ENCRYPT)
+        ret = mbedtls_aes_sw_setkey_enc(&actx->sw, key, keybits);
+    else
+        ret = mbedtls_aes_sw_setkey_dec(&actx->sw, key, keybits);
+    if (ret == 0)
+        actx->keyed = 1;
+    else
+        mbedtls_aes_sw_free(&actx->sw);
+    return ret;
+}
+
 /*
  * AES key schedule (encryption)
  */
@@ -70,14 +152,7 @@ void mbedtls_aes_free(mbedtls_aes_context *ctx)
 int mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key,
                            unsigned int keybits)
 {
-    psCipherContext_t *pctx;
-
-    if (ctx)
-    {
-        pctx = (psCipherContext_t *)*ctx;
-        memcpy(pctx->aes.key.skey, key, keybits/8);
-    }
-    return 0;
+    return aes_setkey(ctx, key, keybits, MBEDTLS_AES_ENCRYPT);
 }
 #endif /* !MBEDTLS_AES_SETKEY_ENC_ALT */
 
@@ -88,14 +163,7 @@ int mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key,
 int mbedtls_aes_setkey_dec(mbedtls_aes_context *ctx, const unsigned char *key,
                            unsigned int keybits)
 {
-    psCipherContext_t *pctx;
-
-    if (ctx)
-    {
-        pctx = (psCipherContext_t *)*ctx;
-        memcpy(pctx->aes.key.skey, key, keybits/8);
-    }
-    return 0;
+    return aes_setkey(ctx, key, keybits, MBEDTLS_AES_DECRYPT);
 }
 #endif /* !MBEDTLS_AES_SETKEY_DEC_ALT */
 
@@ -149,18 +217,24 @@ int mbedtls_aes_crypt_ecb(mbedtls_aes_context *ctx,
                           const unsigned char input[16],
                           unsigned char output[16])
 {
-    psCipherContext_t *pctx;
+    aes_alt_context *actx;
 
-    if (ctx)
-    {
-        pctx = (psCipherContext_t *)*ctx;
-        pctx->aes.key.type = CRYPTO_MODE_ECB;
+    if (!ctx || !*ctx)
+        return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
 
-        tls_crypto_aes_encrypt_decrypt(pctx, (unsigned char *)input, output, 16, 
-        mode == MBEDTLS_AES_ENCRYPT ? CRYPTO_WAY_ENCRYPT : CRYPTO_WAY_DECRYPT);
+    actx = (aes_alt_context *)*ctx;
+    if (!actx->keyed)
+        return MBEDTLS_ERR_AES_INVALID_KEY_LENGTH;
+    if (AES_ALT_IS_HW(actx))
+    {
+        aes_hw_crypt(actx, CRYPTO_MODE_ECB, mode, input, output, 16);
+        return 0;
     }
 
-    return 0;
+    if (mode == MBEDTLS_AES_ENCRYPT)
+        return mbedtls_aes_sw_encrypt(&actx->sw, input, output);
+    else
+        return mbedtls_aes_sw_decrypt(&actx->sw, input, output);
 }
 
 #if defined(MBEDTLS_CIPHER_MODE_CBC)
@@ -173,35 +247,44 @@ int mbedtls_aes_crypt_cbc(mbedtls_aes_context *ctx,
                           unsigned char iv[16],
                           const unsigned char *input,
                           unsigned char *output)
-{	
+{
     int i;
+    aes_alt_context *actx;
     unsigned char temp[16];
-    unsigned char ctt[16];
 
     if( length % 16 )
         return( MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH );
 
-#if defined(MBEDTLS_PADLOCK_C) && defined(MBEDTLS_HAVE_X86)
-    if( aes_padlock_ace )
+    if (!ctx || !*ctx)
+        return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+
+    actx = (aes_alt_context *)*ctx;
+    if (!actx->keyed)
+        return MBEDTLS_ERR_AES_INVALID_KEY_LENGTH;
+    if (AES_ALT_IS_HW(actx))
     {
-        if( mbedtls_padlock_xcryptcbc( ctx, mode, length, iv, input, output ) == 0 )
+        /* the engine chains the blocks itself, only the IV is handed back */
+        if (length == 0)
             return( 0 );
+        if (mode == MBEDTLS_AES_DECRYPT)
+            memcpy(temp, input + length - 16, 16);
+        memcpy(actx->hw.IV, iv, 16);
+
+        aes_hw_crypt(actx, CRYPTO_MODE_CBC, mode, input, output, length);
 
-        // If padlock data misaligned, we just fall back to
-        // unaccelerated mode
-        //
+        memcpy(iv, mode == MBEDTLS_AES_DECRYPT ? temp : output + length - 16, 16);
+        return( 0 );
     }
-#endif
 
     if( mode == MBEDTLS_AES_DECRYPT )
     {
         while( length > 0 )
         {
             memcpy( temp, input, 16 );
-            mbedtls_aes_crypt_ecb( ctx, mode, input, ctt );
+            mbedtls_aes_sw_decrypt( &actx->sw, input, output );
 
             for( i = 0; i < 16; i++ )
-                output[i] = (unsigned char)( ctt[i] ^ iv[i] );
+                output[i] = (unsigned char)( output[i] ^ iv[i] );
 
             memcpy( iv, temp, 16 );
 
@@ -215,11 +298,10 @@ int mbedtls_aes_crypt_cbc(mbedtls_aes_context *ctx,
         while( length > 0 )
         {
             for( i = 0; i < 16; i++ )
-                temp[i] = (unsigned char)( input[i] ^ iv[i] );
+                output[i] = (unsigned char)( input[i] ^ iv[i] );
 
-            mbedtls_aes_crypt_ecb( ctx, mode, temp, ctt );
-			memcpy( output, ctt, 16);
-            memcpy( iv, ctt, 16 );
+            mbedtls_aes_sw_encrypt( &actx->sw, output, output );
+            memcpy( iv, output, 16 );
 
             input  += 16;
             output += 16;
@@ -243,8 +325,39 @@ int mbedtls_aes_crypt_cfb128(mbedtls_aes_context *ctx,
                              const unsigned char *input,
                              unsigned char *output)
 {
-    printf("%s:%d don't support\r\n", __func__, __LINE__);
-    return -1;
+    int c, ret;
+    size_t n = *iv_off;
+
+    if( mode == MBEDTLS_AES_DECRYPT )
+    {
+        while( length-- )
+        {
+            if( n == 0 && ( ret = mbedtls_aes_crypt_ecb( ctx, MBEDTLS_AES_ENCRYPT, iv, iv ) ) != 0 )
+                return( ret );
+
+            c = *input++;
+            *output++ = (unsigned char)( c ^ iv[n] );
+            iv[n] = (unsigned char) c;
+
+            n = ( n + 1 ) & 0x0F;
+        }
+    }
+    else
+    {
+        while( length-- )
+        {
+            if( n == 0 && ( ret = mbedtls_aes_crypt_ecb( ctx, MBEDTLS_AES_ENCRYPT, iv, iv ) ) != 0 )
+                return( ret );
+
+            iv[n] = *output++ = (unsigned char)( iv[n] ^ *input++ );
+
+            n = ( n + 1 ) & 0x0F;
+        }
+    }
+
+    *iv_off = n;
+
+    return( 0 );
 }
 
 /*
@@ -257,26 +370,30 @@ int mbedtls_aes_crypt_cfb8(mbedtls_aes_context *ctx,
                            const unsigned char *input,
                            unsigned char *output)
 {
-    printf("%s:%d don't support\r\n", __func__, __LINE__);
-    return -1;
-}
-#endif /*MBEDTLS_CIPHER_MODE_CFB */
+    int ret;
+    unsigned char c;
+    unsigned char ov[17];
 
-#if defined(MBEDTLS_CIPHER_MODE_OFB)
-/*
- * AES-OFB (Output Feedback Mode) buffer encryption/decryption
- */
-int mbedtls_aes_crypt_ofb(mbedtls_aes_context *ctx,
-                          size_t length,
-                          size_t *iv_off,
-                          unsigned char iv[16],
-                          const unsigned char *input,
-                          unsigned char *output)
-{
-    printf("%s:%d don't support\r\n", __func__, __LINE__);
-    return -1;
+    while( length-- )
+    {
+        memcpy( ov, iv, 16 );
+        if( ( ret = mbedtls_aes_crypt_ecb( ctx, MBEDTLS_AES_ENCRYPT, iv, iv ) ) != 0 )
+            return( ret );
+
+        if( mode == MBEDTLS_AES_DECRYPT )
+            ov[16] = *input;
+
+        c = *output++ = (unsigned char)( iv[0] ^ *input++ );
+
+        if( mode == MBEDTLS_AES_ENCRYPT )
+            ov[16] = c;
+
+        memcpy( iv, ov + 1, 16 );
+    }
+
+    return( 0 );
 }
-#endif /* MBEDTLS_CIPHER_MODE_OFB */
+#endif /*MBEDTLS_CIPHER_MODE_CFB */
 
 #if defined(MBEDTLS_CIPHER_MODE_CTR)
 /*
@@ -290,36 +407,63 @@ int mbedtls_aes_crypt_ctr(mbedtls_aes_context *ctx,
                           const unsigned char *input,
                           unsigned char *output)
 {
-    int i;
-    psCipherContext_t *pctx;
-    unsigned char temp[16];
-    size_t nc_off_s;
-
-    if (ctx)
+    int c, i, ret;
+    size_t n = *nc_off;
+    size_t run;
+    uint32_t low;
+    aes_alt_context *actx;
+
+    if (!ctx || !*ctx)
+        return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+
+    actx = (aes_alt_context *)*ctx;
+    if (!actx->keyed)
+        return MBEDTLS_ERR_AES_INVALID_KEY_LENGTH;
+    while (length > 0)
     {
-        pctx = (psCipherContext_t *)*ctx;
-        pctx->aes.key.type = CRYPTO_MODE_CTR;
-
-        if (*nc_off == 0)
+        /*
+         * Whole blocks on a block boundary go to the engine in CTR mode. A run
+         * never carries out of the low counter word, so it does not matter
+         * how wide the engine's counter is.
+         */
+        if (n == 0 && length >= 16 && AES_ALT_IS_HW(actx))
         {
-            for (i = 0; i < 16; i++) {
-                pctx->aes.IV[i] = nonce_counter[i];
-            }
-
-            memcpy(temp, &input[length - 16], 16);
+            run = length & ~(size_t)15;
+            GET_UINT32_BE(low, nonce_counter, 12);
+            if (low != 0 && run / 16 > 0xFFFFFFFFu - low + 1)
+                run = (size_t)(0xFFFFFFFFu - low + 1) * 16;
+
+            memcpy(actx->hw.IV, nonce_counter, 16);
+            aes_hw_crypt(actx, CRYPTO_MODE_CTR, MBEDTLS_AES_ENCRYPT, input, output, run);
+            aes_ctr_add(nonce_counter, (uint32_t)(run / 16));
+
+            input  += run;
+            output += run;
+            length -= run;
+            continue;
         }
-        nc_off_s = *nc_off;
-        tls_crypto_aes_encrypt_decrypt(pctx, (unsigned char *)input, output, length, CRYPTO_WAY_DECRYPT);
-        *nc_off = nc_off_s;
-        if (stream_block)
+
+        if( n == 0 )
         {
-            memcpy(stream_block, temp, 16);
+            if( ( ret = mbedtls_aes_crypt_ecb( ctx, MBEDTLS_AES_ENCRYPT, nonce_counter, stream_block ) ) != 0 )
+                return( ret );
+
+            for( i = 16; i > 0; i-- )
+                if( ++nonce_counter[i - 1] != 0 )
+                    break;
         }
+        c = *input++;
+        *output++ = (unsigned char)( c ^ stream_block[n] );
+
+        n = ( n + 1 ) & 0x0F;
+        length--;
     }
 
-    return 0;
+    *nc_off = n;
+
+    return( 0 );
 }
 #endif /* MBEDTLS_CIPHER_MODE_CTR */
 
-#endif /* MBEDTLS_SELF_TEST */
+#endif /* MBEDTLS_AES_ALT */
 #endif /* MBEDTLS_AES_C */
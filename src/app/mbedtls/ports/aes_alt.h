@@ -68,9 +68,39 @@ extern "C" {
 
 /**
  * \brief The AES context-type definition.
+ *
+ *        Points to the port context: 128-bit keys are run on the GPSEC
+ *        engine, 192 and 256-bit keys on the software implementation.
  */
 typedef void *mbedtls_aes_context;
 
+/**
+ * \brief The software AES context, as in the regular implementation.
+ *        library/aes.c builds its key schedule and block functions
+ *        under the mbedtls_aes_sw_ names below when MBEDTLS_AES_ALT is
+ *        defined.
+ */
+typedef struct
+{
+    int nr;                     /*!< The number of rounds. */
+    uint32_t *rk;               /*!< AES round keys. */
+    uint32_t buf[68];           /*!< Unaligned data buffer. */
+}
+mbedtls_aes_sw_context;
+
+void mbedtls_aes_sw_init( mbedtls_aes_sw_context *ctx );
+void mbedtls_aes_sw_free( mbedtls_aes_sw_context *ctx );
+int mbedtls_aes_sw_setkey_enc( mbedtls_aes_sw_context *ctx, const unsigned char *key,
+                               unsigned int keybits );
+int mbedtls_aes_sw_setkey_dec( mbedtls_aes_sw_context *ctx, const unsigned char *key,
+                               unsigned int keybits );
+int mbedtls_aes_sw_encrypt( mbedtls_aes_sw_context *ctx,
+                            const unsigned char input[16],
+                            unsigned char output[16] );
+int mbedtls_aes_sw_decrypt( mbedtls_aes_sw_context *ctx,
+                            const unsigned char input[16],
+                            unsigned char output[16] );
+
 /**
  * \brief          This function initializes the specified AES context.
  *
@@ -160,6 +160,8 @@ int mbedtls_des3_set2key_enc(mbedtls_des3_context *ctx,
     {
         pctx = (psCipherContext_t *)*ctx;
         memcpy(pctx->des3.key.ek[0], key, 16);
+        /* two key 3DES is K1, K2, K1 */
+        memcpy((unsigned char *)pctx->des3.key.ek[0] + 16, key, 8);
         pctx->des3.blocklen = CRYPTO_WAY_ENCRYPT;
     }
     return 0;
@@ -177,6 +179,8 @@ int mbedtls_des3_set2key_dec(mbedtls_des3_context *ctx,
     {
         pctx = (psCipherContext_t *)*ctx;
         memcpy(pctx->des3.key.ek[0], key, 16);
+        /* two key 3DES is K1, K2, K1 */
+        memcpy((unsigned char *)pctx->des3.key.ek[0] + 16, key, 8);
         pctx->des3.blocklen = CRYPTO_WAY_DECRYPT;
     }
     return 0;
@@ -0,0 +1,241 @@
+/*
+ *  Elliptic curves over GF(p): field multiplications on the RSA engine
+ *
+ *  Copyright (C) 2006-2015, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+/*
+ * Point doubling and mixed addition in Jacobian coordinates, as in ecp.c,
+ * with the products computed by the Montgomery multiplier of the RSA engine.
+ * mbedtls_ecp_mul() and mbedtls_ecp_muladd() open the multiplier for the
+ * curve prime through mbedtls_internal_ecp_init() and keep it for the whole
+ * scalar multiplication; everything else stays in software.
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_C) && defined(MBEDTLS_ECP_INTERNAL_ALT)
+
+#include "mbedtls/ecp.h"
+#include "mbedtls/ecp_internal.h"
+#include "wm_crypto_hard_mbed.h"
+
+/*
+ * X = A * B mod P, with A and B in [0, P)
+ */
+static int ecp_hw_mul( const mbedtls_ecp_group *grp, mbedtls_mpi *X,
+                       const mbedtls_mpi *A, const mbedtls_mpi *B )
+{
+    int ret;
+
+    MBEDTLS_MPI_CHK( tls_crypto_mbedtls_mont_mulmod( X, A, B ) );
+    while( mbedtls_mpi_cmp_mpi( X, &grp->P ) >= 0 )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_abs( X, X, &grp->P ) );
+
+cleanup:
+    return( ret );
+}
+
+#define MUL_MOD( X, A, B )  MBEDTLS_MPI_CHK( ecp_hw_mul( grp, &X, A, B ) )
+
+/* Same reductions as in ecp.c, after additions and subtractions */
+#define MOD_SUB( N )                                \
+    while( N.s < 0 && mbedtls_mpi_cmp_int( &N, 0 ) != 0 )   \
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &N, &N, &grp->P ) )
+
+#define MOD_ADD( N )                                \
+    while( mbedtls_mpi_cmp_mpi( &N, &grp->P ) >= 0 )        \
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_abs( &N, &N, &grp->P ) )
+
+unsigned char mbedtls_internal_ecp_grp_capable( const mbedtls_ecp_group *grp )
+{
+    /* short Weierstrass curves only, odd prime within the multiplier size */
+    return( grp->G.Y.p != NULL &&
+            grp->pbits <= MAX_HARD_EXPTMOD_BITLEN &&
+            mbedtls_mpi_get_bit( &grp->P, 0 ) == 1 );
+}
+
+int mbedtls_internal_ecp_init( const mbedtls_ecp_group *grp )
+{
+    return( tls_crypto_mbedtls_mont_open( &grp->P ) );
+}
+
+void mbedtls_internal_ecp_free( const mbedtls_ecp_group *grp )
+{
+    (void) grp;
+
+    tls_crypto_mbedtls_mont_close();
+}
+
+#if defined(MBEDTLS_ECP_DOUBLE_JAC_ALT)
+/*
+ * Point doubling R = 2 P, Jacobian coordinates, see ecp_double_jac()
+ */
+int mbedtls_internal_ecp_double_jac( const mbedtls_ecp_group *grp,
+                                     mbedtls_ecp_point *R,
+                                     const mbedtls_ecp_point *P )
+{
+    int ret;
+    mbedtls_mpi M, S, T, U;
+
+    mbedtls_mpi_init( &M ); mbedtls_mpi_init( &S ); mbedtls_mpi_init( &T ); mbedtls_mpi_init( &U );
+
+    /* Special case for A = -3 */
+    if( grp->A.p == NULL )
+    {
+        /* M = 3(X + Z^2)(X - Z^2) */
+        MUL_MOD( S, &P->Z, &P->Z );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &T,  &P->X,  &S      ) ); MOD_ADD( T );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &U,  &P->X,  &S      ) ); MOD_SUB( U );
+        MUL_MOD( S, &T, &U );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &M,  &S,     3       ) ); MOD_ADD( M );
+    }
+    else
+    {
+        /* M = 3.X^2 */
+        MUL_MOD( S, &P->X, &P->X );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &M,  &S,     3       ) ); MOD_ADD( M );
+
+        /* Optimize away for "koblitz" curves with A = 0 */
+        if( mbedtls_mpi_cmp_int( &grp->A, 0 ) != 0 )
+        {
+            /* M += A.Z^4 */
+            MUL_MOD( S, &P->Z, &P->Z );
+            MUL_MOD( T, &S, &S );
+            MUL_MOD( S, &T, &grp->A );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &M,  &M,     &S      ) ); MOD_ADD( M );
+        }
+    }
+
+    /* S = 4.X.Y^2 */
+    MUL_MOD( T, &P->Y, &P->Y );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &T,  1               ) ); MOD_ADD( T );
+    MUL_MOD( S, &P->X, &T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &S,  1               ) ); MOD_ADD( S );
+
+    /* U = 8.Y^4 */
+    MUL_MOD( U, &T, &T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &U,  1               ) ); MOD_ADD( U );
+
+    /* T = M^2 - 2.S */
+    MUL_MOD( T, &M, &M );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T,  &T,     &S      ) ); MOD_SUB( T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T,  &T,     &S      ) ); MOD_SUB( T );
+
+    /* S = M(S - T) - U */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &S,  &S,     &T      ) ); MOD_SUB( S );
+    MUL_MOD( S, &S, &M );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &S,  &S,     &U      ) ); MOD_SUB( S );
+
+    /* U = 2.Y.Z */
+    MUL_MOD( U, &P->Y, &P->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &U,  1               ) ); MOD_ADD( U );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->X, &T ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Y, &S ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Z, &U ) );
+
+cleanup:
+    mbedtls_mpi_free( &M ); mbedtls_mpi_free( &S ); mbedtls_mpi_free( &T ); mbedtls_mpi_free( &U );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECP_DOUBLE_JAC_ALT */
+
+#if defined(MBEDTLS_ECP_ADD_MIXED_ALT)
+/*
+ * Addition R = P + Q, mixed affine-Jacobian coordinates, see ecp_add_mixed()
+ */
+int mbedtls_internal_ecp_add_mixed( const mbedtls_ecp_group *grp,
+                                    mbedtls_ecp_point *R,
+                                    const mbedtls_ecp_point *P,
+                                    const mbedtls_ecp_point *Q )
+{
+    int ret;
+    mbedtls_mpi T1, T2, T3, T4, X, Y, Z;
+
+    /*
+     * Trivial cases: P == 0 or Q == 0
+     */
+    if( mbedtls_mpi_cmp_int( &P->Z, 0 ) == 0 )
+        return( mbedtls_ecp_copy( R, Q ) );
+
+    if( Q->Z.p != NULL && mbedtls_mpi_cmp_int( &Q->Z, 0 ) == 0 )
+        return( mbedtls_ecp_copy( R, P ) );
+
+    /*
+     * Make sure Q coordinates are normalized
+     */
+    if( Q->Z.p != NULL && mbedtls_mpi_cmp_int( &Q->Z, 1 ) != 0 )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    mbedtls_mpi_init( &T1 ); mbedtls_mpi_init( &T2 ); mbedtls_mpi_init( &T3 ); mbedtls_mpi_init( &T4 );
+    mbedtls_mpi_init( &X ); mbedtls_mpi_init( &Y ); mbedtls_mpi_init( &Z );
+
+    MUL_MOD( T1, &P->Z, &P->Z );
+    MUL_MOD( T2, &T1, &P->Z );
+    MUL_MOD( T1, &T1, &Q->X );
+    MUL_MOD( T2, &T2, &Q->Y );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T1,  &T1,    &P->X ) );  MOD_SUB( T1 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T2,  &T2,    &P->Y ) );  MOD_SUB( T2 );
+
+    /* Special cases: R == 0 or P == Q */
+    if( mbedtls_mpi_cmp_int( &T1, 0 ) == 0 )
+    {
+        if( mbedtls_mpi_cmp_int( &T2, 0 ) == 0 )
+        {
+            ret = mbedtls_internal_ecp_double_jac( grp, R, P );
+            goto cleanup;
+        }
+        else
+        {
+            ret = mbedtls_ecp_set_zero( R );
+            goto cleanup;
+        }
+    }
+
+    MUL_MOD( Z,  &P->Z, &T1 );
+    MUL_MOD( T3, &T1, &T1 );
+    MUL_MOD( T4, &T3, &T1 );
+    MUL_MOD( T3, &T3, &P->X );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &T1,  &T3,    2     ) );  MOD_ADD( T1 );
+    MUL_MOD( X,  &T2, &T2 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &X,   &X,     &T1   ) );  MOD_SUB( X  );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &X,   &X,     &T4   ) );  MOD_SUB( X  );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T3,  &T3,    &X    ) );  MOD_SUB( T3 );
+    MUL_MOD( T3, &T3, &T2 );
+    MUL_MOD( T4, &T4, &P->Y );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &Y,   &T3,    &T4   ) );  MOD_SUB( Y  );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->X, &X ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Y, &Y ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Z, &Z ) );
+
+cleanup:
+
+    mbedtls_mpi_free( &T1 ); mbedtls_mpi_free( &T2 ); mbedtls_mpi_free( &T3 ); mbedtls_mpi_free( &T4 );
+    mbedtls_mpi_free( &X ); mbedtls_mpi_free( &Y ); mbedtls_mpi_free( &Z );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECP_ADD_MIXED_ALT */
+
+#endif /* MBEDTLS_ECP_C && MBEDTLS_ECP_INTERNAL_ALT */
@@ -0,0 +1,153 @@
+/*
+ *  FIPS-180-2 compliant SHA-256 block function
+ *
+ *  Copyright (C) 2006-2015, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+/*
+ *  There is no SHA-256 block in the crypto engine, so this replaces only the
+ *  compression function of library/sha256.c with one laid out for the xt804:
+ *
+ *  - the working variables are scalars, the rounds are unrolled in groups of
+ *    sixteen and the variables are rotated by renaming, so the whole state
+ *    stays in registers and no moves are emitted between rounds;
+ *  - the message schedule is a 16 word ring expanded in place, 64 bytes of
+ *    stack instead of 256, with every index a constant inside a group.
+ *
+ *  Undefining MBEDTLS_SHA256_PROCESS_ALT falls back to the library version.
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_SHA256_C) && defined(MBEDTLS_SHA256_PROCESS_ALT)
+
+#include "mbedtls/sha256.h"
+
+#define GET_UINT32_BE(b,i)                              \
+    ( ( (uint32_t) (b)[(i)    ] << 24 )                 \
+    | ( (uint32_t) (b)[(i) + 1] << 16 )                 \
+    | ( (uint32_t) (b)[(i) + 2] <<  8 )                 \
+    | ( (uint32_t) (b)[(i) + 3]       ) )
+
+static const uint32_t K[] =
+{
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+    0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+    0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+    0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+    0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+    0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+    0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+    0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+    0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+};
+
+/* written so that gcc emits a single rotate instruction */
+#define ROTR(x,n) ( ( (x) >> (n) ) | ( (x) << ( 32 - (n) ) ) )
+
+#define S0(x) (ROTR(x, 7) ^ ROTR(x,18) ^ ((x) >>  3))
+#define S1(x) (ROTR(x,17) ^ ROTR(x,19) ^ ((x) >> 10))
+
+#define S2(x) (ROTR(x, 2) ^ ROTR(x,13) ^ ROTR(x,22))
+#define S3(x) (ROTR(x, 6) ^ ROTR(x,11) ^ ROTR(x,25))
+
+#define CH(x,y,z)  ((z) ^ ((x) & ((y) ^ (z))))
+#define MAJ(x,y,z) (((x) & (y)) | ((z) & ((x) | (y))))
+
+/* rounds 0..15 of a block, i is the ring index */
+#define RND0(a,b,c,d,e,f,g,h,i)                                     \
+{                                                                   \
+    h += S3(e) + CH(e,f,g) + k[i] + W[i];                           \
+    d += h;                                                         \
+    h += S2(a) + MAJ(a,b,c);                                        \
+}
+
+/* rounds 16..63, W[t - 16] is overwritten with W[t] */
+#define RND1(a,b,c,d,e,f,g,h,i)                                     \
+{                                                                   \
+    W[i] += S1(W[((i) + 14) & 15]) + W[((i) + 9) & 15] +            \
+            S0(W[((i) +  1) & 15]);                                 \
+    RND0(a,b,c,d,e,f,g,h,i)                                         \
+}
+
+#define ROUNDS16(R)                                                 \
+{                                                                   \
+    R(a,b,c,d,e,f,g,h, 0) R(h,a,b,c,d,e,f,g, 1)                     \
+    R(g,h,a,b,c,d,e,f, 2) R(f,g,h,a,b,c,d,e, 3)                     \
+    R(e,f,g,h,a,b,c,d, 4) R(d,e,f,g,h,a,b,c, 5)                     \
+    R(c,d,e,f,g,h,a,b, 6) R(b,c,d,e,f,g,h,a, 7)                     \
+    R(a,b,c,d,e,f,g,h, 8) R(h,a,b,c,d,e,f,g, 9)                     \
+    R(g,h,a,b,c,d,e,f,10) R(f,g,h,a,b,c,d,e,11)                     \
+    R(e,f,g,h,a,b,c,d,12) R(d,e,f,g,h,a,b,c,13)                     \
+    R(c,d,e,f,g,h,a,b,14) R(b,c,d,e,f,g,h,a,15)                     \
+}
+
+int mbedtls_internal_sha256_process( mbedtls_sha256_context *ctx,
+                                const unsigned char data[64] )
+{
+    uint32_t a, b, c, d, e, f, g, h;
+    uint32_t W[16];
+    const uint32_t *k;
+
+    W[ 0] = GET_UINT32_BE( data,  0 ); W[ 1] = GET_UINT32_BE( data,  4 );
+    W[ 2] = GET_UINT32_BE( data,  8 ); W[ 3] = GET_UINT32_BE( data, 12 );
+    W[ 4] = GET_UINT32_BE( data, 16 ); W[ 5] = GET_UINT32_BE( data, 20 );
+    W[ 6] = GET_UINT32_BE( data, 24 ); W[ 7] = GET_UINT32_BE( data, 28 );
+    W[ 8] = GET_UINT32_BE( data, 32 ); W[ 9] = GET_UINT32_BE( data, 36 );
+    W[10] = GET_UINT32_BE( data, 40 ); W[11] = GET_UINT32_BE( data, 44 );
+    W[12] = GET_UINT32_BE( data, 48 ); W[13] = GET_UINT32_BE( data, 52 );
+    W[14] = GET_UINT32_BE( data, 56 ); W[15] = GET_UINT32_BE( data, 60 );
+
+    a = ctx->state[0]; b = ctx->state[1];
+    c = ctx->state[2]; d = ctx->state[3];
+    e = ctx->state[4]; f = ctx->state[5];
+    g = ctx->state[6]; h = ctx->state[7];
+
+    k = K;
+    ROUNDS16( RND0 );
+
+    for( k = K + 16; k < K + 64; k += 16 )
+        ROUNDS16( RND1 );
+
+    ctx->state[0] += a; ctx->state[1] += b;
+    ctx->state[2] += c; ctx->state[3] += d;
+    ctx->state[4] += e; ctx->state[5] += f;
+    ctx->state[6] += g; ctx->state[7] += h;
+
+    return( 0 );
+}
+
+#if !defined(MBEDTLS_DEPRECATED_REMOVED)
+void mbedtls_sha256_process( mbedtls_sha256_context *ctx,
+                             const unsigned char data[64] )
+{
+    mbedtls_internal_sha256_process( ctx, data );
+}
+#endif
+
+#endif /* MBEDTLS_SHA256_C && MBEDTLS_SHA256_PROCESS_ALT */
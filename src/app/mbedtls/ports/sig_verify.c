@@ -0,0 +1,248 @@
+/*
+ *  Signature verification cache
+ *
+ *  Copyright (C) 2006-2015, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+/*
+ * A cache entry is the SHA-256 of everything the result depends on: the
+ * algorithm, the hash, the signature and the public key. Only successful
+ * checks are stored, so a hit can never turn a bad signature into a good one,
+ * and entries expire MBEDTLS_SIG_VERIFY_CACHE_TIMEOUT seconds after the
+ * verification that produced them.
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_SIG_VERIFY_CACHE)
+
+#include <string.h>
+
+#include "mbedtls/sha256.h"
+#include "mbedtls/rsa.h"
+#include "mbedtls/ecp.h"
+#include "sig_verify.h"
+
+#if defined(MBEDTLS_PLATFORM_C)
+#include "mbedtls/platform.h"
+#else
+#include <stdlib.h>
+#define mbedtls_calloc    calloc
+#define mbedtls_free       free
+#endif
+
+#include "wm_osal.h"
+
+#define SIG_CACHE_KEY_LEN   32
+
+typedef struct
+{
+    unsigned char key[SIG_CACHE_KEY_LEN];
+    u32 stamp;                      /* tls_os_get_time() of the verification */
+    u8 valid;
+}
+sig_cache_entry;
+
+static sig_cache_entry sig_cache[MBEDTLS_SIG_VERIFY_CACHE_MAX_ENTRIES];
+
+static int sig_cache_update_len( mbedtls_sha256_context *sha, size_t len )
+{
+    unsigned char buf[4];
+
+    buf[0] = (unsigned char)( len >> 24 );
+    buf[1] = (unsigned char)( len >> 16 );
+    buf[2] = (unsigned char)( len >>  8 );
+    buf[3] = (unsigned char)( len       );
+
+    return( mbedtls_sha256_update_ret( sha, buf, sizeof( buf ) ) );
+}
+
+static int sig_cache_update_buf( mbedtls_sha256_context *sha,
+                                 const unsigned char *buf, size_t len )
+{
+    int ret;
+
+    if( ( ret = sig_cache_update_len( sha, len ) ) != 0 )
+        return( ret );
+
+    return( mbedtls_sha256_update_ret( sha, buf, len ) );
+}
+
+/* the significant limbs, as they are in memory: the key only lives in RAM */
+static int sig_cache_update_mpi( mbedtls_sha256_context *sha, const mbedtls_mpi *X )
+{
+    size_t n = ( mbedtls_mpi_bitlen( X ) + 8 * sizeof( mbedtls_mpi_uint ) - 1 ) /
+               ( 8 * sizeof( mbedtls_mpi_uint ) );
+
+    return( sig_cache_update_buf( sha, (const unsigned char *) X->p,
+                                  n * sizeof( mbedtls_mpi_uint ) ) );
+}
+
+/*
+ * Derive the cache key of a check, returns non-zero if it is not cacheable
+ */
+static int sig_cache_key( mbedtls_pk_type_t type, const void *options,
+                          mbedtls_pk_context *pk, mbedtls_md_type_t md_alg,
+                          const unsigned char *hash, size_t hash_len,
+                          const unsigned char *sig, size_t sig_len,
+                          unsigned char key[SIG_CACHE_KEY_LEN] )
+{
+    int ret;
+    mbedtls_sha256_context sha;
+    mbedtls_pk_type_t pk_type = mbedtls_pk_get_type( pk );
+    unsigned char alg[2];
+
+    if( options != NULL )
+        return( -1 );
+
+    if( !( type == MBEDTLS_PK_RSA && pk_type == MBEDTLS_PK_RSA ) &&
+        !( type == MBEDTLS_PK_ECDSA &&
+           ( pk_type == MBEDTLS_PK_ECKEY || pk_type == MBEDTLS_PK_ECDSA ) ) )
+        return( -1 );
+
+    alg[0] = (unsigned char) type;
+    alg[1] = (unsigned char) md_alg;
+
+    mbedtls_sha256_init( &sha );
+
+    if( ( ret = mbedtls_sha256_starts_ret( &sha, 0 ) ) != 0 ||
+        ( ret = mbedtls_sha256_update_ret( &sha, alg, sizeof( alg ) ) ) != 0 ||
+        ( ret = sig_cache_update_buf( &sha, hash, hash_len ) ) != 0 ||
+        ( ret = sig_cache_update_buf( &sha, sig, sig_len ) ) != 0 )
+        goto cleanup;
+
+    if( type == MBEDTLS_PK_RSA )
+    {
+        const mbedtls_rsa_context *rsa = mbedtls_pk_rsa( *pk );
+
+        if( ( ret = sig_cache_update_mpi( &sha, &rsa->N ) ) != 0 ||
+            ( ret = sig_cache_update_mpi( &sha, &rsa->E ) ) != 0 )
+            goto cleanup;
+    }
+    else
+    {
+        const mbedtls_ecp_keypair *ec = mbedtls_pk_ec( *pk );
+
+        if( ( ret = sig_cache_update_len( &sha, ec->grp.id ) ) != 0 ||
+            ( ret = sig_cache_update_mpi( &sha, &ec->Q.X ) ) != 0 ||
+            ( ret = sig_cache_update_mpi( &sha, &ec->Q.Y ) ) != 0 )
+            goto cleanup;
+    }
+
+    ret = mbedtls_sha256_finish_ret( &sha, key );
+
+cleanup:
+    mbedtls_sha256_free( &sha );
+
+    return( ret );
+}
+
+static int sig_cache_find( const unsigned char key[SIG_CACHE_KEY_LEN] )
+{
+    u32 now = tls_os_get_time();
+    u32 cpu_sr;
+    int found = 0;
+    int i;
+
+    cpu_sr = tls_os_set_critical();
+    for( i = 0; i < MBEDTLS_SIG_VERIFY_CACHE_MAX_ENTRIES; i++ )
+    {
+        sig_cache_entry *entry = &sig_cache[i];
+
+        if( !entry->valid )
+            continue;
+
+        if( now - entry->stamp >= (u32) MBEDTLS_SIG_VERIFY_CACHE_TIMEOUT * HZ )
+        {
+            entry->valid = 0;
+            continue;
+        }
+
+        if( memcmp( entry->key, key, SIG_CACHE_KEY_LEN ) == 0 )
+        {
+            found = 1;
+            break;
+        }
+    }
+    tls_os_release_critical( cpu_sr );
+
+    return( found );
+}
+
+/* store a successful check, in a free entry or over the oldest one */
+static void sig_cache_add( const unsigned char key[SIG_CACHE_KEY_LEN] )
+{
+    u32 now = tls_os_get_time();
+    u32 cpu_sr;
+    sig_cache_entry *entry = &sig_cache[0];
+    int i;
+
+    cpu_sr = tls_os_set_critical();
+    for( i = 0; i < MBEDTLS_SIG_VERIFY_CACHE_MAX_ENTRIES; i++ )
+    {
+        if( !sig_cache[i].valid )
+        {
+            entry = &sig_cache[i];
+            break;
+        }
+
+        if( now - sig_cache[i].stamp > now - entry->stamp )
+            entry = &sig_cache[i];
+    }
+
+    memcpy( entry->key, key, SIG_CACHE_KEY_LEN );
+    entry->stamp = now;
+    entry->valid = 1;
+    tls_os_release_critical( cpu_sr );
+}
+
+void mbedtls_sig_verify_flush( void )
+{
+    u32 cpu_sr;
+
+    cpu_sr = tls_os_set_critical();
+    memset( sig_cache, 0, sizeof( sig_cache ) );
+    tls_os_release_critical( cpu_sr );
+}
+
+int mbedtls_sig_verify_ext( mbedtls_pk_type_t type, const void *options,
+                            mbedtls_pk_context *pk, mbedtls_md_type_t md_alg,
+                            const unsigned char *hash, size_t hash_len,
+                            const unsigned char *sig, size_t sig_len )
+{
+    int ret;
+    unsigned char key[SIG_CACHE_KEY_LEN];
+    int cacheable;
+
+    cacheable = sig_cache_key( type, options, pk, md_alg, hash, hash_len,
+                               sig, sig_len, key ) == 0;
+    if( cacheable && sig_cache_find( key ) )
+        return( 0 );
+
+    ret = mbedtls_pk_verify_ext( type, options, pk, md_alg,
+                                 hash, hash_len, sig, sig_len );
+    if( ret == 0 && cacheable )
+        sig_cache_add( key );
+
+    return( ret );
+}
+
+#endif /* MBEDTLS_SIG_VERIFY_CACHE */
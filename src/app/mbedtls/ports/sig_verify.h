@@ -0,0 +1,78 @@
+/**
+ * \file sig_verify.h
+ *
+ * \brief Signature verification with a cache of the successful checks.
+ */
+/*
+ *  Copyright (C) 2006-2018, Arm Limited (or its affiliates), All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of Mbed TLS (https://tls.mbed.org)
+ */
+#ifndef MBEDTLS_SIG_VERIFY_H
+#define MBEDTLS_SIG_VERIFY_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include <stddef.h>
+
+#include "mbedtls/pk.h"
+
+#if defined(MBEDTLS_SIG_VERIFY_CACHE)
+
+#if !defined(MBEDTLS_SIG_VERIFY_CACHE_TIMEOUT)
+#define MBEDTLS_SIG_VERIFY_CACHE_TIMEOUT       3600 /**< Seconds a successful signature check is remembered */
+#endif
+
+#if !defined(MBEDTLS_SIG_VERIFY_CACHE_MAX_ENTRIES)
+#define MBEDTLS_SIG_VERIFY_CACHE_MAX_ENTRIES      8 /**< Maximum entries in cache */
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief          Drop-in for mbedtls_pk_verify_ext() that answers from the
+ *                 cache when the same signature over the same hash was
+ *                 already found valid for the same key.
+ *
+ *                 Successful RSA (PKCS#1 v1.5) and ECDSA checks are cached,
+ *                 anything else is verified every time.
+ *
+ * \return         0 on success, or a specific error code as for
+ *                 mbedtls_pk_verify_ext().
+ */
+int mbedtls_sig_verify_ext( mbedtls_pk_type_t type, const void *options,
+                            mbedtls_pk_context *pk, mbedtls_md_type_t md_alg,
+                            const unsigned char *hash, size_t hash_len,
+                            const unsigned char *sig, size_t sig_len );
+
+/**
+ * \brief          Forget all cached results, e.g. after a key was revoked.
+ */
+void mbedtls_sig_verify_flush( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_SIG_VERIFY_CACHE */
+
+#endif /* MBEDTLS_SIG_VERIFY_H */
@@ -14,6 +14,8 @@
 #define MQTT_USERNAME_FLAG  (1<<7)
 #define MQTT_PASSWORD_FLAG  (1<<6)
 
+int encode_length(int length, uint8_t *buf);
+
 uint8_t mqtt_num_rem_len_bytes(const uint8_t* buf) {
     uint8_t num_bytes = 1;
 
@@ -31,10 +33,11 @@ uint8_t mqtt_num_rem_len_bytes(const uint8_t* buf) {
     return num_bytes;
 }
 
-uint16_t mqtt_parse_rem_len(const uint8_t* buf) {
-    uint16_t multiplier = 1;
-    uint16_t value = 0;
+uint32_t mqtt_parse_rem_len(const uint8_t* buf) {
+    uint32_t multiplier = 1;
+    uint32_t value = 0;
     uint8_t digit;
+    uint8_t num_bytes = 0;
 
     //printf("mqtt_parse_rem_len\n");
 
@@ -45,7 +48,7 @@ uint16_t mqtt_parse_rem_len(const uint8_t* buf) {
         value += (digit & 127) * multiplier;
         multiplier *= 128;
         buf++;
-    } while ((digit & 128) != 0);
+    } while ((digit & 128) != 0 && ++num_bytes < 4);
 
     return value;
 }
@@ -63,7 +66,7 @@ uint16_t mqtt_parse_msg_id(const uint8_t* buf) {
                 // fixed header length + Topic (UTF encoded)
                 // = 1 for "flags" byte + rlb for length bytes + topic size
                 uint8_t rlb = mqtt_num_rem_len_bytes(buf);
-                uint8_t offset = *(buf+1+rlb)<<8;	// topic UTF MSB
+                uint32_t offset = *(buf+1+rlb)<<8;	// topic UTF MSB
                 offset |= *(buf+1+rlb+1);			// topic UTF LSB
                 offset += (1+rlb+2);					// fixed header + topic size
                 id = *(buf+offset)<<8;				// id MSB
@@ -111,9 +114,9 @@ uint16_t mqtt_parse_pub_topic_ptr(const uint8_t* buf, const uint8_t **topic_ptr)
     return len;
 }
 
-uint16_t mqtt_parse_publish_msg(const uint8_t* buf, uint8_t** msg) {
+uint32_t mqtt_parse_publish_msg(const uint8_t* buf, uint8_t** msg) {
     uint8_t* ptr;
-    uint16_t msg_len = mqtt_parse_pub_msg_ptr(buf, (const uint8_t **)&ptr);
+    uint32_t msg_len = mqtt_parse_pub_msg_ptr(buf, (const uint8_t **)&ptr);
 
     if(msg_len != 0 && ptr != NULL) {
         //memcpy(msg, ptr, msg_len);
@@ -123,8 +126,8 @@ uint16_t mqtt_parse_publish_msg(const uint8_t* buf, uint8_t** msg) {
     return msg_len;
 }
 
-uint16_t mqtt_parse_pub_msg_ptr(const uint8_t* buf, const uint8_t **msg_ptr) {
-    uint16_t len = 0;
+uint32_t mqtt_parse_pub_msg_ptr(const uint8_t* buf, const uint8_t **msg_ptr) {
+    uint32_t len = 0;
 
     //printf("mqtt_parse_pub_msg_ptr\n");
 
@@ -132,7 +135,7 @@ uint16_t mqtt_parse_pub_msg_ptr(const uint8_t* buf, const uint8_t **msg_ptr) {
         // message starts at
         // fixed header length + Topic (UTF encoded) + msg id (if QoS>0)
         uint8_t rlb = mqtt_num_rem_len_bytes(buf);
-        uint8_t offset = (*(buf+1+rlb))<<8;	// topic UTF MSB
+        uint32_t offset = (*(buf+1+rlb))<<8;	// topic UTF MSB
         offset |= *(buf+1+rlb+1);			// topic UTF LSB
         offset += (1+rlb+2);				// fixed header + topic size
 
@@ -170,6 +173,7 @@ void mqtt_init(mqtt_broker_handle_t* broker, const char* clientid) {
     }
     // Will topic
     broker->clean_session = 1;
+    broker->mqttsendv = NULL;
 }
 
 void mqtt_init_auth(mqtt_broker_handle_t* broker, const char* username, const char* password) {
@@ -201,7 +205,7 @@ int mqtt_connect(mqtt_broker_handle_t* broker)
     uint16_t offset = 0;
     uint16_t clientidlen,usernamelen,passwordlen,payload_len;
     uint8_t fixedHeaderSize;
-    uint8_t remainLen;
+    int remainLen;
     uint8_t var_header[12] = {
         0x00,0x06,0x4d,0x51,0x49,0x73,0x64,0x70, // Protocol name: MQIsdp
         0x03, // Protocol version
@@ -233,31 +237,19 @@ int mqtt_connect(mqtt_broker_handle_t* broker)
     var_header[9]= flags;
 
     // Fixed header
-    fixedHeaderSize = 2;    // Default size = one byte Message Type + one byte Remaining Length
+    fixedHeaderSize = 5;    // one byte Message Type + up to four bytes Remaining Length
     remainLen = sizeof(var_header)+payload_len;
-    if (remainLen > 127) {
-        fixedHeaderSize++;          // add an additional byte for Remaining Length
-    }
     
     fixed_header = (uint8_t*)tls_mem_alloc( fixedHeaderSize );
     if( fixed_header==NULL )
     {
         return -1;
     }
-    fixed_headerLen = fixedHeaderSize;
     // Message Type
     fixed_header[0] = MQTT_MSG_CONNECT;
 
     // Remaining Length
-    if (remainLen <= 127) {
-        fixed_header[1] = remainLen;
-    } else {
-        // first byte is remainder (mod) of 128, then set the MSB to indicate more bytes
-        fixed_header[1] = remainLen % 128;
-        fixed_header[1] = fixed_header[1] | 0x80;
-        // second byte is number of 128s
-        fixed_header[2] = remainLen / 128;
-    }
+    fixed_headerLen = 1 + encode_length(remainLen, &fixed_header[1]);
 	
     packet = (uint8_t*)tls_mem_alloc( fixed_headerLen+sizeof(var_header)+payload_len );
     if( packet==NULL )
@@ -336,6 +328,28 @@ int mqtt_ping(mqtt_broker_handle_t* broker) {
 int mqtt_publish(mqtt_broker_handle_t* broker, const char* topic, const char* msg, int msgLen, uint8_t retain) {
     return mqtt_publish_with_qos(broker, topic, msg, msgLen,retain, 0, NULL);
 }
+static int mqtt_sendv(mqtt_broker_handle_t* broker, const mqtt_iovec_t* iov, int iovcnt) {
+    int total = 0;
+    int i;
+
+    if(broker->mqttsendv) {
+        for(i = 0; i < iovcnt; i++) {
+            total += iov[i].len;
+        }
+        if(broker->mqttsendv(broker->socketid, iov, iovcnt) < total) {
+            return -1;
+        }
+        return 1;
+    }
+
+    for(i = 0; i < iovcnt; i++) {
+        if(iov[i].len && broker->mqttsend(broker->socketid, iov[i].base, iov[i].len) < (int)iov[i].len) {
+            return -1;
+        }
+    }
+    return 1;
+}
+
 int mqtt_publish_with_qos(mqtt_broker_handle_t* broker, 
                              const char* topic, 
                              const char* msg,
@@ -343,21 +357,40 @@ int mqtt_publish_with_qos(mqtt_broker_handle_t* broker,
                              uint8_t retain, 
                              uint8_t qos, 
                              uint16_t* message_id) 
+{
+    uint16_t id = 0;
+
+    if(qos == 1 || qos == 2) {
+        id = broker->seq++;
+        if(id == 0) { // 0 is not a valid message id
+            id = broker->seq++;
+        }
+        if(message_id) { // Returning message id
+            *message_id = id;
+        }
+    }
+    return mqtt_publish_with_id(broker, topic, msg, msgLen, retain, qos, id, 0);
+}
+
+int mqtt_publish_with_id(mqtt_broker_handle_t* broker, 
+                             const char* topic, 
+                             const char* msg,
+                             int msgLen, 
+                             uint8_t retain, 
+                             uint8_t qos, 
+                             uint16_t message_id,
+                             uint8_t dup) 
 {
     uint16_t topiclen = strlen(topic);
 
     uint8_t qos_flag = MQTT_QOS0_FLAG;
     uint8_t qos_size = 0; // No QoS included
-/************************add by alex****************************/
-    int var_headerLen;
-    int fixed_headerLen;
-    int packetLen;
-
-    uint8_t *var_header=NULL;
-    uint8_t *fixed_header=NULL;
-    uint8_t fixedHeaderSize = 2;
-    uint16_t remainLen;
-/***************************************************************/	
+    uint8_t buf[MQTT_CONF_PUBLISH_BUF_SIZE];
+    uint8_t id[2];
+    mqtt_iovec_t iov[4];
+    int iovcnt = 0;
+    int bufLen;
+    int remainLen;
 
     if(qos == 1) {
         qos_size = 2; // 2 bytes for QoS
@@ -367,106 +400,81 @@ int mqtt_publish_with_qos(mqtt_broker_handle_t* broker,
         qos_size = 2; // 2 bytes for QoS
         qos_flag = MQTT_QOS2_FLAG;
     }
-/************************add by alex*******************************/
-    // Variable header
-    var_header = ( uint8_t* )tls_mem_alloc( topiclen+2+qos_size );
-    
-    if( var_header==NULL )
-    {
+
+    if(msgLen < 0) {
         return -1;
     }
-    
-    var_headerLen = topiclen+2+qos_size;
-/******************************************************************/
-    memset(var_header, 0, var_headerLen);
-    var_header[0] = topiclen>>8;
-    var_header[1] = topiclen&0xFF;
-    memcpy(var_header+2, topic, topiclen);
-    if(qos_size) {
-        var_header[topiclen+2] = broker->seq>>8;
-        var_header[topiclen+3] = broker->seq&0xFF;
-        if(message_id) { // Returning message id
-            *message_id = broker->seq;
-        }
-        broker->seq++;
+    remainLen = 2+topiclen+qos_size+msgLen;
+    if(remainLen > 268435455) { // 4 remaining length bytes at most
+        return -1;
     }
 
-    // Fixed header
-    // the remaining length is one byte for messages up to 127 bytes, then two bytes after that
-    // actually, it can be up to 4 bytes but I'm making the assumption the embedded device will only
-    // need up to two bytes of length (handles up to 16,383 (almost 16k) sized message)
+    // Fixed header: Message Type, DUP flag, QoS level, Retain, Remaining Length
+    buf[0] = MQTT_MSG_PUBLISH | qos_flag;
+    if(retain) {
+        buf[0] |= MQTT_RETAIN_FLAG;
+    }
+    if(dup && qos_size) {
+        buf[0] |= MQTT_DUP_FLAG;
+    }
+    bufLen = 1 + encode_length(remainLen, &buf[1]);
 
-    /**********************add by alex**************************************/
-    remainLen = var_headerLen+msgLen;
-    /***********************************************************************/
-    if (remainLen > 127) {
-        fixedHeaderSize++;          // add an additional byte for Remaining Length
+    // Variable header: topic and message id
+    buf[bufLen++] = topiclen>>8;
+    buf[bufLen++] = topiclen&0xFF;
+    if(qos_size) {
+        id[0] = message_id>>8;
+        id[1] = message_id&0xFF;
+    }
+    if(bufLen+topiclen+qos_size <= sizeof(buf)) {
+        memcpy(buf+bufLen, topic, topiclen);
+        bufLen += topiclen;
+        if(qos_size) {
+            buf[bufLen++] = id[0];
+            buf[bufLen++] = id[1];
+        }
+    } else {
+        iov[iovcnt].base = buf;
+        iov[iovcnt++].len = bufLen;
+        iov[iovcnt].base = topic;
+        iov[iovcnt++].len = topiclen;
+        bufLen = 0;
+        if(qos_size) {
+            iov[iovcnt].base = id;
+            iov[iovcnt++].len = 2;
+        }
     }
 
-    /***********************add by alex *******************/
-    fixed_headerLen = fixedHeaderSize;
-    fixed_header = (uint8_t *)tls_mem_alloc( fixed_headerLen );
-    if( fixed_header==NULL )
-    {
-        tls_mem_free( var_header );
-        return -1;
+    // Without a gather send, a short message goes out with its headers in
+    // one write rather than as a separate segment.
+    if(!broker->mqttsendv && iovcnt == 0 && bufLen+msgLen <= sizeof(buf)) {
+        memcpy(buf+bufLen, msg, msgLen);
+        bufLen += msgLen;
+        msgLen = 0;
     }
-    /******************************************************/
-    
-    // Message Type, DUP flag, QoS level, Retain
-    fixed_header[0] = MQTT_MSG_PUBLISH | qos_flag;
-    if(retain) {
-        fixed_header[0] |= MQTT_RETAIN_FLAG;
+    if(bufLen) {
+        iov[iovcnt].base = buf;
+        iov[iovcnt++].len = bufLen;
     }
-    // Remaining Length
-    if (remainLen <= 127) {
-        fixed_header[1] = remainLen;
-    } else {
-        // first byte is remainder (mod) of 128, then set the MSB to indicate more bytes
-        fixed_header[1] = remainLen % 128;
-        fixed_header[1] = fixed_header[1] | 0x80;
-        // second byte is number of 128s
-        fixed_header[2] = remainLen / 128;
-    }
-    /**********************add by alex******************************/
-    packetLen = fixed_headerLen+var_headerLen+msgLen;
-    //uint8_t packet[packetLen];
-    uint8_t *packet = tls_mem_alloc(packetLen);
-    if (!packet)
-    {
-        tls_mem_free(var_header);
-        tls_mem_free( fixed_header );
-        return -1;
+    if(msgLen) {
+        iov[iovcnt].base = msg;
+        iov[iovcnt++].len = msgLen;
     }
-    memset(packet, 0, packetLen);
-    memcpy(packet, fixed_header, fixed_headerLen);
-    memcpy(packet+fixed_headerLen, var_header, var_headerLen);
-    memcpy(packet+fixed_headerLen+var_headerLen, msg, msgLen);
 
     // Send the packet
-    if(broker->mqttsend(broker->socketid, packet, packetLen ) < packetLen) {
-        tls_mem_free(var_header);
-        tls_mem_free( fixed_header );
-        tls_mem_free(packet);
-        return -1;
-    }
-    tls_mem_free( fixed_header );
-    tls_mem_free(var_header);
-    tls_mem_free(packet);
-    return 1;
+    return mqtt_sendv(broker, iov, iovcnt);
 }
 
-int mqtt_pubrel(mqtt_broker_handle_t* broker, uint16_t message_id) {
+static int mqtt_send_ack(mqtt_broker_handle_t* broker, uint8_t type, uint16_t message_id) {
     uint8_t packet[4] = {
-        MQTT_MSG_PUBREL | MQTT_QOS1_FLAG, // Message Type, DUP flag, QoS level, Retain
+        0, // Message Type, DUP flag, QoS level, Retain
         0x02, // Remaining length
         0/*message_id>>8*/,
         0/*message_id&0xFF*/
     };
-    /************add by alex*****************/
+    packet[0] = type;
     packet[2] = message_id>>8;
     packet[3] = message_id&0xFF;
-    /****************************************/
     // Send the packet
     if(broker->mqttsend(broker->socketid, packet, sizeof(packet)) < sizeof(packet)) {
         return -1;
@@ -475,6 +483,22 @@ int mqtt_pubrel(mqtt_broker_handle_t* broker, uint16_t message_id) {
     return 1;
 }
 
+int mqtt_pubrel(mqtt_broker_handle_t* broker, uint16_t message_id) {
+    return mqtt_send_ack(broker, MQTT_MSG_PUBREL | MQTT_QOS1_FLAG, message_id);
+}
+
+int mqtt_puback(mqtt_broker_handle_t* broker, uint16_t message_id) {
+    return mqtt_send_ack(broker, MQTT_MSG_PUBACK, message_id);
+}
+
+int mqtt_pubrec(mqtt_broker_handle_t* broker, uint16_t message_id) {
+    return mqtt_send_ack(broker, MQTT_MSG_PUBREC, message_id);
+}
+
+int mqtt_pubcomp(mqtt_broker_handle_t* broker, uint16_t message_id) {
+    return mqtt_send_ack(broker, MQTT_MSG_PUBCOMP, message_id);
+}
+
 int encode_length(int length, uint8_t *buf)
 {
 	int ret = 0;
@@ -40,6 +40,10 @@
 	#define MQTT_CONF_PASSWORD_LENGTH 24 // Recommended by MQTT Specification (12 + '\0')
 #endif
 
+#ifndef MQTT_CONF_PUBLISH_BUF_SIZE
+	#define MQTT_CONF_PUBLISH_BUF_SIZE 128 // Stack buffer used by mqtt_publish_with_qos for headers (and short messages)
+#endif
+
 #define CLOUD_MQTT_SET_ALIVE      (120)
 
 #define MQTT_MSG_CONNECT       (1<<4)
@@ -109,7 +113,7 @@ uint8_t mqtt_num_rem_len_bytes(const uint8_t* buf);
  *
  * @retval remaining length
  */
-uint16_t mqtt_parse_rem_len(const uint8_t* buf);
+uint32_t mqtt_parse_rem_len(const uint8_t* buf);
 
 /** Parse packet buffer for message id.
  *
@@ -147,18 +151,27 @@ uint16_t mqtt_parse_pub_topic_ptr(const uint8_t* buf, const uint8_t** topic_ptr)
  *
  * @retval size in bytes of topic (0 = no publish message in buffer)
  */
-uint16_t mqtt_parse_publish_msg(const uint8_t* buf, uint8_t** msg);
+uint32_t mqtt_parse_publish_msg(const uint8_t* buf, uint8_t** msg);
 
 /** Parse a packet buffer for a pointer to the publish message.
  *
  *  Not called directly - called by mqtt_parse_pub_msg
  */
-uint16_t mqtt_parse_pub_msg_ptr(const uint8_t* buf, const uint8_t** msg_ptr);
+uint32_t mqtt_parse_pub_msg_ptr(const uint8_t* buf, const uint8_t** msg_ptr);
 
 
+/** One element of the gather list handed to mqttsendv. */
+typedef struct {
+	const void* base;
+	unsigned int len;
+} mqtt_iovec_t;
+
 typedef struct {
 	int socketid;    
 	int (*mqttsend)(int socket_info, const void* buf, unsigned int count);
+	// Optional gather send, returns the number of bytes sent. Used by
+	// mqtt_publish_with_qos when set, mqttsend is called per element otherwise.
+	int (*mqttsendv)(int socket_info, const mqtt_iovec_t* iov, int iovcnt);
 	// Connection info
 	char clientid[50];
 	// Auth fields
@@ -239,12 +252,31 @@ int mqtt_publish(mqtt_broker_handle_t* broker, const char* topic, const char* ms
  * @param qos Quality of Service (values: 0, 1 or 2)
  * @param message_id Variable that will store the Message ID, if the pointer is not NULL.
  *
+ * @note No memory is allocated: the headers are built on the stack and
+ * the topic and message are sent from the caller's buffers, through
+ * mqttsendv if set.
+ *
  * @retval  1 On success.
  * @retval  0 On connection error.
  * @retval -1 On IO error.
  */
 int mqtt_publish_with_qos(mqtt_broker_handle_t* broker, const char* topic, const char* msg, int msgLen, uint8_t retain, uint8_t qos, uint16_t* message_id);
 
+/** Publish a message with a given message id.
+ * @param broker Data structure that contains the connection information with the broker.
+ * @param topic The topic name.
+ * @param msg The message.
+ * @param retain Enable or disable the Retain flag (values: 0 or 1).
+ * @param qos Quality of Service (values: 0, 1 or 2)
+ * @param message_id Message ID, ignored for QoS 0.
+ * @param dup Set the DUP flag, used when a QoS 1/2 message is retransmitted.
+ *
+ * @retval  1 On success.
+ * @retval  0 On connection error.
+ * @retval -1 On IO error.
+ */
+int mqtt_publish_with_id(mqtt_broker_handle_t* broker, const char* topic, const char* msg, int msgLen, uint8_t retain, uint8_t qos, uint16_t message_id, uint8_t dup);
+
 /** Send a PUBREL message. It's used for PUBLISH message with 2 QoS level.
  * @param broker Data structure that contains the connection information with the broker.
  * @param message_id Message ID
@@ -255,6 +287,36 @@ int mqtt_publish_with_qos(mqtt_broker_handle_t* broker, const char* topic, const
  */
 int mqtt_pubrel(mqtt_broker_handle_t* broker, uint16_t message_id);
 
+/** Send a PUBACK message, in reply to a received PUBLISH with 1 QoS level.
+ * @param broker Data structure that contains the connection information with the broker.
+ * @param message_id Message ID
+ *
+ * @retval  1 On success.
+ * @retval  0 On connection error.
+ * @retval -1 On IO error.
+ */
+int mqtt_puback(mqtt_broker_handle_t* broker, uint16_t message_id);
+
+/** Send a PUBREC message, in reply to a received PUBLISH with 2 QoS level.
+ * @param broker Data structure that contains the connection information with the broker.
+ * @param message_id Message ID
+ *
+ * @retval  1 On success.
+ * @retval  0 On connection error.
+ * @retval -1 On IO error.
+ */
+int mqtt_pubrec(mqtt_broker_handle_t* broker, uint16_t message_id);
+
+/** Send a PUBCOMP message, in reply to a received PUBREL.
+ * @param broker Data structure that contains the connection information with the broker.
+ * @param message_id Message ID
+ *
+ * @retval  1 On success.
+ * @retval  0 On connection error.
+ * @retval -1 On IO error.
+ */
+int mqtt_pubcomp(mqtt_broker_handle_t* broker, uint16_t message_id);
+
 /** Subscribe to a topic.
  * @param broker Data structure that contains the connection information with the broker.
  * @param topic The topic name.
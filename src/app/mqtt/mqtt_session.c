@@ -0,0 +1,388 @@
+/*
+ * This file is part of libemqtt.
+ *
+ * libemqtt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libemqtt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libemqtt.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "wm_include.h"
+#include "wm_internal_flash.h"
+#include "mqtt_session.h"
+
+#define MQTT_SESSION_QUEUED       0 // Not sent yet
+#define MQTT_SESSION_WAIT_PUBACK  1 // QoS 1, sent
+#define MQTT_SESSION_WAIT_PUBREC  2 // QoS 2, sent
+#define MQTT_SESSION_WAIT_PUBCOMP 3 // QoS 2, PUBREL sent
+
+#define MQTT_SESSION_NO_FLASH     0xFFFFFFFF
+
+#define MQTT_SESSION_REC_MAGIC    0x4D51
+#define MQTT_SESSION_REC_VALID    0x5A
+
+typedef struct {
+    struct dl_list list;
+    uint32_t sent;          // Tick of the last transmission
+    uint32_t flash_offset;  // Record in the flash region, or MQTT_SESSION_NO_FLASH
+    uint32_t msglen;
+    uint16_t topiclen;
+    uint16_t id;
+    uint8_t qos;
+    uint8_t retain;
+    uint8_t state;
+    // Followed by the NUL terminated topic and the message
+} mqtt_session_msg_t;
+
+// Flash record header, followed by the topic and the message. Records are
+// appended; `valid` is written last and `done` is cleared on acknowledgement,
+// both without erasing.
+typedef struct {
+    uint16_t magic;
+    uint16_t topiclen;
+    uint32_t msglen;
+    uint8_t flags;          // QoS in bits 0-1, retain in bit 2
+    uint8_t valid;
+    uint8_t done;
+    uint8_t reserved;
+} mqtt_session_rec_t;
+
+#define MQTT_SESSION_REC_LEN(topiclen, msglen) \
+    ((sizeof(mqtt_session_rec_t) + (topiclen) + (msglen) + 3) & ~3)
+
+static char* msg_topic(mqtt_session_msg_t* m) {
+    return (char*)(m + 1);
+}
+
+static char* msg_data(mqtt_session_msg_t* m) {
+    return (char*)(m + 1) + m->topiclen + 1;
+}
+
+static mqtt_session_msg_t* msg_alloc(uint16_t topiclen, uint32_t msglen) {
+    mqtt_session_msg_t* m = tls_mem_alloc(sizeof(mqtt_session_msg_t) + topiclen + 1 + msglen);
+
+    if(m == NULL) {
+        return NULL;
+    }
+    memset(m, 0, sizeof(mqtt_session_msg_t));
+    m->topiclen = topiclen;
+    m->msglen = msglen;
+    m->flash_offset = MQTT_SESSION_NO_FLASH;
+    msg_topic(m)[topiclen] = '\0';
+    return m;
+}
+
+static void flash_erase(mqtt_session_t* session) {
+    uint32_t off;
+
+    for(off = 0; off < session->flash_size; off += INSIDE_FLS_SECTOR_SIZE) {
+        tls_fls_erase((session->flash_addr + off) / INSIDE_FLS_SECTOR_SIZE);
+    }
+    session->flash_pos = 0;
+}
+
+static void flash_store(mqtt_session_t* session, mqtt_session_msg_t* m) {
+    mqtt_session_rec_t rec;
+    uint32_t len = MQTT_SESSION_REC_LEN(m->topiclen, m->msglen);
+    uint32_t addr;
+
+    if(session->flash_size == 0) {
+        return;
+    }
+    if(session->flash_pos + len > session->flash_size) {
+        // The region is only reclaimed once every record in it is done
+        if(session->flash_live) {
+            return;
+        }
+        flash_erase(session);
+        if(len > session->flash_size) {
+            return;
+        }
+    }
+
+    memset(&rec, 0xFF, sizeof(rec));
+    rec.magic = MQTT_SESSION_REC_MAGIC;
+    rec.topiclen = m->topiclen;
+    rec.msglen = m->msglen;
+    rec.flags = m->qos | (m->retain ? 0x04 : 0);
+    addr = session->flash_addr + session->flash_pos;
+    if(tls_fls_write_without_erase(addr, (u8*)&rec, sizeof(rec)) != TLS_FLS_STATUS_OK ||
+       tls_fls_write_without_erase(addr + sizeof(rec), (u8*)msg_topic(m), m->topiclen) != TLS_FLS_STATUS_OK ||
+       (m->msglen && tls_fls_write_without_erase(addr + sizeof(rec) + m->topiclen, (u8*)msg_data(m), m->msglen) != TLS_FLS_STATUS_OK)) {
+        session->flash_pos = session->flash_size; // Unknown state, reclaim on next store
+        return;
+    }
+    rec.valid = MQTT_SESSION_REC_VALID;
+    tls_fls_write_without_erase(addr + offsetof(mqtt_session_rec_t, valid), &rec.valid, 1);
+
+    m->flash_offset = session->flash_pos;
+    session->flash_pos += len;
+    session->flash_live++;
+}
+
+static void flash_done(mqtt_session_t* session, mqtt_session_msg_t* m) {
+    uint8_t done = 0;
+
+    if(m->flash_offset == MQTT_SESSION_NO_FLASH) {
+        return;
+    }
+    tls_fls_write_without_erase(session->flash_addr + m->flash_offset + offsetof(mqtt_session_rec_t, done), &done, 1);
+    m->flash_offset = MQTT_SESSION_NO_FLASH;
+    session->flash_live--;
+}
+
+static void flash_restore(mqtt_session_t* session) {
+    mqtt_session_rec_t rec;
+    mqtt_session_msg_t* m;
+    uint32_t addr;
+    uint32_t len;
+
+    session->flash_pos = 0;
+    while(session->flash_pos + sizeof(rec) <= session->flash_size) {
+        addr = session->flash_addr + session->flash_pos;
+        tls_fls_read(addr, (u8*)&rec, sizeof(rec));
+        if(rec.magic == 0xFFFF) {
+            return; // Erased, end of the log
+        }
+        len = MQTT_SESSION_REC_LEN(rec.topiclen, rec.msglen);
+        if(rec.magic != MQTT_SESSION_REC_MAGIC || rec.valid != MQTT_SESSION_REC_VALID ||
+           session->flash_pos + len > session->flash_size) {
+            // Interrupted write, nothing can be appended after it
+            session->flash_pos = session->flash_size;
+            return;
+        }
+        if(rec.done == 0xFF && session->queued < session->max_queued) {
+            m = msg_alloc(rec.topiclen, rec.msglen);
+            if(m) {
+                tls_fls_read(addr + sizeof(rec), (u8*)msg_topic(m), rec.topiclen);
+                if(rec.msglen) {
+                    tls_fls_read(addr + sizeof(rec) + rec.topiclen, (u8*)msg_data(m), rec.msglen);
+                }
+                m->qos = rec.flags & 0x03;
+                m->retain = (rec.flags & 0x04) ? 1 : 0;
+                m->flash_offset = session->flash_pos;
+                dl_list_add_tail(&session->queue, &m->list);
+                session->queued++;
+                session->flash_live++;
+            }
+        }
+        session->flash_pos += len;
+    }
+}
+
+static void msg_complete(mqtt_session_t* session, mqtt_session_msg_t* m) {
+    flash_done(session, m);
+    dl_list_del(&m->list);
+    session->queued--;
+    session->inflight--;
+    tls_mem_free(m);
+}
+
+static int msg_send(mqtt_session_t* session, mqtt_session_msg_t* m, uint8_t dup) {
+    m->sent = tls_os_get_time();
+    if(m->state == MQTT_SESSION_WAIT_PUBCOMP) {
+        return mqtt_pubrel(session->broker, m->id);
+    }
+    return mqtt_publish_with_id(session->broker, msg_topic(m), msg_data(m), m->msglen,
+                                m->retain, m->qos, m->id, dup);
+}
+
+static mqtt_session_msg_t* msg_find(mqtt_session_t* session, uint16_t id, uint8_t state) {
+    mqtt_session_msg_t* m;
+
+    dl_list_for_each(m, &session->queue, mqtt_session_msg_t, list) {
+        if(m->state == state && m->id == id) {
+            return m;
+        }
+    }
+    return NULL;
+}
+
+// Send queued messages while the window allows.
+static void session_pump(mqtt_session_t* session) {
+    mqtt_session_msg_t* m;
+    mqtt_broker_handle_t* broker = session->broker;
+
+    if(!session->connected) {
+        return;
+    }
+    dl_list_for_each(m, &session->queue, mqtt_session_msg_t, list) {
+        if(session->inflight >= session->window) {
+            break;
+        }
+        if(m->state != MQTT_SESSION_QUEUED) {
+            continue;
+        }
+        m->id = broker->seq++;
+        if(m->id == 0) { // 0 is not a valid message id
+            m->id = broker->seq++;
+        }
+        m->state = (m->qos == 1) ? MQTT_SESSION_WAIT_PUBACK : MQTT_SESSION_WAIT_PUBREC;
+        session->inflight++;
+        if(msg_send(session, m, 0) < 0) {
+            // Left in flight, retransmitted by mqtt_session_poll or on reconnect
+            session->connected = 0;
+            break;
+        }
+    }
+}
+
+int mqtt_session_init(mqtt_session_t* session, mqtt_broker_handle_t* broker, uint32_t flash_addr, uint32_t flash_size) {
+    memset(session, 0, sizeof(mqtt_session_t));
+    session->broker = broker;
+    dl_list_init(&session->queue);
+    session->window = MQTT_SESSION_WINDOW;
+    session->max_queued = MQTT_SESSION_MAX_QUEUED;
+    session->retry_ticks = MQTT_SESSION_RETRY_MS * HZ / 1000;
+
+    if(flash_size) {
+        if((flash_addr % INSIDE_FLS_SECTOR_SIZE) || (flash_size % INSIDE_FLS_SECTOR_SIZE)) {
+            return -1;
+        }
+        session->flash_addr = flash_addr;
+        session->flash_size = flash_size;
+        flash_restore(session);
+    }
+    return 0;
+}
+
+void mqtt_session_deinit(mqtt_session_t* session) {
+    mqtt_session_msg_t* m;
+    mqtt_session_msg_t* n;
+
+    dl_list_for_each_safe(m, n, &session->queue, mqtt_session_msg_t, list) {
+        dl_list_del(&m->list);
+        tls_mem_free(m);
+    }
+    session->queued = 0;
+    session->inflight = 0;
+    session->flash_live = 0;
+}
+
+void mqtt_session_connected(mqtt_session_t* session) {
+    mqtt_session_msg_t* m;
+
+    session->connected = 1;
+    dl_list_for_each(m, &session->queue, mqtt_session_msg_t, list) {
+        if(m->state == MQTT_SESSION_QUEUED) {
+            break; // In flight messages are all ahead of the queued ones
+        }
+        if(msg_send(session, m, 1) < 0) {
+            session->connected = 0;
+            return;
+        }
+    }
+    session_pump(session);
+}
+
+void mqtt_session_disconnected(mqtt_session_t* session) {
+    session->connected = 0;
+}
+
+int mqtt_session_publish(mqtt_session_t* session, const char* topic, const char* msg, int msgLen, uint8_t retain, uint8_t qos) {
+    mqtt_session_msg_t* m;
+    uint16_t topiclen = strlen(topic);
+
+    if(qos == 0) {
+        if(!session->connected) {
+            return -1;
+        }
+        return mqtt_publish_with_id(session->broker, topic, msg, msgLen, retain, 0, 0, 0);
+    }
+    if(qos > 2 || msgLen < 0 || session->queued >= session->max_queued) {
+        return -1;
+    }
+
+    m = msg_alloc(topiclen, msgLen);
+    if(m == NULL) {
+        return -1;
+    }
+    memcpy(msg_topic(m), topic, topiclen);
+    memcpy(msg_data(m), msg, msgLen);
+    m->qos = qos;
+    m->retain = retain ? 1 : 0;
+    flash_store(session, m);
+    dl_list_add_tail(&session->queue, &m->list);
+    session->queued++;
+
+    session_pump(session);
+    return 1;
+}
+
+uint8_t mqtt_session_input(mqtt_session_t* session, const uint8_t* packet) {
+    uint8_t type = MQTTParseMessageType(packet);
+    uint16_t id = mqtt_parse_msg_id(packet);
+    mqtt_session_msg_t* m;
+
+    switch(type) {
+    case MQTT_MSG_PUBACK:
+        m = msg_find(session, id, MQTT_SESSION_WAIT_PUBACK);
+        if(m) {
+            msg_complete(session, m);
+            session_pump(session);
+        }
+        break;
+    case MQTT_MSG_PUBREC:
+        m = msg_find(session, id, MQTT_SESSION_WAIT_PUBREC);
+        if(m) {
+            // The broker owns the message now, only the release is left
+            flash_done(session, m);
+            m->state = MQTT_SESSION_WAIT_PUBCOMP;
+            msg_send(session, m, 0);
+        } else if(msg_find(session, id, MQTT_SESSION_WAIT_PUBCOMP) == NULL) {
+            mqtt_pubrel(session->broker, id);
+        }
+        break;
+    case MQTT_MSG_PUBCOMP:
+        m = msg_find(session, id, MQTT_SESSION_WAIT_PUBCOMP);
+        if(m) {
+            msg_complete(session, m);
+            session_pump(session);
+        }
+        break;
+    case MQTT_MSG_PUBLISH:
+        if(MQTTParseMessageQos(packet) == 1) {
+            mqtt_puback(session->broker, id);
+        } else if(MQTTParseMessageQos(packet) == 2) {
+            mqtt_pubrec(session->broker, id);
+        }
+        break;
+    case MQTT_MSG_PUBREL:
+        mqtt_pubcomp(session->broker, id);
+        break;
+    default:
+        break;
+    }
+    return type;
+}
+
+void mqtt_session_poll(mqtt_session_t* session) {
+    mqtt_session_msg_t* m;
+    uint32_t now = tls_os_get_time();
+
+    if(!session->connected) {
+        return;
+    }
+    dl_list_for_each(m, &session->queue, mqtt_session_msg_t, list) {
+        if(m->state == MQTT_SESSION_QUEUED) {
+            break;
+        }
+        if((uint32_t)(now - m->sent) >= session->retry_ticks) {
+            if(msg_send(session, m, 1) < 0) {
+                session->connected = 0;
+                return;
+            }
+        }
+    }
+    session_pump(session);
+}
@@ -0,0 +1,126 @@
+/*
+ * This file is part of libemqtt.
+ *
+ * libemqtt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libemqtt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libemqtt.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Client session on top of libemqtt: outbound QoS 1/2 messages are kept
+ * in a queue until acknowledged, up to `window` of them are in flight at
+ * once and unacknowledged ones are retransmitted. The queue can optionally
+ * be mirrored to a flash region so that it survives a reboot.
+ */
+#ifndef __MQTT_SESSION_H__
+#define __MQTT_SESSION_H__
+
+#include "libemqtt.h"
+#include "list.h"
+
+#ifndef MQTT_SESSION_WINDOW
+	#define MQTT_SESSION_WINDOW 8 // Default number of unacknowledged messages in flight
+#endif
+
+#ifndef MQTT_SESSION_MAX_QUEUED
+	#define MQTT_SESSION_MAX_QUEUED 32 // Default limit of queued (including in flight) messages
+#endif
+
+#ifndef MQTT_SESSION_RETRY_MS
+	#define MQTT_SESSION_RETRY_MS 5000 // Default retransmission timeout
+#endif
+
+typedef struct {
+	mqtt_broker_handle_t* broker;
+	struct dl_list queue;	// Unacknowledged messages, oldest first
+	uint16_t queued;
+	uint16_t inflight;
+	uint16_t window;
+	uint16_t max_queued;
+	uint32_t retry_ticks;
+	uint8_t connected;
+	// Flash mirror of the queue, unused when flash_size is 0
+	uint32_t flash_addr;
+	uint32_t flash_size;
+	uint32_t flash_pos;
+	uint16_t flash_live;
+} mqtt_session_t;
+
+
+/** Initialize a session.
+ * @param session Session to initialize.
+ * @param broker Broker handle used to send packets (see mqtt_init).
+ * @param flash_addr Start of a sector aligned flash region used to keep the queue across reboots.
+ * @param flash_size Size of that region, a multiple of the sector size, or 0 to keep the queue in RAM only.
+ *
+ * Messages found in the flash region are queued again (with new message ids).
+ *
+ * @retval  0 On success.
+ * @retval -1 On invalid flash region.
+ */
+int mqtt_session_init(mqtt_session_t* session, mqtt_broker_handle_t* broker, uint32_t flash_addr, uint32_t flash_size);
+
+/** Free all queued messages. The flash region is left untouched.
+ * @param session Session.
+ */
+void mqtt_session_deinit(mqtt_session_t* session);
+
+/** Tell the session that the connection (CONNACK received) is up.
+ * @param session Session.
+ *
+ * All messages in flight are retransmitted with the DUP flag, then queued
+ * messages are sent as the window allows.
+ */
+void mqtt_session_connected(mqtt_session_t* session);
+
+/** Tell the session that the connection was lost. Messages stay queued.
+ * @param session Session.
+ */
+void mqtt_session_disconnected(mqtt_session_t* session);
+
+/** Publish a message through the session.
+ * @param session Session.
+ * @param topic The topic name.
+ * @param msg The message.
+ * @param msgLen Length of the message.
+ * @param retain Enable or disable the Retain flag (values: 0 or 1).
+ * @param qos Quality of Service (values: 0, 1 or 2)
+ *
+ * QoS 0 messages are sent at once. QoS 1 and 2 messages are copied into
+ * the queue and sent when the window allows, so this does not wait for
+ * the acknowledgement.
+ *
+ * @retval  1 On success.
+ * @retval -1 On IO error (QoS 0), or when the queue is full or out of memory.
+ */
+int mqtt_session_publish(mqtt_session_t* session, const char* topic, const char* msg, int msgLen, uint8_t retain, uint8_t qos);
+
+/** Handle a packet received from the broker.
+ * @param session Session.
+ * @param packet The complete packet.
+ *
+ * Acknowledgements of queued messages are consumed, received QoS 1/2
+ * PUBLISH and PUBREL messages are acknowledged.
+ *
+ * @return Message type of the packet (MQTT_MSG_*), so that the caller can
+ * still handle PUBLISH, SUBACK, PINGRESP, ...
+ */
+uint8_t mqtt_session_input(mqtt_session_t* session, const uint8_t* packet);
+
+/** Retransmit timed out messages and send queued ones.
+ * @param session Session.
+ *
+ * @note Should be called periodically, e.g. from the receive loop.
+ */
+void mqtt_session_poll(mqtt_session_t* session);
+
+#endif // __MQTT_SESSION_H__
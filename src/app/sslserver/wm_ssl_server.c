@@ -20,6 +20,9 @@
 #include "mbedtls/net_sockets.h"
 #include "mbedtls/error.h"
 #include "mbedtls/debug.h"
+#if defined(MBEDTLS_SSL_CACHE_C)
+#include "mbedtls/ssl_cache.h"
+#endif
 
 typedef struct {
     mbedtls_x509_crt srvcert;
@@ -28,6 +31,12 @@ typedef struct {
 
 static int  g_proto;
 
+#if defined(MBEDTLS_SSL_CACHE_C)
+/* sessions of recent clients, shared by all connections so that they can resume */
+static mbedtls_ssl_cache_context ssl_server_cache;
+static u8 ssl_server_cache_inited = 0;
+#endif
+
 #if defined(MBEDTLS_DEBUG_C)
 #define DEBUG_LEVEL 3
 
@@ -45,6 +54,14 @@ int tls_ssl_server_init(void * arg)
 {
 	g_proto = (int)arg;
 
+#if defined(MBEDTLS_SSL_CACHE_C)
+    if (!ssl_server_cache_inited)
+    {
+        mbedtls_ssl_cache_init( &ssl_server_cache );
+        ssl_server_cache_inited = 1;
+    }
+#endif
+
     return 0;
 }
 
@@ -174,6 +191,12 @@ int tls_ssl_server_handshake(tls_ssl_t **ssl_p, int fd, tls_ssl_key_t *keys)
         goto exit;
     }
 
+#if defined(MBEDTLS_SSL_CACHE_C)
+    if (ssl_server_cache_inited)
+        mbedtls_ssl_conf_session_cache( &ssl_server_ctx->conf, &ssl_server_cache,
+                                        mbedtls_ssl_cache_get, mbedtls_ssl_cache_set );
+#endif
+
     //mbedtls_ssl_conf_min_version( &ssl_server_ctx->conf, g_proto, g_proto );
     //mbedtls_ssl_conf_max_version( &ssl_server_ctx->conf, g_proto, g_proto );
 
@@ -331,6 +354,14 @@ int tls_ssl_server_close(tls_ssl_key_t * keys)
         tls_mem_free(keys);
     }
 
+#if defined(MBEDTLS_SSL_CACHE_C)
+    if (ssl_server_cache_inited)
+    {
+        mbedtls_ssl_cache_free( &ssl_server_cache );
+        ssl_server_cache_inited = 0;
+    }
+#endif
+
     return 0;
 }
 
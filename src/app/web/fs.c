@@ -190,6 +190,9 @@ struct fs_file *fs_open(char *name)
       file->index = file->len;
       file->pextension = NULL;
       file->ReadIndex=0;
+      /* no index in external flash, filter every page as before */
+      file->etag = 0;
+      file->flags = FS_FLAG_PARSE;
       return file;
     }
   }
@@ -197,11 +200,61 @@ struct fs_file *fs_open(char *name)
   fs_free(file);
   return NULL;
 }
+
+struct fs_file *fs_open_gzip(char *name)
+{
+  return fs_open(name);
+}
 #else
-struct fs_file *fs_open(char *name)
+/* 32-bit FNV-1a, must match fnv1a() in makefs. */
+static unsigned int fs_name_hash(const char *name, int *len)
+{
+	unsigned int hash = 0x811c9dc5;
+	const char *p = name;
+
+	while (*p)
+	{
+		hash ^= (unsigned char)*p++;
+		hash *= 0x01000193;
+	}
+	*len = p - name;
+	return hash;
+}
+
+/* Binary search of the hash sorted index emitted by makefs. */
+static const struct fsdata_index *fs_lookup(const char *name)
+{
+	const struct fsdata_index *idx;
+	unsigned int hash;
+	int lo = 0;
+	int hi = FS_NUMFILES - 1;
+	int mid;
+	int len;
+
+	hash = fs_name_hash(name, &len);
+	while (lo <= hi)
+	{
+		mid = (lo + hi) / 2;
+		if (FS_INDEX[mid].hash < hash)
+			lo = mid + 1;
+		else
+			hi = mid - 1;
+	}
+
+	/* lo is the first entry whose hash is not below ours, walk collisions */
+	for (idx = &FS_INDEX[lo]; (idx < &FS_INDEX[FS_NUMFILES]) && (idx->hash == hash); idx++)
+	{
+		if ((idx->name_len == len) && !memcmp(name, idx->file->name, len))
+			return idx;
+	}
+	return NULL;
+}
+
+static struct fs_file *fs_open_index(char *name, int gzip)
 {
 	struct fs_file *file;
 	const struct fsdata_file *f;
+	const struct fsdata_index *idx;
   
 	DEBUG_PRINT("kevin debug fs_open = %s\n\r", name);
 	file = fs_malloc();
@@ -219,21 +272,37 @@ struct fs_file *fs_open(char *name)
 		gCurHtmlFile = 0;
 	}
 #endif  
-	for(f = FS_ROOT; f != NULL; f = f->next) 
+	idx = fs_lookup(name);
+	if (idx)
 	{
-		if (!strcmp(name, (char *)f->name)) 
+		file->flags = idx->flags & ~FS_FLAG_GZIP;
+		f = idx->file;
+		if (gzip && idx->gzfile)
 		{
-			file->data = (char *)f->data;
-			file->len = f->len;
-			file->index = f->len;
-			file->pextension = NULL;
-			file->ReadIndex=0;
-			return file;
+			f = idx->gzfile;
+			file->flags |= FS_FLAG_GZIP;
 		}
+		file->data = (char *)f->data;
+		file->len = f->len;
+		file->index = f->len;
+		file->pextension = NULL;
+		file->ReadIndex=0;
+		file->etag = idx->etag;
+		return file;
 	}
 	fs_free(file);
 	return NULL;
 }
+
+struct fs_file *fs_open(char *name)
+{
+	return fs_open_index(name, 0);
+}
+
+struct fs_file *fs_open_gzip(char *name)
+{
+	return fs_open_index(name, 1);
+}
 #endif
 
 /*-----------------------------------------------------------------------------------*/
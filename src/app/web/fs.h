@@ -32,12 +32,20 @@
 #ifndef __FS_H__
 #define __FS_H__
 
+/* Per file flags. */
+#define FS_FLAG_PARSE       0x01    /* html with id="..." fields filled in at runtime */
+#define FS_FLAG_SSI         0x02    /* .shtml/.shtm/.ssi */
+#define FS_FLAG_GZIP        0x04    /* data is the gzip precompressed variant */
+#define FS_FLAG_LENGTH      0x08    /* header has Content-Length, connection may stay open */
+
 struct fs_file {
   char *data;
   int len;
   int index;
   int ReadIndex;
   void *pextension;
+  unsigned int etag;
+  unsigned char flags;
 };
 
 /* file will be allocated and filled in by the fs_open function. file will
@@ -45,5 +53,8 @@ struct fs_file {
 struct fs_file *fs_open(char *name);
 void fs_close(struct fs_file *file);
 int fs_read(struct fs_file *file, char *buffer, int count);
+/* like fs_open, but picks the gzip variant stored by makefs if there is one;
+ * the caller must only use it when the client sent Accept-Encoding: gzip. */
+struct fs_file *fs_open_gzip(char *name);
 
 #endif /* __FS_H__ */
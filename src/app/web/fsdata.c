@@ -1,7 +1,7 @@
 static const unsigned char data_404_html[] = {
 	/* /404.html */
 	0x2f, 0x34, 0x30, 0x34, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x34, 
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x34, 
 	0x30, 0x34, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x6e, 0x6f, 
 	0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0xd, 0xa, 0x53, 
 	0x65, 0x72, 0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 
@@ -11,16 +11,21 @@ static const unsigned char data_404_html[] = {
 	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
 	0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
 	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
-	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, 0x3c, 
-	0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x65, 
-	0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x69, 0x74, 0x6c, 
-	0x65, 0x3e, 0x4e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 
-	0x64, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0xd, 
-	0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 
-	0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 0x4e, 0x6f, 
-	0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0xa, 0x3c, 0x2f, 
-	0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 
-	0x74, 0x6d, 0x6c, 0x3e, 0xd, 0xa, };
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0xd, 0xa, 0x43, 0x61, 0x63, 
+	0x68, 0x65, 0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 
+	0x3a, 0x20, 0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 
+	0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
+	0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x38, 0x37, 
+	0xd, 0xa, 0xd, 0xa, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 
+	0xd, 0xa, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 
+	0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x4e, 0x6f, 0x74, 
+	0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x3c, 0x2f, 0x74, 0x69, 
+	0x74, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x65, 
+	0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x62, 0x6f, 0x64, 0x79, 
+	0x3e, 0xd, 0xa, 0x4e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 
+	0x6e, 0x64, 0xa, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 
+	0xd, 0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xd, 
+	0xa, };
 
 static const unsigned char data_advance_html[] = {
 	/* /advance.html */
@@ -34,820 +39,858 @@ static const unsigned char data_advance_html[] = {
 	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
 	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
 	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
-	0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, 0x3c, 0x21, 0x44, 
-	0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 
-	0x6c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 
-	0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f, 0x2f, 0x44, 0x54, 
-	0x44, 0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x31, 0x2e, 
-	0x30, 0x20, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 
-	0x6f, 0x6e, 0x61, 0x6c, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x20, 
-	0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 
-	0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x54, 
-	0x52, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2f, 0x44, 
-	0x54, 0x44, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2d, 
-	0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
-	0x61, 0x6c, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 0xd, 0xa, 
-	0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 
-	0x73, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 
-	0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 
-	0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x78, 0x68, 0x74, 0x6d, 
-	0x6c, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 
-	0x44, 0x57, 0x36, 0x20, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 
-	0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 
-	0x2d, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x20, 0x32, 0x30, 0x30, 0x35, 0x20, 0x4d, 0x61, 0x63, 
-	0x72, 0x6f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2c, 0x20, 0x49, 
-	0x6e, 0x63, 0x2e, 0x20, 0x41, 0x6c, 0x6c, 0x20, 0x72, 0x69, 
-	0x67, 0x68, 0x74, 0x73, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 
-	0x76, 0x65, 0x64, 0x2e, 0x20, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 
-	0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x68, 0x74, 0x74, 0x70, 
-	0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d, 0x22, 0x43, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 
-	0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 
-	0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 
-	0x3b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 
-	0x67, 0x62, 0x32, 0x33, 0x31, 0x32, 0x22, 0x20, 0x2f, 0x3e, 
-	0xd, 0xa, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x41, 
-	0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x20, 0x43, 0x6f, 
-	0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 
-	0x6e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x3c, 0x2f, 0x74, 
-	0x69, 0x74, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x3c, 0x6c, 0x69, 
-	0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 
-	0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 
-	0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 
-	0x65, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 
-	0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 
-	0x73, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x73, 0x63, 
-	0x72, 0x69, 0x70, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
-	0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x4a, 0x61, 0x76, 0x61, 
-	0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3e, 0xd, 0xa, 
-	0x3c, 0x21, 0x2d, 0x2d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x72, 0x6c, 0x65, 
-	0x6e, 0x28, 0x73, 0x74, 0x72, 0x29, 0x20, 0x7b, 0xd, 0xa, 
-	0x9, 0x76, 0x61, 0x72, 0x20, 0x6c, 0x65, 0x6e, 0x20, 0x3d, 
-	0x20, 0x30, 0x3b, 0xd, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 
-	0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 
-	0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x73, 0x74, 0x72, 0x2e, 
-	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x69, 0x2b, 
-	0x2b, 0x29, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 
-	0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x2e, 0x63, 0x68, 
-	0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x41, 0x74, 0x28, 0x69, 
-	0x29, 0x20, 0x3e, 0x20, 0x32, 0x35, 0x35, 0x29, 0x20, 0x6c, 
-	0x65, 0x6e, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x3b, 0x20, 0x65, 
-	0x6c, 0x73, 0x65, 0x20, 0x6c, 0x65, 0x6e, 0x20, 0x2b, 0x2b, 
-	0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xd, 0xa, 
-	0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6c, 0x65, 
-	0x6e, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x66, 
-	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x61, 
-	0x76, 0x65, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28, 0x29, 
-	0x7b, 0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x63, 0x6f, 0x6e, 
-	0x66, 0x69, 0x72, 0x6d, 0x28, 0x27, 0x41, 0x72, 0x65, 0x20, 
-	0x79, 0x6f, 0x75, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 
-	0x6f, 0x20, 0x73, 0x61, 0x76, 0x65, 0x3f, 0x5c, 0x6e, 0x27, 
-	0x29, 0x29, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x72, 0x65, 0x74, 
-	0x75, 0x72, 0x6e, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x9, 
-	0x20, 0x20, 0xd, 0xa, 0x9, 0x7d, 0x9, 0x20, 0x20, 0xd, 
-	0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xd, 0xa, 0x9, 0x7b, 
-	0xd, 0xa, 0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
-	0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 
-	0x7d, 0x9, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x66, 
-	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x57, 0x69, 
-	0x72, 0x65, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x70, 0x6f, 0x70, 
-	0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 0x20, 0x7b, 0x20, 
-	0x2f, 0x2f, 0x76, 0x31, 0x2e, 0x30, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x42, 0x73, 
-	0x73, 0x69, 0x64, 0x5f, 0x76, 0x61, 0x72, 0x3d, 0x64, 0x6f, 
-	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
-	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
-	0x64, 0x28, 0x22, 0x42, 0x73, 0x73, 0x69, 0x64, 0x22, 0x29, 
-	0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 
-	0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x42, 0x73, 0x73, 0x69, 
-	0x64, 0x45, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x6f, 0x62, 0x6a, 
-	0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
-	0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 
-	0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x42, 0x73, 0x73, 0x69, 
-	0x64, 0x45, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x29, 0x2e, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x54, 0x72, 
-	0x79, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x5f, 0x76, 0x61, 
-	0x72, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
-	0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
-	0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x54, 0x72, 0x79, 
-	0x5f, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x22, 0x29, 0x2e, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3b, 0x9, 0x20, 0x20, 0x9, 0x20, 
-	0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x76, 0x61, 0x72, 0x20, 0x42, 0x73, 0x73, 0x69, 0x64, 0x4c, 
-	0x65, 0x6e, 0x3d, 0x73, 0x74, 0x72, 0x6c, 0x65, 0x6e, 0x28, 
-	0x42, 0x73, 0x73, 0x69, 0x64, 0x5f, 0x76, 0x61, 0x72, 0x29, 
-	0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x69, 0x66, 0x28, 0x42, 
-	0x73, 0x73, 0x69, 0x64, 0x45, 0x61, 0x62, 0x6c, 0x65, 0x5f, 
-	0x6f, 0x62, 0x6a, 0x3d, 0x3d, 0x31, 0x29, 0xd, 0xa, 0x9, 
+	0x74, 0x6d, 0x6c, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 
+	0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 
+	0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0xd, 0xa, 
+	0xd, 0xa, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 
+	0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x50, 0x55, 0x42, 
+	0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 0x57, 0x33, 
+	0x43, 0x2f, 0x2f, 0x44, 0x54, 0x44, 0x20, 0x58, 0x48, 0x54, 
+	0x4d, 0x4c, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x54, 0x72, 0x61, 
+	0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2f, 
+	0x2f, 0x45, 0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 
+	0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 
+	0x6f, 0x72, 0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 0x74, 
+	0x6d, 0x6c, 0x31, 0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 0x68, 
+	0x74, 0x6d, 0x6c, 0x31, 0x2d, 0x74, 0x72, 0x61, 0x6e, 0x73, 
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2e, 0x64, 0x74, 
+	0x64, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 
+	0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 
+	0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 
+	0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 
+	0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0xd, 0xa, 
+	0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x44, 0x57, 0x36, 0x20, 0x2d, 
+	0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 
+	0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x70, 
+	0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x30, 
+	0x35, 0x20, 0x4d, 0x61, 0x63, 0x72, 0x6f, 0x6d, 0x65, 0x64, 
+	0x69, 0x61, 0x2c, 0x20, 0x49, 0x6e, 0x63, 0x2e, 0x20, 0x41, 
+	0x6c, 0x6c, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 
+	0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2e, 0x20, 
+	0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x6d, 0x65, 0x74, 0x61, 
+	0x20, 0x68, 0x74, 0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 
+	0x76, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
+	0x2d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 
+	0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 
+	0x72, 0x73, 0x65, 0x74, 0x3d, 0x67, 0x62, 0x32, 0x33, 0x31, 
+	0x32, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x69, 
+	0x74, 0x6c, 0x65, 0x3e, 0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 
+	0x65, 0x64, 0x20, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 
+	0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x26, 0x6e, 0x62, 0x73, 
+	0x70, 0x3b, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 
+	0xd, 0xa, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 
+	0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 
+	0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 
+	0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 
+	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 
+	0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2f, 0x3e, 
+	0xd, 0xa, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 
+	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x4a, 0x61, 0x76, 0x61, 0x53, 0x63, 0x72, 0x69, 0x70, 
+	0x74, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0xd, 
+	0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x73, 0x74, 0x72, 0x6c, 0x65, 0x6e, 0x28, 0x73, 0x74, 0x72, 
+	0x29, 0x20, 0x7b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 
+	0x6c, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0xd, 0xa, 
+	0x9, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 
+	0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 
+	0x20, 0x73, 0x74, 0x72, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
+	0x68, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0xd, 0xa, 0x9, 
+	0x7b, 0xd, 0xa, 0x9, 0x9, 0x69, 0x66, 0x20, 0x28, 0x73, 
+	0x74, 0x72, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x43, 0x6f, 0x64, 
+	0x65, 0x41, 0x74, 0x28, 0x69, 0x29, 0x20, 0x3e, 0x20, 0x32, 
+	0x35, 0x35, 0x29, 0x20, 0x6c, 0x65, 0x6e, 0x20, 0x2b, 0x3d, 
+	0x20, 0x32, 0x3b, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x6c, 
+	0x65, 0x6e, 0x20, 0x2b, 0x2b, 0x3b, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0xd, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 
+	0x72, 0x6e, 0x20, 0x6c, 0x65, 0x6e, 0x3b, 0xd, 0xa, 0x7d, 
+	0xd, 0xa, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x73, 0x61, 0x76, 0x65, 0x63, 0x6f, 0x6e, 
+	0x66, 0x69, 0x67, 0x28, 0x29, 0x7b, 0xd, 0xa, 0x9, 0x69, 
+	0x66, 0x28, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x28, 
+	0x27, 0x41, 0x72, 0x65, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x73, 
+	0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x61, 0x76, 
+	0x65, 0x3f, 0x5c, 0x6e, 0x27, 0x29, 0x29, 0x7b, 0xd, 0xa, 
+	0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 
+	0x72, 0x75, 0x65, 0x3b, 0x9, 0x20, 0x20, 0xd, 0xa, 0x9, 
+	0x7d, 0x9, 0x20, 0x20, 0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 
+	0x65, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 
+	0x65, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0x9, 0xd, 0xa, 0x7d, 
+	0xd, 0xa, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x57, 0x69, 0x72, 0x65, 0x6c, 0x65, 0x73, 
+	0x73, 0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 
+	0x28, 0x29, 0x20, 0x7b, 0x20, 0x2f, 0x2f, 0x76, 0x31, 0x2e, 
+	0x30, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x42, 0x73, 0x73, 0x69, 0x64, 0x5f, 0x76, 
+	0x61, 0x72, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+	0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x42, 0x73, 
+	0x73, 0x69, 0x64, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x76, 0x61, 0x72, 
+	0x20, 0x42, 0x73, 0x73, 0x69, 0x64, 0x45, 0x61, 0x62, 0x6c, 
+	0x65, 0x5f, 0x6f, 0x62, 0x6a, 0x3d, 0x64, 0x6f, 0x63, 0x75, 
+	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 
+	0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 
+	0x22, 0x42, 0x73, 0x73, 0x69, 0x64, 0x45, 0x61, 0x62, 0x6c, 
+	0x65, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 
+	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x54, 0x72, 0x79, 0x5f, 0x74, 0x69, 0x6d, 
+	0x65, 0x73, 0x5f, 0x76, 0x61, 0x72, 0x3d, 0x64, 0x6f, 0x63, 
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 
+	0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 
+	0x28, 0x22, 0x54, 0x72, 0x79, 0x5f, 0x74, 0x69, 0x6d, 0x65, 
+	0x73, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 
+	0x9, 0x20, 0x20, 0x9, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x42, 
+	0x73, 0x73, 0x69, 0x64, 0x4c, 0x65, 0x6e, 0x3d, 0x73, 0x74, 
+	0x72, 0x6c, 0x65, 0x6e, 0x28, 0x42, 0x73, 0x73, 0x69, 0x64, 
+	0x5f, 0x76, 0x61, 0x72, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x20, 
+	0x20, 0x69, 0x66, 0x28, 0x42, 0x73, 0x73, 0x69, 0x64, 0x45, 
+	0x61, 0x62, 0x6c, 0x65, 0x5f, 0x6f, 0x62, 0x6a, 0x3d, 0x3d, 
+	0x31, 0x29, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x28, 0x42, 
+	0x73, 0x73, 0x69, 0x64, 0x4c, 0x65, 0x6e, 0x21, 0x3d, 0x31, 
+	0x32, 0x29, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x7b, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74, 
+	0x28, 0x27, 0x42, 0x73, 0x73, 0x69, 0x64, 0x20, 0x4c, 0x65, 
+	0x6e, 0x67, 0x74, 0x68, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 
+	0x62, 0x65, 0x20, 0x31, 0x32, 0x20, 0x63, 0x68, 0x61, 0x72, 
+	0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x21, 0x27, 0x29, 0x3b, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 
+	0x65, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x7d, 0xd, 
+	0xa, 0x9, 0x20, 0x20, 0x20, 0x69, 0x66, 0x28, 0x70, 0x61, 
+	0x72, 0x73, 0x65, 0x49, 0x6e, 0x74, 0x28, 0x54, 0x72, 0x79, 
+	0x5f, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x5f, 0x76, 0x61, 0x72, 
+	0x29, 0x3e, 0x32, 0x35, 0x35, 0x29, 0xd, 0xa, 0x9, 0x20, 
 	0x20, 0x20, 0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x69, 0x66, 0x28, 0x42, 0x73, 0x73, 0x69, 0x64, 0x4c, 
-	0x65, 0x6e, 0x21, 0x3d, 0x31, 0x32, 0x29, 0xd, 0xa, 0x9, 
-	0x20, 0x20, 0x20, 0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 
+	0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 0x54, 0x72, 0x79, 0x20, 
+	0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x45, 0x72, 0x72, 0x6f, 
+	0x72, 0x21, 0x27, 0x29, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 0x42, 0x73, 0x73, 
-	0x69, 0x64, 0x20, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 
-	0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x31, 0x32, 
+	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x9, 0x20, 0x20, 
+	0x20, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x7d, 0x9, 0x9, 
+	0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x61, 0x76, 
+	0x65, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28, 0x29, 0x3b, 
+	0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x4d, 0x4d, 0x5f, 0x70, 
+	0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 0x20, 
+	0x7b, 0x20, 0x2f, 0x2f, 0x76, 0x31, 0x2e, 0x30, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 
+	0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x5f, 0x76, 
+	0x61, 0x72, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+	0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x50, 0x61, 
+	0x73, 0x73, 0x57, 0x6f, 0x72, 0x64, 0x22, 0x29, 0x2e, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
+	0x72, 0x20, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
+	0x4c, 0x65, 0x6e, 0x3d, 0x73, 0x74, 0x72, 0x6c, 0x65, 0x6e, 
+	0x28, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x5f, 
+	0x76, 0x61, 0x72, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x69, 0x66, 0x28, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 
+	0x64, 0x4c, 0x65, 0x6e, 0x21, 0x3d, 0x36, 0x29, 0x7b, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74, 
+	0x28, 0x27, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
+	0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x36, 
 	0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
 	0x73, 0x21, 0x27, 0x29, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
 	0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xd, 0xa, 0x9, 
-	0x20, 0x20, 0x20, 0x7d, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 
-	0x69, 0x66, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6e, 
-	0x74, 0x28, 0x54, 0x72, 0x79, 0x5f, 0x74, 0x69, 0x6d, 0x65, 
-	0x73, 0x5f, 0x76, 0x61, 0x72, 0x29, 0x3e, 0x32, 0x35, 0x35, 
-	0x29, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x7b, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 
-	0x27, 0x54, 0x72, 0x79, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 
-	0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x21, 0x27, 0x29, 0x3b, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
-	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 
-	0x65, 0x3b, 0x9, 0x20, 0x20, 0x20, 0xd, 0xa, 0x9, 0x20, 
-	0x20, 0x20, 0x7d, 0x9, 0x9, 0x20, 0x20, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
-	0x6e, 0x20, 0x73, 0x61, 0x76, 0x65, 0x63, 0x6f, 0x6e, 0x66, 
-	0x69, 0x67, 0x28, 0x29, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 
-	0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
-	0x20, 0x4d, 0x4d, 0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 
-	0x73, 0x67, 0x28, 0x29, 0x20, 0x7b, 0x20, 0x2f, 0x2f, 0x76, 
-	0x31, 0x2e, 0x30, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x76, 0x61, 0x72, 0x20, 0x50, 0x61, 0x73, 0x73, 0x77, 
-	0x6f, 0x72, 0x64, 0x5f, 0x76, 0x61, 0x72, 0x3d, 0x64, 0x6f, 
-	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
-	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
-	0x64, 0x28, 0x22, 0x50, 0x61, 0x73, 0x73, 0x57, 0x6f, 0x72, 
-	0x64, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x50, 0x61, 0x73, 
-	0x73, 0x77, 0x6f, 0x72, 0x64, 0x4c, 0x65, 0x6e, 0x3d, 0x73, 
-	0x74, 0x72, 0x6c, 0x65, 0x6e, 0x28, 0x50, 0x61, 0x73, 0x73, 
-	0x77, 0x6f, 0x72, 0x64, 0x5f, 0x76, 0x61, 0x72, 0x29, 0x3b, 
-	0xd, 0xa, 0x9, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x28, 0x50, 0x61, 
-	0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x4c, 0x65, 0x6e, 0x21, 
-	0x3d, 0x36, 0x29, 0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 0x50, 0x61, 0x73, 
-	0x73, 0x77, 0x6f, 0x72, 0x64, 0x20, 0x6d, 0x75, 0x73, 0x74, 
-	0x20, 0x62, 0x65, 0x20, 0x36, 0x20, 0x63, 0x68, 0x61, 0x72, 
-	0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x21, 0x27, 0x29, 0x3b, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
-	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 
-	0x65, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x7d, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
-	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x61, 0x76, 0x65, 
-	0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28, 0x29, 0x3b, 0xd, 
-	0xa, 0x7d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x42, 0x73, 0x73, 0x69, 0x64, 0x45, 0x61, 
-	0x62, 0x6c, 0x65, 0x31, 0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 
-	0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x62, 0x6a, 0x3d, 
-	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x66, 
-	0x6f, 0x72, 0x6d, 0x34, 0x2e, 0x42, 0x73, 0x73, 0x69, 0x64, 
-	0x45, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 
-	0x65, 0x3b, 0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x6f, 0x62, 
-	0x6a, 0x3d, 0x3d, 0x30, 0x29, 0xd, 0xa, 0x9, 0x7b, 0xd, 
-	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x66, 0x6f, 0x72, 0x6d, 0x34, 0x2e, 0x42, 0x73, 
-	0x73, 0x69, 0x64, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
-	0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 
-	0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xd, 
-	0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 
-	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x66, 0x6f, 0x72, 0x6d, 
-	0x34, 0x2e, 0x42, 0x73, 0x73, 0x69, 0x64, 0x2e, 0x64, 0x69, 
-	0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 
-	0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x7d, 
-	0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
-	0x20, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x42, 0x67, 0x28, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x20, 0x73, 0x61, 0x76, 0x65, 0x63, 0x6f, 0x6e, 0x66, 0x69, 
+	0x67, 0x28, 0x29, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x42, 0x73, 
+	0x73, 0x69, 0x64, 0x45, 0x61, 0x62, 0x6c, 0x65, 0x31, 0x28, 
 	0x29, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 
 	0x20, 0x6f, 0x62, 0x6a, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
-	0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x42, 0x67, 
+	0x65, 0x6e, 0x74, 0x2e, 0x66, 0x6f, 0x72, 0x6d, 0x34, 0x2e, 
+	0x42, 0x73, 0x73, 0x69, 0x64, 0x45, 0x61, 0x62, 0x6c, 0x65, 
 	0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 
-	0x76, 0x61, 0x72, 0x20, 0x52, 0x61, 0x74, 0x65, 0x53, 0x65, 
-	0x6c, 0x65, 0x63, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
-	0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 
-	0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 
-	0x52, 0x61, 0x74, 0x65, 0x22, 0x29, 0x3b, 0xd, 0xa, 0x9, 
-	0x76, 0x61, 0x72, 0x20, 0x62, 0x6d, 0x3d, 0x6e, 0x65, 0x77, 
-	0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x29, 0x3b, 0xd, 
-	0xa, 0x9, 0x52, 0x61, 0x74, 0x65, 0x53, 0x65, 0x6c, 0x65, 
-	0x63, 0x74, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
-	0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x20, 
-	0x30, 0x3b, 0xd, 0xa, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x62, 0x6d, 0x5b, 0x30, 0x5d, 0x3d, 0x22, 0x30, 0x22, 0x3b, 
-	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 
-	0x31, 0x5d, 0x3d, 0x22, 0x31, 0x4d, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 0x5d, 
-	0x3d, 0x22, 0x31, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x5d, 0x3d, 0x22, 0x32, 
+	0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 0x3d, 0x3d, 0x30, 0x29, 
+	0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x66, 0x6f, 0x72, 
+	0x6d, 0x34, 0x2e, 0x42, 0x73, 0x73, 0x69, 0x64, 0x2e, 0x64, 
+	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 
+	0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 
+	0x65, 0x6c, 0x73, 0x65, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 
+	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x66, 0x6f, 0x72, 0x6d, 0x34, 0x2e, 0x42, 0x73, 0x73, 
+	0x69, 0x64, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
+	0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 
+	0x9, 0x7d, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 0x65, 0x6c, 0x65, 
+	0x63, 0x74, 0x42, 0x67, 0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 
+	0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x62, 0x6a, 0x3d, 
+	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
+	0x6c, 0x6c, 0x2e, 0x42, 0x67, 0x2e, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x52, 
+	0x61, 0x74, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 
+	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 
+	0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 
+	0x79, 0x49, 0x64, 0x28, 0x22, 0x52, 0x61, 0x74, 0x65, 0x22, 
+	0x29, 0x3b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x62, 
+	0x6d, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x41, 0x72, 0x72, 0x61, 
+	0x79, 0x28, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x52, 0x61, 0x74, 
+	0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 
+	0x74, 0x68, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0xd, 0xa, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x30, 0x5d, 
+	0x3d, 0x22, 0x30, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x5d, 0x3d, 0x22, 0x31, 
 	0x4d, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x62, 0x6d, 0x5b, 0x34, 0x5d, 0x3d, 0x22, 0x32, 0x22, 0x3b, 
-	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 
-	0x35, 0x5d, 0x3d, 0x22, 0x35, 0x2e, 0x35, 0x4d, 0x22, 0x3b, 
+	0x62, 0x6d, 0x5b, 0x32, 0x5d, 0x3d, 0x22, 0x31, 0x22, 0x3b, 
 	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 
-	0x36, 0x5d, 0x3d, 0x22, 0x33, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x37, 0x5d, 0x3d, 
-	0x22, 0x31, 0x31, 0x4d, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x38, 0x5d, 0x3d, 0x22, 
-	0x34, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x62, 0x6d, 0x5b, 0x39, 0x5d, 0x3d, 0x22, 0x36, 0x4d, 0x22, 
+	0x33, 0x5d, 0x3d, 0x22, 0x32, 0x4d, 0x22, 0x3b, 0x20, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 0x5d, 
+	0x3d, 0x22, 0x32, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x62, 0x6d, 0x5b, 0x35, 0x5d, 0x3d, 0x22, 0x35, 
+	0x2e, 0x35, 0x4d, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x62, 0x6d, 0x5b, 0x36, 0x5d, 0x3d, 0x22, 0x33, 
+	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x6d, 0x5b, 0x37, 0x5d, 0x3d, 0x22, 0x31, 0x31, 0x4d, 0x22, 
+	0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 
+	0x5b, 0x38, 0x5d, 0x3d, 0x22, 0x34, 0x22, 0x3b, 0x20, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x39, 0x5d, 
+	0x3d, 0x22, 0x36, 0x4d, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x30, 0x5d, 0x3d, 
+	0x22, 0x35, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x6d, 0x5b, 0x31, 0x31, 0x5d, 0x3d, 0x22, 0x39, 
+	0x4d, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x31, 0x32, 0x5d, 0x3d, 0x22, 0x36, 0x22, 
 	0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 
-	0x5b, 0x31, 0x30, 0x5d, 0x3d, 0x22, 0x35, 0x22, 0x3b, 0x20, 
+	0x5b, 0x31, 0x33, 0x5d, 0x3d, 0x22, 0x31, 0x32, 0x4d, 0x22, 
+	0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 
+	0x5b, 0x31, 0x34, 0x5d, 0x3d, 0x22, 0x37, 0x22, 0x3b, 0x20, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 
+	0x35, 0x5d, 0x3d, 0x22, 0x31, 0x38, 0x4d, 0x22, 0x3b, 0x20, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 
-	0x31, 0x5d, 0x3d, 0x22, 0x39, 0x4d, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x32, 
-	0x5d, 0x3d, 0x22, 0x36, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x33, 0x5d, 0x3d, 
-	0x22, 0x31, 0x32, 0x4d, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x34, 0x5d, 0x3d, 
-	0x22, 0x37, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x62, 0x6d, 0x5b, 0x31, 0x35, 0x5d, 0x3d, 0x22, 0x31, 
+	0x36, 0x5d, 0x3d, 0x22, 0x38, 0x22, 0x3b, 0x20, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x37, 0x5d, 
+	0x3d, 0x22, 0x32, 0x34, 0x4d, 0x22, 0x3b, 0x20, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x38, 0x5d, 
+	0x3d, 0x22, 0x39, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x39, 0x5d, 0x3d, 0x22, 
+	0x33, 0x36, 0x4d, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 0x30, 0x5d, 0x3d, 0x22, 
+	0x31, 0x30, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x6d, 0x5b, 0x32, 0x31, 0x5d, 0x3d, 0x22, 0x34, 
 	0x38, 0x4d, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x62, 0x6d, 0x5b, 0x31, 0x36, 0x5d, 0x3d, 0x22, 0x38, 
+	0x20, 0x62, 0x6d, 0x5b, 0x32, 0x32, 0x5d, 0x3d, 0x22, 0x31, 
+	0x31, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x32, 0x33, 0x5d, 0x3d, 0x22, 0x35, 0x34, 
+	0x4d, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x32, 0x34, 0x5d, 0x3d, 0x22, 0x31, 0x32, 
 	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
-	0x6d, 0x5b, 0x31, 0x37, 0x5d, 0x3d, 0x22, 0x32, 0x34, 0x4d, 
+	0x6d, 0x5b, 0x32, 0x35, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
+	0x30, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x32, 0x36, 0x5d, 0x3d, 0x22, 0x31, 0x33, 
 	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
-	0x6d, 0x5b, 0x31, 0x38, 0x5d, 0x3d, 0x22, 0x39, 0x22, 0x3b, 
-	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 
-	0x31, 0x39, 0x5d, 0x3d, 0x22, 0x33, 0x36, 0x4d, 0x22, 0x3b, 
-	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 
-	0x32, 0x30, 0x5d, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x3b, 0x20, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 
-	0x31, 0x5d, 0x3d, 0x22, 0x34, 0x38, 0x4d, 0x22, 0x3b, 0x20, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 
-	0x32, 0x5d, 0x3d, 0x22, 0x31, 0x31, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 0x33, 
-	0x5d, 0x3d, 0x22, 0x35, 0x34, 0x4d, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 0x34, 
-	0x5d, 0x3d, 0x22, 0x31, 0x32, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 0x35, 0x5d, 
-	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x30, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 0x36, 
-	0x5d, 0x3d, 0x22, 0x31, 0x33, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 0x37, 0x5d, 
-	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x31, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 0x38, 
-	0x5d, 0x3d, 0x22, 0x31, 0x34, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 0x39, 0x5d, 
-	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x32, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x30, 
-	0x5d, 0x3d, 0x22, 0x31, 0x35, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x31, 0x5d, 
-	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x33, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x32, 
-	0x5d, 0x3d, 0x22, 0x31, 0x36, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x33, 0x5d, 
-	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x34, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x34, 
-	0x5d, 0x3d, 0x22, 0x31, 0x37, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x35, 0x5d, 
-	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x35, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x36, 
-	0x5d, 0x3d, 0x22, 0x31, 0x38, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x37, 0x5d, 
-	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x36, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x38, 
-	0x5d, 0x3d, 0x22, 0x31, 0x39, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x39, 0x5d, 
-	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x37, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 0x30, 
-	0x5d, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 0x31, 0x5d, 
-	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x38, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 0x32, 
-	0x5d, 0x3d, 0x22, 0x32, 0x31, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 0x33, 0x5d, 
-	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x39, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 0x34, 
-	0x5d, 0x3d, 0x22, 0x32, 0x32, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 0x35, 0x5d, 
-	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x31, 0x30, 0x22, 0x3b, 0x20, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 
-	0x36, 0x5d, 0x3d, 0x22, 0x32, 0x33, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 0x37, 
-	0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 0x31, 0x31, 0x22, 0x3b, 
-	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 
-	0x34, 0x38, 0x5d, 0x3d, 0x22, 0x32, 0x34, 0x22, 0x3b, 0x20, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 
-	0x39, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 0x31, 0x32, 0x22, 
-	0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 
-	0x5b, 0x35, 0x30, 0x5d, 0x3d, 0x22, 0x32, 0x35, 0x22, 0x3b, 
-	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 
-	0x35, 0x31, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 0x31, 0x33, 
+	0x6d, 0x5b, 0x32, 0x37, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
+	0x31, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x32, 0x38, 0x5d, 0x3d, 0x22, 0x31, 0x34, 
 	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
-	0x6d, 0x5b, 0x35, 0x32, 0x5d, 0x3d, 0x22, 0x32, 0x36, 0x22, 
-	0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 
-	0x5b, 0x35, 0x33, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 0x31, 
+	0x6d, 0x5b, 0x32, 0x39, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
+	0x32, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x33, 0x30, 0x5d, 0x3d, 0x22, 0x31, 0x35, 
+	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x6d, 0x5b, 0x33, 0x31, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
+	0x33, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x33, 0x32, 0x5d, 0x3d, 0x22, 0x31, 0x36, 
+	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x6d, 0x5b, 0x33, 0x33, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
 	0x34, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x62, 0x6d, 0x5b, 0x35, 0x34, 0x5d, 0x3d, 0x22, 0x32, 0x37, 
+	0x62, 0x6d, 0x5b, 0x33, 0x34, 0x5d, 0x3d, 0x22, 0x31, 0x37, 
+	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x6d, 0x5b, 0x33, 0x35, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
+	0x35, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x33, 0x36, 0x5d, 0x3d, 0x22, 0x31, 0x38, 
 	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
-	0x6d, 0x5b, 0x35, 0x35, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
-	0x31, 0x35, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x62, 0x6d, 0x5b, 0x35, 0x36, 0x5d, 0x3d, 0x22, 0x32, 
+	0x6d, 0x5b, 0x33, 0x37, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
+	0x36, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x33, 0x38, 0x5d, 0x3d, 0x22, 0x31, 0x39, 
+	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x6d, 0x5b, 0x33, 0x39, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
+	0x37, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x34, 0x30, 0x5d, 0x3d, 0x22, 0x32, 0x30, 
+	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x6d, 0x5b, 0x34, 0x31, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
 	0x38, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x62, 0x6d, 0x5b, 0x35, 0x37, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 
-	0x53, 0x33, 0x32, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x9, 0x69, 
-	0x66, 0x28, 0x6f, 0x62, 0x6a, 0x3d, 0x3d, 0x30, 0x29, 0xd, 
-	0xa, 0x9, 0x7b, 0x9, 0xd, 0xa, 0x20, 0x20, 0x9, 0x9, 
-	0x66, 0x6f, 0x72, 0x28, 0x78, 0x3d, 0x30, 0x3b, 0x78, 0x3c, 
-	0x32, 0x34, 0x3b, 0x78, 0x3d, 0x78, 0x2b, 0x32, 0x29, 0xd, 
-	0xa, 0x9, 0x9, 0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 
-	0x9, 0x9, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 
-	0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x62, 0x6d, 0x5b, 
-	0x78, 0x2b, 0x31, 0x5d, 0x2c, 0x62, 0x6d, 0x5b, 0x78, 0x5d, 
-	0x29, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x9, 0x9, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x52, 0x61, 0x74, 0x65, 0x53, 0x65, 0x6c, 
-	0x65, 0x63, 0x74, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x73, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x29, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 
-	0x9, 0x7d, 0x9, 0x9, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 
-	0x9, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x6f, 
-	0x62, 0x6a, 0x3d, 0x3d, 0x32, 0x29, 0xd, 0xa, 0x9, 0x7b, 
-	0x9, 0xd, 0xa, 0x20, 0x20, 0x9, 0x9, 0x66, 0x6f, 0x72, 
-	0x28, 0x78, 0x3d, 0x30, 0x3b, 0x78, 0x3c, 0x62, 0x6d, 0x2e, 
-	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x78, 0x3d, 0x78, 
-	0x2b, 0x32, 0x29, 0xd, 0xa, 0x9, 0x9, 0x7b, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x9, 0x9, 0x9, 0x20, 0x76, 0x61, 0x72, 
-	0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 
-	0x6e, 0x65, 0x77, 0x20, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x28, 0x62, 0x6d, 0x5b, 0x78, 0x2b, 0x31, 0x5d, 0x2c, 0x62, 
-	0x6d, 0x5b, 0x78, 0x5d, 0x29, 0x3b, 0x20, 0xd, 0xa, 0x20, 
-	0x9, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x61, 0x74, 
-	0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x28, 
-	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x9, 0x9, 0x7d, 0x9, 0x9, 0xd, 0xa, 
-	0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xd, 
-	0xa, 0x9, 0x7b, 0xd, 0xa, 0x20, 0x20, 0x9, 0x9, 0x66, 
-	0x6f, 0x72, 0x28, 0x78, 0x3d, 0x30, 0x3b, 0x78, 0x3c, 0x38, 
-	0x3b, 0x78, 0x3d, 0x78, 0x2b, 0x32, 0x29, 0xd, 0xa, 0x9, 
-	0x9, 0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 0x9, 
-	0x20, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x4f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x28, 0x62, 0x6d, 0x5b, 0x78, 0x2b, 
-	0x31, 0x5d, 0x2c, 0x62, 0x6d, 0x5b, 0x78, 0x5d, 0x29, 0x3b, 
-	0x20, 0xd, 0xa, 0x20, 0x9, 0x9, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x52, 0x61, 0x74, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 
-	0x74, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 
-	0x61, 0x64, 0x64, 0x28, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x29, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 0x7d, 
-	0x9, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x7d, 0xd, 0xa, 
-	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x45, 
-	0x73, 0x63, 0x6b, 0x65, 0x79, 0x48, 0x61, 0x6e, 0x64, 0x6c, 
-	0x65, 0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x20, 0x20, 
-	0x69, 0x66, 0x9, 0x28, 0xd, 0xa, 0x28, 0x65, 0x76, 0x65, 
-	0x6e, 0x74, 0x2e, 0x6b, 0x65, 0x79, 0x43, 0x6f, 0x64, 0x65, 
-	0x3e, 0x3d, 0x34, 0x38, 0x20, 0x26, 0x26, 0x20, 0x65, 0x76, 
+	0x62, 0x6d, 0x5b, 0x34, 0x32, 0x5d, 0x3d, 0x22, 0x32, 0x31, 
+	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x6d, 0x5b, 0x34, 0x33, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
+	0x39, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x34, 0x34, 0x5d, 0x3d, 0x22, 0x32, 0x32, 
+	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x6d, 0x5b, 0x34, 0x35, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 
+	0x31, 0x30, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x6d, 0x5b, 0x34, 0x36, 0x5d, 0x3d, 0x22, 0x32, 
+	0x33, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x34, 0x37, 0x5d, 0x3d, 0x22, 0x4d, 0x43, 
+	0x53, 0x31, 0x31, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 0x38, 0x5d, 0x3d, 0x22, 
+	0x32, 0x34, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x6d, 0x5b, 0x34, 0x39, 0x5d, 0x3d, 0x22, 0x4d, 
+	0x43, 0x53, 0x31, 0x32, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x35, 0x30, 0x5d, 0x3d, 
+	0x22, 0x32, 0x35, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x62, 0x6d, 0x5b, 0x35, 0x31, 0x5d, 0x3d, 0x22, 
+	0x4d, 0x43, 0x53, 0x31, 0x33, 0x22, 0x3b, 0x20, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x35, 0x32, 0x5d, 
+	0x3d, 0x22, 0x32, 0x36, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x35, 0x33, 0x5d, 0x3d, 
+	0x22, 0x4d, 0x43, 0x53, 0x31, 0x34, 0x22, 0x3b, 0x20, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x35, 0x34, 
+	0x5d, 0x3d, 0x22, 0x32, 0x37, 0x22, 0x3b, 0x20, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x35, 0x35, 0x5d, 
+	0x3d, 0x22, 0x4d, 0x43, 0x53, 0x31, 0x35, 0x22, 0x3b, 0x20, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x35, 
+	0x36, 0x5d, 0x3d, 0x22, 0x32, 0x38, 0x22, 0x3b, 0x20, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x35, 0x37, 
+	0x5d, 0x3d, 0x22, 0x4d, 0x43, 0x53, 0x33, 0x32, 0x22, 0x3b, 
+	0x20, 0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 
+	0x3d, 0x3d, 0x30, 0x29, 0xd, 0xa, 0x9, 0x7b, 0x9, 0xd, 
+	0xa, 0x20, 0x20, 0x9, 0x9, 0x66, 0x6f, 0x72, 0x28, 0x78, 
+	0x3d, 0x30, 0x3b, 0x78, 0x3c, 0x32, 0x34, 0x3b, 0x78, 0x3d, 
+	0x78, 0x2b, 0x32, 0x29, 0xd, 0xa, 0x9, 0x9, 0x7b, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 0x9, 0x20, 0x76, 0x61, 
+	0x72, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 
+	0x20, 0x6e, 0x65, 0x77, 0x20, 0x4f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x28, 0x62, 0x6d, 0x5b, 0x78, 0x2b, 0x31, 0x5d, 0x2c, 
+	0x62, 0x6d, 0x5b, 0x78, 0x5d, 0x29, 0x3b, 0x20, 0xd, 0xa, 
+	0x20, 0x9, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x61, 
+	0x74, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x64, 
+	0x28, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 0x7d, 0x9, 0x9, 0xd, 
+	0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 
+	0x20, 0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 0x3d, 0x3d, 0x32, 
+	0x29, 0xd, 0xa, 0x9, 0x7b, 0x9, 0xd, 0xa, 0x20, 0x20, 
+	0x9, 0x9, 0x66, 0x6f, 0x72, 0x28, 0x78, 0x3d, 0x30, 0x3b, 
+	0x78, 0x3c, 0x62, 0x6d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
+	0x68, 0x3b, 0x78, 0x3d, 0x78, 0x2b, 0x32, 0x29, 0xd, 0xa, 
+	0x9, 0x9, 0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 
+	0x9, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x4f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x62, 0x6d, 0x5b, 0x78, 
+	0x2b, 0x31, 0x5d, 0x2c, 0x62, 0x6d, 0x5b, 0x78, 0x5d, 0x29, 
+	0x3b, 0x20, 0xd, 0xa, 0x20, 0x9, 0x9, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x52, 0x61, 0x74, 0x65, 0x53, 0x65, 0x6c, 0x65, 
+	0x63, 0x74, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+	0x2e, 0x61, 0x64, 0x64, 0x28, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x29, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 
+	0x7d, 0x9, 0x9, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 
+	0x65, 0x6c, 0x73, 0x65, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 
+	0x20, 0x20, 0x9, 0x9, 0x66, 0x6f, 0x72, 0x28, 0x78, 0x3d, 
+	0x30, 0x3b, 0x78, 0x3c, 0x38, 0x3b, 0x78, 0x3d, 0x78, 0x2b, 
+	0x32, 0x29, 0xd, 0xa, 0x9, 0x9, 0x7b, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x9, 0x9, 0x9, 0x20, 0x76, 0x61, 0x72, 0x20, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x6e, 
+	0x65, 0x77, 0x20, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x28, 
+	0x62, 0x6d, 0x5b, 0x78, 0x2b, 0x31, 0x5d, 0x2c, 0x62, 0x6d, 
+	0x5b, 0x78, 0x5d, 0x29, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x9, 
+	0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x61, 0x74, 0x65, 
+	0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x9, 0x9, 0x7d, 0x9, 0xd, 0xa, 0x9, 0x7d, 
+	0xd, 0xa, 0x7d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x45, 0x73, 0x63, 0x6b, 0x65, 0x79, 
+	0x48, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x28, 0x29, 0xd, 0xa, 
+	0x7b, 0xd, 0xa, 0x20, 0x20, 0x69, 0x66, 0x9, 0x28, 0xd, 
+	0xa, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x6b, 0x65, 
+	0x79, 0x43, 0x6f, 0x64, 0x65, 0x3e, 0x3d, 0x34, 0x38, 0x20, 
+	0x26, 0x26, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x6b, 
+	0x65, 0x79, 0x43, 0x6f, 0x64, 0x65, 0x3c, 0x3d, 0x35, 0x37, 
+	0x29, 0x20, 0x7c, 0x7c, 0x20, 0xd, 0xa, 0x28, 0x65, 0x76, 
 	0x65, 0x6e, 0x74, 0x2e, 0x6b, 0x65, 0x79, 0x43, 0x6f, 0x64, 
-	0x65, 0x3c, 0x3d, 0x35, 0x37, 0x29, 0x20, 0x7c, 0x7c, 0x20, 
+	0x65, 0x3e, 0x3d, 0x36, 0x35, 0x20, 0x26, 0x26, 0x20, 0x65, 
+	0x76, 0x65, 0x6e, 0x74, 0x2e, 0x6b, 0x65, 0x79, 0x43, 0x6f, 
+	0x64, 0x65, 0x3c, 0x3d, 0x37, 0x30, 0x29, 0x20, 0x7c, 0x7c, 
 	0xd, 0xa, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x6b, 
-	0x65, 0x79, 0x43, 0x6f, 0x64, 0x65, 0x3e, 0x3d, 0x36, 0x35, 
+	0x65, 0x79, 0x43, 0x6f, 0x64, 0x65, 0x3e, 0x3d, 0x39, 0x37, 
 	0x20, 0x26, 0x26, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 
-	0x6b, 0x65, 0x79, 0x43, 0x6f, 0x64, 0x65, 0x3c, 0x3d, 0x37, 
-	0x30, 0x29, 0x20, 0x7c, 0x7c, 0xd, 0xa, 0x28, 0x65, 0x76, 
-	0x65, 0x6e, 0x74, 0x2e, 0x6b, 0x65, 0x79, 0x43, 0x6f, 0x64, 
-	0x65, 0x3e, 0x3d, 0x39, 0x37, 0x20, 0x26, 0x26, 0x20, 0x65, 
-	0x76, 0x65, 0x6e, 0x74, 0x2e, 0x6b, 0x65, 0x79, 0x43, 0x6f, 
-	0x64, 0x65, 0x3c, 0x3d, 0x31, 0x30, 0x32, 0x29, 0x20, 0xd, 
-	0xa, 0x9, 0x29, 0xd, 0xa, 0x7b, 0x20, 0x20, 0x20, 0xd, 
-	0xa, 0x9, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x72, 0x65, 
-	0x74, 0x75, 0x72, 0x6e, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x20, 
-	0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x7d, 
-	0xd, 0xa, 0x65, 0x6c, 0x73, 0x65, 0x20, 0xd, 0xa, 0x7b, 
-	0xd, 0xa, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x22, 
-	0x4d, 0x75, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 
-	0x20, 0x48, 0x45, 0x58, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
-	0x63, 0x74, 0x65, 0x72, 0x73, 0x21, 0x22, 0x29, 0x3b, 0x9, 
-	0x20, 0xd, 0xa, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 
-	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x56, 0x61, 0x6c, 0x75, 
-	0x65, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 
-	0xd, 0xa, 0x7d, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x2f, 0x2f, 
-	0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x73, 0x63, 0x72, 
-	0x69, 0x70, 0x74, 0x3e, 0xd, 0xa, 0x3c, 0x73, 0x74, 0x79, 
-	0x6c, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 
-	0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x3e, 0xd, 
-	0xa, 0x3c, 0x21, 0x2d, 0x2d, 0xd, 0xa, 0x2e, 0x53, 0x54, 
-	0x59, 0x4c, 0x45, 0x31, 0x20, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 
-	0x72, 0x3a, 0x20, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-	0x7d, 0xd, 0xa, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 
-	0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0xd, 0xa, 
-	0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 
-	0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x64, 0x69, 
-	0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 0x67, 0x65, 
-	0x63, 0x65, 0x6c, 0x6c, 0x31, 0x22, 0x20, 0x73, 0x74, 0x79, 
-	0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 
-	0x38, 0x30, 0x30, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-	0x3d, 0x38, 0x30, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x70, 
-	0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x2d, 0x2d, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 
-	0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 
-	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 
-	0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x43, 0x43, 0x43, 0x43, 0x43, 
-	0x43, 0x22, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x3c, 
-	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 
-	0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 
-	0x67, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x32, 0x3e, 0x41, 0x64, 
-	0x76, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x3c, 0x2f, 0x68, 0x32, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 0x67, 0x65, 0x4e, 0x61, 
-	0x76, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x65, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6e, 0x6b, 0x73, 
-	0x22, 0x3e, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 
-	0x3d, 0x22, 0x62, 0x61, 0x73, 0x69, 0x63, 0x2e, 0x68, 0x74, 
-	0x6d, 0x6c, 0x22, 0x3e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x20, 
-	0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 
-	0x65, 0x66, 0x3d, 0x22, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 
-	0x65, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x41, 0x64, 
-	0x76, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x20, 0x3c, 0x2f, 0x61, 
-	0x3e, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 
-	0x22, 0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x2e, 
-	0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x53, 0x79, 0x73, 0x74, 
-	0x65, 0x6d, 0x20, 0x3c, 0x2f, 0x61, 0x3e, 0x3c, 0x2f, 0x64, 
-	0x69, 0x76, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x70, 0x3e, 0x3c, 
-	0x2f, 0x70, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x64, 0x69, 0x76, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x64, 0x76, 0x65, 0x72, 
-	0x74, 0x22, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x70, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 
-	0x22, 0x3e, 0xa1, 0xa4, 0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 
-	0x65, 0x64, 0x20, 0x57, 0x69, 0x72, 0x65, 0x6c, 0x65, 0x73, 
-	0x73, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
-	0x3a, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x63, 0x61, 0x6e, 0x20, 
-	0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x20, 
-	0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 
-	0x69, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x72, 0x65, 0x6c, 0x65, 
-	0x73, 0x73, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
-	0x65, 0x72, 0x73, 0x3a, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 
-	0x72, 0x6b, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0xa1, 0xa2, 0x77, 
-	0x69, 0x72, 0x65, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x73, 0x74, 
-	0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 0xa1, 0xa2, 0x41, 0x50, 
-	0x20, 0x42, 0x53, 0x53, 0x49, 0x44, 0x20, 0x65, 0x74, 0x63, 
-	0x2e, 0x3c, 0x2f, 0x70, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x70, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 
-	0x66, 0x74, 0x22, 0x3e, 0xa1, 0xa4, 0x43, 0x68, 0x61, 0x6e, 
-	0x6e, 0x65, 0x6c, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x53, 
-	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3a, 0x20, 0x50, 
-	0x72, 0x6f, 0x70, 0x65, 0x72, 0x20, 0x63, 0x68, 0x61, 0x6e, 
-	0x6e, 0x65, 0x6c, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x53, 
-	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x63, 0x61, 
-	0x6e, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x74, 0x68, 
-	0x65, 0x20, 0x77, 0x69, 0x72, 0x65, 0x6c, 0x65, 0x73, 0x73, 
-	0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x63, 
-	0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 
-	0x3c, 0x2f, 0x70, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x70, 0x20, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 
-	0x74, 0x22, 0x3e, 0xa1, 0xa4, 0x53, 0x65, 0x72, 0x69, 0x61, 
-	0x6c, 0x20, 0x50, 0x6f, 0x72, 0x74, 0x20, 0x53, 0x65, 0x74, 
-	0x74, 0x69, 0x6e, 0x67, 0x73, 0x3a, 0x20, 0x50, 0x72, 0x6f, 
-	0x70, 0x65, 0x72, 0x20, 0x73, 0x65, 0x72, 0x69, 0x61, 0x6c, 
-	0x20, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x73, 0x65, 0x74, 0x74, 
-	0x69, 0x6e, 0x67, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x65, 
-	0x63, 0x65, 0x73, 0x73, 0x61, 0x72, 0x79, 0x20, 0x66, 0x6f, 
-	0x72, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x74, 0x6f, 0x20, 0x75, 
-	0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x69, 0x66, 
-	0x69, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x2e, 0x3c, 
-	0x2f, 0x70, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x64, 0x69, 
-	0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 
-	0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x65, 
-	0x6e, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x66, 
-	0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x6f, 
-	0x72, 0x6d, 0x34, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x66, 0x6f, 0x72, 0x6d, 0x34, 0x22, 0x20, 0x6d, 0x65, 
-	0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 
-	0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 
-	0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 
-	0x74, 0x6f, 0x72, 0x79, 0x22, 0x3e, 0x20, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x20, 0x73, 
-	0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 
-	0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 
-	0x6f, 0x72, 0x3a, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 
-	0x22, 0x3e, 0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x20, 
-	0x57, 0x69, 0x72, 0x65, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x20, 
-	0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f, 
-	0x68, 0x33, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 
-	0x64, 0x74, 0x68, 0x3d, 0x22, 0x35, 0x35, 0x30, 0x22, 0x20, 
-	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 
-	0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 
-	0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 
-	0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 
-	0x35, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
-	0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
-	0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x2f, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 
-	0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x22, 0x3e, 0x57, 0x69, 0x72, 0x65, 0x6c, 0x65, 0x73, 
-	0x73, 0x20, 0x53, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 
-	0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 
-	0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x42, 0x67, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 
-	0x22, 0x31, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 
-	0x67, 0x65, 0x3d, 0x22, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x42, 0x67, 0x28, 0x29, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
-	0x42, 0x67, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x30, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x65, 0x64, 0x22, 0x3e, 0x62, 0x2f, 0x67, 0x3c, 0x2f, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x31, 0x22, 0x3e, 0x62, 0x3c, 0x2f, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 
+	0x6b, 0x65, 0x79, 0x43, 0x6f, 0x64, 0x65, 0x3c, 0x3d, 0x31, 
+	0x30, 0x32, 0x29, 0x20, 0xd, 0xa, 0x9, 0x29, 0xd, 0xa, 
+	0x7b, 0x20, 0x20, 0x20, 0xd, 0xa, 0x9, 0x65, 0x76, 0x65, 
+	0x6e, 0x74, 0x2e, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x56, 
+	0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 
+	0x65, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x65, 0x6c, 0x73, 
+	0x65, 0x20, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x20, 0x61, 0x6c, 
+	0x65, 0x72, 0x74, 0x28, 0x22, 0x4d, 0x75, 0x73, 0x74, 0x20, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x48, 0x45, 0x58, 0x20, 
+	0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 
+	0x21, 0x22, 0x29, 0x3b, 0x9, 0x20, 0xd, 0xa, 0x20, 0x65, 
+	0x76, 0x65, 0x6e, 0x74, 0x2e, 0x72, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x66, 
+	0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 
+	0x7d, 0xd, 0xa, 0x2f, 0x2f, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 
+	0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0xd, 
+	0xa, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x74, 0x79, 
+	0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 
+	0x73, 0x73, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 
+	0xd, 0xa, 0x2e, 0x53, 0x54, 0x59, 0x4c, 0x45, 0x31, 0x20, 
+	0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x7d, 0xd, 0xa, 0x2d, 0x2d, 
+	0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+	0x3e, 0xd, 0xa, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 
+	0x64, 0x3e, 0xd, 0xa, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 
+	0xd, 0xa, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 
+	0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 
+	0x69, 0x64, 0x74, 0x68, 0x3a, 0x38, 0x30, 0x30, 0x3b, 0x68, 
+	0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x38, 0x30, 0x30, 0x22, 
+	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 
+	0x6e, 0x74, 0x65, 0x72, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x3c, 0x21, 0x2d, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 
+	0x6c, 0x6c, 0x31, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x3c, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+	0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 
+	0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 
+	0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x22, 0x3e, 0x26, 0x6e, 
+	0x62, 0x73, 0x70, 0x3b, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x70, 0x61, 0x67, 0x65, 0x4e, 0x61, 0x6d, 
+	0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x68, 0x32, 0x3e, 0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 
+	0x64, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 
+	0x61, 0x67, 0x65, 0x4e, 0x61, 0x76, 0x22, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x4c, 0x69, 0x6e, 0x6b, 0x73, 0x22, 0x3e, 0x20, 0x3c, 0x61, 
+	0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x62, 0x61, 0x73, 
+	0x69, 0x63, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x42, 
+	0x61, 0x73, 0x69, 0x63, 0x20, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 
+	0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x61, 
+	0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x2e, 0x68, 0x74, 0x6d, 
+	0x6c, 0x22, 0x3e, 0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 
+	0x64, 0x20, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x3c, 0x61, 0x20, 
+	0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x66, 0x69, 0x72, 0x6d, 
+	0x77, 0x61, 0x72, 0x65, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 
+	0x3e, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x3c, 0x2f, 
+	0x61, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 
+	0x9, 0x3c, 0x70, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0xd, 0xa, 
+	0x9, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x61, 0x64, 0x76, 0x65, 0x72, 0x74, 0x22, 0x3e, 0xd, 0xa, 
+	0x9, 0x3c, 0x70, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0xa1, 0xa4, 0x41, 
+	0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x20, 0x57, 0x69, 
+	0x72, 0x65, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x53, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x3a, 0x20, 0x59, 0x6f, 0x75, 
+	0x20, 0x63, 0x61, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 
+	0x67, 0x75, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+	0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x77, 
+	0x69, 0x72, 0x65, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x70, 0x61, 
+	0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x3a, 0x20, 
+	0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x6d, 0x6f, 
+	0x64, 0x65, 0xa1, 0xa2, 0x77, 0x69, 0x72, 0x65, 0x6c, 0x65, 
+	0x73, 0x73, 0x20, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+	0x64, 0xa1, 0xa2, 0x41, 0x50, 0x20, 0x42, 0x53, 0x53, 0x49, 
+	0x44, 0x20, 0x65, 0x74, 0x63, 0x2e, 0x3c, 0x2f, 0x70, 0x3e, 
+	0xd, 0xa, 0x9, 0x3c, 0x70, 0x20, 0x61, 0x6c, 0x69, 0x67, 
+	0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0xa1, 
+	0xa4, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x20, 0x4c, 
+	0x69, 0x73, 0x74, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x3a, 0x20, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 
+	0x20, 0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x20, 0x6c, 
+	0x69, 0x73, 0x74, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x73, 0x70, 0x65, 
+	0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x69, 0x72, 
+	0x65, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x6e, 0x65, 0x74, 0x77, 
+	0x6f, 0x72, 0x6b, 0x20, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x3c, 0x2f, 0x70, 0x3e, 0xd, 
+	0xa, 0x9, 0x3c, 0x70, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0xa1, 0xa4, 
+	0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x50, 0x6f, 0x72, 
+	0x74, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x3a, 0x20, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x20, 0x73, 
+	0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x70, 0x6f, 0x72, 0x74, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 
+	0x69, 0x73, 0x20, 0x6e, 0x65, 0x63, 0x65, 0x73, 0x73, 0x61, 
+	0x72, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x79, 0x6f, 0x75, 
+	0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 
+	0x65, 0x20, 0x77, 0x69, 0x66, 0x69, 0x20, 0x6d, 0x6f, 0x64, 
+	0x75, 0x6c, 0x65, 0x2e, 0x3c, 0x2f, 0x70, 0x3e, 0xd, 0xa, 
+	0x9, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x22, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x34, 0x22, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 
+	0x34, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 
+	0x22, 0x67, 0x65, 0x74, 0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 
+	0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x22, 
+	0x3e, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x68, 0x33, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 
+	0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
+	0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x36, 
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x22, 0x3e, 0x41, 0x64, 0x76, 
+	0x61, 0x6e, 0x63, 0x65, 0x20, 0x57, 0x69, 0x72, 0x65, 0x6c, 
+	0x65, 0x73, 0x73, 0x20, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 
+	0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 
+	0x35, 0x35, 0x30, 0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 
+	0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 
+	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x30, 
+	0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 
+	0x69, 0x6e, 0x67, 0x3d, 0x22, 0x35, 0x22, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
+	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 
+	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 
+	0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x9, 
+	0x9, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 
-	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 
-	0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x30, 0x34, 0x22, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 
-	0x66, 0x74, 0x22, 0x3e, 0x44, 0x61, 0x74, 0x61, 0x20, 0x52, 
-	0x61, 0x74, 0x65, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 
-	0x68, 0x3d, 0x22, 0x31, 0x39, 0x34, 0x22, 0x20, 0x61, 0x6c, 
+	0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x57, 0x69, 
+	0x72, 0x65, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x53, 0x74, 0x61, 
+	0x6e, 0x64, 0x61, 0x72, 0x64, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
 	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 
 	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 
-	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x61, 0x74, 0x65, 
-	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x52, 0x61, 0x74, 0x65, 0x22, 
-	0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x31, 
-	0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 
-	0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 
-	0x22, 0x3e, 0x31, 0x4d, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
-	0x30, 0x22, 0x3e, 0x32, 0x4d, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
-	0x39, 0x22, 0x3e, 0x35, 0x2e, 0x35, 0x4d, 0x3c, 0x2f, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x38, 0x22, 0x3e, 0x36, 0x4d, 0x3c, 0x2f, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x37, 0x22, 0x3e, 0x39, 0x4d, 0x3c, 0x2f, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x36, 0x22, 0x3e, 0x31, 0x31, 0x4d, 0x3c, 0x2f, 
-	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x67, 0x22, 0x20, 
+	0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x6f, 
+	0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x53, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x42, 0x67, 0x28, 0x29, 0x22, 
+	0x20, 0x69, 0x64, 0x3d, 0x22, 0x42, 0x67, 0x22, 0x20, 0x3e, 
+	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x62, 
+	0x2f, 0x67, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 
+	0x62, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 
+	0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
+	0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 
+	0x22, 0x31, 0x30, 0x34, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 
+	0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x44, 
+	0x61, 0x74, 0x61, 0x20, 0x52, 0x61, 0x74, 0x65, 0xa3, 0xba, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
+	0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x39, 
+	0x34, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
+	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 
+	0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
+	0x22, 0x52, 0x61, 0x74, 0x65, 0x22, 0x20, 0x73, 0x69, 0x7a, 
+	0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x52, 0x61, 0x74, 0x65, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 
 	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
-	0x65, 0x3d, 0x22, 0x35, 0x22, 0x3e, 0x31, 0x32, 0x4d, 0x3c, 
+	0x65, 0x3d, 0x22, 0x31, 0x31, 0x22, 0x20, 0x73, 0x65, 0x6c, 
+	0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 
+	0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x31, 0x4d, 0x3c, 
 	0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 
 	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 
-	0x75, 0x65, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x31, 0x38, 0x4d, 
+	0x75, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x3e, 0x32, 0x4d, 
 	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 
 	0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x33, 0x22, 0x3e, 0x32, 0x34, 
-	0x4d, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
-	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x33, 
+	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x39, 0x22, 0x3e, 0x35, 0x2e, 
+	0x35, 0x4d, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x38, 0x22, 0x3e, 
 	0x36, 0x4d, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
 	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 
-	0x34, 0x38, 0x4d, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x37, 0x22, 0x3e, 
+	0x39, 0x4d, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x36, 0x22, 0x3e, 
+	0x31, 0x31, 0x4d, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
 	0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 
-	0x3e, 0x35, 0x34, 0x4d, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 
-	0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 
-	0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 
-	0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 
-	0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x43, 0x68, 0x61, 0x6e, 
-	0x6e, 0x65, 0x6c, 0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
-	0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 
-	0x3d, 0x22, 0x33, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 
-	0x65, 0x3d, 0x22, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 
-	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x61, 0x6e, 0x6e, 
-	0x65, 0x6c, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
+	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x35, 0x22, 
+	0x3e, 0x31, 0x32, 0x4d, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x34, 
+	0x22, 0x3e, 0x31, 0x38, 0x4d, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x33, 0x22, 0x3e, 0x32, 0x34, 0x4d, 0x3c, 0x2f, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
 	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x30, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x65, 0x64, 0x22, 0x3e, 0x41, 0x75, 0x74, 0x6f, 0x3c, 0x2f, 
-	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
-	0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x31, 0x3c, 0x2f, 0x6f, 
+	0x22, 0x32, 0x22, 0x3e, 0x33, 0x36, 0x4d, 0x3c, 0x2f, 0x6f, 
 	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
 	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x32, 0x22, 0x3e, 0x32, 0x3c, 0x2f, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x33, 0x22, 0x3e, 0x33, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
-	0x34, 0x22, 0x3e, 0x34, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x35, 
-	0x22, 0x3e, 0x35, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x3d, 0x22, 0x31, 0x22, 0x3e, 0x34, 0x38, 0x4d, 0x3c, 0x2f, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x30, 0x22, 0x3e, 0x35, 0x34, 0x4d, 0x3c, 
+	0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 
+	0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 
+	0x3e, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x20, 0x4e, 
+	0x75, 0x6d, 0x62, 0x65, 0x72, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x63, 0x6f, 
+	0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x33, 0x22, 0x20, 
+	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 
+	0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 
+	0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x22, 0x20, 0x73, 0x69, 0x7a, 
+	0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x22, 0x20, 0x3e, 
+	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x41, 
+	0x75, 0x74, 0x6f, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
 	0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x36, 0x22, 
-	0x3e, 0x36, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 
+	0x3e, 0x31, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
 	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x37, 0x22, 0x3e, 
-	0x37, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x3e, 
+	0x32, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
 	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x38, 0x22, 0x3e, 0x38, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x33, 0x22, 0x3e, 0x33, 
 	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 
 	0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x39, 0x22, 0x3e, 0x39, 0x3c, 
+	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x34, 0x3c, 
 	0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 
 	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 
-	0x75, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x3e, 0x31, 0x30, 
-	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 
-	0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x31, 0x22, 0x3e, 0x31, 
-	0x31, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
-	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x32, 0x22, 0x3e, 
-	0x31, 0x32, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x33, 0x22, 
-	0x3e, 0x31, 0x33, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x34, 
-	0x22, 0x3e, 0x31, 0x34, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 
-	0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x9, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 
-	0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 
-	0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x52, 0x6f, 0x61, 
-	0x6d, 0x28, 0x53, 0x74, 0x61, 0x29, 0xa3, 0xba, 0x3c, 0x2f, 
-	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x63, 
-	0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x33, 0x22, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 
-	0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 
-	0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x72, 
-	0x6f, 0x61, 0x6d, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 
-	0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x6f, 
-	0x61, 0x6d, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
+	0x75, 0x65, 0x3d, 0x22, 0x35, 0x22, 0x3e, 0x35, 0x3c, 0x2f, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x36, 0x22, 0x3e, 0x36, 0x3c, 0x2f, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3d, 0x22, 0x37, 0x22, 0x3e, 0x37, 0x3c, 0x2f, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
 	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x30, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x65, 0x64, 0x22, 0x3e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
-	0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
-	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x65, 
-	0x6e, 0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0xd, 0xa, 0x9, 0x9, 0x9, 
+	0x22, 0x38, 0x22, 0x3e, 0x38, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x39, 0x22, 0x3e, 0x39, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
+	0x30, 0x22, 0x3e, 0x31, 0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x31, 0x31, 0x22, 0x3e, 0x31, 0x31, 0x3c, 0x2f, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x31, 0x32, 0x22, 0x3e, 0x31, 0x32, 0x3c, 0x2f, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3d, 0x22, 0x31, 0x33, 0x22, 0x3e, 0x31, 0x33, 0x3c, 0x2f, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x31, 0x34, 0x22, 0x3e, 0x31, 0x34, 0x3c, 
+	0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
 	0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
-	0x3e, 0x9, 0x9, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 
-	0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x22, 0x3e, 0x50, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x53, 
-	0x61, 0x76, 0x65, 0x28, 0x53, 0x74, 0x61, 0x29, 0xa3, 0xba, 
-	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
-	0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 
-	0x33, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 
-	0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x73, 0x61, 0x76, 0x65, 
-	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x6f, 0x77, 0x65, 0x72, 
-	0x73, 0x61, 0x76, 0x65, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
-	0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 
-	0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 
-	0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x64, 0x69, 0x73, 0x61, 
-	0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 
-	0x3e, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0xd, 0xa, 0x9, 
-	0x9, 0x9, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 
-	0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x74, 0x72, 0x3e, 0x9, 0x9, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 
-	0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 
-	0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x42, 0x73, 0x73, 
-	0x69, 0x64, 0x20, 0x42, 0x69, 0x6e, 0x64, 0x28, 0x53, 0x74, 
-	0x61, 0x29, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-	0x3d, 0x22, 0x37, 0x37, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 
+	0x3e, 0x9, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 
+	0x22, 0x3e, 0x52, 0x6f, 0x61, 0x6d, 0x28, 0x53, 0x74, 0x61, 
+	0x29, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x74, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 
+	0x6e, 0x3d, 0x22, 0x33, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 
 	0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 
 	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 
-	0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x42, 0x73, 0x73, 0x69, 0x64, 0x45, 0x61, 0x62, 
-	0x6c, 0x65, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 
-	0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x42, 0x73, 0x73, 
-	0x69, 0x64, 0x45, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x6f, 
-	0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x42, 
-	0x73, 0x73, 0x69, 0x64, 0x45, 0x61, 0x62, 0x6c, 0x65, 0x31, 
-	0x28, 0x29, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x30, 0x22, 0x3e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
-	0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x3d, 0x22, 0x72, 0x6f, 0x61, 0x6d, 0x22, 0x20, 
+	0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x72, 0x6f, 0x61, 0x6d, 0x22, 0x20, 0x3e, 
 	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x65, 
-	0x6e, 0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x64, 
+	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x31, 0x22, 0x3e, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 
+	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 
+	0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x2f, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0xd, 0xa, 0x20, 0x9, 0x9, 0x9, 0x3c, 0x74, 
-	0x64, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 
-	0x22, 0x32, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x20, 
+	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x9, 0x9, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 
-	0x6d, 0x65, 0x3d, 0x22, 0x42, 0x73, 0x73, 0x69, 0x64, 0x22, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 
-	0x74, 0x22, 0x20, 0x6f, 0x6e, 0x6b, 0x65, 0x79, 0x70, 0x72, 
-	0x65, 0x73, 0x73, 0x3d, 0x22, 0x45, 0x73, 0x63, 0x6b, 0x65, 
-	0x79, 0x48, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x28, 0x29, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x42, 0x73, 0x73, 0x69, 0x64, 
-	0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 
-	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 
-	0x30, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 
-	0x32, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 
-	0x74, 0x68, 0x3d, 0x22, 0x31, 0x32, 0x22, 0x20, 0x2f, 0x3e, 
+	0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x50, 0x6f, 
+	0x77, 0x65, 0x72, 0x20, 0x53, 0x61, 0x76, 0x65, 0x28, 0x53, 
+	0x74, 0x61, 0x29, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x73, 
+	0x70, 0x61, 0x6e, 0x3d, 0x22, 0x33, 0x22, 0x20, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 
+	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x6f, 0x77, 0x65, 
+	0x72, 0x73, 0x61, 0x76, 0x65, 0x22, 0x20, 0x73, 0x69, 0x7a, 
+	0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x70, 0x6f, 0x77, 0x65, 0x72, 0x73, 0x61, 0x76, 0x65, 0x22, 
+	0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 
+	0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 
+	0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 
+	0x3e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x65, 0x6e, 0x61, 0x62, 
+	0x6c, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3e, 0x20, 0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 0x3c, 
+	0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x9, 0x9, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x28, 0x65, 0x2e, 0x67, 0x2e, 0x20, 
-	0x30, 0x30, 0x31, 0x31, 0x32, 0x32, 0x33, 0x33, 0x34, 0x34, 
-	0x35, 0x35, 0x29, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
+	0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 
+	0x22, 0x3e, 0x42, 0x73, 0x73, 0x69, 0x64, 0x20, 0x42, 0x69, 
+	0x6e, 0x64, 0x28, 0x53, 0x74, 0x61, 0x29, 0xa3, 0xba, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
+	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x37, 0x37, 0x22, 
+	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 
+	0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x73, 0x73, 
+	0x69, 0x64, 0x45, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x73, 
+	0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 
+	0x3d, 0x22, 0x42, 0x73, 0x73, 0x69, 0x64, 0x45, 0x61, 0x62, 
+	0x6c, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 
+	0x67, 0x65, 0x3d, 0x22, 0x42, 0x73, 0x73, 0x69, 0x64, 0x45, 
+	0x61, 0x62, 0x6c, 0x65, 0x31, 0x28, 0x29, 0x22, 0x20, 0x3e, 
+	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3e, 0x64, 
+	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x31, 0x22, 0x3e, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 
+	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x9, 0x9, 0x9, 0x3c, 0x74, 0x64, 0x20, 0x63, 0x6f, 0x6c, 
+	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x20, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 
+	0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 
+	0x73, 0x73, 0x69, 0x64, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x6f, 0x6e, 
+	0x6b, 0x65, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x3d, 0x22, 
+	0x45, 0x73, 0x63, 0x6b, 0x65, 0x79, 0x48, 0x61, 0x6e, 0x64, 
+	0x6c, 0x65, 0x28, 0x29, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x42, 0x73, 0x73, 0x69, 0x64, 0x22, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x22, 0x20, 0x73, 0x69, 
+	0x7a, 0x65, 0x3d, 0x22, 0x31, 0x32, 0x22, 0x20, 0x6d, 0x61, 
+	0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x31, 
+	0x32, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 
+	0x65, 0x2e, 0x67, 0x2e, 0x20, 0x30, 0x30, 0x31, 0x31, 0x32, 
+	0x32, 0x33, 0x33, 0x34, 0x34, 0x35, 0x35, 0x29, 0x20, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
+	0x3e, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x20, 
+	0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x41, 
+	0x75, 0x74, 0x6f, 0x20, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 
+	0x28, 0x41, 0x64, 0x68, 0x6f, 0x63, 0x29, 0xa3, 0xba, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
+	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x33, 
+	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 
+	0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 
+	0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
+	0x61, 0x75, 0x74, 0x6f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 
+	0x61, 0x64, 0x68, 0x6f, 0x63, 0x22, 0x20, 0x73, 0x69, 0x7a, 
+	0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x61, 0x75, 0x74, 0x6f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 
+	0x61, 0x64, 0x68, 0x6f, 0x63, 0x22, 0x20, 0x3e, 0x20, 0x3c, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x73, 0x65, 0x6c, 
+	0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 
+	0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x64, 0x69, 0x73, 
+	0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
+	0x22, 0x3e, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0xd, 0xa, 
+	0x9, 0x9, 0x9, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 
+	0x72, 0x3e, 0x9, 0x20, 0x20, 0x9, 0xd, 0xa, 0x9, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 
 	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 
 	0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
 	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 
-	0x68, 0x74, 0x22, 0x3e, 0x41, 0x75, 0x74, 0x6f, 0x20, 0x43, 
-	0x72, 0x65, 0x61, 0x74, 0x65, 0x28, 0x41, 0x64, 0x68, 0x6f, 
-	0x63, 0x29, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
+	0x68, 0x74, 0x22, 0x3e, 0x53, 0x73, 0x69, 0x64, 0x20, 0x42, 
+	0x72, 0x6f, 0x61, 0x64, 0x63, 0x61, 0x73, 0x74, 0x28, 0x41, 
+	0x50, 0x29, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x3c, 0x74, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
 	0x61, 0x6e, 0x3d, 0x22, 0x33, 0x22, 0x20, 0x61, 0x6c, 0x69, 
@@ -855,638 +898,512 @@ static const unsigned char data_advance_html[] = {
 	0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 
-	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x61, 0x75, 0x74, 0x6f, 0x63, 
-	0x72, 0x65, 0x61, 0x74, 0x65, 0x61, 0x64, 0x68, 0x6f, 0x63, 
-	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x75, 0x74, 0x6f, 0x63, 
-	0x72, 0x65, 0x61, 0x74, 0x65, 0x61, 0x64, 0x68, 0x6f, 0x63, 
-	0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 
-	0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 
-	0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 
-	0x22, 0x3e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3c, 
-	0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 
-	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 
-	0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x65, 0x6e, 0x61, 
-	0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3e, 0x20, 0xd, 0xa, 0x9, 0x9, 0x9, 0x3c, 0x2f, 
-	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 
+	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x73, 0x69, 0x64, 0x42, 
+	0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x73, 0x69, 
+	0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x53, 0x73, 0x69, 0x64, 0x42, 0x65, 0x6e, 0x61, 0x62, 
+	0x6c, 0x65, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x30, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
+	0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
+	0x65, 0x64, 0x22, 0x3e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+	0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x65, 
+	0x6e, 0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0xd, 0xa, 0x9, 0x9, 0x9, 
+	0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x9, 
+	0x20, 0x20, 0x9, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 
+	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
+	0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
+	0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 
 	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x9, 0x20, 0x20, 
-	0x9, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 
+	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x53, 
-	0x73, 0x69, 0x64, 0x20, 0x42, 0x72, 0x6f, 0x61, 0x64, 0x63, 
-	0x61, 0x73, 0x74, 0x28, 0x41, 0x50, 0x29, 0xa3, 0xba, 0x3c, 
-	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
-	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x33, 
-	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 
-	0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 
-	0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x53, 0x73, 0x69, 0x64, 0x42, 0x65, 0x6e, 0x61, 0x62, 0x6c, 
-	0x65, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 
-	0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x73, 0x69, 0x64, 
-	0x42, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x3e, 
-	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x73, 
-	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 
-	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x64, 
-	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x31, 0x22, 0x3e, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 
-	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 
-	0xd, 0xa, 0x9, 0x9, 0x9, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 
-	0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
-	0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x74, 0x72, 0x3e, 0x9, 0x20, 0x20, 0x9, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
-	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 
-	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 
-	0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 
+	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x20, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 
+	0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 
+	0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x32, 0x22, 
+	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 
+	0x6d, 0x69, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 
+	0x61, 0x76, 0x65, 0x32, 0x22, 0x20, 0x6f, 0x6e, 0x43, 0x6c, 
+	0x69, 0x63, 0x6b, 0x3d, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x20, 0x57, 0x69, 0x72, 0x65, 0x6c, 0x65, 0x73, 0x73, 
+	0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 
+	0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 
+	0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0xd, 
+	0xa, 0x9, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 
+	0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x33, 0x22, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x33, 
+	0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 
+	0x67, 0x65, 0x74, 0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x3d, 0x22, 0x22, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x64, 
+	0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 
+	0x73, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x3e, 0x20, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x20, 
+	0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 
+	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 
+	0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 
+	0x36, 0x22, 0x3e, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 
+	0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x53, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x20, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3d, 0x22, 0x35, 0x35, 0x30, 0x22, 0x20, 0x62, 0x6f, 0x72, 
+	0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 
+	0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 
+	0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 
+	0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x35, 0x22, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
-	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 
+	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 
 	0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 
-	0x22, 0x34, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x76, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 
-	0x64, 0x6c, 0x65, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 
-	0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 
-	0x61, 0x76, 0x65, 0x32, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
-	0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x32, 0x22, 
-	0x20, 0x6f, 0x6e, 0x43, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 
-	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x57, 0x69, 0x72, 
-	0x65, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x70, 0x6f, 0x70, 0x75, 
-	0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 
-	0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 
-	0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 
-	0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 
-	0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 0x66, 
-	0x6f, 0x72, 0x6d, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x66, 0x6f, 
-	0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x6f, 0x72, 
-	0x6d, 0x33, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x66, 0x6f, 0x72, 0x6d, 0x33, 0x22, 0x20, 0x6d, 0x65, 0x74, 
-	0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 0x20, 
-	0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x3e, 
-	0xd, 0xa, 0x9, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 
-	0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x6f, 0x72, 0x79, 
-	0x22, 0x3e, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x68, 0x33, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
-	0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 
-	0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x22, 0x3e, 0x43, 0x68, 
-	0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x20, 0x4c, 0x69, 0x73, 0x74, 
-	0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 
-	0x3c, 0x2f, 0x68, 0x33, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x35, 0x35, 0x30, 
-	0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 
-	0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 
-	0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 
-	0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 
-	0x3d, 0x22, 0x35, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-	0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 
-	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x37, 0x22, 0x3e, 0x3c, 
-	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
+	0x22, 0x37, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x72, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x3e, 0x3c, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+	0x3d, 0x22, 0x43, 0x68, 0x31, 0x22, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 
+	0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x31, 
+	0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
+	0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 
+	0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 
+	0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 0x31, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x3e, 
+	0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x32, 0x22, 0x20, 0x74, 
+	0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 
+	0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 
+	0x68, 0x32, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 
+	0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 
+	0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 0x32, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
+	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x33, 0x22, 0x20, 
+	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 
+	0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x43, 0x68, 0x33, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 
+	0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 
+	0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 
+	0x33, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
 	0x64, 0x20, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
-	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x31, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x34, 
 	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 
-	0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x43, 0x68, 0x31, 0x22, 0x20, 0x76, 0x61, 0x6c, 
-	0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 
-	0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 
-	0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 
+	0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x69, 0x64, 0x3d, 
+	0x22, 0x43, 0x68, 0x34, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 
+	0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 
+	0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 
-	0x68, 0x20, 0x31, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 
+	0x20, 0x34, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x74, 0x64, 0x20, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 
+	0x35, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 
+	0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x43, 0x68, 0x35, 0x22, 0x20, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 
+	0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 
+	0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x74, 0x64, 0x20, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 
-	0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 
-	0x68, 0x32, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 
-	0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x32, 0x22, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 
-	0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 
-	0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 
+	0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0x43, 0x68, 0x20, 0x35, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
-	0x3e, 0x43, 0x68, 0x20, 0x32, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
+	0x20, 0x3c, 0x74, 0x64, 0x20, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
 	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 
 	0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x43, 0x68, 0x33, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
+	0x43, 0x68, 0x36, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
 	0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x33, 0x22, 0x20, 
+	0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x36, 0x22, 0x20, 
 	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 
 	0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 
 	0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0x43, 0x68, 0x20, 0x33, 0x3c, 0x2f, 0x74, 0x64, 
+	0x6c, 0x3e, 0x43, 0x68, 0x20, 0x36, 0x3c, 0x2f, 0x74, 0x64, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x3e, 0x3c, 0x6c, 
 	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
 	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x43, 0x68, 0x34, 0x22, 0x20, 0x74, 0x79, 0x70, 
+	0x3d, 0x22, 0x43, 0x68, 0x37, 0x22, 0x20, 0x74, 0x79, 0x70, 
 	0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 
-	0x78, 0x22, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x34, 0x22, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 
-	0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 
-	0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 0x34, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x3e, 0x3c, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x37, 
+	0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
+	0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 
+	0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 
+	0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 0x37, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x72, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 
+	0x65, 0x66, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
+	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 
-	0x65, 0x3d, 0x22, 0x43, 0x68, 0x35, 0x22, 0x20, 0x74, 0x79, 
-	0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 
-	0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 
-	0x35, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
-	0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 
-	0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 
-	0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x38, 0x22, 0x20, 
+	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 
+	0x6b, 0x62, 0x6f, 0x78, 0x22, 0x69, 0x64, 0x3d, 0x22, 0x43, 
+	0x68, 0x38, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 
+	0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 
+	0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 0x35, 0x3c, 
-	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0x20, 0x43, 0x68, 0x20, 0x38, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
 	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 
-	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x36, 0x22, 0x20, 
+	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x39, 0x22, 0x20, 
 	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 
 	0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
-	0x43, 0x68, 0x36, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x43, 0x68, 0x39, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
 	0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 
 	0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 
 	0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
 	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 
-	0x36, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x39, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x64, 0x20, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
-	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x37, 
+	0x64, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x31, 0x30, 
 	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 
 	0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x43, 0x68, 0x37, 0x22, 0x20, 0x76, 0x61, 0x6c, 
-	0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 
-	0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 
-	0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 
+	0x3d, 0x22, 0x43, 0x68, 0x31, 0x30, 0x22, 0x20, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 
+	0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 
+	0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 
-	0x68, 0x20, 0x37, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 
-	0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x43, 0x68, 0x38, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
-	0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 
-	0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x38, 0x22, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 
-	0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 
-	0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
-	0x20, 0x43, 0x68, 0x20, 0x38, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0x43, 0x68, 0x20, 0x31, 0x30, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
 	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 
 	0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x43, 0x68, 0x39, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
-	0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x39, 0x22, 0x20, 
+	0x43, 0x68, 0x31, 0x31, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 
+	0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x31, 0x31, 
+	0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
+	0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 
+	0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 
+	0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 0x31, 0x31, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 
+	0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x31, 0x32, 0x22, 0x20, 
+	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 
+	0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x43, 0x68, 0x31, 0x32, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 
+	0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 
+	0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 
+	0x20, 0x31, 0x32, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 
+	0x31, 0x33, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 
+	0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x31, 0x33, 0x22, 0x20, 
 	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 
 	0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 
 	0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0x43, 0x68, 0x20, 0x39, 0x3c, 0x2f, 0x74, 0x64, 
+	0x6c, 0x3e, 0x43, 0x68, 0x20, 0x31, 0x33, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+	0x3d, 0x22, 0x43, 0x68, 0x31, 0x34, 0x22, 0x20, 0x74, 0x79, 
+	0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 
+	0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 
+	0x31, 0x34, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 
+	0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 
+	0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 0x31, 
+	0x34, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x6c, 0x61, 
-	0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 
-	0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x43, 0x68, 0x31, 0x30, 0x22, 0x20, 0x74, 0x79, 0x70, 
-	0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 
-	0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x31, 
-	0x30, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
-	0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 
-	0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 
-	0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 0x31, 0x30, 
-	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
-	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 
-	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x31, 0x31, 0x22, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 
-	0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 
-	0x22, 0x43, 0x68, 0x31, 0x31, 0x22, 0x20, 0x76, 0x61, 0x6c, 
-	0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 
-	0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 
-	0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 
-	0x68, 0x20, 0x31, 0x31, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 
-	0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 
-	0x68, 0x31, 0x32, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
-	0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x31, 0x32, 0x22, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 
-	0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 
-	0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 0x31, 0x32, 0x3c, 0x2f, 
-	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 
-	0x65, 0x3d, 0x22, 0x43, 0x68, 0x31, 0x33, 0x22, 0x20, 0x74, 
-	0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 
-	0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 
-	0x68, 0x31, 0x33, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 
-	0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 
-	0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x43, 0x68, 0x20, 
-	0x31, 0x33, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 
+	0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 
+	0x3d, 0x22, 0x37, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
-	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x31, 
-	0x34, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 
-	0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 
-	0x64, 0x3d, 0x22, 0x43, 0x68, 0x31, 0x34, 0x22, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 
-	0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 
-	0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 0xd, 
+	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
-	0x3e, 0x43, 0x68, 0x20, 0x31, 0x34, 0x3c, 0x2f, 0x74, 0x64, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 
-	0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 
-	0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x37, 0x22, 0x3e, 
-	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
-	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 
-	0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 
-	0x22, 0x37, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x76, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 
-	0x64, 0x6c, 0x65, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 
-	0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 
-	0x61, 0x76, 0x65, 0x33, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
-	0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x33, 0x22, 
-	0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 
-	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x4d, 0x4d, 0x5f, 
-	0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 
-	0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 
-	0x61, 0x76, 0x65, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 
+	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x37, 0x22, 0x20, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 
+	0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 
+	0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 
-	0x6e, 0x62, 0x73, 0x70, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 
-	0x6c, 0x65, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x64, 0x69, 
-	0x76, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 
-	0x6d, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 
-	0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x6f, 
-	0x72, 0x6d, 0x31, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 
-	0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 0x20, 0x61, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 
-	0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x6f, 0x72, 
-	0x79, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x68, 0x33, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
-	0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 
-	0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x22, 0x3e, 0x53, 0x65, 
-	0x72, 0x69, 0x61, 0x6c, 0x20, 0x50, 0x6f, 0x72, 0x74, 0x20, 
-	0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f, 
-	0x68, 0x33, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 
-	0x64, 0x74, 0x68, 0x3d, 0x22, 0x35, 0x35, 0x30, 0x22, 0x20, 
-	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 
-	0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 
-	0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 
-	0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 
-	0x35, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
-	0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
-	0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 
-	0x9, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 
-	0x74, 0x68, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x22, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x22, 0x3e, 0x42, 0x61, 0x75, 0x64, 0x20, 0x72, 0x61, 
-	0x74, 0x65, 0x20, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x33, 0x22, 
+	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 
+	0x6d, 0x69, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 
+	0x61, 0x76, 0x65, 0x33, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 
+	0x69, 0x63, 0x6b, 0x3d, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x20, 0x4d, 0x4d, 0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 
+	0x4d, 0x73, 0x67, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 
+	0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x6e, 
+	0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 
-	0x68, 0x3d, 0x22, 0x31, 0x32, 0x30, 0x22, 0x20, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 
-	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 
-	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x61, 0x75, 0x64, 
-	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x42, 0x61, 0x75, 0x64, 0x22, 
-	0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 
-	0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 
-	0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 
-	0x20, 0x3e, 0x31, 0x31, 0x35, 0x32, 0x30, 0x30, 0x3c, 0x2f, 
-	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
-	0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x35, 0x37, 0x36, 0x30, 
-	0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
-	0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x3e, 
-	0x33, 0x38, 0x34, 0x30, 0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
-	0x33, 0x22, 0x3e, 0x31, 0x39, 0x32, 0x30, 0x30, 0x3c, 0x2f, 
-	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
-	0x65, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x39, 0x36, 0x30, 0x30, 
-	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 
-	0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x35, 0x22, 0x3e, 0x34, 0x38, 
-	0x30, 0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x36, 0x22, 0x3e, 
-	0x32, 0x34, 0x30, 0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x37, 
-	0x22, 0x3e, 0x31, 0x32, 0x30, 0x30, 0x3c, 0x2f, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x62, 0x70, 
-	0x73, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 
+	0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xd, 0xa, 
+	0x9, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x9, 
+	0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0xd, 0xa, 0x9, 
+	0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 0x20, 0x6e, 0x61, 0x6d, 
+	0x65, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 0x20, 
+	0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 
+	0x74, 0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 
+	0x22, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 
+	0x22, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x20, 
+	0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 
+	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 
+	0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 
+	0x36, 0x22, 0x3e, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 
+	0x50, 0x6f, 0x72, 0x74, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 
+	0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 
+	0x35, 0x35, 0x30, 0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 
+	0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 
+	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x30, 
+	0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 
+	0x69, 0x6e, 0x67, 0x3d, 0x22, 0x35, 0x22, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
+	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 
+	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 
+	0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 
+	0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x20, 
+	0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 
+	0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
 	0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 
 	0x30, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x50, 0x61, 
-	0x72, 0x69, 0x74, 0x79, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 
-	0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 
-	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6b, 
-	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6b, 
-	0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 
-	0x22, 0x3e, 0x4e, 0x6f, 0x6e, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x31, 0x22, 0x3e, 0x4f, 0x64, 0x64, 0x3c, 0x2f, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x32, 0x22, 0x3e, 0x45, 0x76, 0x65, 0x6e, 0x3c, 
-	0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
-	0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 
-	0x3e, 0x44, 0x61, 0x74, 0x61, 0x20, 0x62, 0x69, 0x74, 0x73, 
-	0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x42, 0x61, 
+	0x75, 0x64, 0x20, 0x72, 0x61, 0x74, 0x65, 0x20, 0xa3, 0xba, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
+	0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x32, 
+	0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
 	0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
 	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 
 	0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x44, 0x61, 0x74, 0x61, 0x53, 0x69, 0x7a, 0x65, 0x22, 
-	0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x44, 0x61, 0x74, 0x61, 0x53, 0x69, 
-	0x7a, 0x65, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x30, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x65, 0x64, 0x22, 0x3e, 0x38, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 
-	0x22, 0x3e, 0x53, 0x74, 0x6f, 0x70, 0x20, 0x62, 0x69, 0x74, 
-	0x73, 0x20, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 
-	0x65, 0x3d, 0x22, 0x53, 0x74, 0x6f, 0x70, 0x53, 0x69, 0x7a, 
-	0x65, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 
-	0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x74, 0x6f, 0x70, 
-	0x53, 0x69, 0x7a, 0x65, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 
+	0x22, 0x42, 0x61, 0x75, 0x64, 0x22, 0x20, 0x73, 0x69, 0x7a, 
+	0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x42, 0x61, 0x75, 0x64, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 
 	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
 	0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 
 	0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 
-	0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x31, 0x3c, 0x2f, 0x6f, 
+	0x63, 0x74, 0x65, 0x64, 0x22, 0x20, 0x3e, 0x31, 0x31, 0x35, 
+	0x32, 0x30, 0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 
+	0x3e, 0x35, 0x37, 0x36, 0x30, 0x30, 0x3c, 0x2f, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x20, 0x3c, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3d, 0x22, 0x32, 0x22, 0x3e, 0x33, 0x38, 0x34, 0x30, 0x30, 
+	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 
+	0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x33, 0x22, 0x3e, 0x31, 0x39, 
+	0x32, 0x30, 0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x34, 0x22, 
+	0x3e, 0x39, 0x36, 0x30, 0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x35, 0x22, 0x3e, 0x34, 0x38, 0x30, 0x30, 0x3c, 0x2f, 0x6f, 
 	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
 	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x31, 0x22, 0x3e, 0x32, 0x3c, 0x2f, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x3d, 0x22, 0x36, 0x22, 0x3e, 0x32, 0x34, 0x30, 0x30, 0x3c, 
+	0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x37, 0x22, 0x3e, 0x31, 0x32, 0x30, 
+	0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 
+	0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
+	0x65, 0x6c, 0x3e, 0x62, 0x70, 0x73, 0x3c, 0x2f, 0x74, 0x64, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 
+	0x74, 0x68, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x22, 0x20, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 
+	0x74, 0x22, 0x3e, 0x50, 0x61, 0x72, 0x69, 0x74, 0x79, 0xa3, 
+	0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 
+	0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 
+	0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
+	0x43, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x20, 0x73, 0x69, 0x7a, 
+	0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x43, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x20, 0x3e, 0x20, 0x3c, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3e, 0x4e, 0x6f, 0x6e, 
+	0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x4f, 
+	0x64, 0x64, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x3e, 
+	0x45, 0x76, 0x65, 0x6e, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 
 	0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
 	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 
-	0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
-	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 
-	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 
-	0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 
-	0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 
-	0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 
-	0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x20, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 
-	0x74, 0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 
-	0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x6c, 0x61, 
-	0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 
+	0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 
+	0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 
+	0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x44, 0x61, 0x74, 0x61, 
+	0x20, 0x62, 0x69, 0x74, 0x73, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 
+	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 
-	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 
-	0x6d, 0x69, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 
-	0x61, 0x76, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x43, 0x6c, 0x69, 
-	0x63, 0x6b, 0x3d, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
-	0x20, 0x4d, 0x4d, 0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 
-	0x73, 0x67, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 
-	0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x2f, 
+	0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x61, 0x74, 0x61, 
+	0x53, 0x69, 0x7a, 0x65, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+	0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x44, 
+	0x61, 0x74, 0x61, 0x53, 0x69, 0x7a, 0x65, 0x22, 0x20, 0x3e, 
+	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x38, 
+	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x53, 0x74, 0x6f, 
+	0x70, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0xa3, 0xba, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
+	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 
+	0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x74, 
+	0x6f, 0x70, 0x53, 0x69, 0x7a, 0x65, 0x22, 0x20, 0x73, 0x69, 
+	0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x53, 0x74, 0x6f, 0x70, 0x53, 0x69, 0x7a, 0x65, 0x22, 
+	0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 
+	0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 
+	0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 
+	0x3e, 0x31, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 
+	0x32, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 
-	0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0xd, 0xa, 0x9, 
-	0x9, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 
-	0x69, 0x76, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x66, 0x6f, 
-	0x72, 0x6d, 0x3e, 0xd, 0xa, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x36, 
-	0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x6f, 
-	0x72, 0x6d, 0x36, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 
-	0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 0x20, 0x61, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 
-	0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x6f, 0x72, 
-	0x79, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x68, 0x33, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
-	0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 
-	0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x22, 0x3e, 0x4f, 0x74, 
-	0x68, 0x65, 0x72, 0x73, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 
-	0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 
-	0x22, 0x35, 0x35, 0x30, 0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 
-	0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 
-	0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 
-	0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 
-	0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x35, 0x22, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 
-	0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
 	0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
-	0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-	0x3d, 0x22, 0x31, 0x33, 0x38, 0x22, 0x20, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 
-	0x3e, 0x4c, 0x6f, 0x67, 0x69, 0x6e, 0x20, 0x50, 0x61, 0x73, 
-	0x73, 0x77, 0x6f, 0x72, 0x64, 0x20, 0xa3, 0xba, 0x3c, 0x2f, 
-	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 
-	0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x32, 0x39, 0x37, 0x22, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 
-	0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 
-	0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x61, 
-	0x73, 0x73, 0x57, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x74, 0x79, 
-	0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x50, 0x61, 0x73, 0x73, 0x57, 0x6f, 
-	0x72, 0x64, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x22, 0x20, 0x73, 
-	0x69, 0x7a, 0x65, 0x3d, 0x22, 0x36, 0x22, 0x20, 0x6d, 0x61, 
-	0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x36, 
-	0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0x20, 0x50, 0x61, 0x73, 0x73, 
-	0x77, 0x6f, 0x72, 0x64, 0x20, 0x20, 0x6d, 0x75, 0x73, 0x74, 
-	0x20, 0x62, 0x65, 0x20, 0x36, 0x20, 0x63, 0x68, 0x61, 0x72, 
-	0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x72, 
 	0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 
 	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
 	0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
-	0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 
+	0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 
 	0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 
 	0x9, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
@@ -1494,47 +1411,138 @@ static const unsigned char data_advance_html[] = {
 	0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 
 	0x3d, 0x22, 0x34, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
 	0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 
-	0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x74, 0x6f, 
-	0x70, 0x22, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 
+	0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 
+	0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x9, 0x9, 
+	0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 
+	0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
+	0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 
+	0x6f, 0x6e, 0x43, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x4d, 0x4d, 0x5f, 0x70, 
+	0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 0x22, 
+	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 0x61, 
+	0x76, 0x65, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 
+	0x70, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 
+	0x9, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0xd, 0xa, 
+	0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x66, 0x6f, 0x72, 0x6d, 0x36, 0x22, 0x20, 0x6e, 0x61, 0x6d, 
+	0x65, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x36, 0x22, 0x20, 
+	0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 
+	0x74, 0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 
+	0x22, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 
+	0x22, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x20, 
+	0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 
+	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 
+	0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 
+	0x36, 0x22, 0x3e, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x3c, 
+	0x2f, 0x68, 0x33, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 
+	0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x35, 0x35, 0x30, 0x22, 
+	0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 
+	0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 
+	0x69, 0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 
+	0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 
+	0x22, 0x35, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+	0x3d, 0x22, 0x31, 0x30, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 
+	0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
+	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x33, 0x38, 
+	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 
+	0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x4c, 0x6f, 0x67, 0x69, 
+	0x6e, 0x20, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
+	0x20, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 
+	0x22, 0x32, 0x39, 0x37, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 
+	0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 
 	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
-	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 
-	0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 
-	0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 
-	0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x43, 
-	0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x72, 0x65, 0x74, 0x75, 
-	0x72, 0x6e, 0x20, 0x4d, 0x4d, 0x5f, 0x70, 0x6f, 0x70, 0x75, 
-	0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 
-	0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x26, 0x6e, 0x62, 
-	0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0xd, 
+	0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 
+	0x65, 0x3d, 0x22, 0x50, 0x61, 0x73, 0x73, 0x57, 0x6f, 0x72, 
+	0x64, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 
+	0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x50, 
+	0x61, 0x73, 0x73, 0x57, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x30, 0x30, 
+	0x30, 0x30, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 
+	0x36, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 
+	0x74, 0x68, 0x3d, 0x22, 0x36, 0x22, 0x20, 0x2f, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 
-	0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 
-	0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 
-	0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 
-	0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 
-	0xa, 0x9, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x9, 
-	0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 
-	0x64, 0x3d, 0x22, 0x73, 0x69, 0x74, 0x65, 0x49, 0x6e, 0x66, 
-	0x6f, 0x22, 0x3e, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 
-	0x68, 0x74, 0x20, 0x32, 0x30, 0x31, 0x30, 0x2d, 0x32, 0x30, 
-	0x31, 0x33, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 
-	0xa, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x3c, 
-	0x21, 0x2d, 0x2d, 0x65, 0x6e, 0x64, 0x20, 0x70, 0x61, 0x67, 
-	0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x2d, 0x2d, 0x3e, 0xd, 
-	0xa, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 
-	0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 
-	0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xd, 0xa, 0xd, 0xa, };
+	0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0x20, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x20, 
+	0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x36, 
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
+	0x73, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x9, 
+	0x9, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 
+	0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
+	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 
+	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 
+	0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 
+	0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 
+	0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 
+	0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x20, 
+	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 
+	0x74, 0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 
+	0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 0x3e, 0xd, 0xa, 
+	0x9, 0x9, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+	0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x74, 0x79, 
+	0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 
+	0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 
+	0x22, 0x20, 0x6f, 0x6e, 0x43, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 
+	0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x4d, 0x4d, 
+	0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 
+	0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 
+	0x62, 0x73, 0x70, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 
+	0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 
+	0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 
+	0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 
+	0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
+	0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 
+	0x65, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x66, 
+	0x6f, 0x72, 0x6d, 0x3e, 0x9, 0xd, 0xa, 0x20, 0x20, 0x3c, 
+	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 
+	0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x69, 
+	0x74, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x22, 0x3e, 0x43, 0x6f, 
+	0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 
+	0x31, 0x30, 0x2d, 0x32, 0x30, 0x31, 0x33, 0x20, 0x3c, 0x2f, 
+	0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x64, 0x69, 
+	0x76, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x65, 0x6e, 
+	0x64, 0x20, 0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 
+	0x31, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x62, 0x72, 0x20, 
+	0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 
+	0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 
+	0xd, 0xa, 0xd, 0xa, };
 
 static const unsigned char data_basic_html[] = {
 	/* /basic.html */
@@ -1548,388 +1556,448 @@ static const unsigned char data_basic_html[] = {
 	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
 	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
 	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
-	0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, 0x3c, 0x21, 0x44, 
-	0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 
-	0x6c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 
-	0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f, 0x2f, 0x44, 0x54, 
-	0x44, 0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x31, 0x2e, 
-	0x30, 0x20, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 
-	0x6f, 0x6e, 0x61, 0x6c, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x20, 
-	0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 
-	0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x54, 
-	0x52, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2f, 0x44, 
-	0x54, 0x44, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2d, 
-	0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
-	0x61, 0x6c, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 0xd, 0xa, 
-	0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 
-	0x73, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 
-	0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 
-	0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x78, 0x68, 0x74, 0x6d, 
-	0x6c, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 
-	0x44, 0x57, 0x36, 0x20, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 
-	0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 
-	0x2d, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x20, 0x32, 0x30, 0x30, 0x35, 0x20, 0x4d, 0x61, 0x63, 
-	0x72, 0x6f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2c, 0x20, 0x49, 
-	0x6e, 0x63, 0x2e, 0x20, 0x41, 0x6c, 0x6c, 0x20, 0x72, 0x69, 
-	0x67, 0x68, 0x74, 0x73, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 
-	0x76, 0x65, 0x64, 0x2e, 0x20, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 
-	0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x68, 0x74, 0x74, 0x70, 
-	0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d, 0x22, 0x43, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 
-	0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 
-	0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 
-	0x3b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 
-	0x67, 0x62, 0x32, 0x33, 0x31, 0x32, 0x22, 0x20, 0x2f, 0x3e, 
-	0xd, 0xa, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x42, 
-	0x61, 0x73, 0x69, 0x63, 0x20, 0x43, 0x6f, 0x6e, 0x66, 0x69, 
-	0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x26, 0x6e, 
-	0x62, 0x73, 0x70, 0x3b, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 
-	0x65, 0x3e, 0xd, 0xa, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 
-	0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 
-	0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 
-	0x66, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 
-	0x73, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 
-	0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x20, 
-	0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 
-	0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 
-	0x78, 0x74, 0x2f, 0x4a, 0x61, 0x76, 0x61, 0x53, 0x63, 0x72, 
-	0x69, 0x70, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 
-	0x2d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x73, 0x74, 0x72, 0x6c, 0x65, 0x6e, 0x28, 0x73, 
-	0x74, 0x72, 0x29, 0x20, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x9, 
-	0x76, 0x61, 0x72, 0x20, 0x6c, 0x65, 0x6e, 0x20, 0x3d, 0x20, 
-	0x30, 0x3b, 0xd, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x28, 
-	0x76, 0x61, 0x72, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 
-	0x20, 0x69, 0x20, 0x3c, 0x20, 0x73, 0x74, 0x72, 0x2e, 0x6c, 
-	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 
-	0x29, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x69, 
-	0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x2e, 0x63, 0x68, 0x61, 
-	0x72, 0x43, 0x6f, 0x64, 0x65, 0x41, 0x74, 0x28, 0x69, 0x29, 
-	0x20, 0x3e, 0x20, 0x32, 0x35, 0x35, 0x29, 0x20, 0x6c, 0x65, 
-	0x6e, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x3b, 0x20, 0x65, 0x6c, 
-	0x73, 0x65, 0x20, 0x6c, 0x65, 0x6e, 0x20, 0x2b, 0x2b, 0x3b, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xd, 0xa, 0x9, 
-	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6c, 0x65, 0x6e, 
-	0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x61, 0x76, 0x65, 0x63, 
-	0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28, 0x29, 0xd, 0xa, 0x7b, 
-	0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x66, 
-	0x69, 0x72, 0x6d, 0x28, 0x27, 0x41, 0x72, 0x65, 0x20, 0x79, 
-	0x6f, 0x75, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 
-	0x20, 0x73, 0x61, 0x76, 0x65, 0x3f, 0x5c, 0x6e, 0x27, 0x29, 
-	0x29, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x72, 
-	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x72, 0x75, 0x65, 
-	0x3b, 0x9, 0x20, 0x20, 0xd, 0xa, 0x9, 0x7d, 0x9, 0x20, 
-	0x20, 0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xd, 0xa, 
-	0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 
-	0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x7d, 0x9, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x66, 
-	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 
-	0x49, 0x70, 0x28, 0x73, 0x74, 0x72, 0x29, 0xd, 0xa, 0x7b, 
-	0x20, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x73, 0x61, 
-	0x3d, 0x73, 0x74, 0x72, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74, 
-	0x28, 0x22, 0x2e, 0x22, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x69, 
-	0x66, 0x28, 0x73, 0x61, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
-	0x68, 0x21, 0x3d, 0x34, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 
-	0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 
-	0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x73, 0x61, 0x2e, 0x6c, 
-	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 
-	0xd, 0xa, 0x9, 0x7b, 0x20, 0xd, 0xa, 0x9, 0x9, 0x69, 
-	0x66, 0x28, 0x21, 0x28, 0x2f, 0x5e, 0x28, 0x5c, 0x64, 0x29, 
-	0x2b, 0x24, 0x2f, 0x67, 0x29, 0x2e, 0x74, 0x65, 0x73, 0x74, 
-	0x28, 0x73, 0x61, 0x5b, 0x69, 0x5d, 0x29, 0x20, 0x7c, 0x7c, 
-	0x20, 0x28, 0x73, 0x61, 0x5b, 0x69, 0x5d, 0x3c, 0x30, 0x29, 
-	0x20, 0x7c, 0x7c, 0x20, 0x28, 0x73, 0x61, 0x5b, 0x69, 0x5d, 
-	0x3e, 0x32, 0x35, 0x35, 0x29, 0x29, 0x20, 0x72, 0x65, 0x74, 
-	0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 
-	0x20, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x72, 0x65, 
-	0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 
-	0xd, 0xa, 0x7d, 0x20, 0xd, 0xa, 0xd, 0xa, 0x66, 0x75, 
-	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x46, 0x6f, 0x72, 
-	0x6d, 0x31, 0x5f, 0x4d, 0x4d, 0x5f, 0x70, 0x6f, 0x70, 0x75, 
-	0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 
-	0xa, 0x9, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x45, 0x6e, 
-	0x63, 0x72, 0x79, 0x5f, 0x76, 0x61, 0x72, 0x20, 0x3d, 0x20, 
-	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 
-	0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 
-	0x79, 0x49, 0x64, 0x28, 0x22, 0x45, 0x6e, 0x63, 0x72, 0x79, 
-	0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x4b, 0x65, 
-	0x79, 0x5f, 0x76, 0x61, 0x72, 0x20, 0x3d, 0x20, 0x64, 0x6f, 
-	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
-	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
-	0x64, 0x28, 0x22, 0x4b, 0x65, 0x79, 0x22, 0x29, 0x2e, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 
-	0x76, 0x61, 0x72, 0x20, 0x4b, 0x65, 0x79, 0x54, 0x79, 0x70, 
-	0x65, 0x5f, 0x76, 0x61, 0x72, 0x20, 0x3d, 0x20, 0x64, 0x6f, 
-	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
-	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
-	0x64, 0x28, 0x22, 0x4b, 0x65, 0x79, 0x54, 0x79, 0x70, 0x65, 
-	0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x4d, 0x6f, 
-	0x64, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x20, 0x3d, 0x20, 0x64, 
-	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 
-	0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 
-	0x49, 0x64, 0x28, 0x22, 0x4d, 0x6f, 0x64, 0x65, 0x22, 0x29, 
-	0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x9, 0x20, 0x20, 
-	0xd, 0xa, 0x9, 0x20, 0x20, 0x69, 0x66, 0x28, 0x4d, 0x6f, 
-	0x64, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x20, 0x21, 0x3d, 0x20, 
-	0x30, 0x29, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 
-	0x9, 0x9, 0x20, 0x20, 0x69, 0x66, 0x28, 0x45, 0x6e, 0x63, 
-	0x72, 0x79, 0x5f, 0x76, 0x61, 0x72, 0x20, 0x3d, 0x3d, 0x20, 
-	0x31, 0x29, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x7b, 0xd, 
-	0xa, 0x9, 0x9, 0x9, 0x9, 0x69, 0x66, 0x28, 0x4b, 0x65, 
-	0x79, 0x54, 0x79, 0x70, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x20, 
-	0x3d, 0x3d, 0x20, 0x30, 0x29, 0xd, 0xa, 0x9, 0x9, 0x9, 
-	0x20, 0x20, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 
+	0x74, 0x6d, 0x6c, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 
+	0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 
+	0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0xd, 0xa, 
+	0xd, 0xa, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 
+	0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x50, 0x55, 0x42, 
+	0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 0x57, 0x33, 
+	0x43, 0x2f, 0x2f, 0x44, 0x54, 0x44, 0x20, 0x58, 0x48, 0x54, 
+	0x4d, 0x4c, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x54, 0x72, 0x61, 
+	0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2f, 
+	0x2f, 0x45, 0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 
+	0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 
+	0x6f, 0x72, 0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 0x74, 
+	0x6d, 0x6c, 0x31, 0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 0x68, 
+	0x74, 0x6d, 0x6c, 0x31, 0x2d, 0x74, 0x72, 0x61, 0x6e, 0x73, 
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2e, 0x64, 0x74, 
+	0x64, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 
+	0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 
+	0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 
+	0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 
+	0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0xd, 0xa, 
+	0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x44, 0x57, 0x36, 0x20, 0x2d, 
+	0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 
+	0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x70, 
+	0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x30, 
+	0x35, 0x20, 0x4d, 0x61, 0x63, 0x72, 0x6f, 0x6d, 0x65, 0x64, 
+	0x69, 0x61, 0x2c, 0x20, 0x49, 0x6e, 0x63, 0x2e, 0x20, 0x41, 
+	0x6c, 0x6c, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 
+	0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2e, 0x20, 
+	0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x6d, 0x65, 0x74, 0x61, 
+	0x20, 0x68, 0x74, 0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 
+	0x76, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
+	0x2d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 
+	0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 
+	0x72, 0x73, 0x65, 0x74, 0x3d, 0x67, 0x62, 0x32, 0x33, 0x31, 
+	0x32, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x69, 
+	0x74, 0x6c, 0x65, 0x3e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x20, 
+	0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 
+	0x69, 0x6f, 0x6e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x3c, 
+	0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x3c, 
+	0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 
+	0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 
+	0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x73, 0x74, 
+	0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x20, 0x74, 
+	0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 
+	0x63, 0x73, 0x73, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 
+	0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x4a, 0x61, 
+	0x76, 0x61, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3e, 
+	0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0xd, 0xa, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x72, 
+	0x6c, 0x65, 0x6e, 0x28, 0x73, 0x74, 0x72, 0x29, 0x20, 0xd, 
+	0xa, 0x7b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x6c, 
+	0x65, 0x6e, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0xd, 0xa, 0x9, 
+	0x66, 0x6f, 0x72, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 
+	0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 
+	0x73, 0x74, 0x72, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 
+	0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0xd, 0xa, 0x9, 0x7b, 
+	0xd, 0xa, 0x9, 0x9, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 
+	0x72, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 
+	0x41, 0x74, 0x28, 0x69, 0x29, 0x20, 0x3e, 0x20, 0x32, 0x35, 
+	0x35, 0x29, 0x20, 0x6c, 0x65, 0x6e, 0x20, 0x2b, 0x3d, 0x20, 
+	0x32, 0x3b, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x6c, 0x65, 
+	0x6e, 0x20, 0x2b, 0x2b, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0xd, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x20, 0x6c, 0x65, 0x6e, 0x3b, 0xd, 0xa, 0x7d, 0xd, 
+	0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x73, 0x61, 0x76, 0x65, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 
+	0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x9, 0x69, 0x66, 
+	0x28, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x28, 0x27, 
+	0x41, 0x72, 0x65, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x73, 0x75, 
+	0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x61, 0x76, 0x65, 
+	0x3f, 0x5c, 0x6e, 0x27, 0x29, 0x29, 0xd, 0xa, 0x9, 0x7b, 
+	0xd, 0xa, 0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x9, 0x20, 0x20, 0xd, 
+	0xa, 0x9, 0x7d, 0x9, 0x20, 0x20, 0xd, 0xa, 0x9, 0x65, 
+	0x6c, 0x73, 0x65, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 
+	0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 
+	0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0x9, 0xd, 
+	0xa, 0x7d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x69, 0x73, 0x49, 0x70, 0x28, 0x73, 0x74, 
+	0x72, 0x29, 0xd, 0xa, 0x7b, 0x20, 0xd, 0xa, 0x9, 0x76, 
+	0x61, 0x72, 0x20, 0x73, 0x61, 0x3d, 0x73, 0x74, 0x72, 0x2e, 
+	0x73, 0x70, 0x6c, 0x69, 0x74, 0x28, 0x22, 0x2e, 0x22, 0x29, 
+	0x3b, 0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x73, 0x61, 0x2e, 
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x21, 0x3d, 0x34, 0x29, 
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 
+	0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x66, 0x6f, 0x72, 
+	0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 
+	0x3c, 0x73, 0x61, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 
+	0x3b, 0x69, 0x2b, 0x2b, 0x29, 0xd, 0xa, 0x9, 0x7b, 0x20, 
+	0xd, 0xa, 0x9, 0x9, 0x69, 0x66, 0x28, 0x21, 0x28, 0x2f, 
+	0x5e, 0x28, 0x5c, 0x64, 0x29, 0x2b, 0x24, 0x2f, 0x67, 0x29, 
+	0x2e, 0x74, 0x65, 0x73, 0x74, 0x28, 0x73, 0x61, 0x5b, 0x69, 
+	0x5d, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x73, 0x61, 0x5b, 
+	0x69, 0x5d, 0x3c, 0x30, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x28, 
+	0x73, 0x61, 0x5b, 0x69, 0x5d, 0x3e, 0x32, 0x35, 0x35, 0x29, 
+	0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 
+	0x61, 0x6c, 0x73, 0x65, 0x3b, 0x20, 0xd, 0xa, 0x9, 0x7d, 
+	0xd, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
+	0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x7d, 0x20, 0xd, 
+	0xa, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x31, 0x5f, 0x4d, 0x4d, 
+	0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 
+	0x29, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x5f, 0x76, 
+	0x61, 0x72, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 
+	0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 
+	0x45, 0x6e, 0x63, 0x72, 0x79, 0x22, 0x29, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x4b, 0x65, 0x79, 0x5f, 0x76, 0x61, 0x72, 
+	0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+	0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x4b, 0x65, 
+	0x79, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 
+	0xd, 0xa, 0x9, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x4b, 
+	0x65, 0x79, 0x54, 0x79, 0x70, 0x65, 0x5f, 0x76, 0x61, 0x72, 
+	0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+	0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x4b, 0x65, 
+	0x79, 0x54, 0x79, 0x70, 0x65, 0x22, 0x29, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x4d, 0x6f, 0x64, 0x65, 0x5f, 0x76, 0x61, 
+	0x72, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 
+	0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x4d, 
+	0x6f, 0x64, 0x65, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3b, 0x9, 0x20, 0x20, 0xd, 0xa, 0x9, 0x20, 0x20, 
+	0x69, 0x66, 0x28, 0x4d, 0x6f, 0x64, 0x65, 0x5f, 0x76, 0x61, 
+	0x72, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0xd, 0xa, 0x9, 
+	0x20, 0x20, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x69, 
+	0x66, 0x28, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x5f, 0x76, 0x61, 
+	0x72, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0xd, 0xa, 0x9, 
+	0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 
+	0x69, 0x66, 0x28, 0x4b, 0x65, 0x79, 0x54, 0x79, 0x70, 0x65, 
+	0x5f, 0x76, 0x61, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 
+	0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 
+	0x9, 0x9, 0x9, 0x9, 0x9, 0x69, 0x66, 0x28, 0x73, 0x74, 
+	0x72, 0x6c, 0x65, 0x6e, 0x28, 0x4b, 0x65, 0x79, 0x5f, 0x76, 
+	0x61, 0x72, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x31, 0x30, 0x29, 
+	0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x7b, 0xd, 0xa, 
+	0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x61, 0x6c, 0x65, 0x72, 
+	0x74, 0x28, 0x27, 0x49, 0x6e, 0x20, 0x57, 0x45, 0x50, 0x36, 
+	0x34, 0x20, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x4b, 0x65, 0x79, 
+	0x28, 0x48, 0x45, 0x58, 0x29, 0x20, 0x4c, 0x65, 0x6e, 0x67, 
+	0x74, 0x68, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 
+	0x62, 0x65, 0x20, 0x20, 0x31, 0x30, 0x20, 0x63, 0x68, 0x61, 
+	0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x21, 0x27, 0x29, 
+	0x3b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 
+	0x65, 0x3b, 0x9, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 
+	0x7d, 0x9, 0x20, 0x20, 0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 
+	0x20, 0x7d, 0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 0x65, 
+	0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x4b, 0x65, 0x79, 
+	0x54, 0x79, 0x70, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x20, 0x3d, 
+	0x3d, 0x20, 0x31, 0x29, 0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 
+	0x20, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 
 	0x69, 0x66, 0x28, 0x73, 0x74, 0x72, 0x6c, 0x65, 0x6e, 0x28, 
 	0x4b, 0x65, 0x79, 0x5f, 0x76, 0x61, 0x72, 0x29, 0x20, 0x21, 
-	0x3d, 0x20, 0x31, 0x30, 0x29, 0xd, 0xa, 0x9, 0x9, 0x9, 
+	0x3d, 0x20, 0x35, 0x29, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 
 	0x9, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 
-	0x9, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 0x49, 0x6e, 
-	0x20, 0x57, 0x45, 0x50, 0x36, 0x34, 0x20, 0x4d, 0x6f, 0x64, 
-	0x65, 0x20, 0x4b, 0x65, 0x79, 0x28, 0x48, 0x45, 0x58, 0x29, 
-	0x20, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x73, 0x68, 
-	0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x20, 0x31, 
-	0x30, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
-	0x72, 0x73, 0x21, 0x27, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x9, 
-	0x9, 0x9, 0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
-	0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x9, 0xd, 0xa, 
-	0x9, 0x9, 0x9, 0x9, 0x9, 0x7d, 0x9, 0x20, 0x20, 0xd, 
-	0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 0x7d, 0xd, 0xa, 0x9, 
-	0x9, 0x9, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 
-	0x66, 0x28, 0x4b, 0x65, 0x79, 0x54, 0x79, 0x70, 0x65, 0x5f, 
-	0x76, 0x61, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0xd, 
-	0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 0x9, 
-	0x9, 0x9, 0x9, 0x9, 0x9, 0x69, 0x66, 0x28, 0x73, 0x74, 
-	0x72, 0x6c, 0x65, 0x6e, 0x28, 0x4b, 0x65, 0x79, 0x5f, 0x76, 
-	0x61, 0x72, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x35, 0x29, 0xd, 
-	0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x7b, 0xd, 0xa, 
-	0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x61, 0x6c, 0x65, 
-	0x72, 0x74, 0x28, 0x27, 0x49, 0x6e, 0x20, 0x57, 0x45, 0x50, 
-	0x36, 0x34, 0x20, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x4b, 0x65, 
-	0x79, 0x28, 0x41, 0x53, 0x43, 0x49, 0x49, 0x29, 0x20, 0x4c, 
-	0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x73, 0x68, 0x6f, 0x75, 
-	0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x20, 0x35, 0x20, 0x63, 
-	0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x21, 
-	0x27, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 
-	0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 
-	0x61, 0x6c, 0x73, 0x65, 0x3b, 0x9, 0xd, 0xa, 0x9, 0x9, 
-	0x9, 0x9, 0x9, 0x9, 0x7d, 0x9, 0x20, 0x20, 0xd, 0xa, 
-	0x9, 0x9, 0x9, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x9, 0x9, 
-	0x7d, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x65, 0x6c, 0x73, 
-	0x65, 0x20, 0x69, 0x66, 0x28, 0x45, 0x6e, 0x63, 0x72, 0x79, 
-	0x5f, 0x76, 0x61, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x32, 0x29, 
-	0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 0x9, 
-	0x9, 0x9, 0x9, 0x69, 0x66, 0x28, 0x4b, 0x65, 0x79, 0x54, 
-	0x79, 0x70, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x20, 0x3d, 0x3d, 
-	0x20, 0x30, 0x29, 0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 
-	0x7b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x69, 0x66, 
-	0x28, 0x73, 0x74, 0x72, 0x6c, 0x65, 0x6e, 0x28, 0x4b, 0x65, 
-	0x79, 0x5f, 0x76, 0x61, 0x72, 0x29, 0x20, 0x21, 0x3d, 0x20, 
-	0x32, 0x36, 0x29, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 
-	0x7b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x61, 
-	0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 0x49, 0x6e, 0x20, 0x57, 
-	0x45, 0x50, 0x31, 0x32, 0x38, 0x20, 0x4d, 0x6f, 0x64, 0x65, 
-	0x20, 0x4b, 0x65, 0x79, 0x28, 0x48, 0x45, 0x58, 0x29, 0x20, 
-	0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x73, 0x68, 0x6f, 
-	0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x20, 0x32, 0x36, 
-	0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
-	0x73, 0x21, 0x27, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x9, 
-	0x9, 0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
-	0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 
-	0x9, 0x9, 0x9, 0x7d, 0x9, 0x9, 0x20, 0x20, 0xd, 0xa, 
-	0x9, 0x9, 0x9, 0x20, 0x20, 0x7d, 0xd, 0xa, 0x9, 0x9, 
-	0x9, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 
+	0x9, 0x9, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 0x49, 
+	0x6e, 0x20, 0x57, 0x45, 0x50, 0x36, 0x34, 0x20, 0x4d, 0x6f, 
+	0x64, 0x65, 0x20, 0x4b, 0x65, 0x79, 0x28, 0x41, 0x53, 0x43, 
+	0x49, 0x49, 0x29, 0x20, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 
+	0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 
+	0x20, 0x20, 0x35, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+	0x74, 0x65, 0x72, 0x73, 0x21, 0x27, 0x29, 0x3b, 0xd, 0xa, 
+	0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 
+	0x9, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x7d, 
+	0x9, 0x20, 0x20, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x7d, 
+	0xd, 0xa, 0x9, 0x9, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x9, 
+	0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 
+	0x45, 0x6e, 0x63, 0x72, 0x79, 0x5f, 0x76, 0x61, 0x72, 0x20, 
+	0x3d, 0x3d, 0x20, 0x32, 0x29, 0xd, 0xa, 0x9, 0x9, 0x20, 
+	0x20, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x69, 0x66, 
 	0x28, 0x4b, 0x65, 0x79, 0x54, 0x79, 0x70, 0x65, 0x5f, 0x76, 
-	0x61, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0xd, 0xa, 
+	0x61, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0xd, 0xa, 
 	0x9, 0x9, 0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 0x9, 0x9, 
-	0x9, 0x20, 0x20, 0x9, 0x69, 0x66, 0x28, 0x73, 0x74, 0x72, 
-	0x6c, 0x65, 0x6e, 0x28, 0x4b, 0x65, 0x79, 0x5f, 0x76, 0x61, 
-	0x72, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x31, 0x33, 0x29, 0xd, 
-	0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x7b, 0xd, 0xa, 0x9, 
-	0x9, 0x9, 0x9, 0x9, 0x9, 0x61, 0x6c, 0x65, 0x72, 0x74, 
-	0x28, 0x27, 0x49, 0x6e, 0x20, 0x57, 0x45, 0x50, 0x31, 0x32, 
-	0x38, 0x20, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x4b, 0x65, 0x79, 
-	0x28, 0x41, 0x53, 0x43, 0x49, 0x49, 0x29, 0x20, 0x4c, 0x65, 
-	0x6e, 0x67, 0x74, 0x68, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 
-	0x64, 0x20, 0x62, 0x65, 0x20, 0x20, 0x31, 0x33, 0x20, 0x63, 
-	0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x21, 
-	0x27, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 
-	0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 
-	0x6c, 0x73, 0x65, 0x3b, 0x9, 0x9, 0x20, 0xd, 0xa, 0x9, 
-	0x9, 0x9, 0x9, 0x9, 0x7d, 0x20, 0xd, 0xa, 0x9, 0x9, 
-	0x9, 0x20, 0x20, 0x7d, 0x9, 0x20, 0x20, 0x9, 0xd, 0xa, 
-	0x9, 0x9, 0x20, 0x20, 0x7d, 0xd, 0xa, 0x9, 0x20, 0x20, 
-	0x7d, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
-	0x75, 0x72, 0x6e, 0x20, 0x73, 0x61, 0x76, 0x65, 0x63, 0x6f, 
-	0x6e, 0x66, 0x69, 0x67, 0x28, 0x29, 0x3b, 0xd, 0xa, 0x7d, 
-	0xd, 0xa, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x33, 0x4d, 0x4d, 
-	0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 
-	0x29, 0x7b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x76, 0x61, 0x72, 
-	0x20, 0x50, 0x6f, 0x72, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x3d, 
-	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 
-	0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 
-	0x79, 0x49, 0x64, 0x28, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x22, 
-	0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 
-	0x9, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x41, 0x75, 0x74, 
-	0x6f, 0x5f, 0x6f, 0x62, 0x6a, 0x3d, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x41, 
-	0x75, 0x74, 0x6f, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 
-	0x64, 0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x69, 0x66, 0x28, 
-	0x41, 0x75, 0x74, 0x6f, 0x5f, 0x6f, 0x62, 0x6a, 0x3d, 0x3d, 
-	0x31, 0x29, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 
-	0x9, 0x20, 0x20, 0x69, 0x66, 0x28, 0x70, 0x61, 0x72, 0x73, 
-	0x65, 0x49, 0x6e, 0x74, 0x28, 0x50, 0x6f, 0x72, 0x74, 0x5f, 
-	0x76, 0x61, 0x72, 0x29, 0x3e, 0x36, 0x35, 0x35, 0x33, 0x36, 
-	0x7c, 0x7c, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6e, 0x74, 
-	0x28, 0x50, 0x6f, 0x72, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x29, 
-	0x3c, 0x31, 0x29, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7b, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74, 
-	0x28, 0x27, 0x50, 0x6f, 0x72, 0x74, 0x20, 0x4e, 0x75, 0x6d, 
-	0x62, 0x65, 0x72, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x21, 
-	0x27, 0x29, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 
-	0x61, 0x6c, 0x73, 0x65, 0x3b, 0x9, 0x20, 0x20, 0x20, 0xd, 
-	0xa, 0x9, 0x20, 0x20, 0x7d, 0x9, 0x20, 0x20, 0x20, 0xd, 
-	0xa, 0x9, 0x20, 0x20, 0x7d, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x9, 0x9, 0x9, 0x69, 0x66, 0x28, 0x73, 0x74, 0x72, 0x6c, 
+	0x65, 0x6e, 0x28, 0x4b, 0x65, 0x79, 0x5f, 0x76, 0x61, 0x72, 
+	0x29, 0x20, 0x21, 0x3d, 0x20, 0x32, 0x36, 0x29, 0xd, 0xa, 
+	0x9, 0x9, 0x9, 0x9, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 
+	0x9, 0x9, 0x9, 0x9, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 
+	0x27, 0x49, 0x6e, 0x20, 0x57, 0x45, 0x50, 0x31, 0x32, 0x38, 
+	0x20, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x4b, 0x65, 0x79, 0x28, 
+	0x48, 0x45, 0x58, 0x29, 0x20, 0x4c, 0x65, 0x6e, 0x67, 0x74, 
+	0x68, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 
+	0x65, 0x20, 0x20, 0x32, 0x36, 0x20, 0x63, 0x68, 0x61, 0x72, 
+	0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x21, 0x27, 0x29, 0x3b, 
+	0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 
+	0x3b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x7d, 0x9, 
+	0x9, 0x20, 0x20, 0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 
+	0x7d, 0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 0x65, 0x6c, 
+	0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x4b, 0x65, 0x79, 0x54, 
+	0x79, 0x70, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x20, 0x3d, 0x3d, 
+	0x20, 0x31, 0x29, 0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 
+	0x7b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 0x9, 0x69, 
+	0x66, 0x28, 0x73, 0x74, 0x72, 0x6c, 0x65, 0x6e, 0x28, 0x4b, 
+	0x65, 0x79, 0x5f, 0x76, 0x61, 0x72, 0x29, 0x20, 0x21, 0x3d, 
+	0x20, 0x31, 0x33, 0x29, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 
+	0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 
+	0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 0x49, 0x6e, 0x20, 
+	0x57, 0x45, 0x50, 0x31, 0x32, 0x38, 0x20, 0x4d, 0x6f, 0x64, 
+	0x65, 0x20, 0x4b, 0x65, 0x79, 0x28, 0x41, 0x53, 0x43, 0x49, 
+	0x49, 0x29, 0x20, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 
+	0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 
+	0x20, 0x31, 0x33, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+	0x74, 0x65, 0x72, 0x73, 0x21, 0x27, 0x29, 0x3b, 0xd, 0xa, 
+	0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 
+	0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x9, 
+	0x9, 0x20, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x7d, 
+	0x20, 0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 0x7d, 0x9, 
+	0x20, 0x20, 0x9, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x7d, 
+	0xd, 0xa, 0x9, 0x20, 0x20, 0x7d, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 
 	0x61, 0x76, 0x65, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28, 
 	0x29, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x66, 
-	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x4d, 0x4d, 
-	0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 
-	0x29, 0x20, 0x7b, 0x20, 0x2f, 0x2f, 0x76, 0x31, 0x2e, 0x30, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
-	0x72, 0x20, 0x49, 0x50, 0x5f, 0x76, 0x61, 0x72, 0x3d, 0x64, 
-	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 
-	0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 
-	0x49, 0x64, 0x28, 0x22, 0x49, 0x70, 0x22, 0x29, 0x2e, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x53, 0x75, 0x62, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x46, 0x6f, 
+	0x72, 0x6d, 0x33, 0x4d, 0x4d, 0x5f, 0x70, 0x6f, 0x70, 0x75, 
+	0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 0x7b, 0xd, 0xa, 0x9, 
+	0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x50, 0x6f, 0x72, 0x74, 
 	0x5f, 0x76, 0x61, 0x72, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
 	0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 
 	0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 
-	0x53, 0x75, 0x62, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 
-	0x65, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x76, 0x61, 0x72, 0x20, 0x47, 0x61, 0x74, 0x65, 0x5f, 0x76, 
-	0x61, 0x72, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
-	0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x47, 0x61, 
-	0x74, 0x65, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
-	0x61, 0x72, 0x20, 0x44, 0x6e, 0x73, 0x5f, 0x76, 0x61, 0x72, 
+	0x50, 0x6f, 0x72, 0x74, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x76, 0x61, 
+	0x72, 0x20, 0x41, 0x75, 0x74, 0x6f, 0x5f, 0x6f, 0x62, 0x6a, 
 	0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
-	0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 
-	0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x44, 0x6e, 0x73, 0x22, 
-	0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 
+	0x61, 0x6c, 0x6c, 0x2e, 0x41, 0x75, 0x74, 0x6f, 0x2e, 0x63, 
+	0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3b, 0xd, 0xa, 0x9, 
+	0x20, 0x20, 0x69, 0x66, 0x28, 0x41, 0x75, 0x74, 0x6f, 0x5f, 
+	0x6f, 0x62, 0x6a, 0x3d, 0x3d, 0x31, 0x29, 0xd, 0xa, 0x9, 
+	0x20, 0x20, 0x7b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x69, 0x66, 
+	0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6e, 0x74, 0x28, 
+	0x50, 0x6f, 0x72, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x29, 0x3e, 
+	0x36, 0x35, 0x35, 0x33, 0x36, 0x7c, 0x7c, 0x70, 0x61, 0x72, 
+	0x73, 0x65, 0x49, 0x6e, 0x74, 0x28, 0x50, 0x6f, 0x72, 0x74, 
+	0x5f, 0x76, 0x61, 0x72, 0x29, 0x3c, 0x31, 0x29, 0xd, 0xa, 
+	0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 0x50, 0x6f, 0x72, 
+	0x74, 0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x45, 
+	0x72, 0x72, 0x6f, 0x72, 0x21, 0x27, 0x29, 0x3b, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 
+	0x9, 0x20, 0x20, 0x20, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7d, 
+	0x9, 0x20, 0x20, 0x20, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7d, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x20, 0x73, 0x61, 0x76, 0x65, 0x63, 0x6f, 
+	0x6e, 0x66, 0x69, 0x67, 0x28, 0x29, 0x3b, 0xd, 0xa, 0x7d, 
+	0xd, 0xa, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x4d, 0x4d, 0x5f, 0x70, 0x6f, 0x70, 0x75, 
+	0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 0x20, 0x7b, 0x20, 0x2f, 
+	0x2f, 0x76, 0x31, 0x2e, 0x30, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x49, 0x50, 0x5f, 
+	0x76, 0x61, 0x72, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 
+	0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x49, 
+	0x70, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
+	0x72, 0x20, 0x53, 0x75, 0x62, 0x5f, 0x76, 0x61, 0x72, 0x3d, 
+	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 
+	0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 
+	0x79, 0x49, 0x64, 0x28, 0x22, 0x53, 0x75, 0x62, 0x22, 0x29, 
+	0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x47, 
+	0x61, 0x74, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x3d, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
+	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
+	0x64, 0x28, 0x22, 0x47, 0x61, 0x74, 0x65, 0x22, 0x29, 0x2e, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x44, 0x6e, 
+	0x73, 0x5f, 0x76, 0x61, 0x72, 0x3d, 0x64, 0x6f, 0x63, 0x75, 
+	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 
+	0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 
+	0x22, 0x44, 0x6e, 0x73, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x69, 0x66, 
+	0x28, 0x21, 0x69, 0x73, 0x49, 0x70, 0x28, 0x49, 0x50, 0x5f, 
+	0x76, 0x61, 0x72, 0x29, 0x29, 0xd, 0xa, 0x9, 0x20, 0x20, 
+	0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6c, 0x65, 
+	0x72, 0x74, 0x28, 0x27, 0x46, 0x69, 0x78, 0x65, 0x64, 0x20, 
+	0x49, 0x50, 0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 
+	0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x21, 0x27, 0x29, 0x3b, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 
+	0x65, 0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7d, 0xd, 0xa, 
 	0x9, 0x20, 0x20, 0x69, 0x66, 0x28, 0x21, 0x69, 0x73, 0x49, 
-	0x70, 0x28, 0x49, 0x50, 0x5f, 0x76, 0x61, 0x72, 0x29, 0x29, 
-	0xd, 0xa, 0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 0x20, 0x20, 
+	0x70, 0x28, 0x53, 0x75, 0x62, 0x5f, 0x76, 0x61, 0x72, 0x29, 
+	0x29, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 
+	0x53, 0x75, 0x62, 0x6e, 0x65, 0x74, 0x20, 0x6d, 0x61, 0x73, 
+	0x6b, 0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 
+	0x45, 0x72, 0x72, 0x6f, 0x72, 0x21, 0x27, 0x29, 0x3b, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 
+	0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7d, 0x9, 0x20, 0x20, 
+	0x69, 0x66, 0x28, 0x21, 0x69, 0x73, 0x49, 0x70, 0x28, 0x47, 
+	0x61, 0x74, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x29, 0x29, 0xd, 
+	0xa, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 0x46, 
-	0x69, 0x78, 0x65, 0x64, 0x20, 0x49, 0x50, 0x20, 0x41, 0x64, 
+	0x20, 0x20, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 
+	0x47, 0x61, 0x74, 0x65, 0x77, 0x61, 0x79, 0x20, 0x41, 0x64, 
 	0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x45, 0x72, 0x72, 0x6f, 
 	0x72, 0x21, 0x27, 0x29, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
 	0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 
-	0x20, 0x20, 0x7d, 0xd, 0xa, 0x9, 0x20, 0x20, 0x69, 0x66, 
-	0x28, 0x21, 0x69, 0x73, 0x49, 0x70, 0x28, 0x53, 0x75, 0x62, 
-	0x5f, 0x76, 0x61, 0x72, 0x29, 0x29, 0xd, 0xa, 0x9, 0x20, 
-	0x20, 0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6c, 
-	0x65, 0x72, 0x74, 0x28, 0x27, 0x53, 0x75, 0x62, 0x6e, 0x65, 
-	0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x41, 0x64, 0x64, 
-	0x72, 0x65, 0x73, 0x73, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 
-	0x21, 0x27, 0x29, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
-	0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x20, 
-	0x20, 0x7d, 0x9, 0x20, 0x20, 0x69, 0x66, 0x28, 0x21, 0x69, 
-	0x73, 0x49, 0x70, 0x28, 0x47, 0x61, 0x74, 0x65, 0x5f, 0x76, 
+	0x20, 0x20, 0x7d, 0x9, 0x20, 0x20, 0x69, 0x66, 0x28, 0x21, 
+	0x69, 0x73, 0x49, 0x70, 0x28, 0x44, 0x6e, 0x73, 0x5f, 0x76, 
 	0x61, 0x72, 0x29, 0x29, 0xd, 0xa, 0xd, 0xa, 0x9, 0x20, 
 	0x20, 0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6c, 
-	0x65, 0x72, 0x74, 0x28, 0x27, 0x47, 0x61, 0x74, 0x65, 0x77, 
-	0x61, 0x79, 0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 
-	0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x21, 0x27, 0x29, 0x3b, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
-	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 
-	0x65, 0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7d, 0x9, 0x20, 
-	0x20, 0x69, 0x66, 0x28, 0x21, 0x69, 0x73, 0x49, 0x70, 0x28, 
-	0x44, 0x6e, 0x73, 0x5f, 0x76, 0x61, 0x72, 0x29, 0x29, 0xd, 
-	0xa, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7b, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 
-	0x44, 0x4e, 0x53, 0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 
-	0x73, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x21, 0x27, 0x29, 
-	0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x65, 0x72, 0x74, 0x28, 0x27, 0x44, 0x4e, 0x53, 0x20, 0x41, 
+	0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x45, 0x72, 0x72, 
+	0x6f, 0x72, 0x21, 0x27, 0x29, 0x3b, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 
-	0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x7d, 0x9, 
-	0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x61, 0x76, 
-	0x65, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28, 0x29, 0x3b, 
-	0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2f, 0x2d, 
-	0x2d, 0x3e, 0xd, 0xa, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x68, 0x63, 0x70, 0x31, 
-	0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x9, 0x76, 0x61, 
-	0x72, 0x20, 0x6f, 0x62, 0x6a, 0x3d, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 
-	0x68, 0x63, 0x70, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 
-	0x64, 0x3b, 0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x6f, 0x62, 
-	0x6a, 0x29, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 
-	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
-	0x6c, 0x6c, 0x2e, 0x49, 0x70, 0x2e, 0x64, 0x69, 0x73, 0x61, 
-	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 
-	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
-	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x53, 0x75, 0x62, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 
+	0x9, 0x20, 0x20, 0x7d, 0x9, 0x20, 0x20, 0x20, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x20, 0x73, 0x61, 0x76, 0x65, 0x63, 0x6f, 0x6e, 0x66, 
+	0x69, 0x67, 0x28, 0x29, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 
+	0xd, 0xa, 0x2f, 0x2f, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0xd, 
+	0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x64, 0x68, 0x63, 0x70, 0x31, 0x28, 0x29, 0xd, 0xa, 0x7b, 
+	0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x62, 0x6a, 
+	0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x68, 0x63, 0x70, 0x2e, 0x63, 
+	0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3b, 0xd, 0xa, 0x9, 
+	0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 0x29, 0xd, 0xa, 0x9, 
+	0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x49, 0x70, 
 	0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 
 	0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 
 	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
-	0x6c, 0x2e, 0x47, 0x61, 0x74, 0x65, 0x2e, 0x64, 0x69, 0x73, 
+	0x6c, 0x2e, 0x53, 0x75, 0x62, 0x2e, 0x64, 0x69, 0x73, 0x61, 
+	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 
+	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x47, 0x61, 0x74, 
+	0x65, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
+	0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 
+	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
+	0x6c, 0x6c, 0x2e, 0x44, 0x6e, 0x73, 0x2e, 0x64, 0x69, 0x73, 
 	0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 
+	0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 
+	0x73, 0x65, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 
+	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
+	0x6c, 0x6c, 0x2e, 0x49, 0x70, 0x2e, 0x64, 0x69, 0x73, 0x61, 
+	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 
 	0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
-	0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x6e, 
-	0x73, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
-	0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x7d, 
-	0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xd, 0xa, 0x9, 
-	0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
-	0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x49, 0x70, 
+	0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x53, 0x75, 
+	0x62, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
+	0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 
+	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x61, 0x6c, 0x6c, 0x2e, 0x47, 0x61, 0x74, 0x65, 0x2e, 0x64, 
+	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 
+	0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 
+	0x2e, 0x44, 0x6e, 0x73, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
+	0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 
+	0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6b, 0x65, 
+	0x79, 0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x9, 0x76, 
+	0x61, 0x72, 0x20, 0x6f, 0x62, 0x6a, 0x45, 0x6e, 0x63, 0x72, 
+	0x79, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 
+	0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x45, 
+	0x6e, 0x63, 0x72, 0x79, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3b, 0x9, 0xd, 0xa, 0x20, 0x20, 0x69, 0x66, 
+	0x28, 0x6f, 0x62, 0x6a, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x20, 
+	0x3d, 0x3d, 0x20, 0x30, 0x29, 0x9, 0x2f, 0x2f, 0x6f, 0x70, 
+	0x65, 0x6e, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 
+	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
+	0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x54, 0x79, 0x70, 0x65, 
 	0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 
-	0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 
+	0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 
+	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
+	0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 
+	0x31, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
+	0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 
 	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
-	0x6c, 0x6c, 0x2e, 0x53, 0x75, 0x62, 0x2e, 0x64, 0x69, 0x73, 
-	0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 
-	0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x47, 
-	0x61, 0x74, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
-	0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 
+	0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 
+	0x78, 0x32, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
+	0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 
+	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 
+	0x65, 0x78, 0x33, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+	0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 
+	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 
+	0x64, 0x65, 0x78, 0x34, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
+	0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 
 	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x6e, 0x73, 0x2e, 
-	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 
-	0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 
-	0xa, 0x7d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x6b, 0x65, 0x79, 0x28, 0x29, 0xd, 0xa, 
-	0x7b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x62, 
-	0x6a, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x20, 0x3d, 0x20, 0x64, 
-	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 
-	0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 
-	0x49, 0x64, 0x28, 0x22, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x22, 
-	0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x9, 0xd, 
-	0xa, 0x20, 0x20, 0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 0x45, 
-	0x6e, 0x63, 0x72, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 
-	0x9, 0x2f, 0x2f, 0x6f, 0x70, 0x65, 0x6e, 0xd, 0xa, 0x9, 
-	0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x2e, 
+	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 
+	0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 
+	0x9, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x6f, 
+	0x62, 0x6a, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x20, 0x3d, 0x3d, 
+	0x20, 0x31, 0x20, 0x7c, 0x7c, 0x20, 0x6f, 0x62, 0x6a, 0x45, 
+	0x6e, 0x63, 0x72, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x32, 0x29, 
+	0x9, 0x2f, 0x2f, 0x77, 0x65, 0x62, 0x36, 0x34, 0x20, 0x77, 
+	0x65, 0x62, 0x31, 0x32, 0x38, 0xd, 0xa, 0x9, 0x7b, 0xd, 
+	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x54, 
+	0x79, 0x70, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+	0x65, 0x64, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 
+	0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
 	0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 
-	0x79, 0x54, 0x79, 0x70, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x61, 
-	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 
+	0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x2e, 0x64, 0x69, 
+	0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 
+	0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 
+	0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x32, 0x2e, 
+	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 
+	0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 
+	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
+	0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 
+	0x33, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
+	0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 
+	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 
+	0x65, 0x78, 0x34, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+	0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 
+	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x2e, 
+	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x3d, 
+	0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 
+	0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0x9, 0x2f, 
+	0x2f, 0x6f, 0x74, 0x68, 0x65, 0x72, 0xd, 0xa, 0x9, 0x7b, 
+	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 
+	0x54, 0x79, 0x70, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
+	0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 
 	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
 	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 
 	0x49, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x2e, 0x64, 0x69, 0x73, 
@@ -1949,939 +2017,912 @@ static const unsigned char data_basic_html[] = {
 	0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 
 	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 
 	0x2e, 0x4b, 0x65, 0x79, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
-	0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 
-	0x20, 0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 0x45, 0x6e, 0x63, 
-	0x72, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x20, 0x7c, 0x7c, 
-	0x20, 0x6f, 0x62, 0x6a, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x20, 
-	0x3d, 0x3d, 0x20, 0x32, 0x29, 0x9, 0x2f, 0x2f, 0x77, 0x65, 
-	0x62, 0x36, 0x34, 0x20, 0x77, 0x65, 0x62, 0x31, 0x32, 0x38, 
-	0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 
-	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 
-	0x2e, 0x4b, 0x65, 0x79, 0x54, 0x79, 0x70, 0x65, 0x2e, 0x64, 
-	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x3d, 0x20, 
-	0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 
-	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
-	0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 
-	0x78, 0x31, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
-	0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 
-	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
-	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 
-	0x64, 0x65, 0x78, 0x32, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
 	0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 
-	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
-	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 
-	0x49, 0x6e, 0x64, 0x65, 0x78, 0x33, 0x2e, 0x64, 0x69, 0x73, 
-	0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 
-	0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 
-	0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x34, 0x2e, 0x64, 
-	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 
-	0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 
+	0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 
+	0x45, 0x6e, 0x63, 0x72, 0x79, 0x4f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x73, 0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x9, 
+	0x76, 0x61, 0x72, 0x20, 0x6f, 0x62, 0x6a, 0x3d, 0x64, 0x6f, 
 	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 
-	0x2e, 0x4b, 0x65, 0x79, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
-	0x6c, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 
-	0x65, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 
-	0x6c, 0x73, 0x65, 0x9, 0x2f, 0x2f, 0x6f, 0x74, 0x68, 0x65, 
-	0x72, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 
-	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
-	0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x54, 0x79, 0x70, 0x65, 0x2e, 
-	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 
-	0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 
-	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
-	0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 
-	0x31, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
-	0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 
-	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
-	0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 
-	0x78, 0x32, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
-	0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 
-	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
-	0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 
-	0x65, 0x78, 0x33, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
-	0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 
-	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
-	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 
-	0x64, 0x65, 0x78, 0x34, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
-	0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x2e, 
-	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 
-	0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 
-	0xa, 0x7d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x72, 0x65, 0x45, 0x6e, 0x63, 0x72, 0x79, 
-	0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x28, 0x29, 0xd, 
-	0xa, 0x7b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x6f, 
-	0x62, 0x6a, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4d, 0x6f, 0x64, 0x65, 
-	0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 
-	0x76, 0x61, 0x72, 0x20, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x53, 
-	0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 
-	0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 
-	0x22, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x22, 0x29, 0x3b, 0xd, 
-	0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x62, 0x6d, 0x3d, 0x6e, 
-	0x65, 0x77, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x29, 
-	0x3b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x6c, 0x65, 
-	0x6e, 0x20, 0x3d, 0x20, 0x32, 0x3b, 0xd, 0xa, 0x9, 0x45, 
+	0x2e, 0x4d, 0x6f, 0x64, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x45, 
 	0x6e, 0x63, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x6c, 
-	0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x30, 0x3b, 
-	0xd, 0xa, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 
-	0x5b, 0x30, 0x5d, 0x3d, 0x22, 0x30, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x5d, 
-	0x3d, 0x22, 0x44, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x22, 
-	0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 
-	0x5b, 0x32, 0x5d, 0x3d, 0x22, 0x31, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 0x5d, 
-	0x3d, 0x22, 0x57, 0x45, 0x50, 0x36, 0x34, 0x22, 0x3b, 0x20, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x34, 
-	0x5d, 0x3d, 0x22, 0x32, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x35, 0x5d, 0x3d, 0x22, 
-	0x57, 0x45, 0x50, 0x31, 0x32, 0x38, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x36, 0x5d, 
-	0x3d, 0x22, 0x33, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x62, 0x6d, 0x5b, 0x37, 0x5d, 0x3d, 0x22, 0x57, 
-	0x50, 0x41, 0x2d, 0x50, 0x53, 0x4b, 0x28, 0x54, 0x4b, 0x49, 
-	0x50, 0x29, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x62, 0x6d, 0x5b, 0x38, 0x5d, 0x3d, 0x22, 0x34, 0x22, 
+	0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 
+	0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x45, 0x6e, 0x63, 0x72, 
+	0x79, 0x22, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 
+	0x20, 0x62, 0x6d, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x41, 0x72, 
+	0x72, 0x61, 0x79, 0x28, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x76, 
+	0x61, 0x72, 0x20, 0x6c, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x32, 
+	0x3b, 0xd, 0xa, 0x9, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x53, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 
+	0x20, 0x3d, 0x20, 0x30, 0x3b, 0xd, 0xa, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x30, 0x5d, 0x3d, 0x22, 
+	0x30, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x31, 0x5d, 0x3d, 0x22, 0x44, 0x69, 0x73, 
+	0x61, 0x62, 0x6c, 0x65, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 0x5d, 0x3d, 0x22, 
+	0x31, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x33, 0x5d, 0x3d, 0x22, 0x57, 0x45, 0x50, 
+	0x36, 0x34, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x6d, 0x5b, 0x34, 0x5d, 0x3d, 0x22, 0x32, 0x22, 
 	0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 
-	0x5b, 0x39, 0x5d, 0x3d, 0x22, 0x57, 0x50, 0x41, 0x2d, 0x50, 
-	0x53, 0x4b, 0x28, 0x43, 0x43, 0x4d, 0x50, 0x29, 0x22, 0x3b, 
+	0x5b, 0x35, 0x5d, 0x3d, 0x22, 0x57, 0x45, 0x50, 0x31, 0x32, 
+	0x38, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x36, 0x5d, 0x3d, 0x22, 0x33, 0x22, 0x3b, 
 	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 
-	0x31, 0x30, 0x5d, 0x3d, 0x22, 0x35, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x31, 
-	0x5d, 0x3d, 0x22, 0x57, 0x50, 0x41, 0x32, 0x2d, 0x50, 0x53, 
+	0x37, 0x5d, 0x3d, 0x22, 0x57, 0x50, 0x41, 0x2d, 0x50, 0x53, 
 	0x4b, 0x28, 0x54, 0x4b, 0x49, 0x50, 0x29, 0x22, 0x3b, 0x20, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 
-	0x32, 0x5d, 0x3d, 0x22, 0x36, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x33, 0x5d, 
-	0x3d, 0x22, 0x57, 0x50, 0x41, 0x32, 0x5f, 0x50, 0x53, 0x4b, 
-	0x28, 0x43, 0x43, 0x4d, 0x50, 0x29, 0x22, 0x3b, 0x20, 0xd, 
-	0xa, 0x9, 0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 0x3d, 0x3d, 
-	0x30, 0x29, 0xd, 0xa, 0x9, 0x7b, 0x9, 0xd, 0xa, 0x9, 
-	0x9, 0x6c, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x32, 0x3b, 0xd, 
-	0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 
-	0x20, 0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 0x20, 0x3d, 0x3d, 
-	0x20, 0x31, 0x29, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 
-	0x9, 0x6c, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x36, 0x3b, 0xd, 
-	0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 
-	0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x6c, 0x65, 
-	0x6e, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x3b, 0xd, 0xa, 0x9, 
-	0x7d, 0xd, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x28, 0x78, 0x3d, 
-	0x30, 0x3b, 0x78, 0x3c, 0x6c, 0x65, 0x6e, 0x3b, 0x78, 0x3d, 
-	0x78, 0x2b, 0x32, 0x29, 0xd, 0xa, 0x20, 0x20, 0x7b, 0xd, 
-	0xa, 0x9, 0x9, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 
-	0x20, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x62, 0x6d, 
-	0x5b, 0x78, 0x2b, 0x31, 0x5d, 0x2c, 0x62, 0x6d, 0x5b, 0x78, 
-	0x5d, 0x29, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 
-	0x63, 0x74, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
-	0x2e, 0x61, 0x64, 0x64, 0x28, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0x9, 0xd, 0xa, 
-	0x7d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x28, 0x29, 0xd, 0xa, 
-	0x7b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x62, 
-	0x6a, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
-	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4d, 0x6f, 0x64, 0x65, 0x2e, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x72, 
-	0x65, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x4f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x73, 0x28, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x69, 
-	0x66, 0x28, 0x6f, 0x62, 0x6a, 0x3d, 0x3d, 0x30, 0x29, 0x9, 
-	0x2f, 0x2f, 0x20, 0x73, 0x74, 0x61, 0xd, 0xa, 0x9, 0x7b, 
-	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
-	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x45, 0x6e, 0x63, 
-	0x72, 0x79, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
-	0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 
-	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
-	0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x54, 0x79, 0x70, 
-	0x65, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
-	0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 
-	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
-	0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 
-	0x78, 0x31, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
-	0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 
-	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
-	0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 
-	0x65, 0x78, 0x32, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
-	0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 
-	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
-	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 
-	0x64, 0x65, 0x78, 0x33, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
-	0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x49, 
-	0x6e, 0x64, 0x65, 0x78, 0x34, 0x2e, 0x64, 0x69, 0x73, 0x61, 
-	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 
-	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
-	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 0x79, 
-	0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 
-	0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x7d, 
-	0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0x9, 0x2f, 0x2f, 
-	0x20, 0x61, 0x70, 0x20, 0x61, 0x64, 0x68, 0x6f, 0x63, 0xd, 
-	0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x38, 
+	0x5d, 0x3d, 0x22, 0x34, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x39, 0x5d, 0x3d, 0x22, 
+	0x57, 0x50, 0x41, 0x2d, 0x50, 0x53, 0x4b, 0x28, 0x43, 0x43, 
+	0x4d, 0x50, 0x29, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x30, 0x5d, 0x3d, 0x22, 
+	0x35, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6d, 0x5b, 0x31, 0x31, 0x5d, 0x3d, 0x22, 0x57, 0x50, 
+	0x41, 0x32, 0x2d, 0x50, 0x53, 0x4b, 0x28, 0x54, 0x4b, 0x49, 
+	0x50, 0x29, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x6d, 0x5b, 0x31, 0x32, 0x5d, 0x3d, 0x22, 0x36, 
+	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x6d, 0x5b, 0x31, 0x33, 0x5d, 0x3d, 0x22, 0x57, 0x50, 0x41, 
+	0x32, 0x5f, 0x50, 0x53, 0x4b, 0x28, 0x43, 0x43, 0x4d, 0x50, 
+	0x29, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 
+	0x6f, 0x62, 0x6a, 0x3d, 0x3d, 0x30, 0x29, 0xd, 0xa, 0x9, 
+	0x7b, 0x9, 0xd, 0xa, 0x9, 0x9, 0x6c, 0x65, 0x6e, 0x20, 
+	0x3d, 0x20, 0x32, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 
+	0x9, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x6f, 
+	0x62, 0x6a, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0xd, 0xa, 
+	0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x6c, 0x65, 0x6e, 0x20, 
+	0x3d, 0x20, 0x36, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 
+	0x9, 0x65, 0x6c, 0x73, 0x65, 0xd, 0xa, 0x9, 0x7b, 0xd, 
+	0xa, 0x9, 0x9, 0x6c, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x31, 
+	0x34, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x66, 
+	0x6f, 0x72, 0x28, 0x78, 0x3d, 0x30, 0x3b, 0x78, 0x3c, 0x6c, 
+	0x65, 0x6e, 0x3b, 0x78, 0x3d, 0x78, 0x2b, 0x32, 0x29, 0xd, 
+	0xa, 0x20, 0x20, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x4f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x28, 0x62, 0x6d, 0x5b, 0x78, 0x2b, 0x31, 0x5d, 
+	0x2c, 0x62, 0x6d, 0x5b, 0x78, 0x5d, 0x29, 0x3b, 0x20, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x6e, 0x63, 0x72, 
+	0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x28, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0xd, 0xa, 
+	0x9, 0x7d, 0x9, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x6f, 0x64, 
+	0x65, 0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x9, 0x76, 
+	0x61, 0x72, 0x20, 0x6f, 0x62, 0x6a, 0x3d, 0x64, 0x6f, 0x63, 
 	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 
-	0x45, 0x6e, 0x63, 0x72, 0x79, 0x2e, 0x64, 0x69, 0x73, 0x61, 
-	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 
-	0x3b, 0xd, 0xa, 0x9, 0x9, 0x6b, 0x65, 0x79, 0x28, 0x29, 
-	0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x69, 0x66, 
-	0x28, 0x6f, 0x62, 0x6a, 0x3d, 0x3d, 0x32, 0x29, 0xd, 0xa, 
-	0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 
-	0x68, 0x63, 0x70, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 
-	0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 
-	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
-	0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x68, 0x63, 0x70, 0x2e, 0x64, 
+	0x4d, 0x6f, 0x64, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3b, 0xd, 0xa, 0x9, 0x72, 0x65, 0x45, 0x6e, 0x63, 0x72, 
+	0x79, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x28, 0x29, 
+	0x3b, 0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 
+	0x3d, 0x3d, 0x30, 0x29, 0x9, 0x2f, 0x2f, 0x20, 0x73, 0x74, 
+	0x61, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 
+	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
+	0x6c, 0x2e, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x2e, 0x64, 0x69, 
+	0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 
+	0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
+	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 
+	0x65, 0x79, 0x54, 0x79, 0x70, 0x65, 0x2e, 0x64, 0x69, 0x73, 
+	0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 
+	0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 0x65, 
+	0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x2e, 0x64, 0x69, 
+	0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 
+	0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
+	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x4b, 
+	0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x32, 0x2e, 0x64, 
 	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 
 	0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 
 	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 
-	0x47, 0x61, 0x74, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
-	0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x6e, 0x73, 0x2e, 
+	0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x33, 0x2e, 
 	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 
 	0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 
 	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 
-	0x2e, 0x49, 0x70, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
-	0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x53, 0x75, 0x62, 0x2e, 
-	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 
-	0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 
+	0x2e, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x34, 
+	0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 
+	0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 
 	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
-	0x6c, 0x2e, 0x44, 0x6e, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x2e, 
-	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 
-	0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 
-	0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xd, 0xa, 0x9, 0x7b, 
+	0x6c, 0x2e, 0x4b, 0x65, 0x79, 0x2e, 0x64, 0x69, 0x73, 0x61, 
+	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 
+	0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 
+	0x73, 0x65, 0x9, 0x2f, 0x2f, 0x20, 0x61, 0x70, 0x20, 0x61, 
+	0x64, 0x68, 0x6f, 0x63, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 
+	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x45, 0x6e, 0x63, 0x72, 0x79, 
+	0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 
+	0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 
+	0x6b, 0x65, 0x79, 0x28, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x7d, 
+	0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 0x3d, 
+	0x3d, 0x32, 0x29, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 
+	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x68, 0x63, 0x70, 0x2e, 0x63, 
+	0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 
+	0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
+	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 
+	0x68, 0x63, 0x70, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+	0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 
+	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x47, 0x61, 0x74, 0x65, 0x2e, 
+	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 
+	0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 
+	0x2e, 0x44, 0x6e, 0x73, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
+	0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 
+	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x49, 0x70, 0x2e, 0x64, 
+	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 
+	0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 
+	0x2e, 0x53, 0x75, 0x62, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
+	0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 
 	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
 	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x6e, 0x73, 
 	0x4e, 0x61, 0x6d, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
-	0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x68, 0x63, 0x70, 
-	0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 
-	0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 
-	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
-	0x6c, 0x6c, 0x2e, 0x47, 0x61, 0x74, 0x65, 0x2e, 0x64, 0x69, 
+	0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 
+	0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 
+	0x65, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 
+	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
+	0x6c, 0x2e, 0x44, 0x6e, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x2e, 
+	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 
+	0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 
+	0x2e, 0x44, 0x68, 0x63, 0x70, 0x2e, 0x64, 0x69, 0x73, 0x61, 
+	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 
+	0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x47, 0x61, 
+	0x74, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
+	0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 
+	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x6e, 0x73, 0x2e, 0x64, 
+	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 
+	0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x68, 
+	0x63, 0x70, 0x31, 0x28, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x7d, 
+	0x9, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x28, 
+	0x29, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 
+	0x20, 0x6f, 0x62, 0x6a, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x41, 0x75, 
+	0x74, 0x6f, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 
+	0x3b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x43, 0x73, 
+	0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x64, 0x6f, 0x63, 
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 
+	0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 
+	0x28, 0x22, 0x43, 0x73, 0x22, 0x29, 0x3b, 0xd, 0xa, 0x9, 
+	0x76, 0x61, 0x72, 0x20, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 
+	0x6f, 0x6c, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x64, 
+	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 
+	0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 
+	0x49, 0x64, 0x28, 0x22, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 
+	0x6f, 0x6c, 0x22, 0x29, 0x3b, 0x9, 0xd, 0xa, 0x9, 0x76, 
+	0x61, 0x72, 0x20, 0x62, 0x6d, 0x3d, 0x6e, 0x65, 0x77, 0x20, 
+	0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x29, 0x3b, 0xd, 0xa, 
+	0x9, 0x76, 0x61, 0x72, 0x20, 0x62, 0x6d, 0x32, 0x3d, 0x6e, 
+	0x65, 0x77, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x29, 
+	0x3b, 0xd, 0xa, 0x9, 0x43, 0x73, 0x53, 0x65, 0x6c, 0x65, 
+	0x63, 0x74, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+	0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x20, 
+	0x30, 0x3b, 0xd, 0xa, 0x9, 0x50, 0x72, 0x6f, 0x74, 0x6f, 
+	0x63, 0x6f, 0x6c, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x6c, 0x65, 
+	0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x30, 0x5d, 
+	0x3d, 0x22, 0x30, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x62, 0x6d, 0x5b, 0x31, 0x5d, 0x3d, 0x22, 0x43, 
+	0x4c, 0x49, 0x45, 0x4e, 0x54, 0x22, 0x3b, 0x20, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x32, 0x5d, 0x3d, 
+	0x22, 0x31, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x6d, 0x5b, 0x33, 0x5d, 0x3d, 0x22, 0x53, 0x45, 
+	0x52, 0x56, 0x45, 0x52, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x62, 0x6d, 0x32, 0x5b, 0x30, 0x5d, 0x3d, 
+	0x22, 0x30, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x6d, 0x32, 0x5b, 0x31, 0x5d, 0x3d, 0x22, 0x54, 
+	0x43, 0x50, 0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x6d, 0x32, 0x5b, 0x32, 0x5d, 0x3d, 0x22, 0x31, 
+	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x6d, 0x32, 0x5b, 0x33, 0x5d, 0x3d, 0x22, 0x55, 0x44, 0x50, 
+	0x22, 0x3b, 0x20, 0x9, 0x9, 0xd, 0xa, 0x9, 0xd, 0xa, 
+	0x9, 0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 0x29, 0xd, 0xa, 
+	0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
+	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x50, 
+	0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x2e, 0x64, 0x69, 
 	0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 
 	0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 
 	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 
-	0x44, 0x6e, 0x73, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
-	0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x9, 0x64, 0x68, 0x63, 0x70, 0x31, 0x28, 0x29, 
-	0x3b, 0xd, 0xa, 0x9, 0x7d, 0x9, 0xd, 0xa, 0x7d, 0xd, 
-	0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x61, 0x75, 0x74, 0x6f, 0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 
-	0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x62, 0x6a, 0x3d, 
-	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
-	0x6c, 0x6c, 0x2e, 0x41, 0x75, 0x74, 0x6f, 0x2e, 0x63, 0x68, 
-	0x65, 0x63, 0x6b, 0x65, 0x64, 0x3b, 0xd, 0xa, 0x9, 0x76, 
-	0x61, 0x72, 0x20, 0x43, 0x73, 0x53, 0x65, 0x6c, 0x65, 0x63, 
-	0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
-	0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
-	0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x43, 0x73, 0x22, 
-	0x29, 0x3b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x50, 
-	0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x53, 0x65, 0x6c, 
-	0x65, 0x63, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
-	0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 
-	0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x50, 
-	0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x22, 0x29, 0x3b, 
-	0x9, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x62, 0x6d, 
-	0x3d, 0x6e, 0x65, 0x77, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 
-	0x28, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 
-	0x62, 0x6d, 0x32, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x41, 0x72, 
-	0x72, 0x61, 0x79, 0x28, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x43, 
-	0x73, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 
-	0x74, 0x68, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0xd, 0xa, 0x9, 
-	0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x53, 0x65, 
-	0x6c, 0x65, 0x63, 0x74, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 
-	0x3d, 0x20, 0x30, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x62, 0x6d, 0x5b, 0x30, 0x5d, 0x3d, 0x22, 0x30, 0x22, 0x3b, 
-	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 
-	0x31, 0x5d, 0x3d, 0x22, 0x43, 0x4c, 0x49, 0x45, 0x4e, 0x54, 
-	0x22, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
-	0x6d, 0x5b, 0x32, 0x5d, 0x3d, 0x22, 0x31, 0x22, 0x3b, 0x20, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x5b, 0x33, 
-	0x5d, 0x3d, 0x22, 0x53, 0x45, 0x52, 0x56, 0x45, 0x52, 0x22, 
-	0x3b, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 
-	0x32, 0x5b, 0x30, 0x5d, 0x3d, 0x22, 0x30, 0x22, 0x3b, 0x20, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x32, 0x5b, 
-	0x31, 0x5d, 0x3d, 0x22, 0x54, 0x43, 0x50, 0x22, 0x3b, 0x20, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x32, 0x5b, 
-	0x32, 0x5d, 0x3d, 0x22, 0x31, 0x22, 0x3b, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6d, 0x32, 0x5b, 0x33, 0x5d, 
-	0x3d, 0x22, 0x55, 0x44, 0x50, 0x22, 0x3b, 0x20, 0x9, 0x9, 
-	0xd, 0xa, 0x9, 0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x6f, 
-	0x62, 0x6a, 0x29, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 
-	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
-	0x61, 0x6c, 0x6c, 0x2e, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 
-	0x6f, 0x6c, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
+	0x43, 0x73, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
 	0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 
 	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
-	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x43, 0x73, 0x2e, 0x64, 0x69, 
-	0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 
-	0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 
+	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x50, 0x6f, 0x72, 0x74, 0x2e, 
+	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 
+	0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 
+	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
+	0x6c, 0x2e, 0x44, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x2e, 0x64, 
+	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 
+	0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 
 	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 
-	0x50, 0x6f, 0x72, 0x74, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
-	0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 
-	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
-	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x6f, 0x6d, 
-	0x61, 0x69, 0x6e, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
-	0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 
+	0x54, 0x43, 0x50, 0x5f, 0x54, 0x69, 0x6d, 0x65, 0x4f, 0x75, 
+	0x74, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
+	0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x9, 0xd, 0xa, 0x9, 
+	0x9, 0x69, 0x66, 0x28, 0x43, 0x73, 0x53, 0x65, 0x6c, 0x65, 
+	0x63, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x3d, 
+	0x30, 0x29, 0xd, 0xa, 0x9, 0x9, 0x9, 0x64, 0x6f, 0x63, 
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 
+	0x44, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x2e, 0x64, 0x69, 0x73, 
+	0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 
+	0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x69, 0x66, 0x28, 0x43, 
+	0x73, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3d, 0x3d, 0x31, 0x29, 0xd, 0xa, 0x9, 
 	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
 	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x54, 0x43, 0x50, 0x5f, 0x54, 
 	0x69, 0x6d, 0x65, 0x4f, 0x75, 0x74, 0x2e, 0x64, 0x69, 0x73, 
-	0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 
-	0x3b, 0x9, 0xd, 0xa, 0x9, 0x9, 0x69, 0x66, 0x28, 0x43, 
-	0x73, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x3d, 0x30, 0x29, 0xd, 0xa, 0x9, 
+	0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 
+	0x65, 0x3b, 0x9, 0x9, 0xd, 0xa, 0x9, 0x9, 0xd, 0xa, 
 	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
 	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x6f, 0x6d, 0x61, 0x69, 
-	0x6e, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
-	0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x9, 
-	0x9, 0x69, 0x66, 0x28, 0x43, 0x73, 0x53, 0x65, 0x6c, 0x65, 
-	0x63, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x3d, 
-	0x31, 0x29, 0xd, 0xa, 0x9, 0x9, 0x9, 0x64, 0x6f, 0x63, 
-	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 
-	0x54, 0x43, 0x50, 0x5f, 0x54, 0x69, 0x6d, 0x65, 0x4f, 0x75, 
-	0x74, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
-	0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x9, 0x9, 0xd, 
-	0xa, 0x9, 0x9, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 
-	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 
-	0x44, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x2e, 0x76, 0x61, 0x6c, 
-	0x75, 0x65, 0x3d, 0x22, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 
-	0x30, 0x22, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 
-	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 
-	0x50, 0x6f, 0x72, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x30, 0x22, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 
-	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
-	0x6c, 0x2e, 0x41, 0x75, 0x74, 0x6f, 0x48, 0x69, 0x64, 0x65, 
-	0x6e, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
-	0x22, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 0x66, 
-	0x6f, 0x72, 0x28, 0x78, 0x3d, 0x30, 0x3b, 0x78, 0x3c, 0x62, 
-	0x6d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x78, 
-	0x3d, 0x78, 0x2b, 0x32, 0x29, 0xd, 0xa, 0x9, 0x9, 0x7b, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 0x9, 0x20, 0x76, 
-	0x61, 0x72, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x4f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x28, 0x62, 0x6d, 0x5b, 0x78, 0x2b, 0x31, 0x5d, 
-	0x2c, 0x62, 0x6d, 0x5b, 0x78, 0x5d, 0x29, 0x3b, 0x20, 0xd, 
-	0xa, 0x20, 0x9, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 
-	0x73, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x28, 
-	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x9, 0x9, 0x7d, 0x9, 0x9, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x9, 0x9, 0x66, 0x6f, 0x72, 0x28, 0x78, 
-	0x3d, 0x30, 0x3b, 0x78, 0x3c, 0x62, 0x6d, 0x2e, 0x6c, 0x65, 
-	0x6e, 0x67, 0x74, 0x68, 0x3b, 0x78, 0x3d, 0x78, 0x2b, 0x32, 
-	0x29, 0xd, 0xa, 0x9, 0x9, 0x7b, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x9, 0x9, 0x9, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x31, 0x20, 0x3d, 0x20, 0x6e, 
-	0x65, 0x77, 0x20, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x28, 
-	0x62, 0x6d, 0x32, 0x5b, 0x78, 0x2b, 0x31, 0x5d, 0x2c, 0x62, 
-	0x6d, 0x32, 0x5b, 0x78, 0x5d, 0x29, 0x3b, 0x20, 0x20, 0x20, 
-	0xd, 0xa, 0x20, 0x9, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x53, 0x65, 
-	0x6c, 0x65, 0x63, 0x74, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x31, 0x29, 0x3b, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x9, 0x9, 0x7d, 0x9, 0x9, 0x9, 0xd, 0xa, 0x9, 
-	0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xd, 0xa, 
-	0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x50, 
-	0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x2e, 0x64, 0x69, 
-	0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 
-	0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x43, 
-	0x73, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
-	0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 
-	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
-	0x6c, 0x6c, 0x2e, 0x44, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x2e, 
-	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 
-	0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 
-	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 
-	0x2e, 0x50, 0x6f, 0x72, 0x74, 0x2e, 0x64, 0x69, 0x73, 0x61, 
-	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 
+	0x6e, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 
+	0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x22, 0x3b, 0xd, 0xa, 
+	0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x50, 0x6f, 0x72, 0x74, 0x2e, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3b, 
 	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
-	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x54, 0x43, 0x50, 
-	0x5f, 0x54, 0x69, 0x6d, 0x65, 0x4f, 0x75, 0x74, 0x2e, 0x64, 
-	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 
-	0x75, 0x65, 0x3b, 0x9, 0x9, 0xd, 0xa, 0x9, 0x9, 0x64, 
-	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
-	0x6c, 0x2e, 0x44, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x2e, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x2e, 0x30, 0x2e, 
-	0x30, 0x2e, 0x30, 0x22, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 
-	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
-	0x6c, 0x2e, 0x50, 0x6f, 0x72, 0x74, 0x2e, 0x76, 0x61, 0x6c, 
-	0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3b, 0xd, 0xa, 0x9, 
+	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x41, 0x75, 0x74, 
+	0x6f, 0x48, 0x69, 0x64, 0x65, 0x6e, 0x2e, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3b, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x9, 0x9, 0x66, 0x6f, 0x72, 0x28, 0x78, 0x3d, 
+	0x30, 0x3b, 0x78, 0x3c, 0x62, 0x6d, 0x2e, 0x6c, 0x65, 0x6e, 
+	0x67, 0x74, 0x68, 0x3b, 0x78, 0x3d, 0x78, 0x2b, 0x32, 0x29, 
+	0xd, 0xa, 0x9, 0x9, 0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x9, 0x9, 0x9, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 
+	0x20, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x62, 0x6d, 
+	0x5b, 0x78, 0x2b, 0x31, 0x5d, 0x2c, 0x62, 0x6d, 0x5b, 0x78, 
+	0x5d, 0x29, 0x3b, 0x20, 0xd, 0xa, 0x20, 0x9, 0x9, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x43, 0x73, 0x53, 0x65, 0x6c, 0x65, 
+	0x63, 0x74, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+	0x2e, 0x61, 0x64, 0x64, 0x28, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x29, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 
+	0x7d, 0x9, 0x9, 0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 
+	0x66, 0x6f, 0x72, 0x28, 0x78, 0x3d, 0x30, 0x3b, 0x78, 0x3c, 
+	0x62, 0x6d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 
+	0x78, 0x3d, 0x78, 0x2b, 0x32, 0x29, 0xd, 0xa, 0x9, 0x9, 
+	0x7b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 0x9, 0x20, 
+	0x76, 0x61, 0x72, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x31, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x4f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x28, 0x62, 0x6d, 0x32, 0x5b, 0x78, 
+	0x2b, 0x31, 0x5d, 0x2c, 0x62, 0x6d, 0x32, 0x5b, 0x78, 0x5d, 
+	0x29, 0x3b, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x9, 0x9, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x74, 0x6f, 
+	0x63, 0x6f, 0x6c, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 
+	0x64, 0x28, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x31, 0x29, 
+	0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x9, 0x9, 0x7d, 0x9, 
+	0x9, 0x9, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 
+	0x6c, 0x73, 0x65, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 
 	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
-	0x61, 0x6c, 0x6c, 0x2e, 0x41, 0x75, 0x74, 0x6f, 0x48, 0x69, 
-	0x64, 0x65, 0x6e, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x30, 0x22, 0x3b, 0x9, 0x9, 0xd, 0xa, 0x9, 0x7d, 
-	0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x66, 0x75, 0x6e, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x74, 
-	0x6f, 0x63, 0x6f, 0x6c, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 
-	0x74, 0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x9, 0x76, 
-	0x61, 0x72, 0x20, 0x6f, 0x62, 0x6a, 0x3d, 0x64, 0x6f, 0x63, 
-	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 
-	0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 
-	0x28, 0x22, 0x43, 0x73, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 
-	0x75, 0x65, 0x3b, 0x9, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 
-	0x20, 0x6f, 0x62, 0x6a, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 
-	0x6f, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
-	0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x50, 0x72, 
-	0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x22, 0x29, 0x2e, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x69, 0x66, 
-	0x28, 0x6f, 0x62, 0x6a, 0x3d, 0x3d, 0x31, 0x20, 0x26, 0x26, 
-	0x20, 0x6f, 0x62, 0x6a, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 
-	0x6f, 0x6c, 0x3d, 0x3d, 0x30, 0x29, 0x2f, 0x2f, 0x54, 0x43, 
-	0x50, 0x20, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0xd, 0xa, 
-	0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x54, 
-	0x43, 0x50, 0x5f, 0x54, 0x69, 0x6d, 0x65, 0x4f, 0x75, 0x74, 
-	0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 
-	0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x9, 0xd, 0xa, 0x9, 
+	0x61, 0x6c, 0x6c, 0x2e, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 
+	0x6f, 0x6c, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
+	0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 
 	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
-	0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 
+	0x61, 0x6c, 0x6c, 0x2e, 0x43, 0x73, 0x2e, 0x64, 0x69, 0x73, 
+	0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 
+	0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x6f, 
+	0x6d, 0x61, 0x69, 0x6e, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
+	0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 
+	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x50, 0x6f, 0x72, 0x74, 
 	0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 
-	0x74, 0x72, 0x75, 0x65, 0x3b, 0x9, 0xd, 0xa, 0x9, 0x7d, 
-	0xd, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xd, 0xa, 0x9, 
-	0x7b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
-	0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x54, 0x43, 
-	0x50, 0x5f, 0x54, 0x69, 0x6d, 0x65, 0x4f, 0x75, 0x74, 0x2e, 
-	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 
-	0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 
-	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 
-	0x2e, 0x44, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x2e, 0x64, 0x69, 
-	0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 
-	0x73, 0x65, 0x3b, 0x9, 0xd, 0xa, 0x9, 0x7d, 0x9, 0x9, 
-	0xd, 0xa, 0x7d, 0xd, 0xa, 0x3c, 0x2f, 0x73, 0x63, 0x72, 
-	0x69, 0x70, 0x74, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x65, 
-	0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x62, 0x6f, 0x64, 0x79, 
-	0x3e, 0xd, 0xa, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 
-	0x31, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x38, 0x30, 0x30, 0x3b, 
-	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x38, 0x30, 0x30, 
-	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 
-	0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x63, 
-	0x65, 0x6c, 0x6c, 0x31, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6c, 
-	0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 
-	0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
-	0x23, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x22, 0x3e, 0x26, 
-	0x6e, 0x62, 0x73, 0x70, 0x3b, 0x3c, 0x2f, 0x64, 0x69, 0x76, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 0x67, 0x65, 0x4e, 0x61, 
-	0x6d, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x68, 0x32, 0x3e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x20, 
-	0x3c, 0x2f, 0x68, 0x32, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 
-	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 
-	0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 
-	0x67, 0x65, 0x4e, 0x61, 0x76, 0x22, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 
-	0x69, 0x6e, 0x6b, 0x73, 0x22, 0x3e, 0x20, 0x3c, 0x61, 0x20, 
-	0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x62, 0x61, 0x73, 0x69, 
-	0x63, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x42, 0x61, 
-	0x73, 0x69, 0x63, 0x20, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x3c, 
-	0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x61, 0x64, 
-	0x76, 0x61, 0x6e, 0x63, 0x65, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 
-	0x22, 0x3e, 0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x64, 
-	0x20, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x3c, 0x61, 0x20, 0x68, 
-	0x72, 0x65, 0x66, 0x3d, 0x22, 0x66, 0x69, 0x72, 0x6d, 0x77, 
-	0x61, 0x72, 0x65, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 
-	0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x3c, 0x2f, 0x61, 
-	0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x9, 
-	0x3c, 0x70, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0xd, 0xa, 0x9, 
-	0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 
-	0x64, 0x76, 0x65, 0x72, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x9, 
-	0x3c, 0x70, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0xa1, 0xa4, 0x57, 0x69, 
-	0x72, 0x65, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x53, 0x65, 0x74, 
-	0x74, 0x69, 0x6e, 0x67, 0x73, 0x3a, 0x20, 0x57, 0x69, 0x72, 
-	0x65, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x73, 0x65, 0x74, 0x74, 
-	0x69, 0x6e, 0x67, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 
-	0x65, 0x20, 0x62, 0x61, 0x73, 0x69, 0x63, 0x20, 0x73, 0x74, 
-	0x65, 0x70, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x79, 0x6f, 0x75, 
-	0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 
-	0x65, 0x20, 0x77, 0x69, 0x66, 0x69, 0x20, 0x6d, 0x6f, 0x64, 
-	0x75, 0x6c, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x65, 
-	0x6e, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x63, 0x61, 0x6e, 0x20, 0x67, 0x75, 0x61, 0x72, 0x61, 0x6e, 
-	0x74, 0x65, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 
-	0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 0x20, 0x6f, 0x66, 0x20, 
-	0x79, 0x6f, 0x75, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2e, 
-	0x3c, 0x2f, 0x70, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x70, 0x20, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 
-	0x74, 0x22, 0x3e, 0xa1, 0xa4, 0x4e, 0x65, 0x74, 0x77, 0x6f, 
-	0x72, 0x6b, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
-	0x73, 0x3a, 0x20, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x20, 
-	0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x53, 0x65, 
-	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x63, 0x61, 0x6e, 
-	0x20, 0x65, 0x6e, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x68, 
-	0x61, 0x74, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x6e, 0x65, 
-	0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x69, 0x73, 0x20, 0x70, 
-	0x72, 0x6f, 0x70, 0x65, 0x72, 0x6c, 0x79, 0x20, 0x63, 0x6f, 
-	0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3c, 0x2f, 0x70, 
-	0x3e, 0xd, 0xa, 0x9, 0x3c, 0x70, 0x20, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 
-	0xa1, 0xa4, 0x41, 0x75, 0x74, 0x6f, 0x20, 0x4d, 0x6f, 0x64, 
-	0x65, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
-	0x3a, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 
-	0x75, 0x74, 0x6f, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x69, 
-	0x73, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2c, 
-	0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x77, 0x69, 0x66, 0x69, 
-	0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20, 0x77, 0x69, 
-	0x6c, 0x6c, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 
-	0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 
-	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x61, 0x72, 0x65, 
-	0x6e, 0x74, 0x6c, 0x79, 0x2e, 0x3c, 0x2f, 0x70, 0x3e, 0xd, 
-	0xa, 0x9, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 
-	0x22, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x22, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 
-	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x6f, 0x72, 
-	0x6d, 0x31, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 
-	0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 0x20, 0x61, 0x63, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 
-	0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x6f, 0x72, 0x79, 
-	0x22, 0x3e, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x68, 0x33, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
-	0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 
-	0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x22, 0x3e, 0x57, 0x69, 
-	0x72, 0x65, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x53, 0x65, 0x74, 
-	0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-	0x3d, 0x22, 0x35, 0x30, 0x30, 0x22, 0x20, 0x62, 0x6f, 0x72, 
-	0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 
-	0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 
-	0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 
-	0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x35, 0x22, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 
-	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 
-	0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 
-	0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 
-	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 
-	0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x35, 0x30, 
-	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 
-	0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x57, 0x6f, 0x72, 0x6b, 
-	0x20, 0x54, 0x79, 0x70, 0x65, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 
-	0x64, 0x74, 0x68, 0x3d, 0x22, 0x37, 0x37, 0x22, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 
-	0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 
+	0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 
+	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 
+	0x6c, 0x2e, 0x54, 0x43, 0x50, 0x5f, 0x54, 0x69, 0x6d, 0x65, 
+	0x4f, 0x75, 0x74, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+	0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x9, 0x9, 
+	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x6f, 0x6d, 
+	0x61, 0x69, 0x6e, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x22, 0x3b, 
+	0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x50, 0x6f, 0x72, 
+	0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 
+	0x22, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
+	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x41, 
+	0x75, 0x74, 0x6f, 0x48, 0x69, 0x64, 0x65, 0x6e, 0x2e, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3b, 0x9, 
+	0x9, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x7d, 0xd, 0xa, 
+	0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x5f, 
+	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x28, 0x29, 0xd, 0xa, 
+	0x7b, 0xd, 0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x62, 
+	0x6a, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+	0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x43, 0x73, 0x22, 
+	0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x9, 0xd, 
+	0xa, 0x9, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x62, 0x6a, 0x50, 
+	0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x3d, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
+	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
+	0x64, 0x28, 0x22, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 
+	0x6c, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 
+	0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x6f, 0x62, 0x6a, 0x3d, 
+	0x3d, 0x31, 0x20, 0x26, 0x26, 0x20, 0x6f, 0x62, 0x6a, 0x50, 
+	0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x3d, 0x3d, 0x30, 
+	0x29, 0x2f, 0x2f, 0x54, 0x43, 0x50, 0x20, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 
+	0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x61, 0x6c, 0x6c, 0x2e, 0x54, 0x43, 0x50, 0x5f, 0x54, 0x69, 
+	0x6d, 0x65, 0x4f, 0x75, 0x74, 0x2e, 0x64, 0x69, 0x73, 0x61, 
+	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 
+	0x3b, 0x9, 0xd, 0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 
+	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 
+	0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x2e, 0x64, 0x69, 0x73, 0x61, 
+	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 
+	0x9, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x65, 0x6c, 
+	0x73, 0x65, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 
+	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 
+	0x6c, 0x6c, 0x2e, 0x54, 0x43, 0x50, 0x5f, 0x54, 0x69, 0x6d, 
+	0x65, 0x4f, 0x75, 0x74, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 
+	0x6c, 0x65, 0x64, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0xd, 
+	0xa, 0x9, 0x9, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x61, 0x6c, 0x6c, 0x2e, 0x44, 0x6f, 0x6d, 0x61, 
+	0x69, 0x6e, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
+	0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x9, 0xd, 
+	0xa, 0x9, 0x7d, 0x9, 0x9, 0xd, 0xa, 0x7d, 0xd, 0xa, 
+	0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0xd, 
+	0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 
+	0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x64, 
+	0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 0x67, 
+	0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x22, 0x20, 0x73, 0x74, 
+	0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3a, 0x38, 0x30, 0x30, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3d, 0x38, 0x30, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 
+	0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x2d, 
+	0x2d, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 
+	0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 
+	0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 
+	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x43, 0x43, 0x43, 0x43, 
+	0x43, 0x43, 0x22, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 
+	0x61, 0x67, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x32, 0x3e, 0x42, 
+	0x61, 0x73, 0x69, 0x63, 0x20, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x70, 0x61, 0x67, 0x65, 0x4e, 0x61, 0x76, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 
+	0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6e, 0x6b, 0x73, 0x22, 
+	0x3e, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 
+	0x22, 0x62, 0x61, 0x73, 0x69, 0x63, 0x2e, 0x68, 0x74, 0x6d, 
+	0x6c, 0x22, 0x3e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x20, 0x3c, 
+	0x2f, 0x61, 0x3e, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 
+	0x66, 0x3d, 0x22, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 
+	0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x41, 0x64, 0x76, 
+	0x61, 0x6e, 0x63, 0x65, 0x64, 0x20, 0x3c, 0x2f, 0x61, 0x3e, 
+	0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 
+	0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x2e, 0x68, 
+	0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x53, 0x79, 0x73, 0x74, 0x65, 
+	0x6d, 0x20, 0x3c, 0x2f, 0x61, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 
+	0x76, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x70, 0x3e, 0x3c, 0x2f, 
+	0x70, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x64, 0x69, 0x76, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x61, 0x64, 0x76, 0x65, 0x72, 0x74, 
+	0x22, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x70, 0x20, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 
+	0x3e, 0xa1, 0xa4, 0x57, 0x69, 0x72, 0x65, 0x6c, 0x65, 0x73, 
+	0x73, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x3a, 0x20, 0x57, 0x69, 0x72, 0x65, 0x6c, 0x65, 0x73, 0x73, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 
+	0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x73, 
+	0x69, 0x63, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x66, 0x6f, 
+	0x72, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x74, 0x6f, 0x20, 0x75, 
+	0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x69, 0x66, 
+	0x69, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x2e, 0x20, 
+	0x54, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x63, 0x72, 0x79, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x67, 
+	0x75, 0x61, 0x72, 0x61, 0x6e, 0x74, 0x65, 0x65, 0x20, 0x74, 
+	0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 
+	0x79, 0x20, 0x6f, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 
+	0x64, 0x61, 0x74, 0x61, 0x2e, 0x3c, 0x2f, 0x70, 0x3e, 0xd, 
+	0xa, 0x9, 0x3c, 0x70, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0xa1, 0xa4, 
+	0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x53, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3a, 0x20, 0x50, 0x72, 
+	0x6f, 0x70, 0x65, 0x72, 0x20, 0x4e, 0x65, 0x74, 0x77, 0x6f, 
+	0x72, 0x6b, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x65, 0x6e, 0x73, 0x75, 
+	0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x79, 0x6f, 
+	0x75, 0x72, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 
+	0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 
+	0x6c, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 
+	0x65, 0x64, 0x3c, 0x2f, 0x70, 0x3e, 0xd, 0xa, 0x9, 0x3c, 
+	0x70, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 
+	0x65, 0x66, 0x74, 0x22, 0x3e, 0xa1, 0xa4, 0x41, 0x75, 0x74, 
+	0x6f, 0x20, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x53, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x3a, 0x20, 0x49, 0x66, 0x20, 
+	0x74, 0x68, 0x65, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x20, 0x6d, 
+	0x6f, 0x64, 0x65, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6e, 0x61, 
+	0x62, 0x6c, 0x65, 0x64, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x72, 
+	0x20, 0x77, 0x69, 0x66, 0x69, 0x20, 0x6d, 0x6f, 0x64, 0x75, 
+	0x6c, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x74, 0x72, 
+	0x61, 0x6e, 0x73, 0x6d, 0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 
+	0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x72, 0x61, 0x6e, 
+	0x73, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x2e, 
+	0x3c, 0x2f, 0x70, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x64, 
+	0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 0x64, 
+	0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 
+	0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 
+	0x65, 0x6e, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 
+	0x6f, 0x72, 0x6d, 0x31, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+	0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 0x20, 0x6d, 
+	0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 
+	0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 
+	0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 
+	0x73, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x3e, 0x20, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x20, 
+	0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 
+	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 
+	0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 
+	0x36, 0x22, 0x3e, 0x57, 0x69, 0x72, 0x65, 0x6c, 0x65, 0x73, 
+	0x73, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x3c, 0x2f, 0x68, 0x33, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x35, 0x30, 0x30, 
+	0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 
+	0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 
+	0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 
+	0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 
+	0x3d, 0x22, 0x35, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 
+	0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 
+	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x6f, 0x64, 
-	0x65, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 
-	0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x4d, 0x6f, 0x64, 0x65, 
-	0x22, 0x20, 0x6f, 0x6e, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 
-	0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x20, 
-	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 
-	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 
-	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 
-	0x53, 0x74, 0x61, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3e, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
-	0x22, 0x3e, 0x41, 0x64, 0x68, 0x6f, 0x63, 0x3c, 0x2f, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
+	0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3d, 0x22, 0x31, 0x35, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 
+	0x3e, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x54, 0x79, 0x70, 0x65, 
+	0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 
+	0x37, 0x37, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+	0x3d, 0x22, 0x4d, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x73, 0x69, 
+	0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x4d, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x43, 
+	0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 
+	0x65, 0x28, 0x29, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
 	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x32, 0x22, 0x3e, 0x41, 0x50, 0x3c, 0x2f, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 
+	0x3d, 0x22, 0x30, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x65, 0x64, 0x22, 0x3e, 0x53, 0x74, 0x61, 0x3c, 0x2f, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x20, 0x3c, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x41, 0x64, 0x68, 
+	0x6f, 0x63, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x3e, 
+	0x41, 0x50, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 
+	0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 
+	0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 
+	0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 
+	0x22, 0x3e, 0x53, 0x53, 0x49, 0x44, 0xa3, 0xba, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
+	0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x32, 0x39, 
+	0x35, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x6c, 0x65, 0x66, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 
+	0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 
-	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x73, 
+	0x69, 0x64, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 
+	0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x53, 0x73, 0x69, 0x64, 0x22, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x6e, 0x6f, 0x6f, 0x73, 0x22, 0x20, 
+	0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x33, 0x30, 0x22, 0x20, 
+	0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 
+	0x22, 0x33, 0x32, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 
+	0xa, 0x9, 0x9, 0x9, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x3d, 0x22, 0x41, 0x70, 0x45, 0x6e, 0x61, 0x62, 
+	0x6c, 0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 
+	0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x22, 0x20, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x41, 0x70, 0x45, 0x6e, 0x61, 0x62, 0x6c, 
+	0x65, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x30, 0x22, 0x2f, 0x3e, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x9, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
-	0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 
-	0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 
-	0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0x53, 0x53, 0x49, 
-	0x44, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 
-	0x68, 0x3d, 0x22, 0x32, 0x39, 0x35, 0x22, 0x20, 0x61, 0x6c, 
+	0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 
+	0x65, 0x22, 0x3e, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
 	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 
 	0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 
 	0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 
 	0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 
-	0x65, 0x3d, 0x22, 0x53, 0x73, 0x69, 0x64, 0x22, 0x20, 0x74, 
-	0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 
-	0x20, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x73, 0x69, 0x64, 
-	0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x6e, 
-	0x6f, 0x6f, 0x73, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 
-	0x22, 0x33, 0x30, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 
-	0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x33, 0x32, 0x22, 0x20, 
-	0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
-	0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x9, 0x3c, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 
-	0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 
-	0x70, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x74, 
-	0x79, 0x70, 0x65, 0x3d, 0x22, 0x68, 0x69, 0x64, 0x64, 0x65, 
-	0x6e, 0x22, 0x20, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x41, 0x70, 
-	0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x2f, 0x3e, 0x3c, 
-	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x9, 
-	0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 
-	0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0x45, 0x6e, 
-	0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0xa3, 0xba, 
-	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x6c, 0x65, 0x66, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 
-	0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 
-	0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 
-	0x6e, 0x63, 0x72, 0x79, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 
-	0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x45, 
-	0x6e, 0x63, 0x72, 0x79, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x68, 
-	0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x6b, 0x65, 0x79, 0x28, 
-	0x29, 0x22, 0x20, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x30, 0x22, 0x20, 0x3e, 0x44, 0x69, 0x73, 0x61, 0x62, 
-	0x6c, 0x65, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 
-	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 
-	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 
-	0x57, 0x45, 0x50, 0x36, 0x34, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
-	0x32, 0x22, 0x20, 0x3e, 0x57, 0x45, 0x50, 0x31, 0x32, 0x38, 
+	0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x3d, 0x22, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x22, 
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x22, 
+	0x20, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 
+	0x22, 0x6b, 0x65, 0x79, 0x28, 0x29, 0x22, 0x20, 0x20, 0x3e, 
+	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x3e, 
+	0x44, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3d, 0x22, 0x31, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x65, 0x64, 0x22, 0x3e, 0x57, 0x45, 0x50, 0x36, 0x34, 
 	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 
 	0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x33, 0x22, 0x3e, 0x57, 0x50, 
-	0x41, 0x2d, 0x50, 0x53, 0x4b, 0x28, 0x54, 0x4b, 0x49, 0x50, 
+	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x20, 0x3e, 0x57, 
+	0x45, 0x50, 0x31, 0x32, 0x38, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x33, 0x22, 0x3e, 0x57, 0x50, 0x41, 0x2d, 0x50, 0x53, 0x4b, 
+	0x28, 0x54, 0x4b, 0x49, 0x50, 0x29, 0x3c, 0x2f, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x34, 0x22, 0x3e, 0x57, 0x50, 0x41, 0x2d, 0x50, 0x53, 
+	0x4b, 0x28, 0x43, 0x43, 0x4d, 0x50, 0x29, 0x3c, 0x2f, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3d, 0x22, 0x35, 0x22, 0x3e, 0x57, 0x50, 0x41, 0x32, 0x2d, 
+	0x50, 0x53, 0x4b, 0x28, 0x54, 0x4b, 0x49, 0x50, 0x29, 0x3c, 
+	0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x36, 0x22, 0x3e, 0x57, 0x50, 0x41, 
+	0x32, 0x5f, 0x50, 0x53, 0x4b, 0x28, 0x43, 0x43, 0x4d, 0x50, 
 	0x29, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
-	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x57, 
-	0x50, 0x41, 0x2d, 0x50, 0x53, 0x4b, 0x28, 0x43, 0x43, 0x4d, 
-	0x50, 0x29, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x35, 0x22, 0x3e, 
-	0x57, 0x50, 0x41, 0x32, 0x2d, 0x50, 0x53, 0x4b, 0x28, 0x54, 
-	0x4b, 0x49, 0x50, 0x29, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x36, 
-	0x22, 0x3e, 0x57, 0x50, 0x41, 0x32, 0x5f, 0x50, 0x53, 0x4b, 
-	0x28, 0x43, 0x43, 0x4d, 0x50, 0x29, 0x3c, 0x2f, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x9, 
-	0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
+	0xd, 0xa, 0x9, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x2f, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x76, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 
+	0x6c, 0x65, 0x22, 0x3e, 0x4b, 0x65, 0x79, 0x20, 0x46, 0x6f, 
+	0x72, 0x6d, 0x61, 0x74, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 
+	0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0x3c, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 
+	0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x65, 0x79, 0x54, 0x79, 
+	0x70, 0x65, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 
+	0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x4b, 0x65, 0x79, 
+	0x54, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 
+	0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 
+	0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x48, 0x45, 0x58, 0x3c, 
+	0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x41, 0x53, 0x43, 
+	0x49, 0x49, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
+	0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x3c, 0x74, 0x72, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 
 	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 
 	0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
 	0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0x4b, 
-	0x65, 0x79, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0xa3, 
-	0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x65, 0x79, 0x20, 0x49, 0x6e, 0x64, 0x65, 0x78, 0xa3, 0xba, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x6c, 0x65, 0x66, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 
+	0x22, 0x3e, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x65, 0x79, 
+	0x49, 0x6e, 0x64, 0x65, 0x78, 0x22, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x22, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 
+	0x65, 0x78, 0x31, 0x22, 0x20, 0x3e, 0xd, 0xa, 0x9, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 
-	0x65, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 
-	0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x4b, 0x65, 0x79, 0x54, 0x79, 0x70, 0x65, 0x22, 0x20, 0x73, 
-	0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x4b, 0x65, 0x79, 0x54, 0x79, 0x70, 0x65, 0x22, 
-	0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 
-	0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 
-	0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 
-	0x3e, 0x48, 0x45, 0x58, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
-	0x22, 0x3e, 0x41, 0x53, 0x43, 0x49, 0x49, 0x3c, 0x2f, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3e, 0x31, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
+	0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x3c, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x65, 0x79, 
+	0x49, 0x6e, 0x64, 0x65, 0x78, 0x22, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x22, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 
+	0x65, 0x78, 0x32, 0x22, 0x20, 0x3e, 0xd, 0xa, 0x9, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
+	0x20, 0x3c, 0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3e, 0x32, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
+	0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x3c, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x65, 0x79, 
+	0x49, 0x6e, 0x64, 0x65, 0x78, 0x22, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x22, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x33, 0x22, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 
+	0x65, 0x78, 0x33, 0x22, 0x20, 0x3e, 0xd, 0xa, 0x9, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3e, 0x33, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
+	0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x3c, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x65, 0x79, 
+	0x49, 0x6e, 0x64, 0x65, 0x78, 0x22, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x22, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x34, 0x22, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 
+	0x65, 0x78, 0x34, 0x22, 0x20, 0x3e, 0xd, 0xa, 0x9, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x9, 
-	0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3e, 0x34, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x76, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 
-	0x6c, 0x65, 0x22, 0x3e, 0x4b, 0x65, 0x79, 0x20, 0x49, 0x6e, 
-	0x64, 0x65, 0x78, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 
-	0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 
-	0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x9, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 
-	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 
-	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x72, 0x61, 
-	0x64, 0x69, 0x6f, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x4b, 
-	0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x22, 0x20, 
-	0x3e, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x69, 0x6e, 
-	0x70, 0x75, 0x74, 0x3e, 0x31, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 
-	0x9, 0x9, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 
-	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 
-	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x72, 0x61, 
-	0x64, 0x69, 0x6f, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x32, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x4b, 
-	0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x32, 0x22, 0x20, 
-	0x3e, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x69, 0x6e, 
-	0x70, 0x75, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 
-	0x9, 0x9, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 
-	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 
-	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x72, 0x61, 
-	0x64, 0x69, 0x6f, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x33, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x4b, 
-	0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x33, 0x22, 0x20, 
-	0x3e, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x69, 0x6e, 
-	0x70, 0x75, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 
-	0x9, 0x9, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 
-	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 
-	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x72, 0x61, 
-	0x64, 0x69, 0x6f, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x34, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x4b, 
-	0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x34, 0x22, 0x20, 
-	0x3e, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x69, 0x6e, 
-	0x70, 0x75, 0x74, 0x3e, 0x34, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 
+	0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0x45, 0x6e, 
+	0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x4b, 
+	0x65, 0x79, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x20, 
+	0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 
+	0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
 	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+	0x3d, 0x22, 0x4b, 0x65, 0x79, 0x22, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x4b, 0x65, 0x79, 0x22, 0x20, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x22, 0x20, 0x73, 0x69, 0x7a, 
+	0x65, 0x3d, 0x22, 0x33, 0x30, 0x22, 0x20, 0x6d, 0x61, 0x78, 
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x36, 0x33, 
+	0x22, 0x20, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 
 	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 
-	0x65, 0x22, 0x3e, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x4b, 0x65, 0x79, 0xa3, 0xba, 0x3c, 
-	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 
-	0x65, 0x66, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 
-	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
+	0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 
+	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
+	0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
+	0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 
+	0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
-	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x65, 0x79, 
-	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 
-	0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x4b, 0x65, 
-	0x79, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
-	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x33, 0x30, 
-	0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
-	0x68, 0x3d, 0x22, 0x36, 0x33, 0x22, 0x20, 0x20, 0x2f, 0x3e, 
+	0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 
+	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x20, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 
+	0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 
+	0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
+	0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 
+	0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 
+	0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x46, 0x6f, 0x72, 
+	0x6d, 0x31, 0x5f, 0x4d, 0x4d, 0x5f, 0x70, 0x6f, 0x70, 0x75, 
+	0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 
+	0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 
-	0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
-	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 
-	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 
-	0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 
-	0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 
+	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x26, 0x6e, 0x62, 
+	0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+	0x3e, 0x9, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x66, 
+	0x6f, 0x72, 0x6d, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x66, 0x6f, 
+	0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x6f, 0x72, 
+	0x6d, 0x31, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
+	0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 0x20, 0x6d, 0x65, 0x74, 
+	0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 0x20, 
+	0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x3e, 
+	0xd, 0xa, 0x9, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 
+	0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x6f, 0x72, 0x79, 
+	0x22, 0x3e, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x68, 0x33, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+	0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 
+	0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x22, 0x3e, 0x4e, 0x65, 
+	0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x53, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x20, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3d, 0x22, 0x35, 0x30, 0x30, 0x22, 0x20, 0x62, 0x6f, 0x72, 
+	0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 
+	0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 
+	0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 
+	0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x35, 0x22, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
 	0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
-	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 
-	0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 
-	0x22, 0x32, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x76, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 
-	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 
-	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 
-	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 
-	0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
-	0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 
-	0x69, 0x63, 0x6b, 0x3d, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 
-	0x6e, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x31, 0x5f, 0x4d, 0x4d, 
-	0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 
-	0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
-	0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 
+	0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 
+	0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 
-	0x62, 0x73, 0x70, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x9, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 
-	0xa, 0x9, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0xd, 
-	0xa, 0x9, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 0x20, 0x6e, 
-	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 
-	0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 
-	0x67, 0x65, 0x74, 0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3d, 0x22, 0x22, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x64, 
-	0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 
-	0x73, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x3e, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x20, 
-	0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 
-	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 
-	0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 
-	0x36, 0x22, 0x3e, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 
-	0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 
-	0x3c, 0x2f, 0x68, 0x33, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x35, 0x30, 0x30, 
-	0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 
-	0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 
-	0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 
-	0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 
-	0x3d, 0x22, 0x35, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x9, 0x9, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x64, 0x20, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 
+	0x65, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
-	0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 
-	0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 
-	0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x33, 
+	0x30, 0x31, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 
+	0x65, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0x3c, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x20, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 
-	0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0x3c, 0x2f, 
+	0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x68, 0x63, 0x70, 0x22, 
+	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 
+	0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x44, 0x68, 0x63, 0x70, 0x22, 0x20, 0x6f, 0x6e, 0x63, 
+	0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x64, 0x68, 0x63, 0x70, 
+	0x31, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3d, 0x22, 0x30, 0x22, 0x20, 0x20, 0x2f, 0x3e, 0x20, 0x44, 
+	0x48, 0x43, 0x50, 0x20, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 
 	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 
-	0x74, 0x68, 0x3d, 0x22, 0x33, 0x30, 0x31, 0x22, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 
-	0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0x3c, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 
-	0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x44, 0x68, 0x63, 0x70, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
-	0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 
-	0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x44, 0x68, 0x63, 0x70, 
-	0x22, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 
-	0x22, 0x64, 0x68, 0x63, 0x70, 0x31, 0x28, 0x29, 0x22, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 
-	0x20, 0x2f, 0x3e, 0x20, 0x44, 0x48, 0x43, 0x50, 0x20, 0x45, 
-	0x6e, 0x61, 0x62, 0x6c, 0x65, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 
+	0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 
+	0x22, 0x3e, 0x46, 0x69, 0x78, 0x65, 0x64, 0x20, 0x49, 0x50, 
+	0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0xa3, 0xba, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 
-	0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 
-	0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0x46, 0x69, 0x78, 
-	0x65, 0x64, 0x20, 0x49, 0x50, 0x20, 0x41, 0x64, 0x64, 0x72, 
-	0x65, 0x73, 0x73, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 
+	0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x33, 0x30, 0x31, 0x22, 
+	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 
+	0x66, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 
+	0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 
-	0x22, 0x33, 0x30, 0x31, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x20, 0x76, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 
-	0x64, 0x6c, 0x65, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+	0x3d, 0x22, 0x49, 0x70, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x49, 0x70, 0x22, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x2e, 0x33, 0x2e, 0x33, 
+	0x2e, 0x31, 0x37, 0x33, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+	0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x35, 0x22, 
+	0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
-	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49, 0x70, 0x22, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 
-	0x74, 0x22, 0x20, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x49, 0x70, 
-	0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
-	0x30, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x31, 0x37, 0x33, 0x22, 
-	0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x35, 0x22, 
-	0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 
-	0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x76, 
+	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 
+	0x64, 0x6c, 0x65, 0x22, 0x3e, 0x53, 0x75, 0x62, 0x6e, 0x65, 
+	0x74, 0x20, 0x4d, 0x61, 0x73, 0x6b, 0xa3, 0xba, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 
-	0x68, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 
-	0x53, 0x75, 0x62, 0x6e, 0x65, 0x74, 0x20, 0x4d, 0x61, 0x73, 
-	0x6b, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x20, 
+	0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 
+	0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
+	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x75, 
+	0x62, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 
+	0x65, 0x78, 0x74, 0x22, 0x20, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x53, 0x75, 0x62, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3d, 0x22, 0x32, 0x35, 0x35, 0x2e, 0x32, 0x35, 0x35, 0x2e, 
+	0x32, 0x35, 0x35, 0x2e, 0x30, 0x22, 0x20, 0x73, 0x69, 0x7a, 
+	0x65, 0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x6d, 0x61, 0x78, 
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x35, 
+	0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 
-	0x65, 0x66, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 
-	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
+	0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
+	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 
+	0x67, 0x68, 0x74, 0x22, 0x3e, 0x47, 0x61, 0x74, 0x65, 0x77, 
+	0x61, 0x79, 0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 
+	0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 
-	0x65, 0x3d, 0x22, 0x53, 0x75, 0x62, 0x22, 0x20, 0x74, 0x79, 
-	0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x75, 0x62, 0x22, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x35, 0x35, 
-	0x2e, 0x32, 0x35, 0x35, 0x2e, 0x32, 0x35, 0x35, 0x2e, 0x30, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
+	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 
+	0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x61, 0x74, 0x65, 
+	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 
+	0x78, 0x74, 0x22, 0x20, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x47, 
+	0x61, 0x74, 0x65, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3d, 0x22, 0x31, 0x30, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x31, 
 	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x35, 
 	0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
 	0x68, 0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x2f, 0x3e, 0xd, 
@@ -2896,404 +2937,373 @@ static const unsigned char data_basic_html[] = {
 	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 
 	0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 
-	0x47, 0x61, 0x74, 0x65, 0x77, 0x61, 0x79, 0x20, 0x41, 0x64, 
-	0x64, 0x72, 0x65, 0x73, 0x73, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 
+	0x3e, 0x44, 0x4e, 0x53, 0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 
+	0x73, 0x73, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
+	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x6e, 
+	0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 
+	0x65, 0x78, 0x74, 0x22, 0x20, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x44, 0x6e, 0x73, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3d, 0x22, 0x31, 0x30, 0x2e, 0x32, 0x2e, 0x34, 0x2e, 0x35, 
+	0x31, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 
+	0x35, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 
+	0x74, 0x68, 0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x2f, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 
-	0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x47, 0x61, 0x74, 0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 
-	0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x47, 0x61, 0x74, 0x65, 0x22, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x2e, 
-	0x33, 0x2e, 0x33, 0x2e, 0x31, 0x22, 0x20, 0x73, 0x69, 0x7a, 
-	0x65, 0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x6d, 0x61, 0x78, 
-	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x35, 
-	0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
+	0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 
+	0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 
+	0x44, 0x4e, 0x53, 0x20, 0x4e, 0x61, 0x6d, 0x65, 0x28, 0x41, 
+	0x50, 0x29, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+	0x3d, 0x22, 0x44, 0x6e, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x22, 
+	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 
+	0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x44, 0x6e, 0x73, 
+	0x4e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+	0x3d, 0x22, 0x33, 0x32, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x33, 0x32, 0x22, 
+	0x20, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
+	0x9, 0x9, 0x9, 0x9, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 
+	0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
+	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 
+	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 
+	0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 
+	0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 
+	0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
+	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 
+	0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 
+	0x22, 0x32, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x76, 
+	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 
-	0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x44, 0x4e, 0x53, 0x20, 
-	0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0xa3, 0xba, 0x3c, 
+	0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 
+	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 
+	0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 
+	0x69, 0x63, 0x6b, 0x3d, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x20, 0x4d, 0x4d, 0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 
+	0x4d, 0x73, 0x67, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 
+	0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x26, 0x6e, 0x62, 0x73, 
+	0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
 	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 
-	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 
-	0x65, 0x3d, 0x22, 0x44, 0x6e, 0x73, 0x22, 0x20, 0x74, 0x79, 
-	0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x44, 0x6e, 0x73, 0x22, 0x20, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x2e, 
-	0x32, 0x2e, 0x34, 0x2e, 0x35, 0x31, 0x22, 0x20, 0x73, 0x69, 
-	0x7a, 0x65, 0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x6d, 0x61, 
-	0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x31, 
-	0x35, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 
-	0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 
-	0x67, 0x68, 0x74, 0x22, 0x3e, 0x44, 0x4e, 0x53, 0x20, 0x4e, 
-	0x61, 0x6d, 0x65, 0x28, 0x41, 0x50, 0x29, 0xa3, 0xba, 0x3c, 
-	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 
-	0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
-	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x6e, 0x73, 
-	0x4e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
-	0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x44, 0x6e, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x22, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 
-	0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x33, 0x32, 0x22, 
-	0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 
-	0x3d, 0x22, 0x33, 0x32, 0x22, 0x20, 0x20, 0x2f, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 
-	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x9, 0x9, 0x9, 0x9, 0xd, 
-	0xa, 0x9, 0x9, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 
-	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
-	0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
-	0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 
-	0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-	0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 
-	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 
-	0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 
+	0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 
+	0x3e, 0xd, 0xa, 0x9, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x6f, 0x72, 
+	0x6d, 0x31, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 
+	0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 0x20, 0x61, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 
+	0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x6f, 0x72, 0x79, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x68, 0x33, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 
+	0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
+	0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x36, 
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x22, 0x3e, 0x41, 0x75, 0x74, 
+	0x6f, 0x20, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x53, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3d, 0x22, 0x35, 0x30, 0x30, 0x22, 0x20, 0x62, 0x6f, 0x72, 
+	0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 
+	0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 
+	0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 
+	0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x35, 0x22, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 
-	0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 
-	0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 
-	0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 
-	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x4d, 0x4d, 0x5f, 
-	0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 
-	0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 
-	0x61, 0x76, 0x65, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 
+	0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
+	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 
+	0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 
+	0x22, 0x34, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 
+	0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
-	0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 
-	0x73, 0x70, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
+	0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 
+	0x22, 0x31, 0x38, 0x33, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 
+	0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 
+	0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x3c, 0x2f, 0x74, 0x64, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x63, 0x6f, 0x6c, 
+	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x33, 0x22, 0x20, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 
+	0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 
-	0x62, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x9, 0x3c, 
-	0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0xd, 0xa, 0x9, 0x3c, 
-	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 
-	0x6f, 0x72, 0x6d, 0x31, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 0x20, 0x6d, 
-	0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 
-	0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 
-	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 
-	0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 
-	0x73, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x20, 0x73, 
-	0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 
-	0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 
-	0x6f, 0x72, 0x3a, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 
-	0x22, 0x3e, 0x41, 0x75, 0x74, 0x6f, 0x20, 0x4d, 0x6f, 0x64, 
-	0x65, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
-	0x3c, 0x2f, 0x68, 0x33, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x35, 0x30, 0x30, 
-	0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 
-	0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 
-	0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 
-	0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 
-	0x3d, 0x22, 0x35, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 
+	0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x75, 0x74, 0x6f, 
+	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 
+	0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x41, 0x75, 0x74, 0x6f, 0x22, 0x20, 0x6f, 
+	0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x61, 0x75, 
+	0x74, 0x6f, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 
+	0x6b, 0x65, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 
+	0x65, 0x64, 0x22, 0x20, 0x2f, 0x3e, 0x20, 0x41, 0x75, 0x74, 
+	0x6f, 0x20, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x45, 0x6e, 0x61, 
+	0x62, 0x6c, 0x65, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x9, 0x3c, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x75, 0x74, 
+	0x6f, 0x48, 0x69, 0x64, 0x65, 0x6e, 0x22, 0x20, 0x74, 0x79, 
+	0x70, 0x65, 0x3d, 0x22, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 
+	0x22, 0x20, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x41, 0x75, 0x74, 
+	0x6f, 0x48, 0x69, 0x64, 0x65, 0x6e, 0x22, 0x20, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x2f, 0x3e, 0x3c, 
+	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-	0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 
-	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x3c, 
+	0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x50, 
+	0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0xa3, 0xba, 0x3c, 
 	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
-	0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 
-	0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 
-	0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x38, 0x33, 0x22, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 
-	0x67, 0x68, 0x74, 0x22, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 
-	0x3b, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x64, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 
-	0x22, 0x33, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 
-	0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 
-	0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x41, 0x75, 0x74, 0x6f, 0x22, 0x20, 0x74, 0x79, 0x70, 
-	0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 
-	0x78, 0x22, 0x20, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x41, 0x75, 
-	0x74, 0x6f, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 
-	0x6b, 0x3d, 0x22, 0x61, 0x75, 0x74, 0x6f, 0x28, 0x29, 0x22, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 
-	0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x22, 
-	0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x20, 0x2f, 
-	0x3e, 0x20, 0x41, 0x75, 0x74, 0x6f, 0x20, 0x4d, 0x6f, 0x64, 
-	0x65, 0x20, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x3c, 
-	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x9, 
-	0x9, 0x9, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 
-	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x41, 0x75, 0x74, 0x6f, 0x48, 0x69, 0x64, 0x65, 
-	0x6e, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x68, 
-	0x69, 0x64, 0x64, 0x65, 0x6e, 0x22, 0x20, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x41, 0x75, 0x74, 0x6f, 0x48, 0x69, 0x64, 0x65, 
-	0x6e, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
-	0x30, 0x22, 0x2f, 0x3e, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 
-	0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 
-	0x68, 0x74, 0x22, 0x3e, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 
-	0x6f, 0x6c, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-	0x3d, 0x22, 0x33, 0x30, 0x32, 0x22, 0x20, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 
-	0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 
-	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f, 0x74, 0x6f, 
-	0x63, 0x6f, 0x6c, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 
-	0x22, 0x31, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 
-	0x67, 0x65, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 
-	0x6f, 0x6c, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x28, 
-	0x29, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x50, 0x72, 0x6f, 
-	0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x22, 0x20, 0x3e, 0x20, 0x3c, 
-	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 
-	0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x73, 0x65, 0x6c, 
-	0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 
-	0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x54, 0x43, 0x50, 
-	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 
-	0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x55, 0x44, 
-	0x50, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 
-	0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 
-	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 
-	0x22, 0x3e, 0x43, 0x2f, 0x53, 0x20, 0x4d, 0x6f, 0x64, 0x65, 
-	0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 
-	0x33, 0x30, 0x32, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x33, 0x30, 0x32, 
+	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 
+	0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 
+	0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
+	0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x22, 0x20, 
+	0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x6f, 
+	0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x70, 
+	0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x5f, 0x73, 0x65, 
+	0x6c, 0x65, 0x63, 0x74, 0x28, 0x29, 0x22, 0x20, 0x69, 0x64, 
+	0x3d, 0x22, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 
+	0x22, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 
+	0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 
+	0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 
+	0x22, 0x3e, 0x54, 0x43, 0x50, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x31, 0x22, 0x3e, 0x55, 0x44, 0x50, 0x3c, 0x2f, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 
-	0x65, 0x3d, 0x22, 0x43, 0x73, 0x22, 0x20, 0x73, 0x69, 0x7a, 
-	0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x68, 
-	0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x74, 
-	0x6f, 0x63, 0x6f, 0x6c, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 
-	0x74, 0x28, 0x29, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x43, 
-	0x73, 0x22, 0x20, 0x20, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x30, 0x22, 0x3e, 0x43, 0x4c, 0x49, 0x45, 0x4e, 0x54, 
-	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 
-	0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x73, 0x65, 
-	0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x22, 0x73, 0x65, 
-	0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x3e, 0x53, 0x45, 
-	0x52, 0x56, 0x45, 0x52, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 
-	0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 
-	0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 
-	0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 
-	0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x53, 0x65, 0x72, 0x76, 
-	0x65, 0x72, 0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 
-	0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 
+	0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 
+	0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
 	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 
-	0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x44, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x79, 
-	0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x44, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 
-	0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
-	0x39, 0x32, 0x2e, 0x31, 0x36, 0x38, 0x2e, 0x31, 0x2e, 0x31, 
-	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x35, 
-	0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
-	0x68, 0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x20, 0x2f, 0x3e, 
+	0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x43, 0x2f, 0x53, 
+	0x20, 0x4d, 0x6f, 0x64, 0x65, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 
+	0x64, 0x74, 0x68, 0x3d, 0x22, 0x33, 0x30, 0x32, 0x22, 0x20, 
+	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 
+	0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
-	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
-	0xd, 0xa, 0x9, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 
-	0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x74, 0x6f, 0x70, 0x22, 0x3e, 0x54, 0x63, 0x70, 0x20, 
-	0x4c, 0x69, 0x6e, 0x6b, 0x20, 0x54, 0x69, 0x6d, 0x65, 0x4f, 
-	0x75, 0x74, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x20, 0x76, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x73, 
+	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 
+	0x20, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 
+	0x22, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x5f, 
+	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x28, 0x29, 0x22, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x43, 0x73, 0x22, 0x20, 0x20, 0x3e, 
+	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3e, 0x43, 
+	0x4c, 0x49, 0x45, 0x4e, 0x54, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x31, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 
+	0x64, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 
+	0x64, 0x22, 0x3e, 0x53, 0x45, 0x52, 0x56, 0x45, 0x52, 0x3c, 
+	0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 
+	0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 
+	0x3e, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x41, 0x64, 
+	0x64, 0x72, 0x65, 0x73, 0x73, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 
 	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 
-	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x43, 0x50, 0x5f, 0x54, 
-	0x69, 0x6d, 0x65, 0x4f, 0x75, 0x74, 0x22, 0x20, 0x74, 0x79, 
-	0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x54, 0x43, 0x50, 0x5f, 0x54, 
-	0x69, 0x6d, 0x65, 0x4f, 0x75, 0x74, 0x22, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x30, 0x30, 
-	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x35, 0x22, 
-	0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 
-	0x3d, 0x22, 0x38, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x73, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x28, 0x72, 0x61, 0x6e, 0x67, 0x65, 
-	0x20, 0x3c, 0x30, 0x20, 0x2c, 0x20, 0x31, 0x30, 0x30, 0x30, 
-	0x30, 0x30, 0x30, 0x30, 0x3e, 0x29, 0x3c, 0x2f, 0x74, 0x64, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x3c, 0x74, 
+	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x6f, 0x6d, 0x61, 0x69, 
+	0x6e, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 
+	0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x44, 
+	0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x22, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x31, 0x39, 0x32, 0x2e, 0x31, 0x36, 
+	0x38, 0x2e, 0x31, 0x2e, 0x31, 0x22, 0x20, 0x73, 0x69, 0x7a, 
+	0x65, 0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x6d, 0x61, 0x78, 
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x35, 
+	0x22, 0x20, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x74, 
 	0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
 	0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
 	0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x76, 0x61, 
 	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 
-	0x3e, 0x50, 0x6f, 0x72, 0x74, 0x20, 0x4e, 0x75, 0x6d, 0x62, 
-	0x65, 0x72, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x20, 0x76, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 
-	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
+	0x3e, 0x54, 0x63, 0x70, 0x20, 0x4c, 0x69, 0x6e, 0x6b, 0x20, 
+	0x54, 0x69, 0x6d, 0x65, 0x4f, 0x75, 0x74, 0xa3, 0xba, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
+	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 
+	0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x74, 0x6f, 0x70, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
+	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 
+	0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
+	0x54, 0x43, 0x50, 0x5f, 0x54, 0x69, 0x6d, 0x65, 0x4f, 0x75, 
+	0x74, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 
+	0x65, 0x78, 0x74, 0x22, 0x20, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x54, 0x43, 0x50, 0x5f, 0x54, 0x69, 0x6d, 0x65, 0x4f, 0x75, 
+	0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x31, 0x30, 0x30, 0x30, 0x30, 0x22, 0x20, 0x73, 0x69, 0x7a, 
+	0x65, 0x3d, 0x22, 0x35, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x38, 0x22, 0x20, 
+	0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 
+	0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x3c, 0x30, 0x20, 0x2c, 
+	0x20, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3e, 
+	0x29, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
+	0x3e, 0xd, 0xa, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 
+	0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 
+	0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x74, 0x6f, 0x70, 0x22, 0x3e, 0x50, 0x6f, 0x72, 0x74, 
+	0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0xa3, 0xba, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
+	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 
+	0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x74, 0x6f, 0x70, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
+	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 
+	0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
+	0x50, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x30, 
+	0x30, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x35, 
+	0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
+	0x68, 0x3d, 0x22, 0x35, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 
-	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x22, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 
-	0x74, 0x22, 0x20, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x50, 0x6f, 
-	0x72, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x31, 0x30, 0x30, 0x30, 0x30, 0x22, 0x20, 0x73, 0x69, 
-	0x7a, 0x65, 0x3d, 0x22, 0x35, 0x22, 0x20, 0x6d, 0x61, 0x78, 
-	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x35, 0x22, 
-	0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x74, 0x72, 0x3e, 0x9, 0x9, 0xd, 0xa, 0x9, 0x9, 0x3c, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 
-	0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 
-	0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 
-	0x34, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x9, 0x9, 
+	0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+	0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 
+	0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 
+	0x9, 0x9, 0x3c, 0x74, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
+	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 
+	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 
+	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 
+	0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x3e, 0xd, 0xa, 0x9, 
+	0x9, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 
+	0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
+	0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 
+	0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 
+	0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x46, 0x6f, 0x72, 
+	0x6d, 0x33, 0x4d, 0x4d, 0x5f, 0x70, 0x6f, 0x70, 0x75, 0x70, 
+	0x4d, 0x73, 0x67, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 
+	0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 
-	0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6d, 
-	0x69, 0x64, 0x64, 0x6c, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 
+	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x26, 0x6e, 0x62, 0x73, 
+	0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
-	0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
-	0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x20, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 
-	0x22, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 
-	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 
-	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 
-	0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
-	0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 
-	0x69, 0x63, 0x6b, 0x3d, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 
-	0x6e, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x33, 0x4d, 0x4d, 0x5f, 
-	0x70, 0x6f, 0x70, 0x75, 0x70, 0x4d, 0x73, 0x67, 0x28, 0x29, 
-	0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 
-	0x61, 0x76, 0x65, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
-	0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 
-	0x73, 0x70, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 
-	0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 
-	0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 
-	0x6e, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
+	0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 
-	0x65, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x66, 
-	0x6f, 0x72, 0x6d, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 
-	0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 
-	0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x69, 0x74, 
-	0x65, 0x49, 0x6e, 0x66, 0x6f, 0x22, 0x3e, 0x43, 0x6f, 0x70, 
-	0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x31, 
-	0x30, 0x2d, 0x32, 0x30, 0x31, 0x33, 0x20, 0x3c, 0x2f, 0x64, 
-	0x69, 0x76, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x64, 0x69, 0x76, 
-	0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x65, 0x6e, 0x64, 
-	0x20, 0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 
-	0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x62, 0x72, 0x20, 0x2f, 
-	0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 
-	0xd, 0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xd, 
-	0xa, };
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 
+	0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 
+	0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 
+	0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 
+	0xa, 0x9, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 
+	0x3d, 0x22, 0x73, 0x69, 0x74, 0x65, 0x49, 0x6e, 0x66, 0x6f, 
+	0x22, 0x3e, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 
+	0x74, 0x20, 0x32, 0x30, 0x31, 0x30, 0x2d, 0x32, 0x30, 0x31, 
+	0x33, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x3c, 0x21, 
+	0x2d, 0x2d, 0x65, 0x6e, 0x64, 0x20, 0x70, 0x61, 0x67, 0x65, 
+	0x63, 0x65, 0x6c, 0x6c, 0x31, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 
+	0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 
+	0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 
+	0x74, 0x6d, 0x6c, 0x3e, 0xd, 0xa, };
 
 static const unsigned char data_firmware_html[] = {
 	/* /firmware.html */
@@ -3307,426 +3317,428 @@ static const unsigned char data_firmware_html[] = {
 	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
 	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
 	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
-	0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, 0x3c, 0x21, 0x44, 
-	0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 
-	0x6c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 
-	0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f, 0x2f, 0x44, 0x54, 
-	0x44, 0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x31, 0x2e, 
-	0x30, 0x20, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 
-	0x6f, 0x6e, 0x61, 0x6c, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x20, 
-	0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 
-	0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x54, 
-	0x52, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2f, 0x44, 
-	0x54, 0x44, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2d, 
-	0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
-	0x61, 0x6c, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 0xd, 0xa, 
-	0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 
-	0x73, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 
-	0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 
-	0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x78, 0x68, 0x74, 0x6d, 
-	0x6c, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 
-	0x44, 0x57, 0x36, 0x20, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 
-	0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 
-	0x2d, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x20, 0x32, 0x30, 0x30, 0x35, 0x20, 0x4d, 0x61, 0x63, 
-	0x72, 0x6f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2c, 0x20, 0x49, 
-	0x6e, 0x63, 0x2e, 0x20, 0x41, 0x6c, 0x6c, 0x20, 0x72, 0x69, 
-	0x67, 0x68, 0x74, 0x73, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 
-	0x76, 0x65, 0x64, 0x2e, 0x20, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 
-	0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x68, 0x74, 0x74, 0x70, 
-	0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d, 0x22, 0x43, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 
-	0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 
-	0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 
-	0x3b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 
-	0x67, 0x62, 0x32, 0x33, 0x31, 0x32, 0x22, 0x20, 0x2f, 0x3e, 
-	0xd, 0xa, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x53, 
-	0x79, 0x73, 0x74, 0x65, 0x6d, 0x26, 0x6e, 0x62, 0x73, 0x70, 
-	0x3b, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0xd, 
-	0xa, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 
-	0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 
-	0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 
-	0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0x22, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 
-	0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2f, 0x3e, 0xd, 
-	0xa, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x74, 
-	0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 
-	0x4a, 0x61, 0x76, 0x61, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 
-	0x22, 0x3e, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x52, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 
-	0x28, 0x29, 0xd, 0xa, 0x7b, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x63, 
-	0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x28, 0x27, 0x41, 0x72, 
-	0x65, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x73, 0x75, 0x72, 0x65, 
-	0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 
-	0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x3f, 0x27, 
-	0x29, 0x29, 0x7b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x64, 
-	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x79, 
-	0x73, 0x74, 0x65, 0x6d, 0x69, 0x6e, 0x66, 0x6f, 0x2e, 0x73, 
-	0x75, 0x62, 0x6d, 0x69, 0x74, 0x28, 0x29, 0x3b, 0xd, 0xa, 
-	0x9, 0x7d, 0x20, 0x9, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x66, 
-	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x55, 0x70, 
-	0x47, 0x72, 0x61, 0x64, 0x65, 0x28, 0x29, 0xd, 0xa, 0x7b, 
+	0x74, 0x6d, 0x6c, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 
+	0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 
+	0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0xd, 0xa, 
+	0xd, 0xa, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 
+	0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x50, 0x55, 0x42, 
+	0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 0x57, 0x33, 
+	0x43, 0x2f, 0x2f, 0x44, 0x54, 0x44, 0x20, 0x58, 0x48, 0x54, 
+	0x4d, 0x4c, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x54, 0x72, 0x61, 
+	0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2f, 
+	0x2f, 0x45, 0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 
+	0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 
+	0x6f, 0x72, 0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 0x74, 
+	0x6d, 0x6c, 0x31, 0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 0x68, 
+	0x74, 0x6d, 0x6c, 0x31, 0x2d, 0x74, 0x72, 0x61, 0x6e, 0x73, 
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2e, 0x64, 0x74, 
+	0x64, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 
+	0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 
+	0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 
+	0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 
+	0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0xd, 0xa, 
+	0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x44, 0x57, 0x36, 0x20, 0x2d, 
+	0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 
+	0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x70, 
+	0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x30, 
+	0x35, 0x20, 0x4d, 0x61, 0x63, 0x72, 0x6f, 0x6d, 0x65, 0x64, 
+	0x69, 0x61, 0x2c, 0x20, 0x49, 0x6e, 0x63, 0x2e, 0x20, 0x41, 
+	0x6c, 0x6c, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 
+	0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2e, 0x20, 
+	0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x6d, 0x65, 0x74, 0x61, 
+	0x20, 0x68, 0x74, 0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 
+	0x76, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
+	0x2d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 
+	0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 
+	0x72, 0x73, 0x65, 0x74, 0x3d, 0x67, 0x62, 0x32, 0x33, 0x31, 
+	0x32, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x69, 
+	0x74, 0x6c, 0x65, 0x3e, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 
+	0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x3c, 0x2f, 0x74, 0x69, 
+	0x74, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x3c, 0x6c, 0x69, 0x6e, 
+	0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 
+	0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 
+	0x72, 0x65, 0x66, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+	0x2e, 0x63, 0x73, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 
+	0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x73, 0x63, 0x72, 
+	0x69, 0x70, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 
+	0x74, 0x65, 0x78, 0x74, 0x2f, 0x4a, 0x61, 0x76, 0x61, 0x53, 
+	0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x52, 0x65, 
+	0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 0x29, 0xd, 0xa, 0x7b, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 
-	0x9, 0x69, 0x66, 0x20, 0x28, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
-	0x65, 0x6e, 0x74, 0x2e, 0x46, 0x69, 0x72, 0x6d, 0x57, 0x61, 
-	0x72, 0x65, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x2e, 
-	0x66, 0x69, 0x6c, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x20, 0x3d, 0x3d, 0x20, 0x22, 0x22, 0x29, 0xd, 0xa, 0x9, 
-	0x7b, 0xd, 0xa, 0x9, 0x9, 0x61, 0x6c, 0x65, 0x72, 0x74, 
-	0x28, 0x22, 0x50, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x73, 
-	0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 
-	0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x22, 0x29, 0x3b, 0xd, 
-	0xa, 0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
-	0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 0x69, 0x66, 
-	0x28, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x28, 0x27, 
-	0x41, 0x72, 0x65, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x73, 0x75, 
-	0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x70, 0x64, 0x61, 
-	0x74, 0x65, 0x20, 0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 
-	0x65, 0x3f, 0x27, 0x29, 0x29, 0x7b, 0xd, 0xa, 0x9, 0x20, 
-	0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
-	0x2e, 0x46, 0x69, 0x72, 0x6d, 0x57, 0x61, 0x72, 0x65, 0x55, 
-	0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x2e, 0x73, 0x75, 0x62, 
-	0x6d, 0x69, 0x74, 0x28, 0x29, 0x20, 0x3b, 0xd, 0xa, 0x9, 
-	0x7d, 0x20, 0x9, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x3c, 0x2f, 
-	0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0xd, 0xa, 0x3c, 
-	0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x62, 
-	0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x64, 0x69, 0x76, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 0x67, 0x65, 0x63, 
-	0x65, 0x6c, 0x6c, 0x31, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 
-	0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x38, 
-	0x30, 0x30, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
-	0x38, 0x30, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x70, 0x61, 
-	0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x2d, 0x2d, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x73, 
-	0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 
-	0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 
-	0x6f, 0x72, 0x3a, 0x23, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 
-	0x22, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x3c, 0x2f, 
+	0x9, 0x69, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 
+	0x6d, 0x28, 0x27, 0x41, 0x72, 0x65, 0x20, 0x79, 0x6f, 0x75, 
+	0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 
+	0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x73, 0x79, 0x73, 
+	0x74, 0x65, 0x6d, 0x3f, 0x27, 0x29, 0x29, 0x7b, 0xd, 0xa, 
+	0x9, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x69, 
+	0x6e, 0x66, 0x6f, 0x2e, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 
+	0x28, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0x20, 0x9, 0xd, 
+	0xa, 0x7d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x55, 0x70, 0x47, 0x72, 0x61, 0x64, 0x65, 
+	0x28, 0x29, 0xd, 0xa, 0x7b, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0xd, 0xa, 0x9, 0x69, 0x66, 0x20, 0x28, 
+	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x46, 
+	0x69, 0x72, 0x6d, 0x57, 0x61, 0x72, 0x65, 0x55, 0x70, 0x67, 
+	0x72, 0x61, 0x64, 0x65, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x2e, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x22, 
+	0x22, 0x29, 0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 
+	0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x22, 0x50, 0x6c, 0x65, 
+	0x61, 0x73, 0x65, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
+	0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 
+	0x74, 0x22, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x9, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x3b, 0xd, 0xa, 0x9, 0x7d, 
+	0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x66, 
+	0x69, 0x72, 0x6d, 0x28, 0x27, 0x41, 0x72, 0x65, 0x20, 0x79, 
+	0x6f, 0x75, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 
+	0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x66, 0x69, 
+	0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x3f, 0x27, 0x29, 0x29, 
+	0x7b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x46, 0x69, 0x72, 0x6d, 
+	0x57, 0x61, 0x72, 0x65, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 
+	0x65, 0x2e, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x28, 0x29, 
+	0x20, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0x20, 0x9, 0xd, 0xa, 
+	0x7d, 0xd, 0xa, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 
+	0x74, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 
+	0x3e, 0xd, 0xa, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 
+	0xa, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x22, 
+	0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 
+	0x64, 0x74, 0x68, 0x3a, 0x38, 0x30, 0x30, 0x3b, 0x68, 0x65, 
+	0x69, 0x67, 0x68, 0x74, 0x3d, 0x38, 0x30, 0x30, 0x22, 0x20, 
+	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 
+	0x74, 0x65, 0x72, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 
+	0x21, 0x2d, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 
+	0x6c, 0x31, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 
+	0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 
+	0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
+	0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x43, 
+	0x43, 0x43, 0x43, 0x43, 0x43, 0x22, 0x3e, 0x26, 0x6e, 0x62, 
+	0x73, 0x70, 0x3b, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 
+	0x3d, 0x22, 0x70, 0x61, 0x67, 0x65, 0x4e, 0x61, 0x6d, 0x65, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 
+	0x32, 0x3e, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x3c, 
+	0x2f, 0x68, 0x32, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 
 	0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 
 	0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 0x67, 
-	0x65, 0x4e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x68, 0x32, 0x3e, 0x53, 0x79, 0x73, 
-	0x74, 0x65, 0x6d, 0x20, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x70, 0x61, 0x67, 0x65, 0x4e, 0x61, 0x76, 0x22, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 
-	0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x63, 0x74, 
-	0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6e, 0x6b, 0x73, 0x22, 0x3e, 
-	0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 
-	0x62, 0x61, 0x73, 0x69, 0x63, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 
-	0x22, 0x3e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x20, 0x3c, 0x2f, 
-	0x61, 0x3e, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 
-	0x3d, 0x22, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x2e, 
-	0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x41, 0x64, 0x76, 0x61, 
-	0x6e, 0x63, 0x65, 0x64, 0x20, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 
-	0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x66, 
-	0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x2e, 0x68, 0x74, 
-	0x6d, 0x6c, 0x22, 0x3e, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 
-	0x20, 0x3c, 0x2f, 0x61, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x3e, 
-	0x3c, 0x2f, 0x70, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x64, 0x69, 
-	0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x64, 0x76, 0x65, 
-	0x72, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x70, 0x20, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 
-	0x74, 0x22, 0x3e, 0xa1, 0xa4, 0x53, 0x79, 0x73, 0x74, 0x65, 
-	0x6d, 0x20, 0x49, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x4d, 0x61, 0x63, 0x20, 0x61, 
-	0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x2c, 0x68, 0x61, 0x72, 
-	0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 
-	0x69, 0x6f, 0x6e, 0x2c, 0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 
-	0x72, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 
-	0x20, 0x3c, 0x2f, 0x70, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x70, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 
-	0x66, 0x74, 0x22, 0x3e, 0xa1, 0xa4, 0x46, 0x69, 0x72, 0x6d, 
-	0x77, 0x61, 0x72, 0x65, 0x20, 0x55, 0x70, 0x67, 0x72, 0x61, 
-	0x64, 0x65, 0x3a, 0x20, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 
-	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x6d, 0x77, 
-	0x61, 0x72, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x61, 
-	0x6e, 0x64, 0x20, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x20, 0x74, 
-	0x68, 0x65, 0xa1, 0xb0, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 
-	0x65, 0xa1, 0xb1, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 
-	0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x79, 0x6f, 0x75, 
-	0x20, 0x63, 0x61, 0x6e, 0x20, 0x75, 0x70, 0x67, 0x72, 0x61, 
-	0x64, 0x65, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x66, 0x69, 
-	0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x20, 0x3c, 0x2f, 0x70, 
-	0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 
-	0x64, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
-	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 
-	0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x79, 0x73, 0x74, 
-	0x65, 0x6d, 0x69, 0x6e, 0x66, 0x6f, 0x22, 0x20, 0x6e, 0x61, 
-	0x6d, 0x65, 0x3d, 0x22, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 
-	0x69, 0x6e, 0x66, 0x6f, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 
-	0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 0x20, 0x61, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 
-	0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x6f, 
-	0x72, 0x79, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x68, 0x33, 0x20, 0x73, 0x74, 0x79, 0x6c, 
-	0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 
-	0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
-	0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x22, 0x3e, 0x53, 
-	0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x49, 0x6e, 0x66, 0x6f, 
-	0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x68, 
-	0x33, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 
-	0x74, 0x68, 0x3d, 0x22, 0x34, 0x30, 0x30, 0x22, 0x20, 0x62, 
-	0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 
-	0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 
-	0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 
-	0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x35, 
-	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 
-	0x31, 0x30, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 
-	0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 
-	0x22, 0x3e, 0x4d, 0x61, 0x63, 0x20, 0x41, 0x64, 0x64, 0x72, 
-	0x65, 0x73, 0x73, 0x20, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 
+	0x65, 0x4e, 0x61, 0x76, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 
+	0x6e, 0x6b, 0x73, 0x22, 0x3e, 0x20, 0x3c, 0x61, 0x20, 0x68, 
+	0x72, 0x65, 0x66, 0x3d, 0x22, 0x62, 0x61, 0x73, 0x69, 0x63, 
+	0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x42, 0x61, 0x73, 
+	0x69, 0x63, 0x20, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x3c, 0x61, 
+	0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x61, 0x64, 0x76, 
+	0x61, 0x6e, 0x63, 0x65, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 
+	0x3e, 0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x20, 
+	0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 
+	0x65, 0x66, 0x3d, 0x22, 0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 
+	0x72, 0x65, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x53, 
+	0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x3c, 0x2f, 0x61, 0x3e, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x70, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0xd, 
+	0xa, 0x9, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x61, 0x64, 0x76, 0x65, 0x72, 0x74, 0x22, 0x3e, 0xd, 
+	0xa, 0x9, 0x3c, 0x70, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0xa1, 0xa4, 
+	0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x49, 0x6e, 0x66, 
+	0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 
+	0x4d, 0x61, 0x63, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 
+	0x73, 0x2c, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 
+	0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2c, 0x66, 
+	0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x20, 0x76, 0x65, 
+	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3c, 0x2f, 0x70, 0x3e, 
+	0xd, 0xa, 0x9, 0x3c, 0x70, 0x20, 0x61, 0x6c, 0x69, 0x67, 
+	0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0xa1, 
+	0xa4, 0x46, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x20, 
+	0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x3a, 0x20, 0x53, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x20, 0x66, 
+	0x69, 0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6c, 
+	0x69, 0x63, 0x6b, 0x20, 0x74, 0x68, 0x65, 0xa1, 0xb0, 0x75, 
+	0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0xa1, 0xb1, 0x20, 0x62, 
+	0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+	0x6e, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x63, 0x61, 0x6e, 0x20, 
+	0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x79, 0x6f, 
+	0x75, 0x72, 0x20, 0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 
+	0x65, 0x20, 0x3c, 0x2f, 0x70, 0x3e, 0xd, 0xa, 0x9, 0x3c, 
+	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 
+	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 
+	0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x63, 0x6f, 
+	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x69, 0x6e, 0x66, 
+	0x6f, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 
+	0x79, 0x73, 0x74, 0x65, 0x6d, 0x69, 0x6e, 0x66, 0x6f, 0x22, 
+	0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 
+	0x65, 0x74, 0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3d, 0x22, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 
+	0x3d, 0x22, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 
+	0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 
+	0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 
+	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x36, 0x36, 0x36, 0x36, 
+	0x36, 0x36, 0x22, 0x3e, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 
+	0x20, 0x49, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 
+	0x6f, 0x6e, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 
+	0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x34, 
+	0x30, 0x30, 0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 
+	0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 
+	0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 
+	0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 
+	0x6e, 0x67, 0x3d, 0x22, 0x35, 0x22, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 
-	0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 
-	0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 
-	0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x41, 0x43, 0x20, 0x41, 0x64, 
-	0x64, 0x72, 0x65, 0x73, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 
-	0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 
-	0x64, 0x3d, 0x22, 0x4d, 0x61, 0x63, 0x41, 0x64, 0x72, 0x22, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 
-	0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 
-	0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x22, 
-	0x2f, 0x3e, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x9, 
-	0x9, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 
-	0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x32, 0x30, 
-	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 
-	0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x48, 0x61, 0x72, 0x64, 
-	0x77, 0x61, 0x72, 0x65, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 
-	0x6f, 0x6e, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 
+	0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x3e, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
+	0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x48, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 
-	0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x20, 
-	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
-	0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x48, 0x61, 0x72, 0x64, 
-	0x56, 0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x30, 0x22, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 
-	0x6c, 0x65, 0x64, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 
-	0x6c, 0x65, 0x64, 0x22, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 
-	0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 
+	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x4d, 0x61, 0x63, 
+	0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0xa3, 
+	0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 
+	0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 
+	0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 
+	0x41, 0x43, 0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 
+	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 
+	0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x4d, 0x61, 
+	0x63, 0x41, 0x64, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x64, 0x69, 0x73, 0x61, 
+	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x61, 
+	0x62, 0x6c, 0x65, 0x64, 0x22, 0x2f, 0x3e, 0x3c, 0x2f, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x72, 
+	0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3d, 0x22, 0x31, 0x32, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 
+	0x3e, 0x48, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 
+	0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0xa3, 0xba, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
+	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 
+	0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 
-	0x68, 0x3d, 0x22, 0x31, 0x32, 0x30, 0x22, 0x20, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 
-	0x22, 0x3e, 0x46, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 
-	0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0xa3, 0xba, 
-	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48, 0x61, 0x72, 
+	0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x56, 0x65, 0x72, 0x73, 
+	0x69, 0x6f, 0x6e, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
+	0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x48, 0x61, 0x72, 0x64, 0x56, 0x65, 0x72, 0x22, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 
+	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x22, 
+	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x22, 0x2f, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 
+	0x9, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 
-	0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x32, 
+	0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x46, 0x69, 0x72, 
+	0x6d, 0x77, 0x61, 0x72, 0x65, 0x20, 0x56, 0x65, 0x72, 0x73, 
+	0x69, 0x6f, 0x6e, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 
+	0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 
+	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 
+	0x65, 0x3d, 0x22, 0x46, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 
+	0x65, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 
+	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 
+	0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x46, 0x69, 0x72, 
+	0x6d, 0x56, 0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x64, 0x69, 0x73, 0x61, 
+	0x62, 0x6c, 0x65, 0x64, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x61, 
+	0x62, 0x6c, 0x65, 0x64, 0x22, 0x2f, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 
 	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 
-	0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 
-	0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x20, 0x56, 0x65, 0x72, 
-	0x73, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
-	0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x46, 0x69, 0x72, 0x6d, 0x56, 0x65, 0x72, 0x22, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 
-	0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 
-	0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x22, 
-	0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 
+	0x74, 0x68, 0x3d, 0x22, 0x31, 0x32, 0x30, 0x22, 0x20, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 
+	0x74, 0x22, 0x3e, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 
+	0x20, 0x54, 0x69, 0x6d, 0x65, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 
+	0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65, 0x6c, 0x65, 0x61, 
+	0x73, 0x65, 0x20, 0x54, 0x69, 0x6d, 0x65, 0x22, 0x20, 0x74, 
+	0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 
+	0x20, 0x69, 0x64, 0x3d, 0x22, 0x52, 0x65, 0x6c, 0x54, 0x69, 
+	0x6d, 0x65, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x30, 0x22, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+	0x65, 0x64, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+	0x65, 0x64, 0x22, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 
+	0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 
+	0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 
+	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
+	0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
+	0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
+	0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 
+	0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x74, 0x6f, 0x70, 0x22, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 
+	0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
+	0x9, 0x9, 0x20, 0x20, 0x9, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x72, 0x65, 0x73, 0x74, 
+	0x61, 0x72, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
+	0x22, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x22, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x2f, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 
+	0x74, 0x22, 0x20, 0x6f, 0x6e, 0x43, 0x6c, 0x69, 0x63, 0x6b, 
+	0x3d, 0x22, 0x52, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 
+	0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x52, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x53, 0x79, 
+	0x73, 0x74, 0x65, 0x6d, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
+	0x6c, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 
+	0x62, 0x73, 0x70, 0x3b, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 
-	0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 
-	0x32, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x52, 0x65, 
-	0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x54, 0x69, 0x6d, 0x65, 
-	0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 
-	0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x54, 0x69, 
-	0x6d, 0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 
-	0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
-	0x52, 0x65, 0x6c, 0x54, 0x69, 0x6d, 0x65, 0x22, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x64, 
-	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x22, 0x64, 
-	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x22, 0x2f, 0x3e, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 
+	0x9, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x9, 0xd, 
+	0xa, 0x9, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 
+	0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x20, 
+	0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x70, 0x6f, 
+	0x73, 0x74, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x61, 
+	0x72, 0x74, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x64, 0x61, 
+	0x74, 0x61, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
+	0x46, 0x69, 0x72, 0x6d, 0x57, 0x61, 0x72, 0x65, 0x55, 0x70, 
+	0x67, 0x72, 0x61, 0x64, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 
+	0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x6f, 0x72, 
+	0x79, 0x22, 0x3e, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x68, 0x33, 0x20, 0x73, 0x74, 0x79, 0x6c, 
+	0x65, 0x3d, 0x22, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 
+	0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
+	0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x22, 0x3e, 0x46, 
+	0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x20, 0x55, 0x70, 
+	0x67, 0x72, 0x61, 0x64, 0x65, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3d, 0x22, 0x34, 0x30, 0x30, 0x22, 0x20, 0x62, 0x6f, 0x72, 
+	0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 
+	0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 
+	0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 
+	0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x35, 0x22, 0x3e, 
 	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
-	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 
 	0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 
 	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 
 	0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 
 	0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 
-	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x3c, 0x74, 
-	0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
-	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 
-	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 
-	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 
-	0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 0x3e, 
-	0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x9, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 
-	0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x20, 
-	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x68, 0x69, 0x64, 0x64, 
-	0x65, 0x6e, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x31, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 
+	0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
+	0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 
+	0x32, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x46, 0x69, 
+	0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x20, 0x46, 0x69, 0x6c, 
+	0x65, 0xa3, 0xba, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 0x75, 0x74, 
-	0x74, 0x6f, 0x6e, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 
-	0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x20, 0x6f, 0x6e, 
-	0x43, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x52, 0x65, 0x73, 
-	0x74, 0x61, 0x72, 0x74, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x52, 0x65, 0x73, 0x74, 0x61, 
-	0x72, 0x74, 0x20, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x22, 
-	0x20, 0x2f, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 
+	0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x3d, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x20, 
+	0x2f, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x26, 0x6e, 0x62, 
-	0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 
-	0x69, 0x76, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x66, 0x6f, 
-	0x72, 0x6d, 0x3e, 0x9, 0xd, 0xa, 0x9, 0x20, 0x20, 0x3c, 
-	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3d, 0x22, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 
-	0x64, 0x3d, 0x22, 0x70, 0x6f, 0x73, 0x74, 0x22, 0x20, 0x65, 
-	0x6e, 0x63, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x6d, 0x75, 
-	0x6c, 0x74, 0x69, 0x70, 0x61, 0x72, 0x74, 0x2f, 0x66, 0x6f, 
-	0x72, 0x6d, 0x2d, 0x64, 0x61, 0x74, 0x61, 0x22, 0x20, 0x6e, 
-	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x72, 0x6d, 0x57, 
-	0x61, 0x72, 0x65, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 
-	0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 
-	0x31, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 
-	0x22, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x3e, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 
-	0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x62, 0x61, 
-	0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 
-	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x36, 0x36, 0x36, 0x36, 
-	0x36, 0x36, 0x22, 0x3e, 0x46, 0x69, 0x72, 0x6d, 0x77, 0x61, 
-	0x72, 0x65, 0x20, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 
-	0x3c, 0x2f, 0x68, 0x33, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x34, 0x30, 0x30, 
-	0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 
-	0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 
-	0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 
-	0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 
-	0x3d, 0x22, 0x35, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 
-	0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-	0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 
-	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 
-	0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
-	0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 
-	0x74, 0x68, 0x3d, 0x22, 0x31, 0x32, 0x30, 0x22, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x22, 0x3e, 0x46, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 
-	0x65, 0x20, 0x46, 0x69, 0x6c, 0x65, 0xa3, 0xba, 0x3c, 0x2f, 
-	0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 
-	0x66, 0x74, 0x22, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x66, 0x69, 0x6c, 
-	0x65, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 
-	0x69, 0x6c, 0x65, 0x22, 0x20, 0x2f, 0x3e, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
-	0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 
-	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
-	0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
-	0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 
-	0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 
-	0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-	0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 
-	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x33, 0x22, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 
-	0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 
-	0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 
-	0x65, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 
-	0x20, 0x6f, 0x6e, 0x43, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 
-	0x55, 0x70, 0x47, 0x72, 0x61, 0x64, 0x65, 0x28, 0x29, 0x22, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x55, 0x70, 
-	0x67, 0x72, 0x61, 0x64, 0x65, 0x22, 0x20, 0x2f, 0x3e, 0x9, 
-	0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x26, 0x6e, 0x62, 0x73, 
-	0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x3c, 0x2f, 
-	0x74, 0x64, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 
 	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 
 	0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
 	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 
 	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 
 	0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 
+	0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 
 	0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 
-	0x76, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 
-	0x6d, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 
-	0x76, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x69, 0x74, 0x65, 0x49, 
-	0x6e, 0x66, 0x6f, 0x22, 0x3e, 0x43, 0x6f, 0x70, 0x79, 0x72, 
-	0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x31, 0x30, 0x2d, 
-	0x32, 0x30, 0x31, 0x33, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 
-	0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 
-	0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x65, 0x6e, 0x64, 0x20, 0x70, 
-	0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x2d, 0x2d, 
-	0x3e, 0xd, 0xa, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0xd, 
-	0xa, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 
-	0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xd, 0xa, 0xd, 
-	0xa, };
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
+	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 
+	0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 
+	0x22, 0x33, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x76, 
+	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 
+	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 0x75, 
+	0x74, 0x74, 0x6f, 0x6e, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x43, 0x6c, 
+	0x69, 0x63, 0x6b, 0x3d, 0x22, 0x55, 0x70, 0x47, 0x72, 0x61, 
+	0x64, 0x65, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 
+	0x22, 0x20, 0x2f, 0x3e, 0x9, 0x20, 0x20, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 
+	0x73, 0x70, 0x3b, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 
+	0x9, 0x9, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
+	0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 
+	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
+	0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
+	0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 
+	0x61, 0x62, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x9, 
+	0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x73, 0x69, 0x74, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x22, 0x3e, 
+	0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 
+	0x32, 0x30, 0x31, 0x30, 0x2d, 0x32, 0x30, 0x31, 0x33, 0x20, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 
+	0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 
+	0x65, 0x6e, 0x64, 0x20, 0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 
+	0x6c, 0x6c, 0x31, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x62, 
+	0x72, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x62, 0x6f, 
+	0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 
+	0x6c, 0x3e, 0xd, 0xa, 0xd, 0xa, };
 
 static const unsigned char data_index_html[] = {
 	/* /index.html */
 	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
 	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
 	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
 	0x31, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x28, 0x68, 0x74, 0x74, 
@@ -3735,42 +3747,102 @@ static const unsigned char data_index_html[] = {
 	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
 	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
 	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
-	0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, 0x3c, 0x21, 0x44, 
-	0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 
-	0x6c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 
-	0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f, 0x2f, 0x44, 0x54, 
-	0x44, 0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x31, 0x2e, 
-	0x30, 0x20, 0x46, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x65, 0x74, 
-	0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 
-	0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 
-	0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 
-	0x74, 0x6d, 0x6c, 0x31, 0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 
-	0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2d, 0x66, 0x72, 0x61, 0x6d, 
-	0x65, 0x73, 0x65, 0x74, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 
-	0xd, 0xa, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x78, 0x6d, 
-	0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 
-	0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 
-	0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x78, 0x68, 
-	0x74, 0x6d, 0x6c, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x65, 
-	0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x6d, 0x65, 0x74, 0x61, 
-	0x20, 0x68, 0x74, 0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 
-	0x76, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
-	0x2d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 
-	0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
-	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 
-	0x72, 0x73, 0x65, 0x74, 0x3d, 0x67, 0x62, 0x32, 0x33, 0x31, 
-	0x32, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x69, 
-	0x74, 0x6c, 0x65, 0x3e, 0x55, 0x41, 0x52, 0x54, 0x2d, 0x57, 
-	0x69, 0x46, 0x69, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 
-	0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 
-	0xd, 0xa, 0x3c, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x65, 
-	0x74, 0x20, 0x72, 0x6f, 0x77, 0x73, 0x3d, 0x22, 0x2a, 0x22, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x66, 0x72, 0x61, 0x6d, 
-	0x65, 0x20, 0x73, 0x72, 0x63, 0x3d, 0x22, 0x62, 0x61, 0x73, 
-	0x69, 0x63, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x20, 0x2f, 
-	0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x66, 0x72, 0x61, 0x6d, 0x65, 
-	0x73, 0x65, 0x74, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x74, 
-	0x6d, 0x6c, 0x3e, 0xd, 0xa, };
+	0x74, 0x6d, 0x6c, 0xd, 0xa, 0x45, 0x54, 0x61, 0x67, 0x3a, 
+	0x20, 0x22, 0x64, 0x63, 0x65, 0x38, 0x39, 0x35, 0x64, 0x32, 
+	0x22, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2d, 0x43, 
+	0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 0x6e, 0x6f, 
+	0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0xd, 0xa, 0x56, 0x61, 
+	0x72, 0x79, 0x3a, 0x20, 0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 
+	0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0xd, 
+	0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x33, 0x34, 0x38, 
+	0xd, 0xa, 0xd, 0xa, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 
+	0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x50, 
+	0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 
+	0x57, 0x33, 0x43, 0x2f, 0x2f, 0x44, 0x54, 0x44, 0x20, 0x58, 
+	0x48, 0x54, 0x4d, 0x4c, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x46, 
+	0x72, 0x61, 0x6d, 0x65, 0x73, 0x65, 0x74, 0x2f, 0x2f, 0x45, 
+	0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 
+	0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 
+	0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 
+	0x31, 0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 0x68, 0x74, 0x6d, 
+	0x6c, 0x31, 0x2d, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x65, 
+	0x74, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 0xd, 0xa, 0x3c, 
+	0x68, 0x74, 0x6d, 0x6c, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 
+	0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 
+	0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 
+	0x31, 0x39, 0x39, 0x39, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 
+	0x22, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 
+	0xd, 0xa, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x68, 0x74, 
+	0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d, 0x22, 
+	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 
+	0x70, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 
+	0x74, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 0x74, 
+	0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 
+	0x74, 0x3d, 0x67, 0x62, 0x32, 0x33, 0x31, 0x32, 0x22, 0x20, 
+	0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 
+	0x3e, 0x55, 0x41, 0x52, 0x54, 0x2d, 0x57, 0x69, 0x46, 0x69, 
+	0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0xd, 0xa, 
+	0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 
+	0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x65, 0x74, 0x20, 0x72, 
+	0x6f, 0x77, 0x73, 0x3d, 0x22, 0x2a, 0x22, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x3c, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x20, 0x73, 
+	0x72, 0x63, 0x3d, 0x22, 0x62, 0x61, 0x73, 0x69, 0x63, 0x2e, 
+	0x68, 0x74, 0x6d, 0x6c, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 
+	0x3c, 0x2f, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x65, 0x74, 
+	0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 
+	0xd, 0xa, };
+
+static const unsigned char data_index_html_gz[] = {
+	/* /index.html */
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x31, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x28, 0x68, 0x74, 0x74, 
+	0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x73, 0x69, 
+	0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 0x64, 0x61, 
+	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
+	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
+	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
+	0x74, 0x6d, 0x6c, 0xd, 0xa, 0x45, 0x54, 0x61, 0x67, 0x3a, 
+	0x20, 0x22, 0x64, 0x63, 0x65, 0x38, 0x39, 0x35, 0x64, 0x32, 
+	0x2d, 0x67, 0x7a, 0x22, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 
+	0x65, 0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 
+	0x20, 0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0xd, 
+	0xa, 0x56, 0x61, 0x72, 0x79, 0x3a, 0x20, 0x41, 0x63, 0x63, 
+	0x65, 0x70, 0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 
+	0x6e, 0x67, 0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 
+	0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 
+	0x3a, 0x20, 0x67, 0x7a, 0x69, 0x70, 0xd, 0xa, 0x43, 0x6f, 
+	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 0x65, 0x6e, 0x67, 
+	0x74, 0x68, 0x3a, 0x20, 0x32, 0x35, 0x31, 0xd, 0xa, 0xd, 
+	0xa, 0x1f, 0x8b, 0x8, 00, 00, 00, 00, 00, 0x2, 
+	0x3, 0x6d, 0x8e, 0xcb, 0x4e, 0xc3, 0x30, 0x10, 0x45, 0xf7, 
+	0x48, 0xfc, 0xc3, 0xe0, 0x25, 0x52, 0x3c, 0xa4, 0x59, 0x85, 
+	0x26, 0x95, 0x20, 0x69, 0x5, 0x52, 0x81, 0xaa, 0x72, 0x55, 
+	0x58, 0xba, 0x89, 0x69, 0x2c, 0xe5, 0x51, 0x9c, 0x1, 0x87, 
+	0xbf, 0x27, 0xae, 0x9b, 0x1d, 0xab, 0x79, 0x9e, 0x7b, 0x6f, 
+	0x72, 0x93, 0xbf, 0x65, 0xe2, 0x63, 0xb3, 0x84, 0x8a, 0x9a, 
+	0x1a, 0x36, 0xbb, 0xc7, 0xf5, 0x73, 0x6, 0x2c, 0x40, 0xdc, 
+	0x47, 0x19, 0x62, 0x2e, 0x72, 0x78, 0x7f, 0x12, 0x2f, 0x6b, 
+	0x8, 0xf9, 0x1d, 0xac, 0x8c, 0x6c, 0x54, 0xaf, 0x8, 0x71, 
+	0xf9, 0xca, 0x80, 0x55, 0x44, 0xa7, 0x7b, 0x44, 0x6b, 0x2d, 
+	0xb7, 0x11, 0xef, 0xcc, 0x11, 0xc5, 0x16, 0x7, 0xa7, 0x13, 
+	0x3a, 0xf0, 0xd2, 0x6, 0x9f, 0x17, 0x8a, 0x97, 0x54, 0xb2, 
+	0xc5, 0xf5, 0x55, 0x72, 0x76, 0x1a, 0x9a, 0xba, 0xed, 0xd3, 
+	0x7f, 0x34, 0xc2, 0x38, 0x8e, 0x3d, 0xea, 0x9f, 0x95, 0x2c, 
+	0x5d, 0x6d, 0x14, 0x49, 0x70, 0xdf, 0x81, 0xfa, 0xfa, 0xd6, 
+	0x3f, 0x29, 0xcb, 0xba, 0x96, 0x54, 0x4b, 0x81, 0xf8, 0x3d, 
+	0x29, 0x6, 0x85, 0x9f, 0x52, 0x46, 0x6a, 0x20, 0x74, 0xf4, 
+	0x1c, 0x8a, 0x4a, 0x9a, 0xd1, 0x37, 0x3d, 0x1e, 0x66, 0x51, 
+	0x38, 0x63, 0x80, 0x4e, 0x87, 0x34, 0xd5, 0x6a, 0xb1, 0x7b, 
+	0xd8, 0x8a, 0x60, 0xaf, 0x57, 0x3a, 0x41, 0xbf, 0x18, 0x2f, 
+	0x38, 0x59, 0x4d, 0x81, 0xc1, 0x74, 0x76, 0x8c, 0x78, 0xeb, 
+	0x72, 00, 0xf8, 0x35, 0xf4, 0xa6, 0x48, 0xd9, 0x41, 0xf6, 
+	0xba, 0xe0, 0xe7, 0x8c, 0x5e, 0x15, 0x27, 0xc6, 0xb, 0x8d, 
+	0x87, 0xb1, 0xf9, 0x3, 0x92, 0x4a, 0x9b, 0x1a, 0x5c, 0x1, 
+	00, 00, };
 
 static const unsigned char data_jump_html[] = {
 	/* /jump.html */
@@ -3784,77 +3856,79 @@ static const unsigned char data_jump_html[] = {
 	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
 	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
 	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
-	0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, 0x3c, 0x21, 0x44, 
-	0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 
-	0x6c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 
-	0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f, 0x2f, 0x44, 0x54, 
-	0x44, 0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x31, 0x2e, 
-	0x30, 0x20, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 
-	0x6f, 0x6e, 0x61, 0x6c, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x20, 
-	0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 
-	0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x54, 
-	0x52, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2f, 0x44, 
-	0x54, 0x44, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2d, 
-	0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
-	0x61, 0x6c, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 0xd, 0xa, 
-	0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 
-	0x73, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 
-	0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 
-	0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x78, 0x68, 0x74, 0x6d, 
-	0x6c, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x65, 0x61, 0x64, 
-	0x3e, 0xd, 0xa, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x68, 
-	0x74, 0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d, 
-	0x22, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x22, 0x20, 
-	0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x31, 
-	0x30, 0x3b, 0x20, 0x75, 0x72, 0x6c, 0x3d, 0x69, 0x6e, 0x64, 
-	0x65, 0x78, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 
-	0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x67, 0x62, 0x32, 
-	0x33, 0x31, 0x32, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 
-	0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x6a, 0x75, 0x6d, 0x70, 
-	0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 
-	0x3e, 0xd, 0xa, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 
-	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
-	0x2f, 0x63, 0x73, 0x73, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x21, 
-	0x2d, 0x2d, 0xd, 0xa, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 
-	0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x3c, 
-	0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x62, 
-	0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x61, 0x62, 
-	0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 
-	0x39, 0x35, 0x32, 0x22, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-	0x74, 0x3d, 0x22, 0x31, 0x31, 0x34, 0x22, 0x20, 0x62, 0x6f, 
-	0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 
-	0x65, 0x72, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x74, 
-	0x72, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 
-	0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x68, 0x65, 0x69, 
-	0x67, 0x68, 0x74, 0x3d, 0x22, 0x3d, 0x31, 0x30, 0x30, 0x25, 
-	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 
-	0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x39, 
-	0x31, 0x33, 0x22, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-	0x3d, 0x22, 0x31, 0x31, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 
+	0x74, 0x6d, 0x6c, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 
+	0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 
+	0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0xd, 0xa, 
+	0xd, 0xa, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 
+	0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x50, 0x55, 0x42, 
+	0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 0x57, 0x33, 
+	0x43, 0x2f, 0x2f, 0x44, 0x54, 0x44, 0x20, 0x58, 0x48, 0x54, 
+	0x4d, 0x4c, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x54, 0x72, 0x61, 
+	0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2f, 
+	0x2f, 0x45, 0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 
+	0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 
+	0x6f, 0x72, 0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 0x74, 
+	0x6d, 0x6c, 0x31, 0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 0x68, 
+	0x74, 0x6d, 0x6c, 0x31, 0x2d, 0x74, 0x72, 0x61, 0x6e, 0x73, 
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2e, 0x64, 0x74, 
+	0x64, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 
+	0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 
+	0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 
+	0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 
+	0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0xd, 0xa, 
+	0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x6d, 
+	0x65, 0x74, 0x61, 0x20, 0x68, 0x74, 0x74, 0x70, 0x2d, 0x65, 
+	0x71, 0x75, 0x69, 0x76, 0x3d, 0x22, 0x72, 0x65, 0x66, 0x72, 
+	0x65, 0x73, 0x68, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 
+	0x6e, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x3b, 0x20, 0x75, 0x72, 
+	0x6c, 0x3d, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x68, 0x74, 
+	0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 
+	0x74, 0x3d, 0x67, 0x62, 0x32, 0x33, 0x31, 0x32, 0x22, 0x20, 
+	0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 
+	0x3e, 0x6a, 0x75, 0x6d, 0x70, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 
+	0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x3c, 0x73, 
+	0x74, 0x79, 0x6c, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
+	0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 
+	0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0xd, 0xa, 0x2d, 
+	0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 
+	0x65, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 
+	0x3e, 0xd, 0xa, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 
+	0xa, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 
+	0x64, 0x74, 0x68, 0x3d, 0x22, 0x39, 0x35, 0x32, 0x22, 0x20, 
+	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x31, 
+	0x34, 0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 
+	0x22, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
+	0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x20, 0x61, 0x6c, 0x69, 
 	0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 
-	0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
-	0x74, 0x6f, 0x70, 0x22, 0x20, 0x6e, 0x6f, 0x77, 0x72, 0x61, 
-	0x70, 0x3d, 0x22, 0x6e, 0x6f, 0x77, 0x72, 0x61, 0x70, 0x22, 
-	0x3e, 0x3c, 0x68, 0x32, 0x20, 0x20, 0x69, 0x64, 0x3d, 0x22, 
-	0x74, 0x65, 0x78, 0x74, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f, 
-	0x6e, 0x31, 0x22, 0x3e, 0x57, 0x69, 0x66, 0x69, 0x20, 0x6d, 
-	0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20, 0x69, 0x73, 0x20, 0x72, 
-	0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x67, 0x2c, 
-	0x20, 0x70, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x77, 0x61, 
-	0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x28, 0x66, 0x6f, 0x72, 
-	0x20, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x20, 0x31, 0x30, 0x73, 
-	0x29, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
-	0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
-	0xd, 0xa, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 
-	0xd, 0xa, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 
-	0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xd, 0xa, 
-};
+	0x22, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 
+	0x3d, 0x31, 0x30, 0x30, 0x25, 0x22, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 
+	0x74, 0x68, 0x3d, 0x22, 0x39, 0x31, 0x33, 0x22, 0x20, 0x68, 
+	0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x31, 0x30, 
+	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 
+	0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 0x20, 
+	0x6e, 0x6f, 0x77, 0x72, 0x61, 0x70, 0x3d, 0x22, 0x6e, 0x6f, 
+	0x77, 0x72, 0x61, 0x70, 0x22, 0x3e, 0x3c, 0x68, 0x32, 0x20, 
+	0x20, 0x69, 0x64, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x53, 
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x31, 0x22, 0x3e, 0x57, 
+	0x69, 0x66, 0x69, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 
+	0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 
+	0x74, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x70, 0x6c, 0x65, 0x61, 
+	0x73, 0x65, 0x20, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6e, 0x67, 
+	0x20, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x62, 0x6f, 0x75, 
+	0x74, 0x20, 0x31, 0x30, 0x73, 0x29, 0x3c, 0x2f, 0x68, 0x32, 
+	0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
+	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x74, 
+	0x61, 0x62, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x62, 
+	0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x74, 
+	0x6d, 0x6c, 0x3e, 0xd, 0xa, };
 
 static const unsigned char data_style_css[] = {
 	/* /style.css */
 	0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
 	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
 	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
 	0x31, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x28, 0x68, 0x74, 0x74, 
@@ -3863,346 +3937,476 @@ static const unsigned char data_style_css[] = {
 	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
 	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
 	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 
-	0x73, 0x73, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 
+	0x73, 0x73, 0xd, 0xa, 0x45, 0x54, 0x61, 0x67, 0x3a, 0x20, 
+	0x22, 0x32, 0x31, 0x62, 0x34, 0x33, 0x62, 0x38, 0x35, 0x22, 
+	0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2d, 0x43, 0x6f, 
+	0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 0x6d, 0x61, 0x78, 
+	0x2d, 0x61, 0x67, 0x65, 0x3d, 0x33, 0x36, 0x30, 0x30, 0xd, 
+	0xa, 0x56, 0x61, 0x72, 0x79, 0x3a, 0x20, 0x41, 0x63, 0x63, 
+	0x65, 0x70, 0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 
+	0x6e, 0x67, 0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 
+	0x74, 0x2d, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 
+	0x33, 0x33, 0x38, 0x35, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x2f, 0x2a, 0x20, 
-	0x48, 0x54, 0x4d, 0x4c, 0x20, 0x74, 0x61, 0x67, 0x20, 0x73, 
-	0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x2f, 
+	0x2a, 0x20, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x74, 0x61, 0x67, 
+	0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0xd, 0xa, 0x2f, 0x2a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0xd, 0xa, 
+	0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 
+	0xa, 0x62, 0x6f, 0x64, 0x79, 0x7b, 0xd, 0xa, 0x9, 0x66, 
+	0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 
+	0x3a, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 0x61, 
+	0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0xd, 
+	0xa, 0x9, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3b, 0xd, 0xa, 0x9, 
+	0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3a, 0x20, 0x31, 0x2e, 0x31, 0x36, 0x36, 0x3b, 0x9, 
+	0xd, 0xa, 0x9, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 
+	0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x70, 0x61, 
+	0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x70, 0x78, 
+	0x3b, 0xd, 0xa, 0x9, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 
+	0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x63, 0x63, 0x63, 
+	0x63, 0x63, 0x63, 0x3b, 0xd, 0xa, 0x9, 0x70, 0x6f, 0x73, 
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x72, 0x65, 0x6c, 0x61, 
+	0x74, 0x69, 0x76, 0x65, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 
+	0xa, 0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 
+	0x68, 0x79, 0x70, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 
+	0x61, 0x6e, 0x64, 0x20, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 
+	0x20, 0x74, 0x61, 0x67, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+	0x73, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 
+	0xd, 0xa, 0xd, 0xa, 0x61, 0x3a, 0x6c, 0x69, 0x6e, 0x6b, 
+	0x2c, 0x20, 0x61, 0x3a, 0x76, 0x69, 0x73, 0x69, 0x74, 0x65, 
+	0x64, 0x7b, 0xd, 0xa, 0x9, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
+	0x3a, 0x20, 0x23, 0x30, 0x30, 0x35, 0x46, 0x41, 0x39, 0x3b, 
+	0xd, 0xa, 0x9, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 
+	0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 
+	0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 
+	0xd, 0xa, 0x61, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x7b, 
+	0xd, 0xa, 0x9, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 
+	0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 
+	0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x3b, 
+	0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x62, 
-	0x6f, 0x64, 0x79, 0x7b, 0xd, 0xa, 0x9, 0x66, 0x6f, 0x6e, 
-	0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 
+	0x2a, 0x2a, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 
+	0x74, 0x61, 0x67, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 
+	0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x68, 0x32, 
+	0x7b, 0xd, 0xa, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x3a, 0x20, 
+	0x62, 0x6f, 0x6c, 0x64, 0x20, 0x31, 0x31, 0x34, 0x25, 0x20, 
 	0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 0x61, 0x6e, 0x73, 
-	0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0xd, 0xa, 0x9, 
-	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 0x33, 
-	0x33, 0x33, 0x33, 0x33, 0x3b, 0xd, 0xa, 0x9, 0x6c, 0x69, 
-	0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 
-	0x20, 0x31, 0x2e, 0x31, 0x36, 0x36, 0x3b, 0x9, 0xd, 0xa, 
-	0x9, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 
-	0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x70, 0x61, 0x64, 0x64, 
-	0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 
-	0xa, 0x9, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 
-	0x6e, 0x64, 0x3a, 0x20, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 
-	0x63, 0x3b, 0xd, 0xa, 0x9, 0x70, 0x6f, 0x73, 0x69, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3a, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 
-	0x76, 0x65, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x2f, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x68, 0x79, 
-	0x70, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x61, 0x6e, 
-	0x64, 0x20, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x20, 0x74, 
-	0x61, 0x67, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 
-	0xd, 0xa, 0x61, 0x3a, 0x6c, 0x69, 0x6e, 0x6b, 0x2c, 0x20, 
-	0x61, 0x3a, 0x76, 0x69, 0x73, 0x69, 0x74, 0x65, 0x64, 0x7b, 
-	0xd, 0xa, 0x9, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 
-	0x23, 0x30, 0x30, 0x35, 0x46, 0x41, 0x39, 0x3b, 0xd, 0xa, 
-	0x9, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 
-	0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x6e, 0x6f, 
-	0x6e, 0x65, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 
-	0x61, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x7b, 0xd, 0xa, 
-	0x9, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 
-	0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x75, 0x6e, 
-	0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x3b, 0xd, 0xa, 
-	0x7d, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x74, 0x61, 
-	0x67, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x68, 0x32, 0x7b, 0xd, 
-	0xa, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x3a, 0x20, 0x62, 0x6f, 
-	0x6c, 0x64, 0x20, 0x31, 0x31, 0x34, 0x25, 0x20, 0x41, 0x72, 
-	0x69, 0x61, 0x6c, 0x2c, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 
-	0x65, 0x72, 0x69, 0x66, 0x3b, 0xd, 0xa, 0x20, 0x63, 0x6f, 
-	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x36, 0x36, 
-	0x39, 0x39, 0x3b, 0xd, 0xa, 0x20, 0x6d, 0x61, 0x72, 0x67, 
-	0x69, 0x6e, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 
-	0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 
-	0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 
-	0xa, 0x68, 0x33, 0x7b, 0xd, 0xa, 0x20, 0x66, 0x6f, 0x6e, 
-	0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 0x64, 0x20, 0x31, 0x30, 
-	0x30, 0x25, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 
-	0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 
-	0xd, 0xa, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 
-	0x23, 0x33, 0x33, 0x34, 0x64, 0x35, 0x35, 0x3b, 0xd, 0xa, 
-	0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 
-	0x70, 0x78, 0x3b, 0xd, 0xa, 0x20, 0x70, 0x61, 0x64, 0x64, 
-	0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 
-	0xa, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x6c, 0x65, 
-	0x66, 0x74, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x74, 
-	0x61, 0x67, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 
+	0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0xd, 0xa, 0x20, 
+	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 
+	0x36, 0x36, 0x39, 0x39, 0x3b, 0xd, 0xa, 0x20, 0x6d, 0x61, 
+	0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 
+	0xd, 0xa, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 
+	0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x7d, 0xd, 
+	0xa, 0xd, 0xa, 0x68, 0x33, 0x7b, 0xd, 0xa, 0x20, 0x66, 
+	0x6f, 0x6e, 0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 0x64, 0x20, 
+	0x31, 0x30, 0x30, 0x25, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 
+	0x2c, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 
+	0x66, 0x3b, 0xd, 0xa, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
+	0x3a, 0x20, 0x23, 0x33, 0x33, 0x34, 0x64, 0x35, 0x35, 0x3b, 
+	0xd, 0xa, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 
+	0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x20, 0x70, 0x61, 
+	0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x70, 0x78, 
+	0x3b, 0xd, 0xa, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 
+	0x6c, 0x65, 0x66, 0x74, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x2f, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0xd, 0xa, 
-	0x75, 0x6c, 0x7b, 0xd, 0xa, 0x20, 0x6c, 0x69, 0x73, 0x74, 
-	0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x74, 0x79, 0x70, 
-	0x65, 0x3a, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3b, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x6c, 0x69, 0x73, 0x74, 
+	0x20, 0x74, 0x61, 0x67, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+	0x73, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 
+	0xd, 0xa, 0x75, 0x6c, 0x7b, 0xd, 0xa, 0x20, 0x6c, 0x69, 
+	0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x74, 
+	0x79, 0x70, 0x65, 0x3a, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 
+	0x65, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x75, 
+	0x6c, 0x20, 0x75, 0x6c, 0x7b, 0xd, 0xa, 0x20, 0x6c, 0x69, 
+	0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x74, 
+	0x79, 0x70, 0x65, 0x3a, 0x20, 0x64, 0x69, 0x73, 0x63, 0x3b, 
 	0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x75, 0x6c, 0x20, 
-	0x75, 0x6c, 0x7b, 0xd, 0xa, 0x20, 0x6c, 0x69, 0x73, 0x74, 
-	0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x74, 0x79, 0x70, 
-	0x65, 0x3a, 0x20, 0x64, 0x69, 0x73, 0x63, 0x3b, 0xd, 0xa, 
-	0x7d, 0xd, 0xa, 0xd, 0xa, 0x75, 0x6c, 0x20, 0x75, 0x6c, 
-	0x20, 0x75, 0x6c, 0x7b, 0xd, 0xa, 0x20, 0x6c, 0x69, 0x73, 
-	0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x74, 0x79, 
-	0x70, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0xd, 
+	0x75, 0x6c, 0x20, 0x75, 0x6c, 0x7b, 0xd, 0xa, 0x20, 0x6c, 
+	0x69, 0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 
+	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 
+	0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x66, 
+	0x6f, 0x72, 0x6d, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 
+	0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x74, 0x61, 0x67, 0x20, 
+	0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0xd, 
+	0xa, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x7b, 0xd, 0xa, 0x9, 
+	0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 
+	0xd, 0xa, 0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 
+	0x3a, 0x20, 0x30, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 
+	0xa, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x7b, 0xd, 0xa, 0x20, 
+	0x66, 0x6f, 0x6e, 0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 0x64, 
+	0x20, 0x31, 0x65, 0x6d, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 
+	0x2c, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 
+	0x66, 0x3b, 0xd, 0xa, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
+	0x3a, 0x20, 0x23, 0x33, 0x33, 0x34, 0x64, 0x35, 0x35, 0x3b, 
+	0xd, 0xa, 0x7d, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0xd, 
+	0xa, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x7b, 0xd, 0xa, 0x66, 
+	0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 
+	0x3a, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 0x61, 
+	0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0xd, 
 	0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x66, 0x6f, 0x72, 
-	0x6d, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x6c, 0x61, 
-	0x74, 0x65, 0x64, 0x20, 0x74, 0x61, 0x67, 0x20, 0x73, 0x74, 
-	0x79, 0x6c, 0x65, 0x73, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0xd, 0xa, 0x66, 
-	0x6f, 0x72, 0x6d, 0x20, 0x7b, 0xd, 0xa, 0x9, 0x6d, 0x61, 
-	0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0xd, 0xa, 
-	0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 
-	0x30, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x7b, 0xd, 0xa, 0x20, 0x66, 0x6f, 
-	0x6e, 0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 0x64, 0x20, 0x31, 
-	0x65, 0x6d, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 
-	0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 
-	0xd, 0xa, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 
-	0x23, 0x33, 0x33, 0x34, 0x64, 0x35, 0x35, 0x3b, 0xd, 0xa, 
-	0x7d, 0xd, 0xa, 0x9, 0x9, 0x9, 0x9, 0xd, 0xa, 0x69, 
-	0x6e, 0x70, 0x75, 0x74, 0x7b, 0xd, 0xa, 0x66, 0x6f, 0x6e, 
-	0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 
-	0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 0x61, 0x6e, 0x73, 
-	0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0xd, 0xa, 0x7d, 
-	0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x2f, 0x2a, 0x20, 0x4c, 0x61, 
-	0x79, 0x6f, 0x75, 0x74, 0x20, 0x44, 0x69, 0x76, 0x73, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x2f, 0x2a, 0x20, 
+	0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x44, 0x69, 0x76, 
+	0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x2a, 0x2f, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 
+	0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0xd, 0xa, 0x2f, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x23, 0x70, 0x61, 
-	0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x7b, 0xd, 0xa, 
-	0x9, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x38, 0x30, 0x30, 
-	0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x6d, 0x61, 0x72, 0x67, 
-	0x69, 0x6e, 0x3a, 0x30, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 
-	0xd, 0xa, 0x9, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 
-	0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
-	0x20, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3b, 0xd, 
-	0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x23, 0x74, 0x6c, 0x20, 
-	0x7b, 0xd, 0xa, 0x9, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 
-	0x6f, 0x6e, 0x3a, 0x61, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 
-	0x65, 0x3b, 0xd, 0xa, 0x9, 0x74, 0x6f, 0x70, 0x3a, 0x20, 
-	0x2d, 0x31, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x6c, 0x65, 
-	0x66, 0x74, 0x3a, 0x20, 0x2d, 0x31, 0x70, 0x78, 0x3b, 0xd, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x23, 
+	0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x7b, 
+	0xd, 0xa, 0x9, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x38, 
+	0x30, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x6d, 0x61, 
+	0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x20, 0x61, 0x75, 0x74, 
+	0x6f, 0x3b, 0xd, 0xa, 0x9, 0x62, 0x61, 0x63, 0x6b, 0x67, 
+	0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 
+	0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+	0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x23, 0x74, 
+	0x6c, 0x20, 0x7b, 0xd, 0xa, 0x9, 0x70, 0x6f, 0x73, 0x69, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x61, 0x62, 0x73, 0x6f, 0x6c, 
+	0x75, 0x74, 0x65, 0x3b, 0xd, 0xa, 0x9, 0x74, 0x6f, 0x70, 
+	0x3a, 0x20, 0x2d, 0x31, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 
+	0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x2d, 0x31, 0x70, 0x78, 
+	0x3b, 0xd, 0xa, 0x9, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
+	0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x70, 
+	0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x70, 
+	0x78, 0x3b, 0xd, 0xa, 0x9, 0x7a, 0x2d, 0x69, 0x6e, 0x64, 
+	0x65, 0x78, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x3b, 0xd, 0xa, 
+	0x7d, 0xd, 0xa, 0x23, 0x70, 0x61, 0x67, 0x65, 0x4e, 0x61, 
+	0x76, 0x7b, 0xd, 0xa, 0x9, 0x66, 0x6c, 0x6f, 0x61, 0x74, 
+	0x3a, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x3b, 0xd, 0xa, 0x9, 
+	0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x37, 0x38, 0x70, 
+	0x78, 0x3b, 0xd, 0xa, 0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 
+	0x6e, 0x67, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 
+	0x9, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
+	0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 
+	0x46, 0x35, 0x66, 0x37, 0x66, 0x37, 0x3b, 0xd, 0xa, 0x9, 
+	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 
+	0x68, 0x74, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 
+	0x6c, 0x69, 0x64, 0x20, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 
+	0x63, 0x3b, 0xd, 0xa, 0x9, 0x62, 0x6f, 0x72, 0x64, 0x65, 
+	0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 
+	0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 
+	0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3b, 0xd, 0xa, 
+	0x9, 0x66, 0x6f, 0x6e, 0x74, 0x3a, 0x20, 0x73, 0x6d, 0x61, 
+	0x6c, 0x6c, 0x20, 0x56, 0x65, 0x72, 0x64, 0x61, 0x6e, 0x61, 
+	0x2c, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 
+	0x66, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x23, 
+	0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x7b, 0xd, 0xa, 
+	0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 
+	0x30, 0x70, 0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 
+	0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 
+	0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x70, 0x78, 
+	0x20, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 0x31, 
+	0x37, 0x38, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x62, 0x6f, 
+	0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 
+	0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 
+	0x20, 0x23, 0x63, 0x63, 0x64, 0x32, 0x64, 0x32, 0x3b, 0xd, 
+	0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x20, 0x70, 0x61, 0x67, 0x65, 0x4e, 0x61, 0x6d, 0x65, 
+	0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0xd, 0xa, 0x23, 
+	0x70, 0x61, 0x67, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x7b, 0xd, 
+	0xa, 0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 
+	0x20, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 0x31, 
+	0x34, 0x70, 0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0xd, 
 	0xa, 0x9, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 
-	0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x70, 0x61, 0x64, 
-	0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 
-	0xd, 0xa, 0x9, 0x7a, 0x2d, 0x69, 0x6e, 0x64, 0x65, 0x78, 
-	0x3a, 0x20, 0x31, 0x30, 0x30, 0x3b, 0xd, 0xa, 0x7d, 0xd, 
-	0xa, 0x23, 0x70, 0x61, 0x67, 0x65, 0x4e, 0x61, 0x76, 0x7b, 
-	0xd, 0xa, 0x9, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3a, 0x20, 
-	0x6c, 0x65, 0x66, 0x74, 0x3b, 0xd, 0xa, 0x9, 0x77, 0x69, 
-	0x64, 0x74, 0x68, 0x3a, 0x31, 0x37, 0x38, 0x70, 0x78, 0x3b, 
+	0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x62, 0x6f, 0x72, 
+	0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 
+	0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 
+	0x20, 0x23, 0x63, 0x63, 0x64, 0x32, 0x64, 0x32, 0x3b, 0xd, 
+	0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x73, 
+	0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0xd, 0xa, 0x2e, 
+	0x73, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x7b, 0xd, 0xa, 0x9, 
+	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 
+	0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 
+	0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 
+	0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 
+	0x20, 0x38, 0x30, 0x25, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 
+	0xd, 0xa, 0x2e, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x68, 
+	0x33, 0x7b, 0xd, 0xa, 0x9, 0x66, 0x6f, 0x6e, 0x74, 0x3a, 
+	0x20, 0x62, 0x6f, 0x6c, 0x64, 0x20, 0x31, 0x32, 0x35, 0x25, 
+	0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 0x61, 0x6e, 
+	0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0xd, 0xa, 
+	0x9, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0xd, 0xa, 0x7d, 0xd, 
+	0xa, 0xd, 0xa, 0x2e, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x20, 
+	0x70, 0x20, 0x7b, 0xd, 0xa, 0x9, 0x70, 0x61, 0x64, 0x64, 
+	0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x20, 0x30, 
+	0x70, 0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 
+	0x78, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x2e, 
+	0x73, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x61, 0x2e, 0x63, 0x61, 
+	0x70, 0x73, 0x75, 0x6c, 0x65, 0x7b, 0xd, 0xa, 0x9, 0x66, 
+	0x6f, 0x6e, 0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 0x64, 0x20, 
+	0x31, 0x65, 0x6d, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 
+	0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 
+	0x3b, 0xd, 0xa, 0x9, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
+	0x20, 0x23, 0x30, 0x30, 0x35, 0x46, 0x41, 0x39, 0x3b, 0xd, 
+	0xa, 0x9, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 
+	0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0xd, 0xa, 0x9, 0x70, 
+	0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x6f, 0x74, 
+	0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x35, 0x70, 0x78, 0x3b, 0xd, 
+	0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x2e, 0x73, 0x74, 0x6f, 
+	0x72, 0x79, 0x20, 0x61, 0x2e, 0x63, 0x61, 0x70, 0x73, 0x75, 
+	0x6c, 0x65, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x7b, 0xd, 
+	0xa, 0x9, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63, 
+	0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x75, 
+	0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x3b, 0xd, 
+	0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x74, 0x64, 0x2e, 0x73, 
+	0x74, 0x6f, 0x72, 0x79, 0x4c, 0x65, 0x66, 0x74, 0x7b, 0xd, 
+	0xa, 0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 
+	0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 0x32, 0x70, 
+	0x78, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0xd, 
+	0xa, 0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x73, 0x69, 0x74, 
+	0x65, 0x49, 0x6e, 0x66, 0x6f, 0x20, 0x73, 0x74, 0x79, 0x6c, 
+	0x65, 0x73, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 
+	0xd, 0xa, 0xd, 0xa, 0x23, 0x73, 0x69, 0x74, 0x65, 0x49, 
+	0x6e, 0x66, 0x6f, 0x7b, 0xd, 0xa, 0x9, 0x63, 0x6c, 0x65, 
+	0x61, 0x72, 0x3a, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x3b, 0xd, 
+	0xa, 0x9, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 
+	0x6f, 0x70, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 
+	0x6c, 0x69, 0x64, 0x20, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 
+	0x63, 0x3b, 0xd, 0xa, 0x9, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 
+	0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x73, 0x6d, 0x61, 0x6c, 
+	0x6c, 0x3b, 0xd, 0xa, 0x9, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
+	0x3a, 0x20, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3b, 
 	0xd, 0xa, 0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 
-	0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x62, 
-	0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 
-	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x46, 0x35, 
-	0x66, 0x37, 0x66, 0x37, 0x3b, 0xd, 0xa, 0x9, 0x62, 0x6f, 
-	0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 
+	0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x31, 0x30, 0x70, 
+	0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x31, 0x30, 0x70, 
+	0x78, 0x3b, 0xd, 0xa, 0x9, 0x6d, 0x61, 0x72, 0x67, 0x69, 
+	0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30, 0x70, 0x78, 
+	0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x23, 0x73, 
+	0x69, 0x74, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x20, 0x69, 0x6d, 
+	0x67, 0x7b, 0xd, 0xa, 0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 
+	0x6e, 0x67, 0x3a, 0x20, 0x34, 0x70, 0x78, 0x20, 0x34, 0x70, 
+	0x78, 0x20, 0x34, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x3b, 
+	0xd, 0xa, 0x9, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 
+	0x6c, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x6d, 
+	0x69, 0x64, 0x64, 0x6c, 0x65, 0x3b, 0xd, 0xa, 0x7d, 0xd, 
+	0xa, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x73, 
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6e, 0x6b, 
+	0x73, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0xd, 0xa, 0x23, 0x73, 
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6e, 0x6b, 
+	0x73, 0x7b, 0xd, 0xa, 0x9, 0x6d, 0x61, 0x72, 0x67, 0x69, 
+	0x6e, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 
+	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 
+	0x70, 0x78, 0x3b, 0xd, 0xa, 0xd, 0xa, 0x7d, 0xd, 0xa, 
+	0xd, 0xa, 0x23, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x4c, 0x69, 0x6e, 0x6b, 0x73, 0x20, 0x68, 0x33, 0x7b, 0xd, 
+	0xa, 0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 
+	0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 
+	0x32, 0x70, 0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0xd, 
+	0xa, 0x9, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 
+	0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x70, 0x78, 
+	0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x63, 0x63, 
+	0x63, 0x63, 0x63, 0x63, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 
+	0xd, 0xa, 0x23, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x4c, 0x69, 0x6e, 0x6b, 0x73, 0x20, 0x61, 0x3a, 0x6c, 0x69, 
+	0x6e, 0x6b, 0x2c, 0x20, 0x23, 0x73, 0x65, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x4c, 0x69, 0x6e, 0x6b, 0x73, 0x20, 0x61, 0x3a, 
+	0x76, 0x69, 0x73, 0x69, 0x74, 0x65, 0x64, 0x20, 0x7b, 0xd, 
+	0xa, 0x9, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 
+	0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0xd, 0xa, 0x9, 
+	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 
 	0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 
-	0x64, 0x20, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3b, 
+	0x64, 0x20, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3b, 
 	0xd, 0xa, 0x9, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 
 	0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x70, 
 	0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x63, 
 	0x63, 0x63, 0x63, 0x63, 0x63, 0x3b, 0xd, 0xa, 0x9, 0x66, 
-	0x6f, 0x6e, 0x74, 0x3a, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 
-	0x20, 0x56, 0x65, 0x72, 0x64, 0x61, 0x6e, 0x61, 0x2c, 0x73, 
-	0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 
-	0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x23, 0x63, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x7b, 0xd, 0xa, 0x9, 0x70, 
-	0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x70, 
-	0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 
-	0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x6d, 0x61, 
-	0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x70, 0x78, 0x20, 0x30, 
-	0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 0x31, 0x37, 0x38, 
-	0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x62, 0x6f, 0x72, 0x64, 
-	0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x31, 
-	0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 
-	0x63, 0x63, 0x64, 0x32, 0x64, 0x32, 0x3b, 0xd, 0xa, 0x7d, 
-	0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 
-	0x70, 0x61, 0x67, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x73, 
-	0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2f, 0xd, 0xa, 0xd, 0xa, 0x23, 0x70, 0x61, 
-	0x67, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x7b, 0xd, 0xa, 0x9, 
-	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 
-	0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 0x31, 0x34, 0x70, 
-	0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 
-	0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x70, 
-	0x78, 0x3b, 0xd, 0xa, 0x9, 0x62, 0x6f, 0x72, 0x64, 0x65, 
-	0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x31, 
-	0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 
-	0x63, 0x63, 0x64, 0x32, 0x64, 0x32, 0x3b, 0xd, 0xa, 0x7d, 
-	0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x20, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x73, 0x74, 0x79, 
-	0x6c, 0x65, 0x73, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 
+	0x3a, 0x20, 0x62, 0x6f, 0x6c, 0x64, 0x3b, 0xd, 0xa, 0x9, 
+	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x33, 
+	0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 0x33, 0x70, 0x78, 
+	0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x63, 
+	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x32, 0x31, 0x35, 
+	0x33, 0x36, 0x41, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 
+	0xa, 0x23, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 
+	0x69, 0x6e, 0x6b, 0x73, 0x20, 0x61, 0x3a, 0x68, 0x6f, 0x76, 
+	0x65, 0x72, 0x7b, 0xd, 0xa, 0x9, 0x62, 0x6f, 0x72, 0x64, 
+	0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x31, 0x70, 
+	0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x63, 
+	0x63, 0x63, 0x63, 0x63, 0x63, 0x3b, 0xd, 0xa, 0x9, 0x62, 
+	0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 
+	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x44, 0x44, 
+	0x45, 0x45, 0x46, 0x46, 0x3b, 0xd, 0xa, 0x9, 0x62, 0x61, 
+	0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x69, 
+	0x6d, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 
+	0x3b, 0xd, 0xa, 0x9, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 
+	0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 
+	0x64, 0x3b, 0xd, 0xa, 0x9, 0x74, 0x65, 0x78, 0x74, 0x2d, 
+	0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0xd, 0xa, 0x7d, 
+	0xd, 0xa, 0xd, 0xa, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2f, 0xd, 0xa, 0xd, 0xa, 0x2e, 0x73, 0x74, 
-	0x6f, 0x72, 0x79, 0x20, 0x7b, 0xd, 0xa, 0x9, 0x70, 0x61, 
-	0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x30, 0x70, 
-	0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 
-	0x31, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x66, 0x6f, 
-	0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x38, 
-	0x30, 0x25, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 
-	0x2e, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x68, 0x33, 0x7b, 
-	0xd, 0xa, 0x9, 0x66, 0x6f, 0x6e, 0x74, 0x3a, 0x20, 0x62, 
-	0x6f, 0x6c, 0x64, 0x20, 0x31, 0x32, 0x35, 0x25, 0x20, 0x41, 
-	0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 0x61, 0x6e, 0x73, 0x2d, 
-	0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0xd, 0xa, 0x9, 0x63, 
-	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x30, 
-	0x30, 0x30, 0x30, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 
-	0xa, 0x2e, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x70, 0x20, 
-	0x7b, 0xd, 0xa, 0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 
-	0x67, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 
-	0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x3b, 
-	0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x2e, 0x73, 0x74, 
-	0x6f, 0x72, 0x79, 0x20, 0x61, 0x2e, 0x63, 0x61, 0x70, 0x73, 
-	0x75, 0x6c, 0x65, 0x7b, 0xd, 0xa, 0x9, 0x66, 0x6f, 0x6e, 
-	0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 0x64, 0x20, 0x31, 0x65, 
-	0x6d, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 0x61, 
-	0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0xd, 
-	0xa, 0x9, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 
-	0x30, 0x30, 0x35, 0x46, 0x41, 0x39, 0x3b, 0xd, 0xa, 0x9, 
-	0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62, 0x6c, 
-	0x6f, 0x63, 0x6b, 0x3b, 0xd, 0xa, 0x9, 0x70, 0x61, 0x64, 
-	0x64, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 
-	0x6d, 0x3a, 0x20, 0x35, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x7d, 
-	0xd, 0xa, 0xd, 0xa, 0x2e, 0x73, 0x74, 0x6f, 0x72, 0x79, 
-	0x20, 0x61, 0x2e, 0x63, 0x61, 0x70, 0x73, 0x75, 0x6c, 0x65, 
-	0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x7b, 0xd, 0xa, 0x9, 
-	0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 0x72, 
-	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x75, 0x6e, 0x64, 
-	0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x3b, 0xd, 0xa, 0x7d, 
-	0xd, 0xa, 0xd, 0xa, 0x74, 0x64, 0x2e, 0x73, 0x74, 0x6f, 
-	0x72, 0x79, 0x4c, 0x65, 0x66, 0x74, 0x7b, 0xd, 0xa, 0x9, 
-	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x72, 0x69, 
-	0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3b, 
-	0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0xd, 0xa, 0x2f, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x61, 0x64, 0x76, 0x65, 
+	0x72, 0x74, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x73, 0x69, 0x74, 0x65, 0x49, 
-	0x6e, 0x66, 0x6f, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 
-	0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 
-	0xd, 0xa, 0x23, 0x73, 0x69, 0x74, 0x65, 0x49, 0x6e, 0x66, 
-	0x6f, 0x7b, 0xd, 0xa, 0x9, 0x63, 0x6c, 0x65, 0x61, 0x72, 
-	0x3a, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x3b, 0xd, 0xa, 0x9, 
-	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 
-	0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 
-	0x64, 0x20, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3b, 
-	0xd, 0xa, 0x9, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 
-	0x7a, 0x65, 0x3a, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x3b, 
-	0xd, 0xa, 0x9, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 
-	0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3b, 0xd, 0xa, 
-	0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 
-	0x31, 0x30, 0x70, 0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 
-	0x31, 0x30, 0x70, 0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 
-	0xd, 0xa, 0x9, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 
-	0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 
-	0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x23, 0x73, 0x69, 0x74, 
-	0x65, 0x49, 0x6e, 0x66, 0x6f, 0x20, 0x69, 0x6d, 0x67, 0x7b, 
+	0xd, 0xa, 0x23, 0x61, 0x64, 0x76, 0x65, 0x72, 0x74, 0x7b, 
 	0xd, 0xa, 0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 
-	0x3a, 0x20, 0x34, 0x70, 0x78, 0x20, 0x34, 0x70, 0x78, 0x20, 
-	0x34, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 
-	0x9, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2d, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x6d, 0x69, 0x64, 
-	0x64, 0x6c, 0x65, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 
-	0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x73, 0x65, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6e, 0x6b, 0x73, 0x20, 
-	0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2f, 0xd, 0xa, 0xd, 0xa, 0x23, 0x73, 0x65, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6e, 0x6b, 0x73, 0x7b, 
-	0xd, 0xa, 0x9, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 
-	0x20, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x70, 0x61, 
-	0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x70, 0x78, 
-	0x3b, 0xd, 0xa, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 
-	0x23, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 
-	0x6e, 0x6b, 0x73, 0x20, 0x68, 0x33, 0x7b, 0xd, 0xa, 0x9, 
-	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 
-	0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 0x32, 0x70, 
-	0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 
-	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 
-	0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 
-	0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x63, 0x63, 0x63, 0x63, 
-	0x63, 0x63, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 
-	0x23, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 
-	0x6e, 0x6b, 0x73, 0x20, 0x61, 0x3a, 0x6c, 0x69, 0x6e, 0x6b, 
-	0x2c, 0x20, 0x23, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
-	0x4c, 0x69, 0x6e, 0x6b, 0x73, 0x20, 0x61, 0x3a, 0x76, 0x69, 
-	0x73, 0x69, 0x74, 0x65, 0x64, 0x20, 0x7b, 0xd, 0xa, 0x9, 
-	0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x62, 
-	0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0xd, 0xa, 0x9, 0x62, 0x6f, 
-	0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 
-	0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 
-	0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3b, 0xd, 0xa, 
-	0x9, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 
-	0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 
-	0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x63, 0x63, 0x63, 
-	0x63, 0x63, 0x63, 0x3b, 0xd, 0xa, 0x9, 0x66, 0x6f, 0x6e, 
-	0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 
-	0x62, 0x6f, 0x6c, 0x64, 0x3b, 0xd, 0xa, 0x9, 0x70, 0x61, 
-	0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x33, 0x70, 0x78, 
-	0x20, 0x30, 0x70, 0x78, 0x20, 0x33, 0x70, 0x78, 0x20, 0x31, 
-	0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x9, 0x63, 0x6f, 0x6c, 
-	0x6f, 0x72, 0x3a, 0x20, 0x23, 0x32, 0x31, 0x35, 0x33, 0x36, 
-	0x41, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x23, 
-	0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6e, 
-	0x6b, 0x73, 0x20, 0x61, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 
-	0x7b, 0xd, 0xa, 0x9, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 
-	0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 
-	0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x63, 0x63, 0x63, 
-	0x63, 0x63, 0x63, 0x3b, 0xd, 0xa, 0x9, 0x62, 0x61, 0x63, 
-	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 
-	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x44, 0x44, 0x45, 0x45, 
-	0x46, 0x46, 0x3b, 0xd, 0xa, 0x9, 0x62, 0x61, 0x63, 0x6b, 
-	0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x69, 0x6d, 0x61, 
-	0x67, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0xd, 
-	0xa, 0x9, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 
-	0x67, 0x68, 0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 0x64, 0x3b, 
-	0xd, 0xa, 0x9, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 
-	0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 
-	0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 
-	0xd, 0xa, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x20, 0x61, 0x64, 0x76, 0x65, 0x72, 0x74, 
-	0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0xd, 0xa, 
-	0x23, 0x61, 0x64, 0x76, 0x65, 0x72, 0x74, 0x7b, 0xd, 0xa, 
-	0x9, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 
-	0x31, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 
-	0xd, 0xa, 0x23, 0x61, 0x64, 0x76, 0x65, 0x72, 0x74, 0x20, 
-	0x69, 0x6d, 0x67, 0x7b, 0xd, 0xa, 0x9, 0x64, 0x69, 0x73, 
-	0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x62, 0x6c, 0x6f, 0x63, 
-	0x6b, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 0xa, 0x2f, 
+	0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0xd, 0xa, 0x7d, 
+	0xd, 0xa, 0xd, 0xa, 0x23, 0x61, 0x64, 0x76, 0x65, 0x72, 
+	0x74, 0x20, 0x69, 0x6d, 0x67, 0x7b, 0xd, 0xa, 0x9, 0x64, 
+	0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x62, 0x6c, 
+	0x6f, 0x63, 0x6b, 0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0xd, 
+	0xa, 0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 
-	0xa, };
+	0x2f, 0xd, 0xa, };
+
+static const unsigned char data_style_css_gz[] = {
+	/* /style.css */
+	0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x31, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x28, 0x68, 0x74, 0x74, 
+	0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x73, 0x69, 
+	0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 0x64, 0x61, 
+	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
+	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
+	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 
+	0x73, 0x73, 0xd, 0xa, 0x45, 0x54, 0x61, 0x67, 0x3a, 0x20, 
+	0x22, 0x32, 0x31, 0x62, 0x34, 0x33, 0x62, 0x38, 0x35, 0x2d, 
+	0x67, 0x7a, 0x22, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 
+	0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 
+	0x6d, 0x61, 0x78, 0x2d, 0x61, 0x67, 0x65, 0x3d, 0x33, 0x36, 
+	0x30, 0x30, 0xd, 0xa, 0x56, 0x61, 0x72, 0x79, 0x3a, 0x20, 
+	0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x2d, 0x45, 0x6e, 0x63, 
+	0x6f, 0x64, 0x69, 0x6e, 0x67, 0xd, 0xa, 0x43, 0x6f, 0x6e, 
+	0x74, 0x65, 0x6e, 0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 
+	0x69, 0x6e, 0x67, 0x3a, 0x20, 0x67, 0x7a, 0x69, 0x70, 0xd, 
+	0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x39, 0x35, 0x32, 
+	0xd, 0xa, 0xd, 0xa, 0x1f, 0x8b, 0x8, 00, 00, 00, 
+	00, 00, 0x2, 0x3, 0xa5, 0x56, 0xc1, 0x6e, 0xa3, 0x30, 
+	0x10, 0x3d, 0x37, 0x52, 0xfe, 0x61, 0xa4, 0xa8, 0x97, 0xaa, 
+	0xb4, 0x90, 0x34, 0x69, 0x4b, 0x4f, 0x95, 0xda, 0x6a, 0x57, 
+	0xea, 0xee, 0x69, 0xb5, 0x77, 0x7, 0x3b, 0xc1, 0xaa, 0xc1, 
+	0xac, 0x31, 0x69, 0xd3, 0x68, 0xff, 0x7d, 0x6d, 0x63, 0xc0, 
+	0x10, 0x48, 0x52, 0xad, 0xa5, 0x44, 0xa, 0x19, 0x66, 0xde, 
+	0xbc, 0x79, 0x33, 0x9e, 0xeb, 0x8b, 0xaf, 0x9d, 0xeb, 0xf1, 
+	0xe8, 0xfa, 0x2, 0xbe, 0xfd, 0xfa, 0xf1, 0xa, 0x12, 0xad, 
+	0x21, 0x97, 0x5b, 0x46, 0x72, 0x38, 0x74, 0xca, 0x57, 0xbe, 
+	0x1c, 0x65, 0xc9, 0xf1, 0x76, 0x37, 0x1e, 0x9d, 0xad, 0x78, 
+	0x2a, 0xbd, 0x15, 0x4a, 0x28, 0xdb, 0x86, 0xf0, 0x28, 0x28, 
+	0x62, 0x97, 0x39, 0x4a, 0x73, 0x2f, 0x27, 0x82, 0xae, 0x1e, 
+	0x94, 0x41, 0xc4, 0x19, 0x17, 0x21, 0x4c, 0x66, 0xe6, 0xe8, 
+	0x27, 0x8c, 0xa6, 0xc4, 0x8b, 0x9, 0x5d, 0xc7, 0x32, 0x84, 
+	0xe0, 0x2a, 0x58, 0x2c, 0x1e, 0xce, 0xd4, 0xe3, 0x4, 0x89, 
+	0x35, 0x4d, 0x43, 0xf0, 0xb3, 0xf, 0x6d, 0x95, 0x21, 0x8c, 
+	0x69, 0xba, 0xae, 0x7f, 0x2f, 0x51, 0xf4, 0xb6, 0x16, 0xbc, 
+	0x48, 0xb1, 0x72, 0x16, 0x99, 0x63, 0xcc, 0x78, 0x4e, 0x25, 
+	0xe5, 0x69, 0x28, 0x8, 0x43, 0x92, 0x6e, 0xc8, 0x78, 0xf4, 
+	0x77, 0x3c, 0x6a, 0x52, 0x82, 0x78, 0x9b, 0x11, 0xa1, 0x42, 
+	0xbe, 0x1, 0x4a, 0xb1, 0xfa, 0x44, 0x31, 0x17, 0x2e, 0x37, 
+	0x4d, 0x4a, 0xe3, 0x11, 0xa, 0xb5, 0xe1, 0x25, 0xa0, 0x70, 
+	0x43, 0x95, 0x5b, 0x82, 0x77, 0x4e, 0x2, 0xbe, 0x3f, 0x7f, 
+	0x79, 0xbc, 0xd7, 0x31, 0x25, 0xf9, 0x90, 0x1e, 0x26, 0x11, 
+	0x17, 0xc8, 0x84, 0x86, 0x94, 0xa7, 0xe4, 0xc1, 0x6, 0x46, 
+	0x61, 0xcc, 0x37, 0x44, 0xec, 0xfa, 0xec, 0x14, 0x78, 0x83, 
+	0xa5, 0x36, 0xee, 0x10, 0xf, 0x31, 0x41, 0xca, 0xa2, 0x7, 
+	0x5e, 0x83, 0x32, 0x9e, 0x2a, 0xd7, 0xa0, 0x69, 0xf, 0x61, 
+	0xc9, 0x19, 0x86, 0x20, 0xb8, 0x39, 0xef, 0x63, 0x1e, 0x1a, 
+	0xe0, 0x8b, 0xc5, 0xbd, 0x6, 0xe, 0x6d, 0x8a, 0xa1, 0x43, 
+	0xb1, 0x41, 0x14, 0xcf, 0xba, 0xee, 0x7d, 0xff, 0xb0, 0xfb, 
+	0xd9, 0xec, 0x6, 0xcf, 0xe7, 0xc7, 0xdd, 0x3, 0x62, 0x74, 
+	0x9d, 0x86, 0x8c, 0xac, 0xa4, 0x89, 0xd5, 0x15, 0x1d, 0x30, 
+	0x9a, 0xcb, 0xe1, 0xd4, 0xcb, 0xa, 0x15, 0x4c, 0xc3, 0xd3, 
+	0x96, 0x9e, 0xb1, 0xf2, 0xa4, 0x2a, 0x6f, 0x8, 0xf9, 0x9f, 
+	0x2, 0x89, 0x9a, 0xd5, 0x82, 0xc1, 0x80, 0x1d, 0xa6, 0x79, 
+	0xd4, 0xb2, 0x1a, 0x32, 0x74, 0x2b, 0xda, 00, 0x55, 0xbc, 
+	0x88, 0xc4, 0xe8, 0xc8, 0xa8, 0x8d, 0xe0, 0x5e, 0xb8, 0x6, 
+	0xa8, 0xb1, 0xdc, 0xb9, 0xb2, 0x6e, 0x8b, 0xba, 0x72, 0xce, 
+	0xd0, 0x92, 0xb0, 0x2e, 0xe5, 0x24, 0x39, 0x8d, 0x71, 0xe5, 
+	0xe1, 0x4c, 0x9d, 0xf1, 0x88, 0xa6, 0x59, 0x21, 0x77, 0x3a, 
+	0xea, 0xe1, 0x6e, 0xec, 0x13, 0xdd, 0x89, 0x33, 0xe5, 0x15, 
+	0x6d, 0x79, 0x21, 0xe1, 0x89, 0x6e, 0xe, 0xcf, 0x93, 0xff, 
+	0x98, 0x29, 0x93, 0xc, 0xad, 0x49, 0x44, 0x18, 0xb, 0x34, 
+	0x71, 0xef, 0x14, 0xcb, 0x38, 0xbc, 0xf3, 0x6d, 0xff, 0x5b, 
+	0x1e, 0x7d, 0x40, 0x85, 0xe4, 0xed, 0x81, 0xe0, 0x55, 0xc4, 
+	0xac, 0xcc, 0xa9, 0xf2, 0x9c, 0x48, 0x66, 0x2a, 0x50, 0x8f, 
+	0x8, 0xb4, 0xcc, 0x39, 0x2b, 0x24, 0x31, 0x3d, 0xcc, 0xb3, 
+	0x10, 0xbc, 0xa0, 0xf4, 0xad, 0x35, 0xd9, 0xfc, 0x3a, 0x32, 
+	0x88, 0x3e, 0x3d, 0xaa, 0xda, 0xf8, 0x23, 0xd4, 0x9d, 0x51, 
+	0x86, 0x32, 0xb8, 0x7f, 0xa2, 0x8d, 0x99, 0x87, 0x8c, 0x23, 
+	0xe5, 0x4b, 0x7b, 0x7c, 0xa8, 0x93, 0x8, 0x6e, 0xef, 0x8e, 
+	0xd, 0xb5, 0x3a, 0x87, 0x97, 0xf9, 0xea, 0x76, 0x75, 0x6b, 
+	0xfe, 0xe4, 0x42, 0xd, 0x3, 0x4f, 0xd8, 0x41, 0x99, 0x7d, 
+	0x80, 0x82, 0x4f, 0xb1, 0x3b, 0xfd, 0xac, 0xc9, 0x92, 0x4b, 
+	0xc9, 0x93, 0x1, 0x9b, 0x52, 0x58, 0x79, 0x82, 0x18, 0x83, 
+	0xdf, 0x44, 0x60, 0x94, 0xa2, 0x1e, 0x51, 0x4c, 0x22, 0x65, 
+	0x46, 0x52, 0xb9, 0xeb, 0xa0, 0x54, 0x59, 0xaa, 0x2f, 0xfb, 
+	0x71, 0xeb, 0xd0, 0x3c, 0x85, 0x3a, 0x3d, 0xb, 0xa7, 0xa4, 
+	0xb3, 0x5, 0x6, 0x4f, 0xf1, 0x74, 0x68, 0xe8, 0x95, 0xec, 
+	0x25, 0x64, 0xa0, 0xef, 0xcb, 0x7e, 0x9a, 0x54, 0x56, 0x7b, 
+	00, 0xd, 0x82, 0x1b, 0x8b, 0xb4, 0xa7, 0x7e, 0x6d, 0x8e, 
+	0x4e, 0x45, 0x75, 0xa1, 0xd0, 0x70, 0xb1, 0x1d, 0xc2, 0x64, 
+	0x51, 0x5d, 0x95, 0x46, 0x2d, 0x4c, 0x41, 0x8b, 0x1a, 0xb, 
+	0xc2, 0x34, 0x66, 0x4e, 0x3f, 0xd5, 0x68, 0xb9, 0xf3, 0xcf, 
+	0xab, 0x98, 0xf6, 0x75, 0x33, 0x73, 0xcf, 0xdc, 0x1, 0x30, 
+	0x9d, 0x9f, 0x1f, 0xbc, 0x4c, 0x7d, 0x73, 0x3a, 0x6e, 0x32, 
+	0xe8, 0xe7, 0xa6, 0x29, 0x9e, 0x6b, 0x8d, 0xae, 0x22, 0x94, 
+	0xe5, 0x5, 0x23, 0xdd, 0xd8, 0xfd, 0xc3, 0xa7, 0xe7, 0x1a, 
+	0x54, 0xc3, 0x34, 0x63, 0x68, 0x1b, 0x2e, 0x19, 0x8f, 0xde, 
+	0x1c, 0x75, 0xd7, 0x72, 0x9c, 0xf, 0x7, 0xfd, 0xca, 0x25, 
+	0x29, 0x71, 0xf9, 0xf6, 0xab, 0x92, 0x95, 0x93, 0x61, 0xdd, 
+	0x18, 0xd3, 0x26, 0xcc, 0xbe, 0xb8, 0xf4, 0x35, 0xfe, 0x3d, 
+	0x5d, 0xf1, 0xc3, 0xe2, 0xaa, 0xac, 0xcc, 0x7d, 0xcf, 0x8, 
+	0x12, 0x9a, 0xc, 0x19, 0x3b, 0xf2, 0x31, 0xf3, 0x62, 0xb0, 
+	0xbf, 0x6c, 0x69, 0x4d, 0x93, 0xb9, 0x64, 0x39, 0x7b, 0x4a, 
+	0x4b, 0x1e, 0xed, 0xaf, 0x46, 0xb4, 0x65, 0x18, 0xa7, 0x58, 
+	0x35, 0x32, 0xa0, 0xc9, 0xba, 0x55, 0x5e, 0xad, 0xf8, 0xea, 
+	0x63, 0x7d, 0x28, 0x46, 0x25, 0x8d, 0x10, 0xf3, 0xca, 0x9b, 
+	0x16, 0x12, 0x8a, 0x31, 0x23, 0x3, 0xdc, 0x40, 0x4e, 0x22, 
+	0x4d, 0xf8, 0xab, 0xda, 0x78, 0xf2, 0xc1, 0x6d, 0x43, 0x23, 
+	0x70, 0xec, 0x76, 0x47, 0xc7, 0x63, 0x8d, 0xdb, 0xf5, 0x5e, 
+	0xa, 0x7c, 0xbf, 0x43, 0xa6, 0xe, 0x1, 0x27, 0x8c, 0xb2, 
+	0x1e, 0xcf, 0xd5, 0xc6, 0xd6, 0x7d, 0x6a, 0xf7, 0x37, 0xd3, 
+	0x11, 0x95, 0x4e, 0xa1, 0x16, 0xea, 0x40, 0x4d, 0xeb, 0xeb, 
+	0xe3, 0xe4, 0xb9, 0xea, 0xbd, 0xdb, 0x35, 0x56, 0xb7, 0x4e, 
+	0x8b, 0x8d, 0x99, 0x4d, 0x71, 0xe6, 0xa4, 0x58, 0xa9, 0x62, 
+	0x1a, 0xcc, 0x67, 0x8b, 0xc7, 0xa1, 0x84, 0xea, 0xce, 0x38, 
+	0xaa, 0xbc, 0x9e, 0xdb, 0xe3, 0xe9, 0xe9, 0xf9, 0xf9, 0xe5, 
+	0xa5, 0xf3, 0x27, 0x4d, 0xd4, 0xec, 0xac, 0x77, 0x9a, 0x7e, 
+	0xe0, 0x7, 0x77, 0xda, 0xde, 0xad, 0x1, 0x10, 0xd6, 0x82, 
+	0x1b, 0x9c, 0x90, 0xa5, 0x7a, 0x4a, 0xa3, 0xbd, 0xf2, 0xd7, 
+	0xc9, 0x5b, 0x27, 0x56, 0xdd, 0x7b, 0xa5, 0x3a, 0xb0, 0xb0, 
+	00, 0x51, 0x7b, 0xd8, 0xe0, 0x2e, 0xf1, 0xf, 0xbe, 0x7d, 
+	0x65, 0x13, 0x39, 0xd, 00, 00, };
 
 const struct fsdata_file file_404_html[] = {{NULL, data_404_html, data_404_html + 10, sizeof(data_404_html) - 10}};
 
@@ -4214,10 +4418,26 @@ const struct fsdata_file file_firmware_html[] = {{file_basic_html, data_firmware
 
 const struct fsdata_file file_index_html[] = {{file_firmware_html, data_index_html, data_index_html + 12, sizeof(data_index_html) - 12}};
 
+const struct fsdata_file file_index_html_gz[] = {{NULL, data_index_html_gz, data_index_html_gz + 12, sizeof(data_index_html_gz) - 12}};
+
 const struct fsdata_file file_jump_html[] = {{file_index_html, data_jump_html, data_jump_html + 11, sizeof(data_jump_html) - 11}};
 
 const struct fsdata_file file_style_css[] = {{file_jump_html, data_style_css, data_style_css + 11, sizeof(data_style_css) - 11}};
 
+const struct fsdata_file file_style_css_gz[] = {{NULL, data_style_css_gz, data_style_css_gz + 11, sizeof(data_style_css_gz) - 11}};
+
 #define FS_ROOT file_style_css
 
 #define FS_NUMFILES 7
+
+static const struct fsdata_index fs_index[FS_NUMFILES] = {
+	{file_jump_html, NULL, 0x1768d7cd, 10, FS_FLAG_PARSE, 0x00000000},
+	{file_advance_html, NULL, 0x19c74907, 13, FS_FLAG_PARSE, 0x00000000},
+	{file_style_css, file_style_css_gz, 0x29d360da, 10, FS_FLAG_LENGTH | FS_FLAG_GZIP, 0x21b43b85},
+	{file_basic_html, NULL, 0x4286b0db, 11, FS_FLAG_PARSE, 0x00000000},
+	{file_index_html, file_index_html_gz, 0x457c5a71, 11, FS_FLAG_LENGTH | FS_FLAG_GZIP, 0xdce895d2},
+	{file_firmware_html, NULL, 0x830000fe, 14, FS_FLAG_PARSE, 0x00000000},
+	{file_404_html, NULL, 0xbdd71e79, 9, FS_FLAG_LENGTH, 0x00000000},
+};
+
+#define FS_INDEX fs_index
@@ -43,4 +43,14 @@ struct fsdata_file {
   const int len;
 };
 
+/* Lookup index generated by makefs, sorted by name hash. */
+struct fsdata_index {
+  const struct fsdata_file *file;
+  const struct fsdata_file *gzfile; /* gzip variant, or NULL */
+  const unsigned int hash;          /* FNV-1a of the file name */
+  const unsigned short name_len;
+  const unsigned char flags;        /* FS_FLAG_*, GZIP: gzfile is set */
+  const unsigned int etag;          /* FNV-1a of the content, 0: not cacheable */
+};
+
 #endif /* __FSDATA_H__ */
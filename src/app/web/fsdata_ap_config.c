@@ -1,7 +1,7 @@
 static const unsigned char data_404_html[] = {
 	/* /404.html */
 	0x2f, 0x34, 0x30, 0x34, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x34, 
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x34, 
 	0x30, 0x34, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x6e, 0x6f, 
 	0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0xd, 0xa, 0x53, 
 	0x65, 0x72, 0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 
@@ -11,7 +11,12 @@ static const unsigned char data_404_html[] = {
 	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
 	0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
 	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
-	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, };
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0xd, 0xa, 0x43, 0x61, 0x63, 
+	0x68, 0x65, 0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 
+	0x3a, 0x20, 0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 
+	0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
+	0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x30, 0xd, 
+	0xa, 0xd, 0xa, };
 
 static const unsigned char data_basic_html[] = {
 	/* /basic.html */
@@ -25,132 +30,133 @@ static const unsigned char data_basic_html[] = {
 	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
 	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
 	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
-	0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, 0x3c, 0x21, 0x44, 
-	0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 
-	0x6c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 
-	0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f, 0x2f, 0x44, 0x54, 
-	0x44, 0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x31, 0x2e, 
-	0x30, 0x20, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 
-	0x6f, 0x6e, 0x61, 0x6c, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x20, 
-	0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 
-	0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x54, 
-	0x52, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2f, 0x44, 
-	0x54, 0x44, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2d, 
-	0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
-	0x61, 0x6c, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 0xd, 0xa, 
-	0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 
-	0x73, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 
-	0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 
-	0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x78, 0x68, 0x74, 0x6d, 
-	0x6c, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 
-	0x44, 0x57, 0x36, 0x20, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 
-	0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 
-	0x2d, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x20, 0x32, 0x30, 0x30, 0x35, 0x20, 0x4d, 0x61, 0x63, 
-	0x72, 0x6f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2c, 0x20, 0x49, 
-	0x6e, 0x63, 0x2e, 0x20, 0x41, 0x6c, 0x6c, 0x20, 0x72, 0x69, 
-	0x67, 0x68, 0x74, 0x73, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 
-	0x76, 0x65, 0x64, 0x2e, 0x20, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 
-	0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x68, 0x74, 0x74, 0x70, 
-	0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d, 0x22, 0x43, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 
-	0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 
-	0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 
-	0x3b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 
-	0x75, 0x74, 0x66, 0x2d, 0x38, 0x22, 0x20, 0x2f, 0x3e, 0xd, 
-	0xa, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 
-	0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 
-	0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 
-	0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0x22, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 
-	0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2f, 0x3e, 0xd, 
-	0xa, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x74, 
-	0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 
-	0x4a, 0x61, 0x76, 0x61, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 
-	0x22, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0xd, 0xa, 
-	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 
-	0x61, 0x76, 0x65, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28, 
-	0x29, 0xd, 0xa, 0x7b, 0xd, 0xa, 0x69, 0x66, 0x28, 0x63, 
-	0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x28, 0x27, 0x53, 0x61, 
-	0x76, 0x65, 0x3f, 0x5c, 0x6e, 0x27, 0x29, 0x29, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
-	0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x9, 0x20, 0x20, 0x20, 
-	0x20, 0xd, 0xa, 0x65, 0x6c, 0x73, 0x65, 0xd, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
-	0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xd, 0xa, 0x7d, 0xd, 
-	0xa, 0x2f, 0x2f, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 
-	0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0xd, 0xa, 0x3c, 
-	0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x62, 
-	0x6f, 0x64, 0x79, 0x3e, 0x20, 0xd, 0xa, 0x3c, 0x42, 0x52, 
-	0x3e, 0x3c, 0x42, 0x52, 0x3e, 0xd, 0xa, 0x3c, 0x64, 0x69, 
-	0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 0x67, 0x65, 
-	0x63, 0x65, 0x6c, 0x6c, 0x31, 0x22, 0x20, 0x73, 0x74, 0x79, 
-	0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 
-	0x38, 0x30, 0x30, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-	0x3d, 0x38, 0x30, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 
-	0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x70, 0x61, 0x67, 
-	0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x2d, 0x2d, 0x3e, 0xd, 
-	0xa, 0xd, 0xa, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x22, 
-	0x3e, 0xd, 0xa, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 
-	0x64, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 0x20, 
-	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 
-	0x31, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 
-	0x22, 0x67, 0x65, 0x74, 0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 
-	0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x64, 
-	0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 
-	0x73, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x3e, 0x20, 0xd, 0xa, 
-	0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 
-	0x74, 0x68, 0x3d, 0x22, 0x35, 0x30, 0x30, 0x22, 0x20, 0x62, 
-	0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 
-	0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 
-	0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 
-	0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x35, 
-	0x22, 0x3e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 
-	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x72, 
-	0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-	0x74, 0x3d, 0x22, 0x34, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 
-	0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x38, 0x22, 0x3e, 0x3c, 
-	0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
-	0xa, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0xd, 0xa, 0x3c, 
-	0x74, 0x72, 0x3e, 0xd, 0xa, 0x3c, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x3e, 0xd, 0xa, 0x73, 0x73, 0x69, 0x64, 0x3a, 0x20, 
-	0x3c, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x20, 0x6e, 0x61, 0x6d, 
-	0x65, 0x3d, 0x22, 0x53, 0x73, 0x69, 0x64, 0x22, 0x20, 0x73, 
-	0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 
-	0x68, 0x3a, 0x20, 0x32, 0x35, 0x30, 0x70, 0x78, 0x3b, 0x20, 
-	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x32, 0x35, 
-	0x70, 0x78, 0x3b, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 
-	0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x38, 0x70, 0x78, 0x3b, 
-	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 
-	0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x73, 
-	0x69, 0x64, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
-	0x22, 0x6e, 0x6f, 0x6f, 0x73, 0x22, 0x20, 0x73, 0x69, 0x7a, 
-	0x65, 0x3d, 0x22, 0x33, 0x30, 0x22, 0x20, 0x6d, 0x61, 0x78, 
-	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x33, 0x32, 
-	0x22, 0x3e, 0x3c, 0x53, 0x50, 0x41, 0x4e, 0x3e, 0x3c, 0x42, 
-	0x52, 0x3e, 0x3c, 0x42, 0x52, 0x3e, 0x20, 0xd, 0xa, 0x4c, 
-	0x69, 0x73, 0x74, 0x3a, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 
-	0x63, 0x74, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x32, 0x35, 0x30, 
-	0x70, 0x78, 0x3b, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-	0x3a, 0x20, 0x33, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x66, 0x6f, 
-	0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 
-	0x38, 0x70, 0x78, 0x3b, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x22, 0x20, 0x73, 
-	0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x22, 0x20, 0x6f, 
-	0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x74, 
-	0x68, 0x69, 0x73, 0x2e, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 
-	0x4e, 0x6f, 0x64, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x69, 
-	0x6f, 0x75, 0x73, 0x53, 0x69, 0x62, 0x6c, 0x69, 0x6e, 0x67, 
-	0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x74, 0x68, 0x69, 
-	0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x3e, 0xd, 
-	0xa, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x74, 0x6d, 0x6c, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 
+	0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 
+	0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0xd, 0xa, 
+	0xd, 0xa, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 
+	0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x50, 0x55, 0x42, 
+	0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 0x57, 0x33, 
+	0x43, 0x2f, 0x2f, 0x44, 0x54, 0x44, 0x20, 0x58, 0x48, 0x54, 
+	0x4d, 0x4c, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x54, 0x72, 0x61, 
+	0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2f, 
+	0x2f, 0x45, 0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 
+	0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 
+	0x6f, 0x72, 0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 0x74, 
+	0x6d, 0x6c, 0x31, 0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 0x68, 
+	0x74, 0x6d, 0x6c, 0x31, 0x2d, 0x74, 0x72, 0x61, 0x6e, 0x73, 
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2e, 0x64, 0x74, 
+	0x64, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 
+	0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 
+	0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 
+	0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 
+	0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0xd, 0xa, 
+	0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x44, 0x57, 0x36, 0x20, 0x2d, 
+	0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 
+	0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x70, 
+	0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x30, 
+	0x35, 0x20, 0x4d, 0x61, 0x63, 0x72, 0x6f, 0x6d, 0x65, 0x64, 
+	0x69, 0x61, 0x2c, 0x20, 0x49, 0x6e, 0x63, 0x2e, 0x20, 0x41, 
+	0x6c, 0x6c, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 
+	0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2e, 0x20, 
+	0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x6d, 0x65, 0x74, 0x61, 
+	0x20, 0x68, 0x74, 0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 
+	0x76, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
+	0x2d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 
+	0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 
+	0x72, 0x73, 0x65, 0x74, 0x3d, 0x75, 0x74, 0x66, 0x2d, 0x38, 
+	0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x6c, 0x69, 0x6e, 
+	0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 
+	0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 
+	0x72, 0x65, 0x66, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+	0x2e, 0x63, 0x73, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 
+	0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x73, 0x63, 0x72, 
+	0x69, 0x70, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 
+	0x74, 0x65, 0x78, 0x74, 0x2f, 0x4a, 0x61, 0x76, 0x61, 0x53, 
+	0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x3c, 
+	0x21, 0x2d, 0x2d, 0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x73, 0x61, 0x76, 0x65, 0x63, 0x6f, 
+	0x6e, 0x66, 0x69, 0x67, 0x28, 0x29, 0xd, 0xa, 0x7b, 0xd, 
+	0xa, 0x69, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 
+	0x6d, 0x28, 0x27, 0x53, 0x61, 0x76, 0x65, 0x3f, 0x5c, 0x6e, 
+	0x27, 0x29, 0x29, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x72, 0x75, 0x65, 
+	0x3b, 0x9, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x65, 0x6c, 
+	0x73, 0x65, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 
+	0x3b, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x2f, 0x2f, 0x2d, 0x2d, 
+	0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 
+	0x74, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 
+	0x3e, 0xd, 0xa, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x20, 
+	0xd, 0xa, 0x3c, 0x42, 0x52, 0x3e, 0x3c, 0x42, 0x52, 0x3e, 
+	0xd, 0xa, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 
+	0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 
+	0x69, 0x64, 0x74, 0x68, 0x3a, 0x38, 0x30, 0x30, 0x3b, 0x68, 
+	0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x38, 0x30, 0x30, 0x22, 
+	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 
+	0x6e, 0x74, 0x65, 0x72, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x21, 
+	0x2d, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 
+	0x31, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0xd, 0xa, 0x3c, 0x64, 
+	0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 
+	0x74, 0x65, 0x6e, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x66, 
+	0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x6f, 
+	0x72, 0x6d, 0x31, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
+	0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 0x20, 0x6d, 0x65, 
+	0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 
+	0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 
+	0x3e, 0xd, 0xa, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 
+	0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x6f, 0x72, 0x79, 
+	0x22, 0x3e, 0x20, 0xd, 0xa, 0x3c, 0x74, 0x61, 0x62, 0x6c, 
+	0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x35, 
+	0x30, 0x30, 0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 
+	0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 
+	0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 
+	0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 
+	0x6e, 0x67, 0x3d, 0x22, 0x35, 0x22, 0x3e, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0xd, 0xa, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
+	0xd, 0xa, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 
+	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x34, 0x30, 
+	0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 
+	0x22, 0x38, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 
+	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x72, 0x3e, 
+	0xd, 0xa, 0xd, 0xa, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 
+	0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x73, 
+	0x73, 0x69, 0x64, 0x3a, 0x20, 0x3c, 0x49, 0x4e, 0x50, 0x55, 
+	0x54, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x73, 
+	0x69, 0x64, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 
+	0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x32, 0x35, 
+	0x30, 0x70, 0x78, 0x3b, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3a, 0x20, 0x32, 0x35, 0x70, 0x78, 0x3b, 0x20, 0x66, 
+	0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 
+	0x31, 0x38, 0x70, 0x78, 0x3b, 0x22, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x53, 0x73, 0x69, 0x64, 0x22, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x6e, 0x6f, 0x6f, 0x73, 
+	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x33, 0x30, 
+	0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
+	0x68, 0x3d, 0x22, 0x33, 0x32, 0x22, 0x3e, 0x3c, 0x53, 0x50, 
+	0x41, 0x4e, 0x3e, 0x3c, 0x42, 0x52, 0x3e, 0x3c, 0x42, 0x52, 
+	0x3e, 0x20, 0xd, 0xa, 0x4c, 0x69, 0x73, 0x74, 0x3a, 0x20, 
+	0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x73, 0x74, 
+	0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3a, 0x20, 0x32, 0x35, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x68, 
+	0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x33, 0x30, 0x70, 
+	0x78, 0x3b, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 
+	0x7a, 0x65, 0x3a, 0x20, 0x31, 0x38, 0x70, 0x78, 0x3b, 0x22, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x6e, 0x63, 
+	0x72, 0x79, 0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 
+	0x31, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x45, 0x6e, 0x63, 
+	0x72, 0x79, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 
+	0x67, 0x65, 0x3d, 0x22, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x70, 
+	0x61, 0x72, 0x65, 0x6e, 0x74, 0x4e, 0x6f, 0x64, 0x65, 0x2e, 
+	0x70, 0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x53, 0x69, 
+	0x62, 0x6c, 0x69, 0x6e, 0x67, 0x2e, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -159,9 +165,9 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x3e, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -172,9 +178,9 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -185,9 +191,9 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -198,8 +204,9 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -211,7 +218,7 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -224,7 +231,7 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -237,7 +244,7 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -250,7 +257,7 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -262,9 +269,8 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -275,9 +281,9 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -288,9 +294,9 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -301,9 +307,9 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -314,9 +320,9 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -327,8 +333,9 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -340,7 +347,7 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -353,7 +360,7 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -366,7 +373,7 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -379,61 +386,62 @@ static const unsigned char data_basic_html[] = {
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xd, 
-	0xa, 0xd, 0xa, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 
-	0x74, 0x3e, 0x3c, 0x2f, 0x53, 0x50, 0x41, 0x4e, 0x3e, 0x3c, 
-	0x42, 0x52, 0x3e, 0x3c, 0x42, 0x52, 0x3e, 0xd, 0xa, 0x3c, 
-	0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x3c, 
-	0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x72, 0x3e, 
-	0xd, 0xa, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 
-	0xa, 0x70, 0x77, 0x64, 0x3a, 0x20, 0x3c, 0x69, 0x6e, 0x70, 
-	0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 
-	0x65, 0x79, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 
-	0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x32, 0x35, 
-	0x30, 0x70, 0x78, 0x3b, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-	0x74, 0x3a, 0x20, 0x32, 0x35, 0x70, 0x78, 0x3b, 0x20, 0x66, 
-	0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 
-	0x31, 0x38, 0x70, 0x78, 0x3b, 0x22, 0x20, 0x74, 0x79, 0x70, 
-	0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 
-	0x64, 0x3d, 0x22, 0x4b, 0x65, 0x79, 0x22, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x22, 0x20, 0x73, 0x69, 0x7a, 
-	0x65, 0x3d, 0x22, 0x33, 0x30, 0x22, 0x20, 0x6d, 0x61, 0x78, 
-	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x36, 0x34, 
-	0x22, 0x20, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x74, 
-	0x72, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 
-	0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-	0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 
-	0x70, 0x61, 0x6e, 0x3d, 0x22, 0x34, 0x22, 0x20, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 
-	0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x74, 0x6f, 0x70, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x3c, 0x69, 0x6e, 
-	0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 
-	0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 
-	0x38, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x68, 0x65, 0x69, 0x67, 
-	0x68, 0x74, 0x3a, 0x20, 0x34, 0x30, 0x70, 0x78, 0x3b, 0x22, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 
-	0x6d, 0x69, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 
-	0x61, 0x76, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 
-	0x63, 0x6b, 0x3d, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
-	0x20, 0x73, 0x61, 0x76, 0x65, 0x63, 0x6f, 0x6e, 0x66, 0x69, 
-	0x67, 0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x2f, 0x3e, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x3e, 0xd, 0xa, 0xd, 0xa, 0x3c, 0x2f, 
+	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0x3c, 0x2f, 0x53, 
+	0x50, 0x41, 0x4e, 0x3e, 0x3c, 0x42, 0x52, 0x3e, 0x3c, 0x42, 
+	0x52, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 
+	0xa, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x3c, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 0x70, 0x77, 0x64, 0x3a, 
+	0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x65, 0x79, 0x22, 0x20, 0x73, 
+	0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 
+	0x68, 0x3a, 0x20, 0x32, 0x35, 0x30, 0x70, 0x78, 0x3b, 0x20, 
+	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x32, 0x35, 
+	0x70, 0x78, 0x3b, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 
+	0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x38, 0x70, 0x78, 0x3b, 
+	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 
+	0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x4b, 0x65, 
+	0x79, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x22, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x33, 0x30, 
+	0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
+	0x68, 0x3d, 0x22, 0x36, 0x34, 0x22, 0x20, 0x20, 0x2f, 0x3e, 
 	0xd, 0xa, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
-	0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 
-	0x70, 0x3b, 0xd, 0xa, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 
-	0xa, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 
-	0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 
-	0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x66, 0x6f, 
-	0x72, 0x6d, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x64, 0x69, 0x76, 
+	0xd, 0xa, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x3c, 
+	0x74, 0x72, 0x3e, 0xd, 0xa, 0x3c, 0x74, 0x64, 0x20, 0x68, 
+	0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 
+	0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 
+	0x34, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 
+	0x3e, 0xd, 0xa, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0xd, 0xa, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 
+	0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 
+	0x64, 0x74, 0x68, 0x3a, 0x20, 0x38, 0x30, 0x70, 0x78, 0x3b, 
+	0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x34, 
+	0x30, 0x70, 0x78, 0x3b, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 
+	0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x61, 0x76, 0x65, 
+	0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28, 0x29, 0x22, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 
+	0x65, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 
+	0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0xd, 0xa, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x74, 0x72, 
+	0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 
 	0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 
-	0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x65, 0x6e, 0x64, 0x20, 0x70, 
-	0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x2d, 0x2d, 
-	0x3e, 0xd, 0xa, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0xd, 
-	0xa, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 
-	0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xd, 0xa, };
+	0xa, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0xd, 0xa, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 
+	0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 
+	0x65, 0x6e, 0x64, 0x20, 0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 
+	0x6c, 0x6c, 0x31, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x62, 
+	0x72, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x62, 0x6f, 
+	0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 
+	0x6c, 0x3e, 0xd, 0xa, };
 
 static const unsigned char data_firmware_html[] = {
 	/* /firmware.html */
@@ -447,179 +455,239 @@ static const unsigned char data_firmware_html[] = {
 	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
 	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
 	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
-	0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, 0x3c, 0x21, 0x44, 
-	0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 
-	0x6c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 
-	0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f, 0x2f, 0x44, 0x54, 
-	0x44, 0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x31, 0x2e, 
-	0x30, 0x20, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 
-	0x6f, 0x6e, 0x61, 0x6c, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x20, 
-	0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 
-	0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x54, 
-	0x52, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2f, 0x44, 
-	0x54, 0x44, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2d, 
-	0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
-	0x61, 0x6c, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 0xd, 0xa, 
-	0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 
-	0x73, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 
-	0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 
-	0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x78, 0x68, 0x74, 0x6d, 
-	0x6c, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 
-	0x44, 0x57, 0x36, 0x20, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 
-	0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 
-	0x2d, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x20, 0x32, 0x30, 0x30, 0x35, 0x20, 0x4d, 0x61, 0x63, 
-	0x72, 0x6f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2c, 0x20, 0x49, 
-	0x6e, 0x63, 0x2e, 0x20, 0x41, 0x6c, 0x6c, 0x20, 0x72, 0x69, 
-	0x67, 0x68, 0x74, 0x73, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 
-	0x76, 0x65, 0x64, 0x2e, 0x20, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 
-	0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x68, 0x74, 0x74, 0x70, 
-	0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d, 0x22, 0x43, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 
-	0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 
-	0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 
-	0x3b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 
-	0x67, 0x62, 0x32, 0x33, 0x31, 0x32, 0x22, 0x20, 0x2f, 0x3e, 
-	0xd, 0xa, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 
-	0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 
-	0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 
-	0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 
-	0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 
-	0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2f, 0x3e, 
-	0xd, 0xa, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 
-	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
-	0x2f, 0x4a, 0x61, 0x76, 0x61, 0x53, 0x63, 0x72, 0x69, 0x70, 
-	0x74, 0x22, 0x3e, 0xd, 0xa, 0xd, 0xa, 0x66, 0x75, 0x6e, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x55, 0x70, 0x47, 0x72, 
-	0x61, 0x64, 0x65, 0x28, 0x29, 0xd, 0xa, 0x7b, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xd, 0xa, 0x9, 0x69, 
-	0x66, 0x20, 0x28, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x46, 0x69, 0x72, 0x6d, 0x57, 0x61, 0x72, 0x65, 
-	0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x2e, 0x66, 0x69, 
-	0x6c, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 
-	0x3d, 0x20, 0x22, 0x22, 0x29, 0xd, 0xa, 0x9, 0x7b, 0xd, 
-	0xa, 0x9, 0x9, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x22, 
-	0x4e, 0x6f, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x21, 0x22, 0x29, 
-	0x3b, 0xd, 0xa, 0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 
-	0x6e, 0x20, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0xd, 0xa, 0x9, 
-	0x69, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 
-	0x28, 0x27, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x3f, 0x27, 
-	0x29, 0x29, 0x7b, 0xd, 0xa, 0x9, 0x20, 0x20, 0x20, 0x64, 
-	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x46, 0x69, 
-	0x72, 0x6d, 0x57, 0x61, 0x72, 0x65, 0x55, 0x70, 0x67, 0x72, 
-	0x61, 0x64, 0x65, 0x2e, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 
-	0x28, 0x29, 0x20, 0x3b, 0xd, 0xa, 0x9, 0x7d, 0x20, 0x9, 
-	0xd, 0xa, 0x7d, 0xd, 0xa, 0x3c, 0x2f, 0x73, 0x63, 0x72, 
-	0x69, 0x70, 0x74, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x65, 
-	0x61, 0x64, 0x3e, 0xd, 0xa, 0x3c, 0x62, 0x6f, 0x64, 0x79, 
-	0x3e, 0xd, 0xa, 0x3c, 0x42, 0x52, 0x3e, 0x3c, 0x42, 0x52, 
-	0x3e, 0xd, 0xa, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 
-	0x31, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x38, 0x30, 0x30, 0x3b, 
-	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x38, 0x30, 0x30, 
-	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 
-	0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x63, 
-	0x65, 0x6c, 0x6c, 0x31, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x20, 
-	0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 
-	0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x22, 0x3e, 0xd, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 
-	0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 
-	0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x70, 
-	0x6f, 0x73, 0x74, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x74, 0x79, 
-	0x70, 0x65, 0x3d, 0x22, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 
-	0x61, 0x72, 0x74, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x64, 
-	0x61, 0x74, 0x61, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x46, 0x69, 0x72, 0x6d, 0x57, 0x61, 0x72, 0x65, 0x55, 
-	0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x22, 0x20, 0x69, 0x64, 
-	0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x31, 0x22, 0x3e, 0x20, 
-	0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 
-	0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 
-	0x73, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x3e, 0x20, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 
-	0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 
-	0x34, 0x30, 0x30, 0x22, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 
-	0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 
-	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x30, 
-	0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 
-	0x69, 0x6e, 0x67, 0x3d, 0x22, 0x35, 0x22, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
-	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 
-	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 
-	0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 
-	0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 
-	0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x32, 0x30, 
-	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x72, 
-	0x69, 0x67, 0x68, 0x74, 0x22, 0x3e, 0x46, 0x69, 0x6c, 0x65, 
-	0x3a, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 
-	0x22, 0x6c, 0x65, 0x66, 0x74, 0x22, 0x3e, 0x3c, 0x69, 0x6e, 
-	0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 
-	0x66, 0x69, 0x6c, 0x65, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x20, 0x2f, 0x3e, 
-	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 
-	0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 
-	0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 
-	0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 
-	0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 
-	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
-	0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 
-	0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x20, 
-	0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x33, 
-	0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 
-	0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x61, 
-	0x6d, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 
-	0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 
-	0x74, 0x68, 0x3a, 0x20, 0x38, 0x30, 0x70, 0x78, 0x3b, 0x20, 
-	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x34, 0x30, 
-	0x70, 0x78, 0x3b, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
-	0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x20, 0x69, 
-	0x64, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x6f, 
-	0x6e, 0x43, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x55, 0x70, 
-	0x47, 0x72, 0x61, 0x64, 0x65, 0x28, 0x29, 0x22, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x55, 0x70, 0x67, 0x72, 
-	0x61, 0x64, 0x65, 0x22, 0x20, 0x2f, 0x3e, 0x9, 0x20, 0x20, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
-	0x62, 0x65, 0x6c, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 
-	0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x3c, 0x2f, 0x74, 0x64, 
-	0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x2f, 0x74, 
-	0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 0x20, 0x3c, 0x74, 
-	0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 
-	0x68, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 
-	0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 
-	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xd, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
-	0xd, 0xa, 0x9, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 
-	0xd, 0xa, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
-	0xd, 0xa, 0xd, 0xa, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
-	0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x65, 0x6e, 0x64, 0x20, 
+	0x74, 0x6d, 0x6c, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 
+	0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 
+	0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0xd, 0xa, 
+	0xd, 0xa, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 
+	0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x50, 0x55, 0x42, 
+	0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 0x57, 0x33, 
+	0x43, 0x2f, 0x2f, 0x44, 0x54, 0x44, 0x20, 0x58, 0x48, 0x54, 
+	0x4d, 0x4c, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x54, 0x72, 0x61, 
+	0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2f, 
+	0x2f, 0x45, 0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 
+	0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 
+	0x6f, 0x72, 0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 0x74, 
+	0x6d, 0x6c, 0x31, 0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 0x68, 
+	0x74, 0x6d, 0x6c, 0x31, 0x2d, 0x74, 0x72, 0x61, 0x6e, 0x73, 
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2e, 0x64, 0x74, 
+	0x64, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 
+	0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 
+	0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 
+	0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 
+	0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0xd, 0xa, 
+	0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x44, 0x57, 0x36, 0x20, 0x2d, 
+	0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 
+	0xd, 0xa, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x70, 
+	0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x30, 
+	0x35, 0x20, 0x4d, 0x61, 0x63, 0x72, 0x6f, 0x6d, 0x65, 0x64, 
+	0x69, 0x61, 0x2c, 0x20, 0x49, 0x6e, 0x63, 0x2e, 0x20, 0x41, 
+	0x6c, 0x6c, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 
+	0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2e, 0x20, 
+	0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x6d, 0x65, 0x74, 0x61, 
+	0x20, 0x68, 0x74, 0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 
+	0x76, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
+	0x2d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 
+	0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 
+	0x72, 0x73, 0x65, 0x74, 0x3d, 0x67, 0x62, 0x32, 0x33, 0x31, 
+	0x32, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x6c, 0x69, 
+	0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 
+	0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 
+	0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 
+	0x65, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 
+	0x73, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x73, 0x63, 
+	0x72, 0x69, 0x70, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
+	0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x4a, 0x61, 0x76, 0x61, 
+	0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3e, 0xd, 0xa, 
+	0xd, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x55, 0x70, 0x47, 0x72, 0x61, 0x64, 0x65, 0x28, 0x29, 
+	0xd, 0xa, 0x7b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0xd, 0xa, 0x9, 0x69, 0x66, 0x20, 0x28, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x46, 0x69, 0x72, 
+	0x6d, 0x57, 0x61, 0x72, 0x65, 0x55, 0x70, 0x67, 0x72, 0x61, 
+	0x64, 0x65, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x22, 0x22, 0x29, 
+	0xd, 0xa, 0x9, 0x7b, 0xd, 0xa, 0x9, 0x9, 0x61, 0x6c, 
+	0x65, 0x72, 0x74, 0x28, 0x22, 0x4e, 0x6f, 0x20, 0x66, 0x69, 
+	0x6c, 0x65, 0x21, 0x22, 0x29, 0x3b, 0xd, 0xa, 0x9, 0x9, 
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x3b, 0xd, 0xa, 
+	0x9, 0x7d, 0xd, 0xa, 0x9, 0x69, 0x66, 0x28, 0x63, 0x6f, 
+	0x6e, 0x66, 0x69, 0x72, 0x6d, 0x28, 0x27, 0x55, 0x70, 0x64, 
+	0x61, 0x74, 0x65, 0x3f, 0x27, 0x29, 0x29, 0x7b, 0xd, 0xa, 
+	0x9, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0x46, 0x69, 0x72, 0x6d, 0x57, 0x61, 0x72, 
+	0x65, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x2e, 0x73, 
+	0x75, 0x62, 0x6d, 0x69, 0x74, 0x28, 0x29, 0x20, 0x3b, 0xd, 
+	0xa, 0x9, 0x7d, 0x20, 0x9, 0xd, 0xa, 0x7d, 0xd, 0xa, 
+	0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0xd, 
+	0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 
+	0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x42, 
+	0x52, 0x3e, 0x3c, 0x42, 0x52, 0x3e, 0xd, 0xa, 0x3c, 0x64, 
+	0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 0x67, 
+	0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x22, 0x20, 0x73, 0x74, 
+	0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3a, 0x38, 0x30, 0x30, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3d, 0x38, 0x30, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 
+	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 
 	0x70, 0x61, 0x67, 0x65, 0x63, 0x65, 0x6c, 0x6c, 0x31, 0x2d, 
-	0x2d, 0x3e, 0xd, 0xa, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 
-	0xd, 0xa, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xd, 
-	0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xd, 0xa, 
-	0xd, 0xa, };
+	0x2d, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 
+	0x20, 0x69, 0x64, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x65, 
+	0x6e, 0x74, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 
+	0x6f, 0x64, 0x3d, 0x22, 0x70, 0x6f, 0x73, 0x74, 0x22, 0x20, 
+	0x65, 0x6e, 0x63, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x6d, 
+	0x75, 0x6c, 0x74, 0x69, 0x70, 0x61, 0x72, 0x74, 0x2f, 0x66, 
+	0x6f, 0x72, 0x6d, 0x2d, 0x64, 0x61, 0x74, 0x61, 0x22, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x72, 0x6d, 
+	0x57, 0x61, 0x72, 0x65, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 
+	0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x6f, 0x72, 
+	0x6d, 0x31, 0x22, 0x3e, 0x20, 0x20, 0x20, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 
+	0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x6f, 0x72, 0x79, 
+	0x22, 0x3e, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 
+	0x64, 0x74, 0x68, 0x3d, 0x22, 0x34, 0x30, 0x30, 0x22, 0x20, 
+	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 
+	0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 
+	0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 
+	0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 
+	0x35, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 
+	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
+	0x22, 0x31, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
+	0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 
+	0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x74, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3d, 0x22, 0x31, 0x32, 0x30, 0x22, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 
+	0x3e, 0x46, 0x69, 0x6c, 0x65, 0x3a, 0x3c, 0x2f, 0x74, 0x64, 
+	0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 
+	0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 
+	0x22, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 
+	0x79, 0x70, 0x65, 0x3d, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x22, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x69, 0x6c, 
+	0x65, 0x22, 0x20, 0x2f, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 
+	0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 
+	0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 
+	0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 
+	0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 0x9, 0x20, 
+	0x20, 0x3c, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x74, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 
+	0x22, 0x32, 0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 
+	0x61, 0x6e, 0x3d, 0x22, 0x33, 0x22, 0x20, 0x61, 0x6c, 0x69, 
+	0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 
+	0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 
+	0x74, 0x6f, 0x70, 0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xd, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 
+	0x75, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 
+	0x61, 0x76, 0x65, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+	0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x38, 
+	0x30, 0x70, 0x78, 0x3b, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3a, 0x20, 0x34, 0x30, 0x70, 0x78, 0x3b, 0x22, 0x20, 
+	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 
+	0x6f, 0x6e, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x61, 
+	0x76, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x43, 0x6c, 0x69, 0x63, 
+	0x6b, 0x3d, 0x22, 0x55, 0x70, 0x47, 0x72, 0x61, 0x64, 0x65, 
+	0x28, 0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x22, 0x20, 
+	0x2f, 0x3e, 0x9, 0x20, 0x20, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x26, 
+	0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 
+	0x3b, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0xd, 0xa, 0x9, 0x9, 
+	0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x9, 
+	0x9, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 
+	0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x31, 
+	0x30, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 
+	0x3d, 0x22, 0x32, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 
+	0x6c, 0x65, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x2f, 
+	0x66, 0x6f, 0x72, 0x6d, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 
+	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0xd, 0xa, 0x3c, 
+	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xd, 0xa, 0x3c, 0x21, 0x2d, 
+	0x2d, 0x65, 0x6e, 0x64, 0x20, 0x70, 0x61, 0x67, 0x65, 0x63, 
+	0x65, 0x6c, 0x6c, 0x31, 0x2d, 0x2d, 0x3e, 0xd, 0xa, 0x3c, 
+	0x62, 0x72, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x62, 
+	0x6f, 0x64, 0x79, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x74, 
+	0x6d, 0x6c, 0x3e, 0xd, 0xa, 0xd, 0xa, };
 
 static const unsigned char data_index_html[] = {
 	/* /index.html */
 	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x31, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x28, 0x68, 0x74, 0x74, 
+	0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x73, 0x69, 
+	0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 0x64, 0x61, 
+	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
+	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
+	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
+	0x74, 0x6d, 0x6c, 0xd, 0xa, 0x45, 0x54, 0x61, 0x67, 0x3a, 
+	0x20, 0x22, 0x32, 0x30, 0x34, 0x35, 0x33, 0x65, 0x39, 0x39, 
+	0x22, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2d, 0x43, 
+	0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 0x6e, 0x6f, 
+	0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0xd, 0xa, 0x56, 0x61, 
+	0x72, 0x79, 0x3a, 0x20, 0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 
+	0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0xd, 
+	0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x33, 0x34, 0x39, 
+	0xd, 0xa, 0xd, 0xa, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 
+	0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x50, 
+	0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 
+	0x57, 0x33, 0x43, 0x2f, 0x2f, 0x44, 0x54, 0x44, 0x20, 0x58, 
+	0x48, 0x54, 0x4d, 0x4c, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x46, 
+	0x72, 0x61, 0x6d, 0x65, 0x73, 0x65, 0x74, 0x2f, 0x2f, 0x45, 
+	0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 
+	0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 
+	0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 
+	0x31, 0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 0x68, 0x74, 0x6d, 
+	0x6c, 0x31, 0x2d, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x65, 
+	0x74, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 0xd, 0xa, 0x3c, 
+	0x68, 0x74, 0x6d, 0x6c, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 
+	0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 
+	0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 
+	0x31, 0x39, 0x39, 0x39, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 
+	0x22, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 
+	0xd, 0xa, 0x9, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x68, 
+	0x74, 0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d, 
+	0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 
+	0x79, 0x70, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 
+	0x6e, 0x74, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
+	0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 
+	0x65, 0x74, 0x3d, 0x67, 0x62, 0x32, 0x33, 0x31, 0x32, 0x22, 
+	0x20, 0x2f, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x74, 0x69, 0x74, 
+	0x6c, 0x65, 0x3e, 0x77, 0x65, 0x6c, 0x63, 0x6f, 0x6d, 0x65, 
+	0x21, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0xd, 
+	0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xd, 0xa, 
+	0x3c, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x65, 0x74, 0x20, 
+	0x72, 0x6f, 0x77, 0x73, 0x3d, 0x22, 0x2a, 0x22, 0x3e, 0xd, 
+	0xa, 0x20, 0x20, 0x3c, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x20, 
+	0x73, 0x72, 0x63, 0x3d, 0x22, 0x62, 0x61, 0x73, 0x69, 0x63, 
+	0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x20, 0x2f, 0x3e, 0xd, 
+	0xa, 0x3c, 0x2f, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x65, 
+	0x74, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 
+	0x3e, 0xd, 0xa, };
+
+static const unsigned char data_index_html_gz[] = {
+	/* /index.html */
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
 	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
 	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
 	0x31, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x28, 0x68, 0x74, 0x74, 
@@ -628,47 +696,49 @@ static const unsigned char data_index_html[] = {
 	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
 	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
 	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
-	0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, 0x3c, 0x21, 0x44, 
-	0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 
-	0x6c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 
-	0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f, 0x2f, 0x44, 0x54, 
-	0x44, 0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x31, 0x2e, 
-	0x30, 0x20, 0x46, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x65, 0x74, 
-	0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 
-	0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 
-	0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 
-	0x74, 0x6d, 0x6c, 0x31, 0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 
-	0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2d, 0x66, 0x72, 0x61, 0x6d, 
-	0x65, 0x73, 0x65, 0x74, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 
-	0xd, 0xa, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x78, 0x6d, 
-	0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 
-	0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 
-	0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x78, 0x68, 
-	0x74, 0x6d, 0x6c, 0x22, 0x3e, 0xd, 0xa, 0x3c, 0x68, 0x65, 
-	0x61, 0x64, 0x3e, 0xd, 0xa, 0x9, 0x3c, 0x6d, 0x65, 0x74, 
-	0x61, 0x20, 0x68, 0x74, 0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 
-	0x69, 0x76, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 
-	0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x20, 0x63, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x74, 0x65, 0x78, 
-	0x74, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 
-	0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x67, 0x62, 0x32, 0x33, 
-	0x31, 0x32, 0x22, 0x20, 0x2f, 0x3e, 0xd, 0xa, 0x9, 0x3c, 
-	0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x77, 0x65, 0x6c, 0x63, 
-	0x6f, 0x6d, 0x65, 0x21, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 
-	0x65, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 
-	0x3e, 0xd, 0xa, 0x3c, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 
-	0x65, 0x74, 0x20, 0x72, 0x6f, 0x77, 0x73, 0x3d, 0x22, 0x2a, 
-	0x22, 0x3e, 0xd, 0xa, 0x20, 0x20, 0x3c, 0x66, 0x72, 0x61, 
-	0x6d, 0x65, 0x20, 0x73, 0x72, 0x63, 0x3d, 0x22, 0x62, 0x61, 
-	0x73, 0x69, 0x63, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x20, 
-	0x2f, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x66, 0x72, 0x61, 0x6d, 
-	0x65, 0x73, 0x65, 0x74, 0x3e, 0xd, 0xa, 0x3c, 0x2f, 0x68, 
-	0x74, 0x6d, 0x6c, 0x3e, 0xd, 0xa, };
+	0x74, 0x6d, 0x6c, 0xd, 0xa, 0x45, 0x54, 0x61, 0x67, 0x3a, 
+	0x20, 0x22, 0x32, 0x30, 0x34, 0x35, 0x33, 0x65, 0x39, 0x39, 
+	0x2d, 0x67, 0x7a, 0x22, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 
+	0x65, 0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 
+	0x20, 0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0xd, 
+	0xa, 0x56, 0x61, 0x72, 0x79, 0x3a, 0x20, 0x41, 0x63, 0x63, 
+	0x65, 0x70, 0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 
+	0x6e, 0x67, 0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 
+	0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 
+	0x3a, 0x20, 0x67, 0x7a, 0x69, 0x70, 0xd, 0xa, 0x43, 0x6f, 
+	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 0x65, 0x6e, 0x67, 
+	0x74, 0x68, 0x3a, 0x20, 0x32, 0x35, 0x32, 0xd, 0xa, 0xd, 
+	0xa, 0x1f, 0x8b, 0x8, 00, 00, 00, 00, 00, 0x2, 
+	0x3, 0x6d, 0x8e, 0x4b, 0x4f, 0x83, 0x40, 0x14, 0x85, 0xd7, 
+	0x9a, 0xf8, 0x1f, 0x6e, 0x67, 0x69, 0x2, 0x57, 0xca, 0xa, 
+	0x3b, 0xd3, 0x85, 0x50, 0xa3, 0x49, 0xd5, 0xc6, 0x60, 0xaa, 
+	0x4b, 0xa, 0xd7, 0x42, 0xc2, 0xa3, 0xe, 0x57, 0x7, 0xff, 
+	0xbd, 0x3, 0x43, 0x77, 0xae, 0xee, 0xf3, 0x7c, 0xe7, 0xc8, 
+	0x45, 0xf2, 0x12, 0xa7, 0x1f, 0xbb, 0xd, 0x94, 0xdc, 0xd4, 
+	0xb0, 0x7b, 0xbb, 0xdb, 0x3e, 0xc6, 0x20, 0x3c, 0xc4, 0x7d, 
+	0x18, 0x23, 0x26, 0x69, 0x2, 0xef, 0xf, 0xe9, 0xd3, 0x16, 
+	0x2, 0xff, 0x6, 0xee, 0x75, 0xd6, 0x50, 0x4f, 0x8c, 0xb8, 
+	0x79, 0x16, 0x20, 0x4a, 0xe6, 0xd3, 0x2d, 0xa2, 0x31, 0xc6, 
+	0x37, 0xa1, 0xdf, 0xe9, 0x23, 0xa6, 0xaf, 0x38, 0x8c, 0x9c, 
+	0x60, 0x14, 0xce, 0xad, 0xf7, 0x39, 0xab, 0xfc, 0x82, 0xb, 
+	0xb1, 0xbe, 0xba, 0x94, 0x93, 0xd3, 0xd0, 0xd4, 0x6d, 0xaf, 
+	0xfe, 0x61, 0x4, 0x51, 0x14, 0x39, 0xa9, 0x7b, 0xa6, 0xac, 
+	0xb0, 0xf5, 0x42, 0x36, 0xc4, 0x19, 0x8c, 0xef, 0x1e, 0x7d, 
+	0x7d, 0x57, 0x3f, 0x4a, 0xc4, 0x5d, 0xcb, 0xd4, 0xb2, 0x97, 
+	0xfe, 0x9e, 0x48, 0x40, 0xee, 0x26, 0x25, 0x98, 0x6, 0xc6, 
+	0x51, 0xbe, 0x82, 0xbc, 0xcc, 0xb4, 0x35, 0x56, 0xc7, 0xc3, 
+	0x32, 0xc, 0x96, 0x2, 0x70, 0x2, 0x71, 0xc5, 0x35, 0xad, 
+	0xd, 0xd5, 0x79, 0xd7, 0xd0, 0x42, 0xa2, 0x9b, 0xad, 0x15, 
+	0xce, 0x5e, 0xf2, 0x9c, 0x18, 0x74, 0x67, 0x6c, 0xc6, 0xeb, 
+	0x31, 0x8, 0x80, 0x5b, 0x43, 0xaf, 0x73, 0x25, 0xe, 0x59, 
+	0x5f, 0xe5, 0xfe, 0x14, 0x72, 0xa2, 0x4a, 0x3c, 0x6b, 0x1c, 
+	0xc8, 0x1e, 0x6c, 0xf3, 0x7, 0xfe, 0x12, 0xa9, 0xf1, 0x5d, 
+	0x1, 00, 00, };
 
 static const unsigned char data_jump_html[] = {
 	/* /jump.html */
 	0x2f, 0x6a, 0x75, 0x6d, 0x70, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
 	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
 	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
 	0x31, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x28, 0x68, 0x74, 0x74, 
@@ -677,12 +747,18 @@ static const unsigned char data_jump_html[] = {
 	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
 	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
 	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 
-	0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, };
+	0x74, 0x6d, 0x6c, 0xd, 0xa, 0x45, 0x54, 0x61, 0x67, 0x3a, 
+	0x20, 0x22, 0x38, 0x31, 0x31, 0x63, 0x39, 0x64, 0x63, 0x35, 
+	0x22, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2d, 0x43, 
+	0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 0x6e, 0x6f, 
+	0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0xd, 0xa, 0x43, 0x6f, 
+	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 0x65, 0x6e, 0x67, 
+	0x74, 0x68, 0x3a, 0x20, 0x30, 0xd, 0xa, 0xd, 0xa, };
 
 static const unsigned char data_style_css[] = {
 	/* /style.css */
 	0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
 	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
 	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
 	0x31, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x28, 0x68, 0x74, 0x74, 
@@ -691,40 +767,92 @@ static const unsigned char data_style_css[] = {
 	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
 	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
 	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 
-	0x73, 0x73, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 
+	0x73, 0x73, 0xd, 0xa, 0x45, 0x54, 0x61, 0x67, 0x3a, 0x20, 
+	0x22, 0x38, 0x34, 0x37, 0x30, 0x64, 0x66, 0x30, 0x64, 0x22, 
+	0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2d, 0x43, 0x6f, 
+	0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 0x6d, 0x61, 0x78, 
+	0x2d, 0x61, 0x67, 0x65, 0x3d, 0x33, 0x36, 0x30, 0x30, 0xd, 
+	0xa, 0x56, 0x61, 0x72, 0x79, 0x3a, 0x20, 0x41, 0x63, 0x63, 
+	0x65, 0x70, 0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 
+	0x6e, 0x67, 0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 
+	0x74, 0x2d, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 
+	0x33, 0x33, 0x31, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x2f, 0x2a, 0x20, 
-	0x48, 0x54, 0x4d, 0x4c, 0x20, 0x74, 0x61, 0x67, 0x20, 0x73, 
-	0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x2f, 0x2a, 
+	0x20, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x74, 0x61, 0x67, 0x20, 
+	0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0xd, 0xa, 0x2f, 0x2a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0xd, 0xa, 0x2f, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 0x62, 
-	0x6f, 0x64, 0x79, 0x7b, 0xd, 0xa, 0x9, 0x66, 0x6f, 0x6e, 
-	0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 
-	0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 0x61, 0x6e, 0x73, 
-	0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0xd, 0xa, 0x9, 
-	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 0x33, 
-	0x33, 0x33, 0x33, 0x33, 0x3b, 0xd, 0xa, 0x9, 0x6c, 0x69, 
-	0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 
-	0x20, 0x31, 0x2e, 0x31, 0x36, 0x36, 0x3b, 0xd, 0xa, 0x9, 
-	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
-	0x3a, 0x20, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3b, 
-	0xd, 0xa, 0x9, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3a, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 
-	0xd, 0xa, 0x7d, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, 
+	0x62, 0x6f, 0x64, 0x79, 0x7b, 0xd, 0xa, 0x9, 0x66, 0x6f, 
+	0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 
+	0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 0x61, 0x6e, 
+	0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0xd, 0xa, 
+	0x9, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x3b, 0xd, 0xa, 0x9, 0x6c, 
+	0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+	0x3a, 0x20, 0x31, 0x2e, 0x31, 0x36, 0x36, 0x3b, 0xd, 0xa, 
+	0x9, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
+	0x64, 0x3a, 0x20, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 
+	0x3b, 0xd, 0xa, 0x9, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 
+	0x6f, 0x6e, 0x3a, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 
+	0x65, 0xd, 0xa, 0x7d, 0xd, 0xa, 0x2f, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x65, 0x6e, 
-	0x64, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x65, 
+	0x6e, 0x64, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
 	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, };
+	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0xd, 0xa, };
+
+static const unsigned char data_style_css_gz[] = {
+	/* /style.css */
+	0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x31, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x28, 0x68, 0x74, 0x74, 
+	0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x73, 0x69, 
+	0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 0x64, 0x61, 
+	0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 0xd, 0xa, 
+	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 
+	0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 
+	0x73, 0x73, 0xd, 0xa, 0x45, 0x54, 0x61, 0x67, 0x3a, 0x20, 
+	0x22, 0x38, 0x34, 0x37, 0x30, 0x64, 0x66, 0x30, 0x64, 0x2d, 
+	0x67, 0x7a, 0x22, 0xd, 0xa, 0x43, 0x61, 0x63, 0x68, 0x65, 
+	0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 
+	0x6d, 0x61, 0x78, 0x2d, 0x61, 0x67, 0x65, 0x3d, 0x33, 0x36, 
+	0x30, 0x30, 0xd, 0xa, 0x56, 0x61, 0x72, 0x79, 0x3a, 0x20, 
+	0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x2d, 0x45, 0x6e, 0x63, 
+	0x6f, 0x64, 0x69, 0x6e, 0x67, 0xd, 0xa, 0x43, 0x6f, 0x6e, 
+	0x74, 0x65, 0x6e, 0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 
+	0x69, 0x6e, 0x67, 0x3a, 0x20, 0x67, 0x7a, 0x69, 0x70, 0xd, 
+	0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x36, 0x37, 
+	0xd, 0xa, 0xd, 0xa, 0x1f, 0x8b, 0x8, 00, 00, 00, 
+	00, 00, 0x2, 0x3, 0x95, 0x8e, 0xb1, 0xa, 0xc2, 0x30, 
+	0x14, 0x45, 0x67, 0xb, 0xf9, 0x87, 0x7, 0x6e, 0xc5, 0x5a, 
+	0x8a, 0xd0, 0x21, 0x4e, 0x6e, 0xe, 0xba, 0xf9, 0x3, 0x69, 
+	0xfb, 0x92, 0x3e, 0x4c, 0xf3, 0x24, 0x89, 0x42, 0x10, 0xff, 
+	0xdd, 0xb6, 0xce, 0x15, 0x7a, 0xc6, 0xc3, 0xbd, 0xdc, 0x5b, 
+	0xe6, 0xeb, 0x28, 0x45, 0x56, 0xe6, 0x70, 0xbe, 0x5d, 0x2f, 
+	0x10, 0x95, 0x81, 0x10, 0x93, 0xc5, 00, 0xff, 0xf8, 0x55, 
+	0x56, 0xaf, 0x34, 0xdc, 0xa5, 0xb7, 0xc8, 0x36, 0x9a, 0x5d, 
+	0x2c, 0xb4, 0x1a, 0xc8, 0x26, 0x9, 0x27, 0x4f, 0xca, 0xee, 
+	0x82, 0x72, 0xa1, 0x8, 0xe8, 0x49, 0x1f, 0xc7, 0x40, 0xcb, 
+	0x96, 0xbd, 0x84, 0xed, 0x61, 0x66, 0x32, 0x96, 0x1c, 0x16, 
+	0x3d, 0x92, 0xe9, 0xa3, 0x84, 0x6a, 0x5f, 0xd5, 0xf5, 0x64, 
+	0x1b, 0xd5, 0xde, 0x8d, 0xe7, 0xa7, 0xeb, 0xc6, 0x70, 0x3b, 
+	0x33, 0xe9, 0x7, 0x7, 0x8a, 0xc4, 0x4e, 0x7a, 0xb4, 0x2a, 
+	0xd2, 0xb, 0x45, 0xf6, 0x59, 0x3a, 0xc, 0xe8, 0x3a, 0x58, 
+	0x7c, 0xfc, 0x5, 0x16, 0xab, 0x14, 0x81, 0x4b, 0x1, 00, 
+	00, };
 
 const struct fsdata_file file_404_html[] = {{NULL, data_404_html, data_404_html + 10, sizeof(data_404_html) - 10}};
 
@@ -734,10 +862,25 @@ const struct fsdata_file file_firmware_html[] = {{file_basic_html, data_firmware
 
 const struct fsdata_file file_index_html[] = {{file_firmware_html, data_index_html, data_index_html + 12, sizeof(data_index_html) - 12}};
 
+const struct fsdata_file file_index_html_gz[] = {{NULL, data_index_html_gz, data_index_html_gz + 12, sizeof(data_index_html_gz) - 12}};
+
 const struct fsdata_file file_jump_html[] = {{file_index_html, data_jump_html, data_jump_html + 11, sizeof(data_jump_html) - 11}};
 
 const struct fsdata_file file_style_css[] = {{file_jump_html, data_style_css, data_style_css + 11, sizeof(data_style_css) - 11}};
 
+const struct fsdata_file file_style_css_gz[] = {{NULL, data_style_css_gz, data_style_css_gz + 11, sizeof(data_style_css_gz) - 11}};
+
 #define FS_ROOT file_style_css
 
 #define FS_NUMFILES 6
+
+static const struct fsdata_index fs_index[FS_NUMFILES] = {
+	{file_jump_html, NULL, 0x1768d7cd, 10, FS_FLAG_LENGTH, 0x811c9dc5},
+	{file_style_css, file_style_css_gz, 0x29d360da, 10, FS_FLAG_LENGTH | FS_FLAG_GZIP, 0x8470df0d},
+	{file_basic_html, NULL, 0x4286b0db, 11, FS_FLAG_PARSE, 0x00000000},
+	{file_index_html, file_index_html_gz, 0x457c5a71, 11, FS_FLAG_LENGTH | FS_FLAG_GZIP, 0x20453e99},
+	{file_firmware_html, NULL, 0x830000fe, 14, FS_FLAG_PARSE, 0x00000000},
+	{file_404_html, NULL, 0xbdd71e79, 9, FS_FLAG_LENGTH, 0x00000000},
+};
+
+#define FS_INDEX fs_index
@@ -66,6 +66,7 @@
  *
  */
 #include <assert.h>
+#include <ctype.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -185,9 +186,16 @@ struct http_state {
  struct http_recive http_recive_request;
   struct pbuf *RecvPbuf;
   int RecvOffset;
-//  struct tcp_pcb *pcb;
+  struct tcp_pcb *pcb;
+  u8 keepalive;     /* Keep the connection open after this response */
+  u8 idle;          /* http_poll rounds without a request in progress */
+  u8 parsing;       /* Inside http_process_requests */
+  u16 requests;     /* Requests served on this connection */
 };
 
+/* Connections currently open, bounded by HTTPD_MAX_CONNS. */
+static struct http_state *http_conns[HTTPD_MAX_CONNS];
+
 #ifdef INCLUDE_HTTPD_SSI
 /* SSI insert handler function pointer. */
 tSSIHandler g_pfnSSIHandler = NULL;
@@ -219,6 +227,42 @@ int g_iNumCGIs = 0;
     "\r\n"
 };
 
+/*-----------------------------------------------------------------------------------*/
+static void
+http_conn_remove(struct http_state *hs)
+{
+  int i;
+
+  for(i = 0; i < HTTPD_MAX_CONNS; i++) {
+    if(http_conns[i] == hs) {
+      http_conns[i] = NULL;
+      break;
+    }
+  }
+}
+
+static void
+http_state_free(struct http_state *hs)
+{
+  http_conn_remove(hs);
+  if(hs->handle) {
+    fs_close(hs->handle);
+    hs->handle = NULL;
+  }
+  if(hs->buf)
+  {
+    mem_free(hs->buf);
+  }
+  if(hs->http_recive_request.Httpd_recive_buf)
+  {
+    mem_free(hs->http_recive_request.Httpd_recive_buf);
+  }
+  if(hs->RecvPbuf)
+  {
+    pbuf_free(hs->RecvPbuf);
+  }
+  mem_free(hs);
+}
 /*-----------------------------------------------------------------------------------*/
 static void
 conn_err(void *arg, err_t err)
@@ -241,15 +285,7 @@ conn_err(void *arg, err_t err)
 		  tcp_close(hs->pcb);
 	  }
 #endif	  
-      if(hs->handle) {
-        fs_close(hs->handle);
-        hs->handle = NULL;
-      }
-      if(hs->buf)
-      {
-          mem_free(hs->buf);
-      }
-      mem_free(hs);
+      http_state_free(hs);
   }
 }
 /*-----------------------------------------------------------------------------------*/
@@ -264,15 +300,7 @@ close_conn(struct tcp_pcb *pcb, struct http_state *hs)
 	  tcp_err(pcb, NULL);
 	  tcp_poll(pcb,NULL,4);
   }
-  if(hs->handle) {
-    fs_close(hs->handle);
-    hs->handle = NULL;
-  }
-  if(hs->buf)
-  {
-    mem_free(hs->buf);
-  }
-  mem_free(hs);
+  http_state_free(hs);
   if (pcb)
   	tcp_close(pcb);
 #if TLS_CONFIG_WEB_SERVER_MODE
@@ -367,8 +395,155 @@ get_tag_insert(struct http_state *hs)
 }
 #endif /* INCLUDE_HTTPD_SSI */
 
+/*-----------------------------------------------------------------------------------*/
+static int
+http_strnicmp(const char *s1, const char *s2, int len)
+{
+  for(; len > 0; len--, s1++, s2++) {
+    if(tolower((unsigned char)*s1) != tolower((unsigned char)*s2)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* Returns the value of request header name (e.g. "Accept-Encoding:"), or
+ * NULL. The value runs up to the next "\r\n".
+ */
+static char *
+http_find_header(char *req, const char *name)
+{
+  int len = strlen(name);
+  char *line = strstr(req, "\r\n");
+
+  while(line && (line[2] != '\r') && (line[2] != '\0')) {
+    line += 2;
+    if(http_strnicmp(line, name, len) == 0) {
+      line += len;
+      while(*line == ' ') {
+        line++;
+      }
+      return line;
+    }
+    line = strstr(line, "\r\n");
+  }
+  return NULL;
+}
+
+/* TRUE if the ";q=" parameter starting at params is zero, e.g. "q=0.000". */
+static u8
+http_qvalue_zero(const char *params)
+{
+  while(*params == ';' || *params == ' ' || *params == '\t') {
+    params++;
+    while(*params == ' ' || *params == '\t') {
+      params++;
+    }
+    if(((*params == 'q') || (*params == 'Q')) && (params[1] == '=')) {
+      params += 2;
+      if(*params++ != '0') {
+        return FALSE;
+      }
+      if(*params == '.') {
+        params++;
+      }
+      while(*params == '0') {
+        params++;
+      }
+      return (*params < '1') || (*params > '9');
+    }
+    while(*params && (*params != '\r') && (*params != ',') && (*params != ';')) {
+      params++;
+    }
+  }
+  return FALSE;
+}
+
+/* TRUE if token is one of the comma separated elements of the header value
+ * returned by http_find_header, compared in any case. An element refused
+ * with "q=0" (as in "gzip;q=0") does not count. Weak entity tags match
+ * their strong form.
+ */
+static u8
+http_header_has(const char *value, const char *token)
+{
+  int len = strlen(token);
+  const char *end;
+
+  if(value == NULL) {
+    return FALSE;
+  }
+  while(*value && (*value != '\r')) {
+    while((*value == ' ') || (*value == '\t') || (*value == ',')) {
+      value++;
+    }
+    if((token[0] == '"') && (http_strnicmp(value, "W/", 2) == 0)) {
+      value += 2;
+    }
+    if(http_strnicmp(value, token, len) == 0) {
+      end = value + len;
+      while((*end == ' ') || (*end == '\t')) {
+        end++;
+      }
+      if((*end == '\0') || (*end == '\r') || (*end == ',')) {
+        return TRUE;
+      }
+      if(*end == ';') {
+        return !http_qvalue_zero(end);
+      }
+    }
+    while(*value && (*value != '\r') && (*value != ',')) {
+      value++;
+    }
+  }
+  return FALSE;
+}
+
+/* HTTP/1.1 connections are persistent unless the client says otherwise.
+ * HTTP/1.0 ones are always closed, our stored headers do not carry
+ * "Connection: keep-alive".
+ */
+static u8
+http_keepalive_requested(char *req)
+{
+  char *line_end = strstr(req, "\r\n");
+
+  if((line_end == NULL) || (line_end - req <= 8) ||
+     (strncmp(line_end - 8, "HTTP/1.1", 8) != 0)) {
+    return FALSE;
+  }
+  return !http_header_has(http_find_header(req, "Connection:"), "close");
+}
+
+/* Entity tag of the file as makefs wrote it in the stored header; the gzip
+ * variant is a different representation and carries its own tag.
+ */
+static void
+http_etag(struct fs_file *file, char *etag)
+{
+  sprintf(etag, (file->flags & FS_FLAG_GZIP) ? "\"%08x-gz\"" : "\"%08x\"", file->etag);
+}
+
+/* Conditional GET: the browser already holds this version of the file. */
+static u8
+http_not_modified(struct fs_file *file, const char *if_none_match)
+{
+  char etag[16];
+
+  if((file->etag == 0) || (if_none_match == NULL)) {
+    return FALSE;
+  }
+  if(*if_none_match == '*') {
+    return TRUE;
+  }
+  http_etag(file, etag);
+  return http_header_has(if_none_match, etag);
+}
+
 extern int fs_read_line(const void *data, char  *buffer, int  max_length,int * tembuflen);
 void send_data_to_sys(struct http_state *hs);
+static void http_request_done(struct tcp_pcb *pcb, struct http_state *hs);
+static void http_process_requests(struct tcp_pcb *pcb, struct http_state *hs);
 void send_jump_html(struct http_state *hs,struct tcp_pcb *pcb);
 void send_error_html(struct http_state *hs,struct tcp_pcb *pcb, int error);
 
@@ -392,6 +567,19 @@ send_data(struct tcp_pcb *pcb, struct http_state *hs)
   {
     int count;
 
+#ifdef INCLUDE_HTTPD_SSI
+    if(!hs->tag_check)
+#endif
+    {
+      /* Static files live in flash and were handed to tcp_write in place,
+       * so there is nothing left to read: the request is done. Only SSI
+       * output needs a per-connection read buffer.
+       */
+      DEBUG_PRINT("End of file here.\n\r");
+      http_request_done(pcb, hs);
+      return;
+    }
+
     /* Do we already have a send buffer allocated? */
     if(hs->buf) {
       /* Yes - get the length of the buffer */
@@ -517,8 +705,16 @@ if(Temp)
  }
 	  else
 	  {
+		  /* Not filtered: reference the fsdata bytes directly (no copy),
+		   * they stay valid in flash until the segment is acked. */
 		  filelen = len;
-		  err = tcp_write(pcb, hs->file, filelen, 0);
+		  do {
+		    err = tcp_write(pcb, hs->file, filelen,
+		                    (hs->left > filelen) ? TCP_WRITE_FLAG_MORE : 0);
+		    if (err == ERR_MEM) {
+		      filelen /= 2;
+		    }
+		  } while (err == ERR_MEM && filelen > 1);
 	  }
 
       if (err == ERR_OK) {
@@ -901,6 +1097,14 @@ http_poll(void *arg, struct tcp_pcb *pcb)
     return ERR_ABRT;
 } else {
     if (hs->recv_state == 0){
+	    if (hs->handle == NULL) {
+	      /* Waiting for the (next) request on this connection */
+	      if (++hs->idle >= HTTPD_IDLE_POLLS) {
+	        DEBUG_PRINT("idle, close\n\r");
+	        close_conn(pcb, hs);
+	      }
+	      return ERR_OK;
+	    }
 	    ++hs->retries;
 	    if (hs->retries >= 10) {
 	      tcp_abort(pcb);
@@ -1015,6 +1219,26 @@ static void decodeBase64(char *Data)
 	*Data = 0;
 }
 #endif
+static void send_not_modified(struct http_state *hs,struct tcp_pcb *pcb)
+{
+    char head[64];
+    char etag[16];
+    int len;
+
+    http_etag(hs->handle, etag);
+    len = sprintf(head, "HTTP/1.1 304 Not Modified\r\n"
+                        "ETag: %s\r\n"
+                        "\r\n", etag);
+    tcp_write(pcb, head, len, TCP_WRITE_FLAG_COPY);
+
+    /* Nothing else to send: once this is acked http_request_done() closes
+     * the connection or, if it is persistent, waits for the next request. */
+    hs->left = 0;
+    hs->retries = 0;
+    tcp_sent(pcb, http_sent);
+    tcp_output(pcb);
+}
+
 void send_jump_html(struct http_state *hs,struct tcp_pcb *pcb)
 {
    struct fs_file *file;
@@ -1067,6 +1291,7 @@ static void resethandler()
     }
 }
 
+ /* Returns 1 when the connection has been closed (hs is freed), 0 otherwise. */
  u8   extract_html_recive(char * html_data,  struct http_state *hs,struct tcp_pcb *pcb)
  {
    int i;
@@ -1084,6 +1309,9 @@ static void resethandler()
 #endif
   u8 NeedRestart=0;
     u8 mode;
+  u8 accept_gzip;
+  u8 keepalive;
+  char *if_none_match;
 
 	
 	if (strncmp(html_data, "GET ", 4) == 0) 
@@ -1098,7 +1326,7 @@ static void resethandler()
 		 tcp_sent(pcb, http_sent);
 	        tcp_output(pcb);	 
 		 close_conn(pcb, hs);	   
-		return 0;
+		return 1;
 	    }
 	    else
 	    {
@@ -1116,7 +1344,7 @@ static void resethandler()
 		 	tcp_sent(pcb, http_sent);
 	        	tcp_output(pcb);		
 		       close_conn(pcb, hs);	   
-			return 0;
+			return 1;
 		}	
 	    }
 #endif		
@@ -1129,6 +1357,10 @@ static void resethandler()
          * assume the request is invalid and close the connection.
          */	
 //        DEBUG_PRINT("Request:\n%s\n", Url); 
+        accept_gzip = http_header_has(http_find_header(html_data, "Accept-Encoding:"), "gzip");
+        if_none_match = http_find_header(html_data, "If-None-Match:");
+        keepalive = http_keepalive_requested(html_data);
+
         Url=&html_data[4];
         for(i = 0; i <= (strlen(html_data)-4 - 5); i++) 
 	 {
@@ -1146,6 +1378,7 @@ static void resethandler()
           /* We failed to find " HTTP" in the request so assume it is invalid */
           DEBUG_PRINT("Invalid GET request. Closing.\n\r");
           close_conn(pcb, hs);
+          return 1;
         }          
         
 #ifdef INCLUDE_HTTPD_SSI
@@ -1179,7 +1412,10 @@ static void resethandler()
 #else
           tls_param_get(TLS_PARAM_ID_WPROTOCOL, (void* )&mode, FALSE);
           loop= (mode == IEEE80211_MODE_AP) ? 1 : 0;
-          file = fs_open((char *)g_psDefaultFilenames[loop].name);
+          if (accept_gzip)
+              file = fs_open_gzip((char *)g_psDefaultFilenames[loop].name);
+          else
+              file = fs_open((char *)g_psDefaultFilenames[loop].name);
 		DEBUG_PRINT("open file : %s\r\n", (char *)g_psDefaultFilenames[loop].name);
 #endif
 
@@ -1224,11 +1460,10 @@ static void resethandler()
 #endif
 	  DEBUG_PRINT("Opening %s\n\r", Url);
 
-         	 file = fs_open(Url);
-		  //if (strstr(Url, "hed"))
-		  {
-			hs->file_flag |= FILEFLAG_FILTER;
-		  }	 			 
+         	 if (accept_gzip)
+         	     file = fs_open_gzip(Url);
+         	 else
+         	     file = fs_open(Url);
           if(file == NULL) {
             if (tls_wifi_get_oneshot_flag()) {
                 file = fs_open("/index.html");
@@ -1265,6 +1500,35 @@ static void resethandler()
         hs->handle = file;
         hs->file = file->data;
 
+        /* Only pages with id="..." fields (flagged by makefs) go through the
+         * Web_parse_line filter, everything else is sent straight from fsdata.
+         */
+        if (file->flags & FS_FLAG_PARSE)
+        {
+          hs->file_flag |= FILEFLAG_FILTER;
+        }
+        else
+        {
+          hs->file_flag &= ~FILEFLAG_FILTER;
+        }
+
+        /* Only responses that carry their length can be followed by another
+         * one on the same connection; each connection gets a bounded number
+         * of requests so that one client cannot hold a slot forever.
+         */
+        hs->keepalive = keepalive && (hs->requests < HTTPD_KEEPALIVE_MAX_REQ);
+        hs->requests++;
+
+        if (http_not_modified(file, if_none_match))
+        {
+          DEBUG_PRINT("Not modified %s\n\r", Url);
+          send_not_modified(hs, pcb);
+          return 0;
+        }
+        if (!(file->flags & FS_FLAG_LENGTH))
+        {
+          hs->keepalive = FALSE;
+        }
 
         LWIP_ASSERT("File length must be positive!", (file->len >= 0));
         hs->left = file->len;
@@ -1448,27 +1712,153 @@ void send_error_html(struct http_state *hs,struct tcp_pcb *pcb, int error)
 	 close_conn(pcb, hs);	   
 }
 
+/*-----------------------------------------------------------------------------------*/
+/* Append a received pbuf to the request buffer, which is kept NUL terminated
+ * so that the header parsing below can use the string functions.
+ */
+static err_t
+http_recv_append(struct http_state *hs, struct pbuf *p)
+{
+	struct http_recive *rq = &hs->http_recive_request;
+	char *buf;
+
+	buf = mem_malloc(rq->charlen + p->tot_len + 1);
+	if (buf == NULL)
+	{
+		DEBUG_PRINT("Httpd Recive Buf Error pbuf:%x\n\r", p);
+		return ERR_MEM;
+	}
+	if (rq->Httpd_recive_buf)
+	{
+		memcpy(buf, rq->Httpd_recive_buf, rq->charlen);
+		mem_free(rq->Httpd_recive_buf);
+	}
+	pbuf_copy_partial(p, buf + rq->charlen, p->tot_len, 0);
+	rq->Httpd_recive_buf = buf;
+	rq->charlen += p->tot_len;
+	rq->Httpd_recive_buf[rq->charlen] = '\0';
+	rq->Valid = 1;
+	return ERR_OK;
+}
+
+/* Drop the first len bytes (one processed request) from the request buffer. */
+static void
+http_recv_consume(struct http_state *hs, int len)
+{
+	struct http_recive *rq = &hs->http_recive_request;
+
+	rq->charlen -= len;
+	if (rq->charlen <= 0)
+	{
+		mem_free(rq->Httpd_recive_buf);
+		rq->Httpd_recive_buf = NULL;
+		rq->charlen = 0;
+		rq->Valid = 0;
+		return;
+	}
+	memmove(rq->Httpd_recive_buf, rq->Httpd_recive_buf + len, rq->charlen + 1);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/* Handle the complete requests sitting in the request buffer, one at a time:
+ * a pipelined request is only parsed once the response to the previous one
+ * has been queued (hs->handle back to NULL).
+ */
+static void
+http_process_requests(struct tcp_pcb *pcb, struct http_state *hs)
+{
+	struct http_recive *rq = &hs->http_recive_request;
+	char *end;
+	int len;
+
+	hs->parsing = 1;
+	while ((hs->handle == NULL) && rq->Valid && (hs->recv_state != 2))
+	{
+		end = strstr(rq->Httpd_recive_buf, "\r\n\r\n");
+		if (end == NULL)
+		{
+			/* wait for the rest of the header */
+			break;
+		}
+		len = (int)(end + 4 - rq->Httpd_recive_buf);
+		if (extract_html_recive(rq->Httpd_recive_buf, hs, pcb))
+		{
+			/* the connection has been closed, hs is gone */
+			return;
+		}
+		if (hs->recv_state == 1)
+		{
+			hs->recv_content_len -= len;
+		}
+		http_recv_consume(hs, len);
+	}
+
+	if (rq->Valid && (hs->recv_state == 2))
+	{
+		/* The rest is upload payload */
+		len = rq->charlen;
+		hs->RecvPbuf = pbuf_alloc(PBUF_TRANSPORT, len, PBUF_RAM);
+		if (hs->RecvPbuf == NULL)
+		{
+			DEBUG_PRINT("http_recv recvpBuf\r\n");
+			hs->parsing = 0;
+			return;
+		}
+		pbuf_take(hs->RecvPbuf, rq->Httpd_recive_buf, len);
+		hs->RecvOffset = 0;
+		http_recv_consume(hs, len);
+		hs->recv_content_len -= len;
+	}
+	hs->parsing = 0;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/* The response has been queued completely: close the connection or, when it
+ * is persistent, get ready for the next (maybe already buffered) request.
+ */
+static void
+http_request_done(struct tcp_pcb *pcb, struct http_state *hs)
+{
+	if (!hs->keepalive)
+	{
+		close_conn(pcb, hs);
+		return;
+	}
+
+	if (hs->handle)
+	{
+		fs_close(hs->handle);
+		hs->handle = NULL;
+	}
+	hs->file_flag = 0;
+	hs->left = 0;
+	hs->keepalive = FALSE;
+	hs->retries = 0;
+	hs->idle = 0;
+
+	if (!hs->parsing)
+	{
+		http_process_requests(pcb, hs);
+	}
+}
+
 /*-----------------------------------------------------------------------------------*/
 static err_t
 http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
 {
     struct http_state *hs;
-    char * temprecive=NULL;
-    char * HtmlBegin=NULL, *HtmlEnd=NULL;
-    int HtmlLen;		
 
 //  DEBUG_PRINT("http_recv 0x%08x\n", pcb);
 
- // memset(Url, 0, HTTP_MAX_REQUEST_LEN);
   hs = arg;
 
   if (err == ERR_OK && p != NULL) {
 
-    /* Inform TCP that we have taken the data. */
-    tcp_recved(pcb, p->tot_len);
-
     if (hs->recv_state == 2){
 
+	/* Inform TCP that we have taken the data. */
+	tcp_recved(pcb, p->tot_len);
+
 	hs->recv_content_len -= p->tot_len;
 
 	if (hs->RecvPbuf == NULL){
@@ -1484,109 +1874,29 @@ http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
 	   return ERR_OK;
     }
 
-    if (hs->handle == NULL) {
-//      data = p->payload;
-		if (hs->http_recive_request.Valid){
-			temprecive = mem_malloc(hs->http_recive_request.charlen);
-			if (NULL == temprecive){
-				if (hs->http_recive_request.Httpd_recive_buf){
-					mem_free(hs->http_recive_request.Httpd_recive_buf);
-					hs->http_recive_request.Httpd_recive_buf = NULL;
-				}
-				hs->http_recive_request.charlen=0;
-				hs->http_recive_request.Valid=0;
-				hs->http_recive_request.PreBuf=NULL;
-				DEBUG_PRINT("http_recv 00pbuf:0x%x\r\n", (u32)p);
-				pbuf_free(p);
-		    	close_conn(pcb, hs);
-		  		return ERR_OK;	
-			}
-			if (hs->http_recive_request.Httpd_recive_buf&&hs->http_recive_request.charlen){
-				memcpy(temprecive,hs->http_recive_request.Httpd_recive_buf, hs->http_recive_request.charlen);
-	    	}
-		}
-
-		if (hs->http_recive_request.Httpd_recive_buf){
-			mem_free(hs->http_recive_request.Httpd_recive_buf);
-			hs->http_recive_request.Httpd_recive_buf = NULL;
-		}
-
-		hs->http_recive_request.Httpd_recive_buf=mem_malloc( p->tot_len+hs->http_recive_request.charlen);
-		if(hs->http_recive_request.Httpd_recive_buf==NULL)
-		{
-			DEBUG_PRINT("Httpd Recive Buf Error pbuf:%x\n\r", p);
-			hs->http_recive_request.charlen=0;
-			hs->http_recive_request.Valid=0;
-			hs->http_recive_request.PreBuf=NULL;
-			pbuf_free(p);
-			close_conn(pcb, hs);
-	  		return ERR_OK;		
-		}		
-
-		memset(hs->http_recive_request.Httpd_recive_buf,0, p->tot_len+hs->http_recive_request.charlen);
-		
-		if(hs->http_recive_request.Valid==1)
-		{
-			if (temprecive){
-				memcpy(hs->http_recive_request.Httpd_recive_buf,temprecive,hs->http_recive_request.charlen);
-				mem_free(temprecive);
-				temprecive = NULL;
-			}
-		}
+    /* While a response is going out, pipelined requests are buffered up to
+     * HTTPD_MAX_PENDING_LEN; beyond that the data is refused and lwIP hands
+     * it to us again later.
+     */
+    if ((hs->handle != NULL) &&
+        (hs->http_recive_request.charlen + p->tot_len > HTTPD_MAX_PENDING_LEN)) {
+      return ERR_MEM;
+    }
 
-		pbuf_copy_partial(p,hs->http_recive_request.Httpd_recive_buf+hs->http_recive_request.charlen, p->tot_len, 0);	
-		hs->http_recive_request.charlen +=p->tot_len;
-		DEBUG_PRINT("####http_recv pbuf:%x\r\n", p);
-		pbuf_free(p);
-		hs->http_recive_request.Valid=1;	
-		DEBUG_PRINT(hs->http_recive_request.Httpd_recive_buf);
-		HtmlLen = 0;
-		HtmlBegin = hs->http_recive_request.Httpd_recive_buf;
-		do{
-			HtmlBegin += HtmlLen;
-			if (hs->recv_state != 2){
-			    HtmlEnd = strstr(HtmlBegin, "\r\n\r\n"); 
-			    if(HtmlEnd){
-			             HtmlEnd += 4;
-				HtmlLen = (int)(HtmlEnd - HtmlBegin)	;	 
-					extract_html_recive(HtmlBegin,hs,pcb);
-				hs->http_recive_request.charlen -= HtmlLen;
-				if (hs->recv_state == 1){
-					hs->recv_content_len -= HtmlLen;	
-				}
-				
-				if (hs->http_recive_request.charlen <= 0){
-			  		mem_free(hs->http_recive_request.Httpd_recive_buf);
-			  		hs->http_recive_request.charlen=0;
-			  		hs->http_recive_request.Httpd_recive_buf=NULL;
-			  		hs->http_recive_request.Valid=0;
-				}	
-		     } 
-	     }
-	     else{
-		HtmlLen = hs->http_recive_request.charlen;
-		hs->RecvPbuf = pbuf_alloc(PBUF_TRANSPORT, HtmlLen, PBUF_RAM);
-		if (hs->RecvPbuf == NULL){
-			DEBUG_PRINT("http_recv recvpBuf\r\n");
+    /* Inform TCP that we have taken the data. */
+    tcp_recved(pcb, p->tot_len);
+    hs->idle = 0;
 
-			return 0;
-		}
-		pbuf_take(hs->RecvPbuf, HtmlBegin, HtmlLen);	
-		hs->RecvOffset = 0;
-		
-  		mem_free(hs->http_recive_request.Httpd_recive_buf);
-  		hs->http_recive_request.charlen=0;
-  		hs->http_recive_request.Httpd_recive_buf=NULL;
-  		hs->http_recive_request.Valid=0;
-
-		hs->recv_content_len -= HtmlLen;
-	     }	 
-	}while((HtmlEnd) && (hs->http_recive_request.charlen > 0));
-
-    } 
-	else {
-      	pbuf_free(p);
+    if (http_recv_append(hs, p) != ERR_OK) {
+      pbuf_free(p);
+      close_conn(pcb, hs);
+      return ERR_OK;
     }
+    DEBUG_PRINT("####http_recv pbuf:%x\r\n", p);
+    pbuf_free(p);
+
+    http_process_requests(pcb, hs);
+    return ERR_OK;
   }
 
   if (err == ERR_OK && p == NULL) {
@@ -1595,11 +1905,44 @@ http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
   return ERR_OK;
 }
 
+/*-----------------------------------------------------------------------------------*/
+/* Find a free connection slot. When all are taken, the persistent connection
+ * that has been idle the longest makes room for the newcomer, so that idle
+ * keep-alive clients cannot lock others out.
+ */
+static int
+http_conn_slot(void)
+{
+  struct http_state *hs;
+  int victim = -1;
+  int i;
+
+  for(i = 0; i < HTTPD_MAX_CONNS; i++) {
+    hs = http_conns[i];
+    if(hs == NULL) {
+      return i;
+    }
+    if((hs->handle == NULL) && (hs->recv_state == 0) &&
+       !hs->http_recive_request.Valid &&
+       ((victim < 0) || (hs->idle > http_conns[victim]->idle))) {
+      victim = i;
+    }
+  }
+
+  if(victim < 0) {
+    return -1;
+  }
+  DEBUG_PRINT("http_accept: closing idle 0x%08x\n\r", (u32)http_conns[victim]->pcb);
+  close_conn(http_conns[victim]->pcb, http_conns[victim]);
+  return victim;
+}
+
 /*-----------------------------------------------------------------------------------*/
 static err_t
 http_accept(void *arg, struct tcp_pcb *pcb, err_t err)
 {
   struct http_state *hs;
+  int slot;
 
   LWIP_UNUSED_ARG(arg);
   LWIP_UNUSED_ARG(err);
@@ -1611,6 +1954,12 @@ http_accept(void *arg, struct tcp_pcb *pcb, err_t err)
   /* Allocate memory for the structure that holds the state of the
      connection. */
 
+  slot = http_conn_slot();
+  if (slot < 0) {
+    DEBUG_PRINT("http_accept: too many connections\n\r");
+    return ERR_MEM;
+  }
+
   hs = (struct http_state *)mem_malloc(sizeof(struct http_state));
 
   if (hs == NULL) {
@@ -1628,7 +1977,8 @@ http_accept(void *arg, struct tcp_pcb *pcb, err_t err)
   /* Tell TCP that this is the structure we wish to be passed for our
      callbacks. */
   tcp_arg(pcb, hs);
- // hs->pcb = pcb;
+  hs->pcb = pcb;
+  http_conns[slot] = hs;
 
   /* Tell TCP that we wish to be informed of incoming data by a call
      to the http_recv() function. */
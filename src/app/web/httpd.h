@@ -49,6 +49,12 @@
 #define DEBUG_PRINT(s, ...) 
 #endif
 
+/* Persistent connections */
+#define HTTPD_MAX_CONNS          4    /* concurrent client connections */
+#define HTTPD_KEEPALIVE_MAX_REQ  32   /* requests served before a connection is closed */
+#define HTTPD_IDLE_POLLS         3    /* idle http_poll rounds (2s each) before closing */
+#define HTTPD_MAX_PENDING_LEN    2048 /* pipelined request bytes buffered during a response */
+
 void httpd_init(unsigned short port);
 void httpd_deinit(void);
 
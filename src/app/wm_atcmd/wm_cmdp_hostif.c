@@ -309,11 +309,235 @@ int tls_hostif_process_cmdrsp(u8 hostif_type, char *cmdrsp, u32 cmdrsp_size)
     return 0;
 }
 
+static void hostif_cmd_index_init(void);
+static int hostif_atcmd_exec(struct tls_atcmd_token_t *tok,
+        union HOSTIF_CMD_PARAMS_UNION *cmd, union HOSTIF_CMDRSP_PARAMS_UNION *cmdrsp,
+        char *res_rsp, u32 *res_len);
+
+/* HOSTIF_xxx_CMD */
+#define HOSTIF_CMD_CHANNELS     7
+
+/* token and parameter/response unions of the command being run */
+struct hostif_atcmd_ctx {
+    struct tls_atcmd_token_t tok;
+    union HOSTIF_CMD_PARAMS_UNION cmd;
+    union HOSTIF_CMDRSP_PARAMS_UNION cmdrsp;
+};
+
+/* one context per command channel, allocated with its first command and kept */
+static struct hostif_atcmd_ctx *hostif_atcmd_ctxs[HOSTIF_CMD_CHANNELS];
+static u8 hostif_atcmd_busy[HOSTIF_CMD_CHANNELS];
+
+static struct hostif_atcmd_ctx *hostif_atcmd_ctx_get(u8 channel)
+{
+    u32 cpu_sr;
+    u8 own = 0;
+
+    if (channel < HOSTIF_CMD_CHANNELS)
+    {
+        cpu_sr = tls_os_set_critical();
+        if (!hostif_atcmd_busy[channel])
+        {
+            hostif_atcmd_busy[channel] = 1;
+            own = 1;
+        }
+        tls_os_release_critical(cpu_sr);
+    }
+    if (!own)
+    {
+        /* the channel is re-entered, use a temporary one */
+        return tls_mem_alloc(sizeof(struct hostif_atcmd_ctx));
+    }
+
+    if (hostif_atcmd_ctxs[channel] == NULL)
+        hostif_atcmd_ctxs[channel] = tls_mem_alloc(sizeof(struct hostif_atcmd_ctx));
+    if (hostif_atcmd_ctxs[channel] == NULL)
+        hostif_atcmd_busy[channel] = 0;
+    return hostif_atcmd_ctxs[channel];
+}
+
+static void hostif_atcmd_ctx_put(u8 channel, struct hostif_atcmd_ctx *ctx)
+{
+    if (ctx == NULL)
+        return;
+    if (channel < HOSTIF_CMD_CHANNELS && ctx == hostif_atcmd_ctxs[channel])
+        hostif_atcmd_busy[channel] = 0;
+    else
+        tls_mem_free(ctx);
+}
+
+/* "AT+@<tag>:<cmd>" runs <cmd> and puts "@<tag>:" in front of its response, so the host can
+   send several commands without waiting and match the responses that come back out of order */
+#define HOSTIF_ATCMD_TAG_LEN        8
+
+/* tagged commands that wait for the network run one after the other on their own task */
+#define HOSTIF_ATCMD_TASK_STK_SIZE  800
+#define HOSTIF_ATCMD_TASK_PRIO      (TLS_HOSTIF_TASK_PRIO + 2)
+#define HOSTIF_ATCMD_QUEUE_SIZE     8
+
+struct hostif_atcmd_job {
+    u8 hostif_type;
+    char tag[HOSTIF_ATCMD_TAG_LEN + 1];
+    struct hostif_atcmd_ctx ctx;
+    char line[1];               /* command line the token points into */
+};
+
+static const char *const hostif_atcmd_async_names[] = {
+    "WSCAN", "WJOIN", "SKCT", "SKGHBN", NULL
+};
+
+static tls_os_queue_t *hostif_atcmd_queue = NULL;
+/* held by every waiter on uart_atcmd_sem: the commands above and bt_wait_rsp_timeout */
+static tls_os_sem_t *hostif_atcmd_async_lock = NULL;
+
+static int hostif_atcmd_is_async(const char *name)
+{
+    int i;
+
+    for (i = 0; hostif_atcmd_async_names[i]; i++)
+    {
+        if (strcmp(hostif_atcmd_async_names[i], name) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+/* returns the length of the tag to skip, 0 if the command has none */
+static u32 hostif_atcmd_tag(const char *buf, u32 len, char *tag)
+{
+    u32 i;
+
+    tag[0] = '\0';
+    if (len < 3 || buf[0] != '@')
+        return 0;
+    for (i = 1; i < len && i <= HOSTIF_ATCMD_TAG_LEN && isalnum((unsigned char)buf[i]); i++)
+        ;
+    if (i == 1 || i >= len || buf[i] != ':')
+        return 0;
+    MEMCPY(tag, buf + 1, i - 1);
+    tag[i - 1] = '\0';
+    return i + 1;
+}
+
+/* executes a parsed command into cmdrsp_buf (AT_CMD_RSP_BUF_SIZE bytes), returns the response length */
+static u32 hostif_atcmd_run(struct hostif_atcmd_ctx *ctx, const char *tag, char *cmdrsp_buf)
+{
+    u32 cmdrsp_size, tag_len = 0;
+    int err, lock;
+
+    if (tag[0])
+        tag_len = sprintf(cmdrsp_buf, "@%s:", tag);
+    cmdrsp_size = AT_CMD_RSP_BUF_SIZE - tag_len;
+
+    lock = hostif_atcmd_async_lock && hostif_atcmd_is_async(ctx->tok.name);
+    if (lock)
+        tls_os_sem_acquire(hostif_atcmd_async_lock, 0);
+    err = hostif_atcmd_exec(&ctx->tok, &ctx->cmd, &ctx->cmdrsp, cmdrsp_buf + tag_len, &cmdrsp_size);
+    if (lock)
+        tls_os_sem_release(hostif_atcmd_async_lock);
+
+    cmdrsp_size += tag_len;
+    if(err != -CMD_ERR_SKT_RPT && err != -CMD_ERR_SKT_SND){
+        cmdrsp_buf[cmdrsp_size] = '\r';
+        cmdrsp_buf[cmdrsp_size+1] = '\n';
+        cmdrsp_buf[cmdrsp_size+2] = '\r';
+        cmdrsp_buf[cmdrsp_size+3] = '\n';
+        cmdrsp_buf[cmdrsp_size+4] = '\0';
+        cmdrsp_size += 4;
+    }
+    return cmdrsp_size;
+}
+
+static void hostif_atcmd_async_task(void *data)
+{
+    struct hostif_atcmd_job *job;
+    char *cmdrsp_buf;
+    u32 cmdrsp_size;
+
+    for (;;)
+    {
+        if (tls_os_queue_receive(hostif_atcmd_queue, (void **)&job, 0, 0))
+            continue;
+
+        cmdrsp_buf = tls_mem_alloc(AT_CMD_RSP_BUF_SIZE);
+        if (cmdrsp_buf)
+        {
+            cmdrsp_size = hostif_atcmd_run(&job->ctx, job->tag, cmdrsp_buf);
+            if (tls_hostif_process_cmdrsp(job->hostif_type, cmdrsp_buf, cmdrsp_size))
+                tls_mem_free(cmdrsp_buf);
+        }
+        tls_mem_free(job);
+    }
+}
+
+static void hostif_atcmd_async_init(void)
+{
+    tls_os_queue_t *queue = NULL;
+    u32 *stk;
+
+    if (tls_os_sem_create(&hostif_atcmd_async_lock, 1))
+    {
+        hostif_atcmd_async_lock = NULL;
+        return;
+    }
+    if (tls_os_queue_create(&queue, HOSTIF_ATCMD_QUEUE_SIZE))
+        return;
+    stk = tls_mem_alloc(HOSTIF_ATCMD_TASK_STK_SIZE * sizeof(u32));
+    if (!stk)
+    {
+        tls_os_queue_delete(queue);
+        return;
+    }
+    hostif_atcmd_queue = queue;
+    if (tls_os_task_create(NULL, "atcmd async", hostif_atcmd_async_task, NULL, (void *)stk,
+                           HOSTIF_ATCMD_TASK_STK_SIZE * sizeof(u32), HOSTIF_ATCMD_TASK_PRIO, 0))
+    {
+        hostif_atcmd_queue = NULL;
+        tls_os_queue_delete(queue);
+        tls_mem_free(stk);
+    }
+}
+
+/* hands a parsed command to the async task, buf is the line the token was parsed from */
+static int hostif_atcmd_post(u8 hostif_type, const char *tag, struct tls_atcmd_token_t *tok,
+        char *buf, u32 length)
+{
+    struct hostif_atcmd_job *job;
+    int i;
+
+    if (hostif_atcmd_queue == NULL)
+        return -1;
+
+    job = tls_mem_alloc(sizeof(struct hostif_atcmd_job) + length);
+    if (!job)
+        return -1;
+    job->hostif_type = hostif_type;
+    strcpy(job->tag, tag);
+    MEMCPY(job->line, buf, length);
+    job->line[length] = '\0';
+    job->ctx.tok = *tok;
+    for (i = 0; i < ATCMD_MAX_ARG; i++)
+    {
+        if (tok->arg[i] >= buf && tok->arg[i] <= buf + length)
+            job->ctx.tok.arg[i] = job->line + (tok->arg[i] - buf);
+    }
+
+    if (tls_os_queue_send(hostif_atcmd_queue, job, 0))
+    {
+        tls_mem_free(job);
+        return -1;
+    }
+    return 0;
+}
+
 int tls_hostif_cmd_handler(u8 hostif_cmd_type, char *buf, u32 length)
 {
     char *cmdrsp_buf;
     u32 cmdrsp_size;
+    struct hostif_atcmd_ctx *ctx = NULL;
     struct tls_atcmd_token_t *atcmd_tok = NULL;
+    char tag[HOSTIF_ATCMD_TAG_LEN + 1];
+    u32 tag_len;
     int err;
     int i, name_len;
     struct tls_hostif_hdr *hdr = (struct tls_hostif_hdr *)buf;
@@ -322,9 +546,15 @@ int tls_hostif_cmd_handler(u8 hostif_cmd_type, char *buf, u32 length)
 
     //TLS_DBGPRT_INFO("===>\n");
     cmdrsp_size = AT_CMD_RSP_BUF_SIZE;
-    atcmd_tok = tls_mem_alloc(sizeof(struct tls_atcmd_token_t));
-    if (NULL == atcmd_tok)
-        return -1;
+    tag[0] = '\0';
+    /* RI commands are parsed in place and need no context */
+    if (hostif_cmd_type != HOSTIF_HSPI_RI_CMD && hostif_cmd_type != HOSTIF_UART1_RI_CMD)
+    {
+        ctx = hostif_atcmd_ctx_get(hostif_cmd_type);
+        if (NULL == ctx)
+            return -1;
+        atcmd_tok = &ctx->tok;
+    }
 
     switch (hostif_cmd_type) {
         case HOSTIF_HSPI_RI_CMD:
@@ -332,7 +562,7 @@ int tls_hostif_cmd_handler(u8 hostif_cmd_type, char *buf, u32 length)
             cmdrsp_buf = tls_mem_alloc(AT_CMD_RSP_BUF_SIZE);
             if (!cmdrsp_buf)
             {
-                tls_mem_free(atcmd_tok);
+                hostif_atcmd_ctx_put(hostif_cmd_type, ctx);
                 return -1;
             }
             err = tls_hostif_ricmd_exec(buf + sizeof(struct tls_hostif_hdr), 
@@ -359,7 +589,7 @@ int tls_hostif_cmd_handler(u8 hostif_cmd_type, char *buf, u32 length)
             cmdrsp_buf = tls_mem_alloc(AT_CMD_RSP_BUF_SIZE);
             if (!cmdrsp_buf)
             {
-                tls_mem_free(atcmd_tok);
+                hostif_atcmd_ctx_put(hostif_cmd_type, ctx);
                 return -1;
             }
 
@@ -388,7 +618,7 @@ int tls_hostif_cmd_handler(u8 hostif_cmd_type, char *buf, u32 length)
                 u8 *atcmd_loopback_buf = tls_mem_alloc(length+1);
                 if (!atcmd_loopback_buf)
                 {
-                    tls_mem_free(atcmd_tok);
+                    hostif_atcmd_ctx_put(hostif_cmd_type, ctx);
                     return -1;
                 }
                 MEMCPY(atcmd_loopback_buf, buf, length);
@@ -403,7 +633,7 @@ int tls_hostif_cmd_handler(u8 hostif_cmd_type, char *buf, u32 length)
             cmdrsp_buf = tls_mem_alloc(AT_CMD_RSP_BUF_SIZE);
             if (!cmdrsp_buf)
             {
-                tls_mem_free(atcmd_tok);
+                hostif_atcmd_ctx_put(hostif_cmd_type, ctx);
                 return -1;
             }
             memset(atcmd_tok, 0, sizeof(struct tls_atcmd_token_t));
@@ -423,7 +653,10 @@ int tls_hostif_cmd_handler(u8 hostif_cmd_type, char *buf, u32 length)
                 err = tls_atcmd_parse(atcmd_tok, buf + 6 + 3, length - 3 - 6);
             else
 #endif
-                err = tls_atcmd_parse(atcmd_tok, buf+3, length - 3);
+            {
+                tag_len = hostif_atcmd_tag(buf + 3, length - 3, tag);
+                err = tls_atcmd_parse(atcmd_tok, buf + 3 + tag_len, length - 3 - tag_len);
+            }
 
 
 #if 0
@@ -438,7 +671,8 @@ int tls_hostif_cmd_handler(u8 hostif_cmd_type, char *buf, u32 length)
 
             if (err) {
                 TLS_DBGPRT_INFO("err parse cmd, code = %d\n", err);
-                cmdrsp_size = sprintf(cmdrsp_buf, "+ERR=%d\r\n", err);
+                cmdrsp_size = tag[0] ? sprintf(cmdrsp_buf, "@%s:", tag) : 0;
+                cmdrsp_size += sprintf(cmdrsp_buf + cmdrsp_size, "+ERR=%d\r\n", err);
             } else {
                 name_len = strlen(atcmd_tok->name);
                 for (i = 0; i < name_len; i++)
@@ -451,25 +685,21 @@ int tls_hostif_cmd_handler(u8 hostif_cmd_type, char *buf, u32 length)
                         memcpy(hif->rmms_addr, buf, 6);
                 }
 #endif
-                err = tls_hostif_atcmd_exec(atcmd_tok, cmdrsp_buf, &cmdrsp_size);
-                if (err) {
-                    //TODO:
-                } 	
-                if(err != -CMD_ERR_SKT_RPT && err != -CMD_ERR_SKT_SND){
-                /* TODO: send cmd response */		
-                    cmdrsp_buf[cmdrsp_size] = '\r';
-                    cmdrsp_buf[cmdrsp_size+1] = '\n';
-    		        cmdrsp_buf[cmdrsp_size+2] = '\r';
-                    cmdrsp_buf[cmdrsp_size+3] = '\n';
-                    cmdrsp_buf[cmdrsp_size+4] = '\0';
-                    cmdrsp_size += 4;
+                if (tag[0] && hostif_atcmd_is_async(atcmd_tok->name) &&
+                    !hostif_atcmd_post(hostif_type, tag, atcmd_tok, buf, length))
+                {
+                    /* answered by the async task */
+                    tls_mem_free(cmdrsp_buf);
+                    hostif_atcmd_ctx_put(hostif_cmd_type, ctx);
+                    return 0;
                 }
+                cmdrsp_size = hostif_atcmd_run(ctx, tag, cmdrsp_buf);
                 //tls_mem_free(cmdrsp_buf);
             }
             break;
         default:
             TLS_DBGPRT_ERR("illegal command type\n");
-             tls_mem_free(atcmd_tok);
+             hostif_atcmd_ctx_put(hostif_cmd_type, ctx);
 			return -1;
             //break;
     }
@@ -500,7 +730,7 @@ int tls_hostif_cmd_handler(u8 hostif_cmd_type, char *buf, u32 length)
     }
 #endif
 
-    tls_mem_free(atcmd_tok);
+    hostif_atcmd_ctx_put(hostif_cmd_type, ctx);
     return err;
 
 }
@@ -1147,6 +1377,7 @@ int tls_hostif_init(void)
 
     hif= &g_hostif;
     memset(hif, 0, sizeof(struct tls_hostif));
+    hostif_cmd_index_init();
     tls_param_get(TLS_PARAM_ID_AUTO_TRIGGER_LENGTH, &transparent_trigger_length, FALSE);
     hif->uart_atlt = transparent_trigger_length;
 
@@ -1180,6 +1411,7 @@ int tls_hostif_init(void)
 #if TLS_CONFIG_UART || TLS_CONFIG_HS_SPI
     err = tls_hostif_task_init();
 #endif
+    hostif_atcmd_async_init();
 
 
     return err; 
@@ -2361,7 +2593,10 @@ int wjoin_proc(u8 set_opt, u8 update_flash, union HOSTIF_CMD_PARAMS_UNION *cmd,
         if (err == CMD_ERR_OK) {
 sem_acquire:
             /* waiting for ever: infact 20s, determind by wpa_supplicant_connect_timeout */
-            err = tls_os_sem_acquire(hif->uart_atcmd_sem, 20 * HZ);
+            if (hif->uart_atcmd_bits & (1 << UART_ATCMD_BIT_WJOIN))
+                err = 0;
+            else
+                err = tls_os_sem_acquire(hif->uart_atcmd_sem, 20 * HZ);
             if (err) 
             {
 				if (hif->last_join)
@@ -2456,7 +2691,10 @@ int wscan_proc(u8 set_opt, u8 update_flash, union HOSTIF_CMD_PARAMS_UNION *cmd,
 		
         time = tls_os_get_time();
 sem_acquire:
-        ret = tls_os_sem_acquire(hif->uart_atcmd_sem, expiredtime - offset);
+        if (hif->uart_atcmd_bits & (1 << UART_ATCMD_BIT_WSCAN))
+            ret = TLS_OS_SUCCESS;
+        else
+            ret = tls_os_sem_acquire(hif->uart_atcmd_sem, expiredtime - offset);
         if (ret == TLS_OS_SUCCESS)
         {
 			if(!(hif->uart_atcmd_bits & (1 << UART_ATCMD_BIT_WSCAN)))
@@ -2570,7 +2808,10 @@ int skct_proc(u8 set_opt, u8 update_flash, union HOSTIF_CMD_PARAMS_UNION *cmd, u
             time = tls_os_get_time();
 sem_acquire:
             /* waiting for 25 seconds */
-            err = tls_os_sem_acquire(hif->uart_atcmd_sem, 25*HZ - offset);
+            if (hif->uart_atcmd_bits & (1 << UART_ATCMD_BIT_SKCT))
+                err = 0;
+            else
+                err = tls_os_sem_acquire(hif->uart_atcmd_sem, 25*HZ - offset);
             if (err) {
                 tls_cmd_close_socket(socket_num);
                 return -CMD_ERR_SKT_CONN; 
@@ -4589,9 +4830,16 @@ tls_bt_status_t bt_wait_rsp_timeout(enum tls_cmd_mode cmd_mode, union HOSTIF_CMD
 
 	if(cmd_mode != CMD_MODE_HSPI_RICMD && cmd_mode != CMD_MODE_UART1_RICMD)
     {
+        /* the wifi commands hold this lock while they wait, so a release
+           meant for us may already have been consumed: check our bit first */
+        if (hostif_atcmd_async_lock)
+            tls_os_sem_acquire(hostif_atcmd_async_lock, 0);
         time = tls_os_get_time();
 sem_acquire:
-        ret = (tls_bt_status_t)tls_os_sem_acquire(hif->uart_atcmd_sem, timeout_s * HZ - offset);
+        if (hif->uart_atcmd_bits & (1 << UART_ATCMD_BIT_BT))
+            ret = (tls_bt_status_t)TLS_OS_SUCCESS;
+        else
+            ret = (tls_bt_status_t)tls_os_sem_acquire(hif->uart_atcmd_sem, timeout_s * HZ - offset);
         if (ret == (tls_bt_status_t)TLS_OS_SUCCESS)
         {
 			if(!(hif->uart_atcmd_bits & (1 << UART_ATCMD_BIT_BT)))
@@ -4603,6 +4851,8 @@ sem_acquire:
 			    }
 			}
         }
+        if (hostif_atcmd_async_lock)
+            tls_os_sem_release(hostif_atcmd_async_lock);
 	}
 
 	return ret;
@@ -7818,6 +8068,52 @@ static struct tls_cmd_t  at_ri_cmd_tbl[] = {
 	{ NULL, HOSTIF_CMD_NOP, 0, 0 , 0, NULL},
 };
 
+#define AT_RI_CMD_CNT   (sizeof(at_ri_cmd_tbl) / sizeof(struct tls_cmd_t) - 1)
+
+/* at_ri_cmd_tbl in name order for a binary search, and by RI command id (table index + 1,
+   0 for none); built once by tls_hostif_init */
+static u16 at_cmd_name_index[AT_RI_CMD_CNT];
+static u16 at_cmd_ri_index[256];
+
+static void hostif_cmd_index_init(void)
+{
+    int i, j;
+
+    /* insertion sort keeps equal names in table order, so the first one is still found */
+    for (i = 0; i < AT_RI_CMD_CNT; i++)
+    {
+        for (j = i; j > 0 && strcmp(at_ri_cmd_tbl[at_cmd_name_index[j - 1]].at_name, at_ri_cmd_tbl[i].at_name) > 0; j--)
+            at_cmd_name_index[j] = at_cmd_name_index[j - 1];
+        at_cmd_name_index[j] = i;
+    }
+
+    /* backwards, the first entry of an id wins as with the linear search */
+    memset(at_cmd_ri_index, 0, sizeof(at_cmd_ri_index));
+    for (i = AT_RI_CMD_CNT - 1; i >= 0; i--)
+    {
+        if (at_ri_cmd_tbl[i].ri_cmd_id > 0 && at_ri_cmd_tbl[i].ri_cmd_id < 256)
+            at_cmd_ri_index[at_ri_cmd_tbl[i].ri_cmd_id] = i + 1;
+    }
+}
+
+static struct tls_cmd_t *hostif_find_atcmd(const char *name)
+{
+    int lo = 0, hi = AT_RI_CMD_CNT, mid;
+
+    /* first entry not below name */
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (strcmp(at_ri_cmd_tbl[at_cmd_name_index[mid]].at_name, name) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo < AT_RI_CMD_CNT && strcmp(at_ri_cmd_tbl[at_cmd_name_index[lo]].at_name, name) == 0)
+        return &at_ri_cmd_tbl[at_cmd_name_index[lo]];
+    return NULL;
+}
+
 int at_parse_func(char *at_name, struct tls_atcmd_token_t *tok, union HOSTIF_CMD_PARAMS_UNION *cmd){
     if(strcmp("QMAC", at_name) == 0 || strcmp("QVER", at_name) == 0 || strcmp("&HWV", at_name) == 0 ||
        strcmp("&LPTSTP", at_name) == 0 || strcmp("&LPTSTT", at_name) == 0 || strcmp("&LPRSTP", at_name) == 0 ||
@@ -11855,15 +12151,13 @@ int tls_atcmd_parse(struct tls_atcmd_token_t *tok, char *buf, u32 len)
     } 
 }
 
-int tls_hostif_atcmd_exec(
-        struct tls_atcmd_token_t *tok,
+static int hostif_atcmd_exec(struct tls_atcmd_token_t *tok,
+        union HOSTIF_CMD_PARAMS_UNION *cmd, union HOSTIF_CMDRSP_PARAMS_UNION *cmdrsp,
         char *res_rsp, u32 *res_len)
 {
     int err = 0;
-	struct tls_cmd_t *atcmd, *match = NULL;
+	struct tls_cmd_t *match = NULL;
 	u8 set_opt=0, update_flash=0;
-	union HOSTIF_CMD_PARAMS_UNION *cmd = NULL;
-	union HOSTIF_CMDRSP_PARAMS_UNION *cmdrsp = NULL;
 
     if (strlen(tok->name) == 0) {
         err = atcmd_nop_proc(tok, res_rsp, res_len);
@@ -11871,29 +12165,9 @@ int tls_hostif_atcmd_exec(
     }
 
     /* look for AT CMD handle table */
-	atcmd = at_ri_cmd_tbl;
-	while (atcmd->at_name) {
-		if (strcmp(atcmd->at_name, tok->name) == 0) {
-			match = atcmd;
-            break;
-		}
-		atcmd++;
-	}
+	match = hostif_find_atcmd(tok->name);
     /* at command handle */
     if (match) {
-    cmd = tls_mem_alloc(sizeof(union HOSTIF_CMD_PARAMS_UNION));
-    if (NULL == cmd)
-    {
-        err = -CMD_ERR_MEM;
-        goto err;
-    }
-    cmdrsp = tls_mem_alloc(sizeof(union HOSTIF_CMDRSP_PARAMS_UNION));
-    if (NULL == cmdrsp)
-    {
-        err = -CMD_ERR_MEM;
-        goto err;
-    }
-    
     	err = hostif_check_atcmd_opt(tok->op, tok->arg_found, match->op_flag, match->at_arg_len, &set_opt, &update_flash);
 //        printf("err1 = %d\n",err);
         if(err)
@@ -11916,10 +12190,6 @@ int tls_hostif_atcmd_exec(
                 goto err;
             }
         }
-     if (NULL != cmd)
-        tls_mem_free(cmd);
-     if (NULL != cmdrsp)
-        tls_mem_free(cmdrsp);
     	 return err;
     }else
     {
@@ -11928,6 +12198,28 @@ int tls_hostif_atcmd_exec(
 err:
     /* at command not found */
     *res_len = sprintf(res_rsp, "+ERR=%d", err); 
+    return err;
+}
+
+int tls_hostif_atcmd_exec(
+        struct tls_atcmd_token_t *tok,
+        char *res_rsp, u32 *res_len)
+{
+    int err;
+	union HOSTIF_CMD_PARAMS_UNION *cmd = NULL;
+	union HOSTIF_CMDRSP_PARAMS_UNION *cmdrsp = NULL;
+
+    cmd = tls_mem_alloc(sizeof(union HOSTIF_CMD_PARAMS_UNION));
+    cmdrsp = tls_mem_alloc(sizeof(union HOSTIF_CMDRSP_PARAMS_UNION));
+    if (NULL == cmd || NULL == cmdrsp)
+    {
+        err = -CMD_ERR_MEM;
+        *res_len = sprintf(res_rsp, "+ERR=%d", err);
+    }
+    else
+    {
+        err = hostif_atcmd_exec(tok, cmd, cmdrsp, res_rsp, res_len);
+    }
     if (NULL != cmd)
         tls_mem_free(cmd);
     if (NULL != cmdrsp)
@@ -11957,8 +12249,7 @@ int tls_hostif_ricmd_exec(char *buf, u32 length, char *cmdrsp_buf, u32 *cmdrsp_s
     //struct tls_hostif_cmdrsp *cmdrsp = (struct tls_hostif_cmdrsp *)cmdrsp_buf;
     int err = 0;
     struct tls_cmd_t * match = NULL;
-    int cmdcnt = sizeof(at_ri_cmd_tbl)/ sizeof(struct tls_cmd_t);
-	int i = 0, set_opt=0, update_flash = 0;
+	int set_opt=0, update_flash = 0;
     
     //TLS_DBGPRT_INFO("========>\n");
 
@@ -11969,12 +12260,8 @@ int tls_hostif_ricmd_exec(char *buf, u32 length, char *cmdrsp_buf, u32 *cmdrsp_s
         cmd->cmd_hdr.ext = 1;
         goto erred;
     }
-	for (i = 0; i< cmdcnt; i++){
-		if (cmd_code == at_ri_cmd_tbl[i].ri_cmd_id){
-			match = &at_ri_cmd_tbl[i];
-			break;
-		}
-	}
+	if (at_cmd_ri_index[cmd_code & 0xFF])
+		match = &at_ri_cmd_tbl[at_cmd_ri_index[cmd_code & 0xFF] - 1];
 	if (match){
 		if(cmd->cmd_hdr.ext & 0x2){
 			if((cmd->cmd_hdr.ext & 0x1) == 0 || (match->op_flag & 0x40) == 0){
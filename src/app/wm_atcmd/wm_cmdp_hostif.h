@@ -51,6 +51,7 @@
 #define PACKET_TYPE_DATA      0
 #define PACKET_TYPE_RI_CMD    1
 #define PACKET_TYPE_AT_CMD    2 
+#define PACKET_TYPE_ACK       3
 
 #define HOSTCMD_SYN      0xAA
 
@@ -2048,13 +2048,28 @@ static struct tls_ricmd_t ri_cmd_tbl[]={
 {-1,                     NULL}
 };
 
+/* ri_cmd_tbl by command id (table index + 1, 0 for none), built with the first command */
+static u8 ri_cmd_index[256];
+static u8 ri_cmd_index_ready = 0;
+
+static void ricmd_index_init(void)
+{
+    int cmdcnt = sizeof(ri_cmd_tbl)/ sizeof(struct tls_ricmd_t);
+    int i;
+
+    /* backwards, the first entry of an id wins */
+    for (i = cmdcnt - 1; i >= 0; i--){
+        if (ri_cmd_tbl[i].cmdId >= 0 && ri_cmd_tbl[i].cmdId < 256 && ri_cmd_tbl[i].proc_func)
+            ri_cmd_index[ri_cmd_tbl[i].cmdId] = i + 1;
+    }
+    ri_cmd_index_ready = 1;
+}
+
 int tls_ricmd_exec(char *buf, u32 length, char *cmdrsp_buf, u32 *cmdrsp_size)
 {
     struct tls_hostif_cmd *cmd = (struct tls_hostif_cmd *)buf;
     //struct tls_hostif_cmdrsp *cmdrsp = (struct tls_hostif_cmdrsp *)cmdrsp_buf;
     int err = 0;
-    int cmdcnt = sizeof(ri_cmd_tbl)/ sizeof(struct tls_ricmd_t);
-	int i = 0;
     
     //TLS_DBGPRT_INFO("========>\n");
 
@@ -2066,14 +2081,12 @@ int tls_ricmd_exec(char *buf, u32 length, char *cmdrsp_buf, u32 *cmdrsp_size)
         return 0;
     }
 
+    if (!ri_cmd_index_ready)
+        ricmd_index_init();
+
  	/*find cmdId*/
-	for (i = 0; i< cmdcnt; i++){
-		if (cmd_code == ri_cmd_tbl[i].cmdId){
-			break;
-		}
-	}
-	if (cmd_code != -1){
-		ri_cmd_tbl[i].proc_func(buf, length, cmdrsp_buf, cmdrsp_size);
+	if (ri_cmd_index[cmd_code & 0xFF]){
+		ri_cmd_tbl[ri_cmd_index[cmd_code & 0xFF] - 1].proc_func(buf, length, cmdrsp_buf, cmdrsp_size);
 	}else{
 		err = ricmd_default_proc(buf, length, cmdrsp_buf, cmdrsp_size);
 	}
@@ -37,15 +37,7 @@
 
 struct tls_hspi g_hspi;
 extern struct tls_slave_hspi g_slave_hspi;
-
-/**
- * @struct hspi_tx_data
- */
-struct hspi_tx_data
-{
-    struct tls_hspi *hspi;
-    struct tls_hostif_tx_msg *tx_msg;
-};
+extern struct task_parameter wl_task_param_hostif;
 
 #if HSPI_TX_MEM_MALLOC
 static void hspi_free_txbuf(struct tls_hspi *hspi)
@@ -169,9 +161,8 @@ static int hspi_socket_recv(struct tls_hspi *hspi,
     padlen = (4 - (total_len & 0x3)) & 0x3;
     total_len += padlen;
     tx_desc->buf_info = total_len << 12;
-/* enable hspi tx */
+/* hand over to hspi, hspi_tx() enables it */
     tx_desc->valid_ctrl = (1UL << 31);
-    tls_reg_write32(HR_SDIO_RXEN, 0x01);
 #if !HSPI_TX_MEM_MALLOC
     offset = 0;
     pbuf_free(p);
@@ -180,30 +171,11 @@ static int hspi_socket_recv(struct tls_hspi *hspi,
     return 0;
 }
 
-static int hspi_tx(struct hspi_tx_data *tx_data)
+static int hspi_tx_msg(struct tls_hspi *hspi,
+                       struct tls_hspi_tx_desc *tx_desc,
+                       struct tls_hostif_tx_msg *tx_msg)
 {
-    struct tls_hspi *hspi = tx_data->hspi;
-    struct tls_hspi_tx_desc *tx_desc;
-    struct tls_hostif_tx_msg *tx_msg = tx_data->tx_msg;
-//    struct tls_hostif *hif = tls_get_hostif();
-//    u32 cpu_sr;
     int err = 0;
-//    int offset;
-
-#if HSPI_TX_MEM_MALLOC
-// printf("\ntx done flag=%d\n",hspi->tls_slave_hspi->txdoneflag);
-    if (1 == hspi->tls_slave_hspi->txdoneflag)
-    {
-        hspi->tls_slave_hspi->txdoneflag = 0;
-        hspi_free_txbuf(hspi);
-    }
-#endif
-    tx_desc = hspi->tls_slave_hspi->curr_tx_desc;
-
-    while (tx_desc->valid_ctrl & BIT(31))
-    {
-        ;
-    }
 
     switch (tx_msg->type)
     {
@@ -238,7 +210,6 @@ static int hspi_tx(struct hspi_tx_data *tx_data)
             tx_desc->buf_info = (tx_msg->u.msg_cmdrsp.buflen) << 12;
 
             tx_desc->valid_ctrl = (1UL << 31);
-            tls_reg_write32(HR_SDIO_RXEN, 0x01);
             break;
 
         case HOSTIF_TX_MSG_TYPE_UDP:
@@ -251,17 +222,69 @@ static int hspi_tx(struct hspi_tx_data *tx_data)
             err = -1;
             break;
     }
-    tx_desc = (struct tls_hspi_tx_desc *) tx_desc->next_desc_addr;
-    hspi->tls_slave_hspi->curr_tx_desc = tx_desc;
 
-    if (tx_msg)
-        tls_mem_free(tx_msg);
-    if (tx_data)
-        tls_mem_free(tx_data);
+    tls_mem_free(tx_msg);
 
     return err;
 }
 
+/**
+ * moves the queued messages into every free tx descriptor and enables hspi
+ * once for the batch. the tx done interrupt is only unmasked while messages
+ * wait for a descriptor, completions are otherwise picked up here.
+ */
+static void hspi_tx(struct tls_hspi *hspi)
+{
+    struct tls_hspi_tx_desc *tx_desc;
+    struct tls_hostif_tx_msg *tx_msg;
+    u32 cpu_sr;
+    int n = 0;
+
+#if HSPI_TX_MEM_MALLOC
+// printf("\ntx done flag=%d\n",hspi->tls_slave_hspi->txdoneflag);
+    if (1 == hspi->tls_slave_hspi->txdoneflag)
+    {
+        hspi->tls_slave_hspi->txdoneflag = 0;
+        hspi_free_txbuf(hspi);
+    }
+#endif
+    tx_desc = hspi->tls_slave_hspi->curr_tx_desc;
+
+    for (;;)
+    {
+        cpu_sr = tls_os_set_critical();
+        if (dl_list_empty(&hspi->tx_msg_list))
+        {
+            tls_os_release_critical(cpu_sr);
+            break;
+        }
+        tls_os_release_critical(cpu_sr);
+
+        if (tx_desc->valid_ctrl & BIT(31))
+        {
+        /* ring full, continue from the tx done interrupt */
+            tls_hspi_irq_unmask(SDIO_WP_INT_SRC_DATA_UP, TRUE);
+            if (tx_desc->valid_ctrl & BIT(31))
+                break;
+            tls_hspi_irq_mask(SDIO_WP_INT_SRC_DATA_UP);
+        }
+
+        cpu_sr = tls_os_set_critical();
+        tx_msg = dl_list_first(&hspi->tx_msg_list, struct tls_hostif_tx_msg, list);
+        dl_list_del(&tx_msg->list);
+        tls_os_release_critical(cpu_sr);
+
+        hspi_tx_msg(hspi, tx_desc, tx_msg);
+        tx_desc = (struct tls_hspi_tx_desc *) tx_desc->next_desc_addr;
+        hspi->tls_slave_hspi->curr_tx_desc = tx_desc;
+        n++;
+    }
+
+/* enable hspi tx */
+    if (n)
+        tls_reg_write32(HR_SDIO_RXEN, 0x01);
+}
+
 #if 0
 void tls_hspi_tx_task(void *data)
 {
@@ -427,61 +450,102 @@ static int hspi_net_send(struct tls_hspi *hspi,
     return 0;
 }
 
-static int hspi_rx_data(void *data)
+static void hspi_rx_frame(struct tls_hspi *hspi,
+                          struct tls_hspi_rx_desc *rx_desc)
 {
-    struct tls_hspi *hspi = (struct tls_hspi *) data;
-    struct tls_hspi_rx_desc *rx_desc;
-
-/* get rx descriptor */
-    rx_desc = hspi->tls_slave_hspi->curr_rx_desc;
-    while (!(rx_desc->valid_ctrl & BIT(31)))
-    {
 #if 0
+    {
+        int i;
+        int errorflag = 0;
+    // for(i = 0;i < 32;i ++)
+        for (i = 0; i < 1500; i++)
         {
-            int i;
-            int errorflag = 0;
-        // for(i = 0;i < 32;i ++)
-            for (i = 0; i < 1500; i++)
+            if (*(u8 *) (rx_desc->buf_addr + i) != 0x38)
             {
-                if (*(u8 *) (rx_desc->buf_addr + i) != 0x38)
-                {
-                    errorflag++;
-                    printf("[%d]=[%x]\n", i, *(u8 *) (rx_desc->buf_addr + i));
-                }
+                errorflag++;
+                printf("[%d]=[%x]\n", i, *(u8 *) (rx_desc->buf_addr + i));
             }
-            printf("show over[%c][%c],errflag=%d\n",
-                   *(u8 *) (rx_desc->buf_addr),
-                   *(u8 *) (rx_desc->buf_addr + 1499), errorflag);
-            if (errorflag > 0)
-                while (1);
+        }
+        printf("show over[%c][%c],errflag=%d\n",
+               *(u8 *) (rx_desc->buf_addr),
+               *(u8 *) (rx_desc->buf_addr + 1499), errorflag);
+        if (errorflag > 0)
+            while (1);
 #if 0
-            for (i = 1468; i < 1500; i++)
-            {
-                printf("[%x]", *(u8 *) (rx_desc->buf_addr + i));
-            }
+        for (i = 1468; i < 1500; i++)
+        {
+            printf("[%x]", *(u8 *) (rx_desc->buf_addr + i));
+        }
 #endif
-            printf("\n");
+        printf("\n");
 
-        }
+    }
 
 #endif
-        if (hspi->iffwup)
+    if (hspi->iffwup)
+    {
+        hspi_fwup_send(hspi, rx_desc);
+    }
+    else
+    {
+    /* transmit data to lwip stack */
+        hspi_net_send(hspi, rx_desc);
+    }
+
+// hspi_free_rxdesc(rx_desc);
+    rx_desc->valid_ctrl = BIT(31);
+/* hspi/sdio tx enableĴsdioӲ֪пõtx descriptor */
+    tls_reg_write32(HR_SDIO_TXEN, BIT(0));
+}
+
+static void hspi_rx_timeout_handler(void *arg);
+
+/**
+ * the rx data interrupt stays masked while the ring is polled here, so a
+ * host streaming frames costs one interrupt per burst instead of one per
+ * frame. the interrupt is unmasked once the ring is empty, or the next pass
+ * is deferred by rx_coal_msecs when this one took rx_coal_frames or more.
+ */
+static int hspi_rx_data(void *data)
+{
+    struct tls_hspi *hspi = (struct tls_hspi *) data;
+    struct tls_slave_hspi *slave = hspi->tls_slave_hspi;
+    struct tls_hspi_rx_desc *rx_desc;
+    int n = 0;
+
+/* get rx descriptor */
+    rx_desc = slave->curr_rx_desc;
+    for (;;)
+    {
+        while (!(rx_desc->valid_ctrl & BIT(31)) && n < HSPI_RX_DESC_NUM)
         {
-            hspi_fwup_send(hspi, rx_desc);
+            hspi_rx_frame(hspi, rx_desc);
+            rx_desc = (struct tls_hspi_rx_desc *) rx_desc->next_desc_addr;
+            slave->curr_rx_desc = rx_desc;
+            n++;
         }
-        else
+
+        if (n >= HSPI_RX_DESC_NUM)
         {
-        /* transmit data to lwip stack */
-            hspi_net_send(hspi, rx_desc);
+        /* a whole ring in one pass, let the other hostif work run first */
+            if (!tls_wl_task_callback(&wl_task_param_hostif,
+                                      (start_routine) hspi_rx_data, hspi, 0))
+                return 0;
+        }
+        else if (slave->rx_coal_msecs && n && n >= slave->rx_coal_frames)
+        {
+            tls_wl_task_untimeout(&wl_task_param_hostif, hspi_rx_timeout_handler, hspi);
+            if (!tls_wl_task_add_timeout(&wl_task_param_hostif, slave->rx_coal_msecs,
+                                         hspi_rx_timeout_handler, hspi))
+                return 0;
         }
 
-    // hspi_free_rxdesc(rx_desc);
-        rx_desc->valid_ctrl = BIT(31);
-    /* hspi/sdio tx enableĴsdioӲ֪пõtx descriptor */
-        tls_reg_write32(HR_SDIO_TXEN, BIT(0));
-
-        rx_desc = (struct tls_hspi_rx_desc *) rx_desc->next_desc_addr;
-        hspi->tls_slave_hspi->curr_rx_desc = rx_desc;
+        tls_hspi_irq_unmask(SDIO_WP_INT_SRC_DATA_DOWN, TRUE);
+        if (rx_desc->valid_ctrl & BIT(31))
+            break;
+    /* a frame landed before the unmask */
+        tls_hspi_irq_mask(SDIO_WP_INT_SRC_DATA_DOWN);
+        n = 0;
     }
 #if 0                           // hspi
     {
@@ -623,6 +687,11 @@ void tls_hspi_rx_task(void *data)
 }
 #endif
 
+static void hspi_rx_timeout_handler(void *arg)
+{
+    hspi_rx_data(arg);
+}
+
 static void tls_hspi_ram_info_dump(void)
 {
     TLS_DBGPRT_INFO("HSPI_TXBUF_BASE_ADDR       : 0x%x -- 0x%x \n",
@@ -636,7 +705,6 @@ static void tls_hspi_ram_info_dump(void)
                     HSPI_RX_DESC_BASE_ADDR + HSPI_RX_DESC_TOTAL_SIZE);
 }
 
-extern struct task_parameter wl_task_param_hostif;
 static s16 tls_hspi_rx_cmd_cb(char *buf)
 {
     struct tls_hspi *hspi = &g_hspi;
@@ -655,6 +723,7 @@ static s16 tls_hspi_rx_data_cb(char *buf)
 
 // if(hspi->rx_msg_queue)
 // tls_os_queue_send(hspi->rx_msg_queue, (void *)HSPI_RX_DATA_MSG, 0);
+    tls_hspi_irq_mask(SDIO_WP_INT_SRC_DATA_DOWN);
     tls_wl_task_callback_static(&wl_task_param_hostif,
                                 (start_routine) hspi_rx_data, hspi, 0,
                                 TLS_MSG_ID_HSPI_RX_DATA);
@@ -663,44 +732,33 @@ static s16 tls_hspi_rx_data_cb(char *buf)
 
 static s16 tls_hspi_tx_data_cb(char *buf)
 {
-//    struct tls_hspi *hspi = &g_hspi;
+    struct tls_hspi *hspi = &g_hspi;
 
 // if(hspi->tx_msg_sem)
 // tls_os_sem_release(hspi->tx_msg_sem);
-#if HSPI_TX_MEM_MALLOC
+    tls_hspi_irq_mask(SDIO_WP_INT_SRC_DATA_UP);
     tls_wl_task_callback_static(&wl_task_param_hostif,
-                                (start_routine) hspi_free_txbuf, hspi, 0,
+                                (start_routine) hspi_tx, hspi, 0,
                                 TLS_MSG_ID_HSPI_TX_DATA);
-#endif
     return WM_SUCCESS;
 }
 
 static void hspi_send_tx_msg(u8 hostif_mode, struct tls_hostif_tx_msg *tx_msg,
                              bool is_event)
 {
-//    u32 cpu_sr;
-    struct hspi_tx_data *tx_data = NULL;
+    u32 cpu_sr;
     if (tx_msg == NULL)
         return;
     switch (hostif_mode)
     {
         case HOSTIF_MODE_HSPI:
-            tx_data = tls_mem_alloc(sizeof(struct hspi_tx_data));
-            if (tx_data == NULL)
-            {
-                free_tx_msg_buffer(tx_msg);
-                tls_mem_free(tx_msg);
-                return;
-            }
-            tx_data->tx_msg = tx_msg;
-            tx_data->hspi = &g_hspi;
-            if (tls_wl_task_callback
-                (&wl_task_param_hostif, (start_routine) hspi_tx, tx_data, 0))
-            {
-                free_tx_msg_buffer(tx_msg);
-                tls_mem_free(tx_msg);
-                tls_mem_free(tx_data);
-            }
+        /* queued messages go out in one batch, see hspi_tx() */
+            cpu_sr = tls_os_set_critical();
+            dl_list_add_tail(&g_hspi.tx_msg_list, &tx_msg->list);
+            tls_os_release_critical(cpu_sr);
+            tls_wl_task_callback_static(&wl_task_param_hostif,
+                                        (start_routine) hspi_tx, &g_hspi, 0,
+                                        TLS_MSG_ID_HSPI_TX_DATA);
             break;
         default:
             free_tx_msg_buffer(tx_msg);
@@ -720,12 +778,16 @@ int tls_hspi_init(void)
 
     hspi = &g_hspi;
     memset(hspi, 0, sizeof(struct tls_hspi));
+    dl_list_init(&hspi->tx_msg_list);
 
     tls_param_get(TLS_PARAM_ID_USRINTF, &mode, TRUE);
 
-    tls_slave_spi_init();
+    if (tls_slave_spi_init())
+        return WM_FAILED;
     tls_set_high_speed_interface_type(mode);
     hspi->tls_slave_hspi = &g_slave_hspi;
+/* tx completions are polled by hspi_tx() */
+    tls_hspi_irq_mask(SDIO_WP_INT_SRC_DATA_UP);
 
     tls_hspi_rx_cmd_callback_register(tls_hspi_rx_cmd_cb);
     tls_hspi_rx_data_callback_register(tls_hspi_rx_data_cb);
@@ -22,6 +22,7 @@
 struct tls_hspi {
 	struct tls_slave_hspi	*tls_slave_hspi;
 	u8 iffwup;        //Ƿ̼
+	struct dl_list tx_msg_list;    /* waiting for a free tx descriptor */
 //	tls_os_queue_t 			*rx_msg_queue;
 //	tls_os_sem_t            *tx_msg_sem;
 }; 
@@ -29,6 +29,7 @@
 #include "wm_mem.h"
 #include "wm_wl_task.h"
 #include "wm_io.h"
+#include "wm_crypto_hard.h"
 
 #if (TLS_CONFIG_HOSTIF && TLS_CONFIG_UART)
 //#define      UART0_TX_TASK_STK_SIZE          256
@@ -845,6 +846,7 @@ void uart_net_send(struct tls_uart *uart, u32 head, u32 tail, int count)
     u8 def_socket;
     int err = 0;
     int remaincount = count;
+    char *data;
 
     static u16 printfFreq = 0;
 
@@ -875,10 +877,12 @@ RESENDBUF:
         bufcopylen = (TLS_UART_RX_BUF_SIZE - tail);
         MEMCPY(uart_net_send_data, (u8 *)recv->buf + tail, bufcopylen);
         MEMCPY(uart_net_send_data + bufcopylen, (u8 *)recv->buf, buflen - bufcopylen);
+        data = uart_net_send_data;
     }
     else
     {
-        MEMCPY(uart_net_send_data, (u8 *)recv->buf + tail, buflen);
+        /* the socket is done with the data when the send returns */
+        data = (char *)recv->buf + tail;
     }
     def_socket = tls_cmd_get_default_socket();
 #if TLS_CONFIG_CMD_USE_RAW_SOCKET
@@ -889,7 +893,7 @@ RESENDBUF:
 
         do
         {
-            err = tls_hostif_send_data(&skt_info, uart_net_send_data, buflen);
+            err = tls_hostif_send_data(&skt_info, data, buflen);
             if (ERR_VAL == err)
             {
                 printf("\nsocket err val\n");
@@ -961,6 +965,116 @@ RESENDBUF:
         }
     }
 }
+
+#if TLS_CONFIG_CMD_USE_RAW_SOCKET
+/*
+ * transparent mode on a TCP client socket: instead of copying, the received
+ * bytes are lent to lwip where they sit in the ring. the tail stays on the
+ * oldest byte not yet acked by the peer, so the ring bounds the data in
+ * flight and the uart driver does not recycle lent bytes (rx_hold).
+ */
+
+/* tcpip thread */
+static void uart_net_acked(u8 skt_num, u32 len, void *arg)
+{
+    struct tls_uart *uart = (struct tls_uart *)arg;
+    u32 cpu_sr;
+
+    cpu_sr = tls_os_set_critical();
+    if (len)
+        uart->net_acked += len;
+    else
+        uart->net_lost = 1;
+    tls_os_release_critical(cpu_sr);
+
+    tls_wl_task_callback_static(&wl_task_param_hostif, (start_routine) uart_rx, uart, 0,
+        (TLS_UART_0 == uart->uart_port->uart_no) ? TLS_MSG_ID_UART0_RX : TLS_MSG_ID_UART1_RX);
+}
+
+/* give the acked bytes back to the ring, returns the bytes still lent */
+static u32 uart_net_release(struct tls_uart *uart)
+{
+    struct tls_uart_circ_buf *recv = &uart->uart_port->recv;
+    u32 cpu_sr;
+    u32 acked;
+    u8 lost;
+
+    cpu_sr = tls_os_set_critical();
+    acked = uart->net_acked;
+    lost = uart->net_lost;
+    uart->net_acked = 0;
+    uart->net_lost = 0;
+    tls_os_release_critical(cpu_sr);
+
+    /* a connection going away drops what it was not acked */
+    if (lost || acked > uart->net_lent)
+        acked = uart->net_lent;
+    if (0 == acked)
+        return uart->net_lent;
+
+    uart->net_lent -= acked;
+    recv->tail = (recv->tail + acked) & (TLS_UART_RX_BUF_SIZE - 1);
+    if (0 == uart->net_lent)
+        uart->uart_port->rx_hold = 0;
+
+    if (TLS_UART_FLOW_CTRL_HARDWARE == uart->uart_port->fcStatus && 
+        TLS_UART_FLOW_CTRL_HARDWARE == uart->uart_port->opts.flow_ctrl &&
+        CIRC_SPACE(recv->head, recv->tail, TLS_UART_RX_BUF_SIZE) > TLS_UART_RX_BUF_SIZE / 2)
+    {
+        tls_set_uart_rx_status(uart->uart_port->uart_no, TLS_UART_RX_ENABLE);
+    }
+    return uart->net_lent;
+}
+
+/* lend the next count bytes, -1 if the socket wants them copied by uart_net_send() */
+static int uart_net_lend(struct tls_uart *uart, int count)
+{
+    struct tls_uart_circ_buf *recv = &uart->uart_port->recv;
+    u8 def_socket = tls_cmd_get_default_socket();
+    u32 pos;
+    int len;
+    int n;
+
+    if (0 == def_socket)
+        return -1;
+
+    uart->uart_port->rx_hold = 1;
+    while (count > 0)
+    {
+        pos = (recv->tail + uart->net_lent) & (TLS_UART_RX_BUF_SIZE - 1);
+        len = TLS_UART_RX_BUF_SIZE - pos;
+        if (len > count)
+            len = count;
+        n = tls_socket_send_ref(def_socket, (void *)(recv->buf + pos), len, uart_net_acked, uart);
+        if (n <= 0)
+        {
+            /* full send buffer: the next ack calls uart_rx() again */
+            if (n < 0 && 0 == uart->net_lent)
+            {
+                uart->uart_port->rx_hold = 0;
+                return -1;
+            }
+            break;
+        }
+        uart->net_lent += n;
+        count -= n;
+    }
+    if (0 == uart->net_lent)
+        uart->uart_port->rx_hold = 0;
+    return 0;
+}
+#endif
+
+static void uart_net_forward(struct tls_uart *uart, int count)
+{
+    struct tls_uart_circ_buf *recv = &uart->uart_port->recv;
+
+#if TLS_CONFIG_CMD_USE_RAW_SOCKET
+    if (0 == uart_net_lend(uart, count))
+        return;
+#endif
+    uart_net_send(uart, recv->head, recv->tail, count);
+}
 #endif
 #if !TLS_CONFIG_CMD_NET_USE_LIST_FTR	
 static int cache_tcp_recv(struct tls_hostif_tx_msg *tx_msg)
@@ -1129,219 +1243,274 @@ static void uart_tx_timeout_check(struct tls_uart *uart)
     }
 }
 #endif
-/*
- * ˵
- * жϴεͬ֡ǷѾɣѾ
- *          黺headָֽڣжǷ0xAA(SYN_FLAG)
- *          ǣ黺ĳǷڵ8
- *          򷵻أǣȡֽڱǺͳϢУϢ
- *          УͣУֵǷƥ䣬
- */
-static int ricmd_handle_sync(struct tls_uart *uart,
-                             struct tls_uart_circ_buf *recv)
+static u32 ricmd_crc32(psCrcContext_t *ctx, u8 *buf, u32 len)
 {
-#if 0
-    int numbytes;
-    u8 type;
-    u8 sn, flag, dest;
-    u8 orgi_crc8, new_crc8;
-    u32 frm_len;
-    u32 count;
-    u32 skip_count = 0;
-    u32 head = recv->head;
-    int i;
-
-    if (!(port->inputstate & INS_SYNC_CHAR))
-    {
-    /* ϴνյݣûSYNҪȴ */
-        if (recv->buf[recv->head] == RICMD_SYNC_FLAG)
-        {
-            numbytes = CIRC_CNT(recv->head, recv->tail, TLS_UART_RX_BUF_SIZE);
-            if (numbytes < 8)
-            {
-            /* Ȳ */
-                skip_count = 0;
-                return skip_count;
-            }
-            else
-            {
-                if ((TLS_UART_RX_BUF_SIZE - recv->head) >= 8)
-                    MEMCPY(&port->sync_header[0], &recv->buf[recv->head], 8);
-                else
-                {
-                    count = TLS_UART_RX_BUF_SIZE - recv->head;
-                    MEMCPY(port->sync_header, &recv->buf[recv->head], count);
-                    MEMCPY(recv->sync_header + count, recv->buf, 8 - count);
-                }
-            /* skip sync flag */
-                recv->head = (recv->head + 1) & (TLS_UART_RX_BUF_SIZE - 1);
-            /* ricmd type */
-                type = recv->buf[recv->head];
-                recv->head = (recv->head + 1) & (TLS_UART_RX_BUF_SIZE - 1);
-
-            /* data length */
-                if (recv->head == (TLS_UART_RX_BUF_SIZE - 1))
-                {
-                    frm_len = recv->buf[recv->head] << 8 | recv->buf[0];
-                }
-                else
-                {
-                    frm_len = recv->buf[recv->head] << 8 |
-                        recv->buf[recv->head + 1];
-                }
-                recv->head = (recv->head + 2) & (TLS_UART_RX_BUF_SIZE - 1);
-
-            /* ricmd sn */
-                sn = recv->buf[recv->head];
-                recv->head = (recv->head + 1) & (TLS_UART_RX_BUF_SIZE - 1);
-            /* ricmd flag */
-                flag = recv->buf[recv->head];
-                recv->head = (recv->head + 1) & (TLS_UART_RX_BUF_SIZE - 1);
-            /* ricmd dest */
-                dest = recv->buf[recv->head];
-                port->ricmd_info.dest = dest;
-                recv->head = (recv->head + 1) & (TLS_UART_RX_BUF_SIZE - 1);
-            /* ricmd crc */
-                orig_crc8 = recv->buf[recv->head];
-                recv->head = (recv->head + 1) & (TLS_UART_RX_BUF_SIZE - 1);
+    u32 crc;
 
-#if 0
-            /* check for crc */
-                new_crc8 = get_crc8(&inbuf->sync_header[1], 3);
-                skip_count++;
+    tls_crypto_crc_update(ctx, buf, len);
+    tls_crypto_crc_final(ctx, &crc);
+    return crc ^ 0xFFFFFFFF;
+}
 
-                TLS_DBGPRT_INFO
-                    ("recevied crc value = 0x%x, check crc value = %x\n",
-                     orgi_crc8, new_crc8);
-#endif
+static void ricmd_put_be32(u8 *p, u32 v)
+{
+    p[0] = (u8)(v >> 24);
+    p[1] = (u8)(v >> 16);
+    p[2] = (u8)(v >> 8);
+    p[3] = (u8)v;
+}
 
-                new_crc8 = orig_crc8;
-                if (orgi_crc8 == new_crc8)
-                {
-                    port->inputstate |= INS_SYNC_CHAR;
-                    switch (type)
-                    {
-                        case 0x0:
-                            port->inputstate |= INS_CMD;
-                            break;
-                        case 0x1:
-                            port->inputstate |= INS_DATA;
-                            break;
-                        default:
-                            data->inputstate |= INS_RAW;
-                            break;
-                    }
-                    port->ricmd_info.length = frm_len;
-                    TLS_DBGPRT_INFO("data length = %d\n", frm_len);
+static void ricmd_seal_hdr(struct tls_hostif_hdr *hdr)
+{
+    hdr->flag |= RICMD_FLAG_CRC;
+    hdr->chk = get_crc8(&hdr->type, 6);
+}
 
-                }
-                else
-                {
-                    TLS_DBGPRT_INFO("crc check failed, drop the char\n");
-                /* crc 󣬺յַַ */
-                }
-            }
-        }
-        else
-        {
-        /* regular data byte */
-            skip_count = 1;
-            return skip_count;
-        }
+/* sends a frame built by the RI command handlers, anything else as it is */
+static void ricmd_fill_frame(struct tls_uart *uart, char *buf, u32 buflen)
+{
+    struct tls_hostif_hdr *hdr = (struct tls_hostif_hdr *) buf;
+    psCrcContext_t ctx;
+    u8 trailer[4];
+
+    if ((buflen < sizeof(struct tls_hostif_hdr))
+        || (hdr->sync != RICMD_SYNC_FLAG)
+        || (be_to_host16(hdr->length) != buflen - sizeof(struct tls_hostif_hdr)))
+    {
+        tls_uart_fill_buf(uart->uart_port, buf, buflen);
+        return;
     }
 
-    return skip_count;
-#endif
-    return 0;
+    ricmd_seal_hdr(hdr);
+    tls_crypto_crc_init(&ctx, 0xFFFFFFFF, CRYPTO_CRC_TYPE_32, INPUT_REFLECT | OUTPUT_REFLECT);
+    ricmd_put_be32(trailer, ricmd_crc32(&ctx, (u8 *) buf + sizeof(struct tls_hostif_hdr),
+                                        buflen - sizeof(struct tls_hostif_hdr)));
+    tls_uart_fill_buf(uart->uart_port, buf, buflen);
+    tls_uart_fill_buf(uart->uart_port, (char *) trailer, sizeof(trailer));
 }
 
-static int data_loop(struct tls_uart *uart,
-                     int numbytes, struct tls_uart_circ_buf *recv)
+static void ricmd_send_ack(struct tls_uart *uart)
 {
-
-    return 0;
+    struct tls_uart_circ_buf *recv = &uart->uart_port->recv;
+    u8 frm[sizeof(struct tls_hostif_hdr) + 2];
+    struct tls_hostif_hdr *hdr = (struct tls_hostif_hdr *) frm;
+    u16 window;
+
+    window = CIRC_SPACE(recv->head, recv->tail, TLS_UART_RX_BUF_SIZE);
+    hdr->sync = RICMD_SYNC_FLAG;
+    hdr->type = PACKET_TYPE_ACK;
+    hdr->length = host_to_be16(2);
+    hdr->seq_num = uart->ricmd_info.rx_seq - 1;
+    hdr->flag = 0;
+    hdr->dest_addr = 0;
+    frm[sizeof(struct tls_hostif_hdr)] = (u8)(window >> 8);
+    frm[sizeof(struct tls_hostif_hdr) + 1] = (u8) window;
+
+    uart->ricmd_info.ack = 0;
+    ricmd_fill_frame(uart, (char *) frm, sizeof(frm));
+    tls_uart_tx_chars_start(uart->uart_port);
 }
 
-#define MAX_RICMD_LENGTH      200
-//u8 ricmd_buffer[MAX_RICMD_LENGTH + 8];
-u8 *ricmd_buffer = NULL;
+/* copies len bytes at offset from the read position of the receive ring */
+static void ricmd_copy(struct tls_uart_circ_buf *recv, u32 offset, u8 *dst, u32 len)
+{
+    u32 pos = (recv->tail + offset) & (TLS_UART_RX_BUF_SIZE - 1);
+    u32 n = TLS_UART_RX_BUF_SIZE - pos;
 
-static int cmd_loop(struct tls_uart *uart,
-                    int numbytes, struct tls_uart_circ_buf *recv)
+    if (n >= len)
+    {
+        MEMCPY(dst, (u8 *) &recv->buf[pos], len);
+    }
+    else
+    {
+        MEMCPY(dst, (u8 *) &recv->buf[pos], n);
+        MEMCPY(dst + n, (u8 *) &recv->buf[0], len - n);
+    }
+}
+
+#if TLS_CONFIG_SOCKET_RAW || TLS_CONFIG_SOCKET_STD
+/* sends the data frame to its socket, ERR_MEM when lwip has no room for it yet */
+static int ricmd_net_send(struct tls_hostif_hdr *hdr, u8 *payload, u32 len)
 {
-    unsigned cbytes = uart->ricmd_info.cbytes;
-    unsigned procbytes = 0;
-    unsigned char c;
+    struct tls_hostif_socket_info skt_info;
+    struct tls_hostif_ricmd_ext_hdr *ext_hdr;
+
+    memset(&skt_info, 0, sizeof(skt_info));
+    skt_info.socket = hdr->dest_addr & 0x3F;
+    skt_info.proto = (hdr->dest_addr & 0xC0) >> 6;
+    if (skt_info.proto == 1)
+    {
+    /* udp */
+        if (len < sizeof(struct tls_hostif_ricmd_ext_hdr))
+            return 0;
+        ext_hdr = (struct tls_hostif_ricmd_ext_hdr *) payload;
+        skt_info.remote_ip = ext_hdr->remote_ip;
+        skt_info.remote_port = ext_hdr->remote_port;
+        skt_info.local_port = ext_hdr->local_port;
+        skt_info.socket = 0;
+        payload += sizeof(struct tls_hostif_ricmd_ext_hdr);
+        len -= sizeof(struct tls_hostif_ricmd_ext_hdr);
+    }
+
+    return tls_hostif_send_data(&skt_info, (char *) payload, len);
+}
 
-	if (ricmd_buffer == NULL)
-	{
-		ricmd_buffer = tls_mem_alloc(MAX_RICMD_LENGTH + 8);
-		if (ricmd_buffer == NULL)
-		{
-			return -1;
-		}
-		memset(ricmd_buffer, 0, (MAX_RICMD_LENGTH + 8));
-	}
+/* socket data to the host as a data frame, the pbuf is queued as it is */
+static void ricmd_send_data(struct tls_uart *uart, struct tls_hostif_tx_msg *tx_msg)
+{
+    struct tls_hostif *hif = tls_get_hostif();
+    struct pbuf *p = (struct pbuf *) tx_msg->u.msg_tcp.p;
+    u8 head[sizeof(struct tls_hostif_hdr) + sizeof(struct tls_hostif_extaddr)];
+    struct tls_hostif_hdr *hdr = (struct tls_hostif_hdr *) head;
+    struct tls_hostif_extaddr *extaddr;
+    u8 skt_num = tx_msg->u.msg_tcp.sock;
+    u32 head_size = sizeof(struct tls_hostif_hdr);
+    tls_uart_tx_msg_t *uart_tx_msg;
+    psCrcContext_t ctx;
+    u8 trailer[4];
+    u32 cpu_sr;
 
-    while (procbytes < numbytes)
+    if (tx_msg->type == HOSTIF_TX_MSG_TYPE_UDP)
     {
-        c = recv->head;
-        procbytes++;
+        skt_num = skt_num | (1 << 6);
+        extaddr = (struct tls_hostif_extaddr *) (head + sizeof(struct tls_hostif_hdr));
+        extaddr->ip_addr = ip_addr_get_ip4_u32(&tx_msg->u.msg_udp.ip_addr);
+        extaddr->remote_port = host_to_be16(tx_msg->u.msg_udp.port);
+        extaddr->local_port = host_to_be16(tx_msg->u.msg_udp.localport);
+        head_size += sizeof(struct tls_hostif_extaddr);
+    }
+    tls_hostif_fill_hdr(hif, hdr, PACKET_TYPE_DATA,
+                        head_size - sizeof(struct tls_hostif_hdr) + p->tot_len, 0, skt_num, 0);
+    ricmd_seal_hdr(hdr);
 
-    /* append to line buffer if possible */
-        if (cbytes < MAX_RICMD_LENGTH)
-            ricmd_buffer[8 + cbytes] = c;
-        uart->ricmd_info.cbytes++;
+    tls_crypto_crc_init(&ctx, 0xFFFFFFFF, CRYPTO_CRC_TYPE_32, INPUT_REFLECT | OUTPUT_REFLECT);
+    tls_crypto_crc_update(&ctx, head + sizeof(struct tls_hostif_hdr),
+                          head_size - sizeof(struct tls_hostif_hdr));
+    ricmd_put_be32(trailer, ricmd_crc32(&ctx, p->payload, p->tot_len));
 
-        if (uart->ricmd_info.cbytes == uart->ricmd_info.length)
-        {
-            tls_hostif_cmd_handler(HOSTIF_UART1_RI_CMD,
-                                   (char *) ricmd_buffer,
-                                   uart->ricmd_info.length + 8);
-            uart->ricmd_info.cbytes = 0;
-            uart->inputstate = 0;
-            break;
-        }
+    uart_tx_msg = tls_mem_alloc(sizeof(tls_uart_tx_msg_t));
+    if ((uart_tx_msg == NULL)
+        || tls_uart_fill_buf(uart->uart_port, (char *) head, head_size))
+    {
+        if (uart_tx_msg)
+            tls_mem_free(uart_tx_msg);
+        uart_tx_socket_finish_callback(p);
+        return;
     }
-    return procbytes;
+    dl_list_init(&uart_tx_msg->list);
+    uart_tx_msg->buf = p->payload;
+    uart_tx_msg->buflen = p->tot_len;
+    uart_tx_msg->offset = 0;
+    uart_tx_msg->finish_callback = uart_tx_socket_finish_callback;
+    uart_tx_msg->callback_arg = p;
+
+    cpu_sr = tls_os_set_critical();
+    dl_list_add_tail(&uart->uart_port->tx_msg_pending_list,
+                     &uart_tx_msg->list);
+    tls_os_release_critical(cpu_sr);
+    tls_uart_fill_buf(uart->uart_port, (char *) trailer, sizeof(trailer));
+    tls_uart_tx_chars_start(uart->uart_port);
 }
+#endif
 
 void parse_ricmd_line(struct tls_uart *uart)
 {
     struct tls_uart_circ_buf *recv = &uart->uart_port->recv;
-    int skip_count;
-    int numbytes;
-    int procbytes;
+    struct uart_ricmd_info *ri = &uart->ricmd_info;
+    struct tls_hostif_hdr hdr;
+    psCrcContext_t ctx;
+    u32 count, len, frm_len;
+    u8 trailer[4];
+    u8 *frm;
+    int err;
 
-    while (!uart_circ_empty(recv))
+    while ((count = CIRC_CNT(recv->head, recv->tail, TLS_UART_RX_BUF_SIZE))
+           >= sizeof(struct tls_hostif_hdr))
     {
-    /* check for frame header */
-        skip_count = ricmd_handle_sync(uart, recv);
-        if ((skip_count == 0) && !(uart->inputstate & INS_SYNC_CHAR))
-            break;
+        if (recv->buf[recv->tail] != RICMD_SYNC_FLAG)
+        {
+            recv->tail = (recv->tail + 1) & (TLS_UART_RX_BUF_SIZE - 1);
+            continue;
+        }
 
-        if (uart->inputstate & INS_SYNC_CHAR)
+        ricmd_copy(recv, 0, (u8 *) &hdr, sizeof(hdr));
+        len = be_to_host16(hdr.length);
+        if ((hdr.chk != get_crc8(&hdr.type, 6)) || (len > RICMD_FRM_MAX_LEN))
         {
-        /* process a contiguous block of bytes */
-            numbytes = CIRC_CNT(recv->head, recv->tail, TLS_UART_RX_BUF_SIZE);
+        /* not a header, look for the next sync byte */
+            recv->tail = (recv->tail + 1) & (TLS_UART_RX_BUF_SIZE - 1);
+            continue;
+        }
+        frm_len = sizeof(hdr) + len + ((hdr.flag & RICMD_FLAG_CRC) ? 4 : 0);
+        if (count < frm_len)
+            break;
 
-            if (uart->inputstate & INS_RICMD)
-                procbytes = cmd_loop(uart, numbytes, recv);
-            else if (uart->inputstate & INS_DATA)
-                procbytes = data_loop(uart, numbytes, recv);
-            else
-                procbytes = numbytes;
+    /* frames are handled in place, only one wrapping around the ring is copied */
+        if (recv->tail + frm_len <= TLS_UART_RX_BUF_SIZE)
+        {
+            frm = (u8 *) &recv->buf[recv->tail];
         }
         else
         {
-        /* ûҪ(һַSYNC_FLAG)ǰİѾ
-         */
-            procbytes = skip_count;
+            if (ri->buf == NULL)
+            {
+                ri->buf = tls_mem_alloc(sizeof(hdr) + RICMD_FRM_MAX_LEN + 4);
+                if (ri->buf == NULL)
+                    break;
+            }
+            ricmd_copy(recv, 0, ri->buf, frm_len);
+            frm = ri->buf;
+        }
+
+        if (hdr.flag & RICMD_FLAG_CRC)
+        {
+            tls_crypto_crc_init(&ctx, 0xFFFFFFFF, CRYPTO_CRC_TYPE_32, INPUT_REFLECT | OUTPUT_REFLECT);
+            ricmd_put_be32(trailer, ricmd_crc32(&ctx, frm + sizeof(hdr), len));
+            if (memcmp(trailer, frm + sizeof(hdr) + len, 4))
+            {
+                ri->ack = 1;
+                goto next;
+            }
         }
-        recv->head = (recv->head + procbytes) & (TLS_UART_RX_BUF_SIZE - 1);
+
+        if (hdr.type == PACKET_TYPE_ACK)
+        {
+        /* frames to the host are not resent */
+            goto next;
+        }
+        if (!(hdr.flag & RICMD_FLAG_RESET) && (hdr.seq_num != ri->rx_seq))
+        {
+        /* repeated or out of order */
+            ri->ack = 1;
+            goto next;
+        }
+
+        if (hdr.type == PACKET_TYPE_RI_CMD)
+        {
+            tls_hostif_cmd_handler(HOSTIF_UART1_RI_CMD, (char *) frm, sizeof(hdr) + len);
+        }
+#if TLS_CONFIG_SOCKET_RAW || TLS_CONFIG_SOCKET_STD
+        else if (hdr.type == PACKET_TYPE_DATA)
+        {
+            err = ricmd_net_send(&hdr, frm + sizeof(hdr), len);
+            if (err == ERR_MEM)
+            {
+            /* retried later, the window closes while it is not acknowledged */
+                tls_wl_task_untimeout(&wl_task_param_hostif, uart_rx_timeout_handler, uart);
+                tls_wl_task_add_timeout(&wl_task_param_hostif, uart1_delaytime, uart_rx_timeout_handler, uart);
+                break;
+            }
+        }
+#endif
+        ri->rx_seq = hdr.seq_num + 1;
+        ri->ack = 1;
+next:
+        recv->tail = (recv->tail + frm_len) & (TLS_UART_RX_BUF_SIZE - 1);
     }
 
-    return;
+    /* one cumulative ACK for everything taken in this pass */
+    if (ri->ack)
+        ricmd_send_ack(uart);
 }
 
 #define UART_UPFW_DATA_SIZE sizeof(struct tls_fwup_block)
@@ -1454,12 +1623,19 @@ void uart_rx_timeout_handler(void * arg)
 	if (uart->cmd_mode == UART_TRANS_MODE)
     {
         data_cnt = CIRC_CNT(recv->head, recv->tail, TLS_UART_RX_BUF_SIZE);
+#if TLS_CONFIG_CMD_USE_RAW_SOCKET
+        data_cnt -= uart_net_release(uart);
+#endif
 
         if (data_cnt)
         {
-            uart_net_send(uart, recv->head, recv->tail, data_cnt);
+            uart_net_forward(uart, data_cnt);
         }
     }
+    else if (uart->cmd_mode == UART_RICMD_MODE)
+    {
+        parse_ricmd_line(uart);
+    }
 }
 #endif
 void uart_rx(struct tls_uart *uart)
@@ -1473,10 +1649,20 @@ void uart_rx(struct tls_uart *uart)
     u8 len = 0;
     char *cmd_rsp = NULL;
 //TLS_DBGPRT_INFO("port->cmd_mode=%d\r\n", port->cmd_mode);
+#if TLS_CONFIG_CMD_USE_RAW_SOCKET
+    /* after +++ the commands are parsed once the data lent before them is acked */
+    if (uart_net_release(uart) && uart->cmd_mode != UART_TRANS_MODE)
+    {
+        return;
+    }
+#endif
 #if TLS_CONFIG_SOCKET_RAW || TLS_CONFIG_SOCKET_STD
     if (uart->cmd_mode == UART_TRANS_MODE)
     {
         data_cnt = CIRC_CNT(recv->head, recv->tail, TLS_UART_RX_BUF_SIZE);
+#if TLS_CONFIG_CMD_USE_RAW_SOCKET
+        data_cnt -= uart->net_lent;
+#endif
         if (data_cnt >= UART_NET_SEND_DATA_SIZE)
         {
             send_data = 1;
@@ -1490,7 +1676,7 @@ void uart_rx(struct tls_uart *uart)
 
         if (send_data)
         {
-            uart_net_send(uart, recv->head, recv->tail, data_cnt);
+            uart_net_forward(uart, data_cnt);
         }
     }
     else
@@ -1602,8 +1788,12 @@ void uart_tx(struct uart_tx_msg *tx_data)
             tls_os_release_critical(cpu_sr);
         // }
 #endif
-            tls_uart_fill_buf(uart->uart_port, tx_msg->u.msg_event.buf,
-                              tx_msg->u.msg_event.buflen);
+            if (uart->cmd_mode == UART_RICMD_MODE)
+                ricmd_fill_frame(uart, tx_msg->u.msg_event.buf,
+                                 tx_msg->u.msg_event.buflen);
+            else
+                tls_uart_fill_buf(uart->uart_port, tx_msg->u.msg_event.buf,
+                                  tx_msg->u.msg_event.buflen);
             uart_tx_event_finish_callback(tx_msg->u.msg_event.buf);
             tls_uart_tx_chars_start(uart->uart_port);
             break;
@@ -1611,7 +1801,11 @@ void uart_tx(struct uart_tx_msg *tx_data)
         // Tcp and Udp both use the below case.
         case HOSTIF_TX_MSG_TYPE_UDP:
         case HOSTIF_TX_MSG_TYPE_TCP:
-            if (uart->cmd_mode == UART_TRANS_MODE || hif->rptmode)
+            if (uart->cmd_mode == UART_RICMD_MODE)
+            {
+                ricmd_send_data(uart, tx_msg);
+            }
+            else if (uart->cmd_mode == UART_TRANS_MODE || hif->rptmode)
             {
             // if (uart_circ_chars_pending(&uart->uart_port->xmit) > 4000) {
             // return;
@@ -18,17 +18,29 @@
 #include "wm_cmdp.h"
 #include "wm_uart.h"
 #include "wm_osal.h"
-#define INS_SYNC_CHAR       0x01
-#define INS_RICMD           0x02
-#define INS_DATA            0x04
-
 #define RICMD_SYNC_FLAG     0xAA
 
+/*
+ * RI mode frames: struct tls_hostif_hdr (chk is the crc8 of the six bytes after
+ * sync), "length" bytes of payload and, with RICMD_FLAG_CRC, the CRC-32 of the
+ * payload, big endian. Data frames carry the socket in dest_addr as over HSPI,
+ * for udp the payload starts with struct tls_hostif_ricmd_ext_hdr.
+ *
+ * Frames from the host are numbered by seq_num and acknowledged with
+ * PACKET_TYPE_ACK frames: seq_num is the last frame taken in order and the two
+ * byte payload the free receive window in bytes. A frame that is out of order
+ * or fails its CRC is dropped and the last good one acknowledged again, the host
+ * then resends from there.
+ */
+#define RICMD_FLAG_CRC      0x01
+#define RICMD_FLAG_RESET    0x02    /* sequence restarts at this frame */
+
+#define RICMD_FRM_MAX_LEN   1600    /* payload */
+
 struct uart_ricmd_info {
-    u8  sync_head[20];
-    u32 cbytes;
-    u16 length;
-    u8  dest;
+    u8  rx_seq;                     /* sequence number expected next */
+    u8  ack;                        /* an ACK is due */
+    u8 *buf;                        /* a frame wrapping around the receive ring */
 };
 
 typedef struct tls_uart{
@@ -49,6 +61,11 @@ typedef struct tls_uart{
 	void (*tx_cb)(struct tls_uart *uart);
 	struct uart_ricmd_info ricmd_info;
 	u16 sksnd_cnt;
+	/** transparent mode: bytes after the ring tail lent to lwip, not acked yet */
+	u32 net_lent;
+	/** acked by the tcpip thread, given back to the ring by uart_rx() */
+	u32 net_acked;
+	u8  net_lost;
 } tls_uart_t;
 
 struct tls_uart *tls_uart_open(u32 uart_no, TLS_UART_MODE_T uart_mode);
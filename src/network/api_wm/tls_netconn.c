@@ -128,6 +128,44 @@ static struct tls_netconn *net_alloc_socket(struct tls_netconn *conn)
 //    return NULL;
 }
 
+/* data sent by tls_socket_send_ref() is still referenced by the pcb */
+static bool net_tcp_ref_pending(struct tls_netconn *conn)
+{
+    return conn->ref_acked != NULL && conn->ref_unacked != 0;
+}
+
+/* the owner of the referenced data gets its memory back */
+static void net_tcp_ref_release(struct tls_netconn *conn)
+{
+    socket_acked_fn acked = conn->ref_acked;
+
+    if (acked)
+    {
+        conn->ref_acked = NULL;
+        conn->ref_unacked = 0;
+        acked(conn->skt_num, 0, conn->ref_arg);
+    }
+}
+
+/**
+ * a pcb still holding referenced data is aborted: after tcp_close() lwip
+ * would keep retransmitting from memory its owner is reusing.
+ * returns ERR_ABRT if so, a callback then has to return ERR_ABRT to lwip.
+ */
+static err_t net_tcp_close_pcb(struct tls_netconn *conn, struct tcp_pcb *pcb)
+{
+    if (net_tcp_ref_pending(conn))
+    {
+        net_tcp_ref_release(conn);
+        tcp_arg(pcb, NULL);
+        tcp_err(pcb, NULL);
+        tcp_abort(pcb);
+        return ERR_ABRT;
+    }
+    net_tcp_ref_release(conn);
+    return tcp_close(pcb);
+}
+
 static void net_free_socket(int socketno)
 {
 	int index;
@@ -158,9 +196,10 @@ static void net_free_socket(int socketno)
 	index = conn->skt_num - 1;//TLS_MAX_NETCONN_NUM - 
 	if (conn->pcb.tcp)
 	{
-		tcp_close(conn->pcb.tcp);
+		net_tcp_close_pcb(conn, conn->pcb.tcp);
 		conn->pcb.tcp = NULL;
 	}
+	net_tcp_ref_release(conn);
 	tls_mem_free(conn);
 	cpu_sr = tls_os_set_critical();
 	conn = NULL;
@@ -205,8 +244,10 @@ static void net_tcp_close_connect(int socketno)
         tcp_poll(conn->pcb.tcp, NULL, 4);
         tcp_err(conn->pcb.tcp, NULL);
     }
-    err = tcp_close(conn->pcb.tcp);
-    if (err)
+    err = net_tcp_close_pcb(conn, conn->pcb.tcp);
+    if (err == ERR_ABRT)
+        err = ERR_OK;
+    else if (err)
         err = tcp_shutdown(conn->pcb.tcp, 1, 1);
     if (err == ERR_OK) {
         /* Closing succeeded */
@@ -251,6 +292,10 @@ static err_t net_tcp_poll_cb(void *arg, struct tcp_pcb *pcb)
     if (conn->write_state && (conn->state == NETCONN_STATE_CONNECTED)) {
         //net_do_writemore(conn);
     } else if (conn->state == NETCONN_STATE_CLOSED) {
+        if (net_tcp_ref_pending(conn)) {
+            net_tcp_close_connect(socketno);
+            return ERR_ABRT;
+        }
         net_tcp_close_connect(socketno); 
     } else {
         if ((pcb->state == CLOSE_WAIT) || (pcb->state == CLOSED)) {
@@ -261,11 +306,13 @@ static err_t net_tcp_poll_cb(void *arg, struct tcp_pcb *pcb)
                 tcp_sent(conn->pcb.tcp, NULL);
                 tcp_poll(conn->pcb.tcp, NULL, 4);
                 tcp_err(conn->pcb.tcp, NULL);
-                tcp_close(conn->pcb.tcp);       
+                err_ret = net_tcp_close_pcb(conn, conn->pcb.tcp);
                 conn->state = NETCONN_STATE_NONE;
                 net_send_event_to_hostif(conn, NET_EVENT_TCP_DISCONNECT);
                 conn->pcb.tcp = NULL;
                 net_free_socket(socketno);
+                if (err_ret == ERR_ABRT)
+                    return ERR_ABRT;
             }
         }
     }
@@ -327,8 +374,10 @@ static void net_tcp_err_cb(void *arg, err_t err)
 		}
 		if(err == ERR_OK)
 		{
-	      tcp_close(pcb);
+	      net_tcp_close_pcb(conn, pcb);
 		}
+		/* otherwise lwip already freed the pcb and the data it referenced */
+		net_tcp_ref_release(conn);
 		if(conn->state != NETCONN_STATE_NONE)
 		{
            conn->state = NETCONN_STATE_NONE;
@@ -462,6 +511,10 @@ static err_t net_tcp_recv_cb(void *arg,
     if(p == NULL)
     {
         TLS_DBGPRT_ERR("received 0\n");
+        if (net_tcp_ref_pending(conn)) {
+            net_tcp_err_cb((void *)socketno, ERR_OK);
+            return ERR_ABRT;
+        }
         net_tcp_err_cb((void *)socketno, ERR_OK);
         return ERR_OK;
     }
@@ -586,6 +639,33 @@ static err_t net_tcp_sent_cb(void *arg, struct tcp_pcb *pcb, u16_t len)
 }
 #endif
 
+/**
+ * reports the acknowledged bytes of data sent by reference. what was queued
+ * by tls_socket_send() before the first tls_socket_send_ref() is skipped.
+ */
+static err_t net_tcp_ref_sent_cb(void *arg, struct tcp_pcb *pcb, u16_t len)
+{
+    struct tls_netconn *conn = NULL;
+    u32 skip;
+
+    conn = tls_net_get_socket((int)arg);
+    if (conn == NULL || TRUE != conn->used || conn->ref_acked == NULL)
+        return ERR_OK;
+
+    skip = len < conn->ref_skip ? len : conn->ref_skip;
+    conn->ref_skip -= skip;
+    len -= skip;
+    if (len > conn->ref_unacked)
+        len = conn->ref_unacked;
+    if (len)
+    {
+        conn->ref_unacked -= len;
+        conn->ref_acked(conn->skt_num, len, conn->ref_arg);
+    }
+
+    return ERR_OK;
+}
+
 /**
  * tcp connnect callback
  */
@@ -1108,6 +1188,74 @@ static void net_do_write(void *ctx)
 #endif
 }
 
+static void net_do_write_ref(void *ctx)
+{
+    struct tls_net_msg *net_msg = (struct tls_net_msg *)ctx;
+    struct tls_netconn *conn = NULL;
+    struct tcp_pcb *pcb;
+    u16 len;
+	int socketno = -1;
+
+    socketno = net_msg->skt_no;
+	conn = tls_net_get_socket(socketno);
+	if(conn == NULL ||TRUE != conn->used)
+	{
+		TLS_DBGPRT_ERR("\n conn=%x,used=%d\n", (u32)conn, conn->used);
+#if CONN_SEM_NOT_FREE
+        sys_sem_signal(&conn_op_completed[socketno - 1]);
+#endif		
+		return;
+	}
+
+    net_msg->write_offset = 0;
+    pcb = conn->pcb.tcp;
+    if (conn->state != NETCONN_STATE_CONNECTED) {
+        net_msg->err = ERR_INPROGRESS;
+    } else if (pcb == NULL) {
+        net_msg->err = ERR_CONN;
+    } else {
+        if (conn->ref_acked == NULL) {
+            /* bytes already queued by tls_socket_send() are acked first */
+            conn->ref_skip = pcb->snd_lbb - pcb->lastack;
+            conn->ref_unacked = 0;
+            tcp_sent(pcb, net_tcp_ref_sent_cb);
+        }
+        conn->ref_acked = net_msg->acked;
+        conn->ref_arg = net_msg->acked_arg;
+
+        len = net_msg->len < tcp_sndbuf(pcb) ? net_msg->len : tcp_sndbuf(pcb);
+        net_msg->err = ERR_OK;
+        if (len) {
+            /* no TCP_WRITE_FLAG_COPY, the segments point at the caller's data */
+            net_msg->err = tcp_write(pcb, net_msg->dataptr, len, 0);
+            if (net_msg->err == ERR_OK) {
+                conn->ref_unacked += len;
+                net_msg->write_offset = len;
+                tcp_output(pcb);
+            } else if (net_msg->err == ERR_MEM) {
+                /* out of segments, the caller retries on the next ack */
+                net_msg->err = ERR_OK;
+            }
+        }
+        if(conn->client && conn->idle_time > 0)
+        {
+            struct tls_netconn *server_conn = get_server_conn(conn);
+            if(server_conn)
+                conn->idle_time = server_conn->idle_time;
+        }
+    }
+
+#if CONN_SEM_NOT_FREE
+    sys_sem_signal(&conn_op_completed[socketno - 1]);
+#else
+	conn = tls_net_get_socket(socketno);
+	if(conn && TRUE == conn->used)
+	{
+		sys_sem_signal(&conn->op_completed);
+	}
+#endif
+}
+
 static void do_create_connect(void *ctx)
 {
     struct tls_net_msg *net_msg = (struct tls_net_msg *)ctx;
@@ -1675,6 +1823,41 @@ int tls_socket_send(u8 skt_num, void *pdata, u16 len)
     return err;
 }
 
+int tls_socket_send_ref(u8 skt_num, void *pdata, u16 len, socket_acked_fn acked, void *arg)
+{
+    struct tls_net_msg net_msg[1] = {0};
+    struct tls_netconn *conn;
+    err_t err;
+
+    if (skt_num < 1 || skt_num > TLS_MAX_NETCONN_NUM || acked == NULL)
+    {
+        return ERR_VAL;
+    }
+    conn = tls_net_get_socket(skt_num);
+    if (conn == NULL || TRUE != conn->used)
+    {
+        return ERR_VAL;
+    }
+    if (conn->proto != TLS_NETCONN_TCP || !conn->client)
+    {
+        return ERR_ARG;
+    }
+
+	dl_list_init(&net_msg->list);
+    net_msg->skt_no = skt_num;
+    net_msg->dataptr = pdata;
+    net_msg->len = len;
+    net_msg->acked = acked;
+    net_msg->acked_arg = arg;
+    net_msg->err = ERR_VAL;/* for debug : catch not set err */
+    err = netconn_msg(net_do_write_ref, net_msg, 0);
+    if (err)
+    {
+        return err;
+    }
+    return net_msg->write_offset;
+}
+
 int tls_net_init()
 {
     //int i;
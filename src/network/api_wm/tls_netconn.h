@@ -59,6 +59,11 @@ struct tls_netconn {
 	sys_sem_t op_completed;
 #endif
 	u32 idle_time;
+	/* data written by tls_socket_send_ref(), see net_tcp_ref_sent_cb() */
+	socket_acked_fn ref_acked;
+	void  *ref_arg;
+	u32    ref_skip;
+	u32    ref_unacked;
 	
 };
 
@@ -73,6 +78,8 @@ struct tls_net_msg {
     u32   write_offset;
     err_t err;
 	int skt_no;
+	socket_acked_fn acked;
+	void *acked_arg;
 };
 #if (RAW_SOCKET_USE_CUSTOM_PBUF)
 struct raw_sk_pbuf_custom{
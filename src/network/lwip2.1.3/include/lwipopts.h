@@ -107,7 +107,11 @@
 
 #define LWIP_RAW                        1
 #define LWIP_IGMP                       TLS_CONFIG_IGMP
-#define LWIP_RAND                   rand
+/* DRBG output, see tls_crypto_random_fast */
+extern unsigned int tls_crypto_random_u32(void);
+#define LWIP_RAND()                 ((u32_t)tls_crypto_random_u32())
+/* random initial sequence numbers instead of the tick based ones */
+#define LWIP_HOOK_TCP_ISN(local_ip, local_port, remote_ip, remote_port) LWIP_RAND()
 #define LWIP_SO_RCVTIMEO         1
 #define LWIP_SO_RCVBUF 			1
 #define LWIP_SO_SNDTIMEO                1
@@ -446,6 +446,10 @@ void tls_dhcps_stop(void)
 {
     DHCPS_Stop();
 }
+s8 tls_dhcps_set_pool_size(u16 num)
+{
+    return DHCPS_SetPoolSize(num);
+}
 
 INT8S tls_dnss_start(INT8U * DnsName)
 {
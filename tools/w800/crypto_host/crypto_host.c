@@ -0,0 +1,835 @@
+/*
+ * Host checks of the crypto engine wrappers, run against the register model of
+ * gpsec_model.c. On top of the vectors of the t-cryptconf demo this covers what the
+ * demo does not reach on the chip in reasonable time or at all: the DRBG output against
+ * an independent CTR_DRBG computation, runs longer than the 64KB length field, the job
+ * queue, and the Montgomery multiplier sessions behind the mbedtls ECP and RSA ports.
+ *
+ * Every buffer the driver hands to the engine must sit below 4GB, since the DMA
+ * address registers are 32 bit: the binary is not position independent, malloc is
+ * kept on the brk heap, and the checks run on a stack mapped with MAP_32BIT.
+ */
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+
+#include "wm_include.h"
+#include "wm_crypto_hard.h"
+#include "wm_crypto_hard_mbed.h"
+#include "mbedtls/aes.h"
+#include "mbedtls/bignum.h"
+#include "mbedtls/des.h"
+#include "mbedtls/ecp.h"
+#include "mbedtls/md5.h"
+#include "mbedtls/rsa.h"
+#include "mbedtls/sha1.h"
+#include "mbedtls/sha256.h"
+#include "gpsec_model.h"
+
+#define LONG_LEN            (3 * 65536 + 1000)     /* several runs of the engine, odd tail */
+#define PIECE_LEN           4096
+#define STACK_SIZE          (1024 * 1024)
+
+static unsigned int failures;
+static ucontext_t main_uc, test_uc;
+static int test_ret;
+
+static void check(const char *name, int ok)
+{
+    printf("%-24s %s\n", name, ok ? "ok" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+static u8 *host_alloc(u32 len)
+{
+    u8 *p = tls_mem_alloc(len);
+
+    if (p == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+/* deterministic filler, the checks compare two paths over the same data */
+static void fill(u8 *p, u32 len, u32 seed)
+{
+    u32 x = seed * 2654435761u + 1;
+
+    while (len--)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        *p++ = (u8)x;
+    }
+}
+
+static int host_rng(void *p_rng, unsigned char *out, size_t len)
+{
+    static u32 seed = 1;
+
+    fill(out, len, seed++);
+    return 0;
+}
+
+/* ---------------------------------------------------------------- DRBG */
+
+/* reference CTR_DRBG of SP 800-90A, AES-128 without derivation function */
+static struct
+{
+    u8 key[16];
+    u8 v[16];
+} ref;
+
+static void ref_keystream(u8 *out, u32 len)
+{
+    mbedtls_aes_sw_context aes;
+    u32 ctr;
+
+    mbedtls_aes_sw_init(&aes);
+    mbedtls_aes_sw_setkey_enc(&aes, ref.key, 128);
+    for (; len > 0; len -= 16, out += 16)
+    {
+        ctr = ((u32)ref.v[12] << 24) | ((u32)ref.v[13] << 16) | ((u32)ref.v[14] << 8) | ref.v[15];
+        ctr++;
+        ref.v[12] = (u8)(ctr >> 24);
+        ref.v[13] = (u8)(ctr >> 16);
+        ref.v[14] = (u8)(ctr >> 8);
+        ref.v[15] = (u8)ctr;
+        mbedtls_aes_sw_encrypt(&aes, ref.v, out);
+    }
+    mbedtls_aes_sw_free(&aes);
+}
+
+static void ref_update(const u8 *data)
+{
+    u8 temp[32];
+    int i;
+
+    ref_keystream(temp, 32);
+    if (data)
+    {
+        for (i = 0; i < 32; i++)
+            temp[i] ^= data[i];
+    }
+    memcpy(ref.key, temp, 16);
+    memcpy(ref.v, temp + 16, 16);
+}
+
+static void ref_generate(u8 *out, u32 len)
+{
+    ref_keystream(out, len);
+    ref_update(NULL);
+}
+
+/* must run before anything else draws from the DRBG, it checks the instantiation */
+static void check_drbg(void)
+{
+    u8 out[64], exp[64], pool[256], entropy[32];
+    u32 w;
+    int i, ok;
+
+    gpsec_model_trng_seed(0x0123456789ABCDEFULL);
+    tls_crypto_random_fast(out, 64);
+
+    gpsec_model_trng_seed(0x0123456789ABCDEFULL);
+    for (i = 0; i < 8; i++)
+    {
+        w = gpsec_model_trng_next();
+        memcpy(entropy + 4 * i, &w, 4);
+    }
+    memset(&ref, 0, sizeof(ref));
+    ref_update(entropy);
+    ref_generate(exp, 64);
+    check("drbg instantiate", memcmp(out, exp, 64) == 0);
+
+    tls_crypto_random_fast(out, 64);
+    ref_generate(exp, 64);
+    check("drbg generate", memcmp(out, exp, 64) == 0);
+
+    /* small requests come from the pool, one generate request fills it */
+    ref_generate(pool, sizeof(pool));
+    ok = 1;
+    for (i = 0; i < 4; i++)
+    {
+        tls_crypto_random_fast(out, 16);
+        ok &= memcmp(out, pool + 16 * i, 16) == 0;
+    }
+    check("drbg pool", ok);
+}
+
+/* ---------------------------------------------------------------- long runs */
+
+static void ref_aes(const u8 *key, const u8 *iv0, CRYPTO_MODE mode, CRYPTO_WAY way,
+                    const u8 *in, u8 *out, u32 len)
+{
+    mbedtls_aes_sw_context aes;
+    u8 iv[16], blk[16], ks[16];
+    u32 i, n, k;
+
+    mbedtls_aes_sw_init(&aes);
+    if (mode != CRYPTO_MODE_CTR && way == CRYPTO_WAY_DECRYPT)
+        mbedtls_aes_sw_setkey_dec(&aes, key, 128);
+    else
+        mbedtls_aes_sw_setkey_enc(&aes, key, 128);
+    memcpy(iv, iv0, 16);
+
+    for (i = 0; i < len; i += 16)
+    {
+        n = len - i < 16 ? len - i : 16;
+        memcpy(blk, in + i, n);
+        if (mode == CRYPTO_MODE_CTR)
+        {
+            mbedtls_aes_sw_encrypt(&aes, iv, ks);
+            for (k = 0; k < n; k++)
+                out[i + k] = blk[k] ^ ks[k];
+            for (k = 16; k-- > 0 && ++iv[k] == 0;)
+                ;
+        }
+        else if (way == CRYPTO_WAY_ENCRYPT)
+        {
+            if (mode == CRYPTO_MODE_CBC)
+                for (k = 0; k < 16; k++)
+                    blk[k] ^= iv[k];
+            mbedtls_aes_sw_encrypt(&aes, blk, out + i);
+            if (mode == CRYPTO_MODE_CBC)
+                memcpy(iv, out + i, 16);
+        }
+        else
+        {
+            mbedtls_aes_sw_decrypt(&aes, blk, out + i);
+            if (mode == CRYPTO_MODE_CBC)
+            {
+                for (k = 0; k < 16; k++)
+                    out[i + k] ^= iv[k];
+                memcpy(iv, blk, 16);
+            }
+        }
+    }
+    mbedtls_aes_sw_free(&aes);
+}
+
+static void ref_rc4(const u8 *key, int keylen, const u8 *in, u8 *out, u32 len)
+{
+    u8 s[256], t, i = 0, j = 0;
+    int k, l;
+
+    for (k = 0; k < 256; k++)
+        s[k] = k;
+    for (k = l = 0; k < 256; k++)
+    {
+        l = (l + s[k] + key[k % keylen]) & 0xFF;
+        t = s[k]; s[k] = s[l]; s[l] = t;
+    }
+    while (len--)
+    {
+        i++;
+        j += s[i];
+        t = s[i]; s[i] = s[j]; s[j] = t;
+        *out++ = *in++ ^ s[(u8)(s[i] + s[j])];
+    }
+}
+
+static void check_long_aes(const char *name, CRYPTO_MODE mode, const u8 *iv, u8 *in, u8 *out, u8 *exp)
+{
+    static const u8 key[16] = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+                               0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+    psCipherContext_t ctx;
+    u32 len = mode == CRYPTO_MODE_CTR ? LONG_LEN : LONG_LEN & ~15;
+    int ok;
+
+    tls_crypto_aes_init(&ctx, iv, key, 16, mode);
+    tls_crypto_aes_encrypt_decrypt(&ctx, in, out, len, CRYPTO_WAY_ENCRYPT);
+    ref_aes(key, iv, mode, CRYPTO_WAY_ENCRYPT, in, exp, len);
+    ok = memcmp(out, exp, len) == 0;
+
+    /* in place, the CBC decryption has to keep the next IV before the run overwrites it */
+    tls_crypto_aes_init(&ctx, iv, key, 16, mode);
+    tls_crypto_aes_encrypt_decrypt(&ctx, out, out, len, CRYPTO_WAY_DECRYPT);
+    ok &= memcmp(out, in, len) == 0;
+    check(name, ok);
+}
+
+/* DES has no software path here, the reference is the same call on short pieces with the IV chained by hand */
+static void check_long_des(const char *name, int triple, u8 *in, u8 *out, u8 *exp)
+{
+    static const u8 key[24] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                               0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01,
+                               0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23};
+    u8 iv[8] = {0x12, 0x34, 0x56, 0x78, 0x90, 0xab, 0xcd, 0xef};
+    psCipherContext_t ctx;
+    u32 len = LONG_LEN & ~7, i, n;
+    int ok;
+
+    if (triple)
+        tls_crypto_3des_init(&ctx, iv, key, 24, CRYPTO_MODE_CBC);
+    else
+        tls_crypto_des_init(&ctx, iv, key, 8, CRYPTO_MODE_CBC);
+    if (triple)
+        tls_crypto_3des_encrypt_decrypt(&ctx, in, out, len, CRYPTO_WAY_ENCRYPT);
+    else
+        tls_crypto_des_encrypt_decrypt(&ctx, in, out, len, CRYPTO_WAY_ENCRYPT);
+
+    for (i = 0; i < len; i += n)
+    {
+        n = len - i < PIECE_LEN ? len - i : PIECE_LEN;
+        if (triple)
+        {
+            tls_crypto_3des_init(&ctx, iv, key, 24, CRYPTO_MODE_CBC);
+            tls_crypto_3des_encrypt_decrypt(&ctx, in + i, exp + i, n, CRYPTO_WAY_ENCRYPT);
+        }
+        else
+        {
+            tls_crypto_des_init(&ctx, iv, key, 8, CRYPTO_MODE_CBC);
+            tls_crypto_des_encrypt_decrypt(&ctx, in + i, exp + i, n, CRYPTO_WAY_ENCRYPT);
+        }
+        memcpy(iv, exp + i + n - 8, 8);
+    }
+    ok = memcmp(out, exp, len) == 0;
+
+    memcpy(iv, "\x12\x34\x56\x78\x90\xab\xcd\xef", 8);
+    if (triple)
+    {
+        tls_crypto_3des_init(&ctx, iv, key, 24, CRYPTO_MODE_CBC);
+        tls_crypto_3des_encrypt_decrypt(&ctx, out, out, len, CRYPTO_WAY_DECRYPT);
+    }
+    else
+    {
+        tls_crypto_des_init(&ctx, iv, key, 8, CRYPTO_MODE_CBC);
+        tls_crypto_des_encrypt_decrypt(&ctx, out, out, len, CRYPTO_WAY_DECRYPT);
+    }
+    ok &= memcmp(out, in, len) == 0;
+    check(name, ok);
+}
+
+static void check_long_runs(void)
+{
+    static const u8 iv[16] = {0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+                              0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff};
+    /* the low counter word wraps inside the first run */
+    static const u8 ctr[16] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                               0x88, 0x99, 0xaa, 0xbb, 0xff, 0xff, 0xf0, 0x00};
+    static const u8 rc4_key[16] = "host rc4 key 128";
+    u8 *in = host_alloc(LONG_LEN);
+    u8 *out = host_alloc(LONG_LEN);
+    u8 *exp = host_alloc(LONG_LEN);
+    psCipherContext_t ctx;
+    psCrcContext_t crc;
+    psDigestContext_t md;
+    u8 hash[2][20];
+    u32 val[2], i, n;
+
+    fill(in, LONG_LEN, 70);
+
+    check_long_aes("long aes-ecb", CRYPTO_MODE_ECB, iv, in, out, exp);
+    check_long_aes("long aes-cbc", CRYPTO_MODE_CBC, iv, in, out, exp);
+    check_long_aes("long aes-ctr", CRYPTO_MODE_CTR, ctr, in, out, exp);
+    check_long_des("long des-cbc", 0, in, out, exp);
+    check_long_des("long 3des-cbc", 1, in, out, exp);
+
+    tls_crypto_rc4_init(&ctx, rc4_key, 16);
+    tls_crypto_rc4(&ctx, in, out, LONG_LEN);
+    ref_rc4(rc4_key, 16, in, exp, LONG_LEN);
+    check("long rc4", memcmp(out, exp, LONG_LEN) == 0);
+
+    tls_crypto_crc_init(&crc, 0xFFFFFFFF, CRYPTO_CRC_TYPE_32, OUTPUT_REFLECT | INPUT_REFLECT);
+    tls_crypto_crc_update(&crc, in, LONG_LEN);
+    tls_crypto_crc_final(&crc, &val[0]);
+    tls_crypto_crc_init(&crc, 0xFFFFFFFF, CRYPTO_CRC_TYPE_32, OUTPUT_REFLECT | INPUT_REFLECT);
+    for (i = 0; i < LONG_LEN; i += n)
+    {
+        n = LONG_LEN - i < 1001 ? LONG_LEN - i : 1001;
+        tls_crypto_crc_update(&crc, in + i, n);
+    }
+    tls_crypto_crc_final(&crc, &val[1]);
+    check("long crc32", val[0] == val[1]);
+
+    tls_crypto_sha1_init(&md);
+    tls_crypto_sha1_update(&md, in, LONG_LEN);
+    tls_crypto_sha1_final(&md, hash[0]);
+    mbedtls_sha1_ret(in, LONG_LEN, hash[1]);
+    check("long sha1", memcmp(hash[0], hash[1], 20) == 0);
+
+    tls_crypto_md5_init(&md);
+    tls_crypto_md5_update(&md, in, LONG_LEN);
+    tls_crypto_md5_final(&md, hash[0]);
+    tls_crypto_md5_init(&md);
+    for (i = 0; i < LONG_LEN; i += n)
+    {
+        n = LONG_LEN - i < 999 ? LONG_LEN - i : 999;
+        tls_crypto_md5_update(&md, in + i, n);
+    }
+    tls_crypto_md5_final(&md, hash[1]);
+    check("long md5", memcmp(hash[0], hash[1], 16) == 0);
+
+    tls_mem_free(in);
+    tls_mem_free(out);
+    tls_mem_free(exp);
+}
+
+/* ---------------------------------------------------------------- jobs */
+
+#define JOB_SEGS    3
+static const u32 job_seg_len[JOB_SEGS] = {4096, 65520, 1008};
+
+static u8 job_order[4];
+static int job_done;
+
+static void job_note(struct tls_crypto_job *job, void *arg)
+{
+    job_order[job_done++] = (u8)(uintptr_t)arg;
+}
+
+/* run a job over the three segments of in, each copied to its own buffer */
+static int job_cipher(struct tls_crypto_job *job, CRYPTO_METHOD method, CRYPTO_WAY way,
+                      psCipherContext_t *ctx, const u8 *in, u8 *out, u32 last_len)
+{
+    tls_crypto_sg_t sg[JOB_SEGS];
+    u8 *seg[JOB_SEGS];
+    u32 i, off = 0;
+    int ret;
+
+    for (i = 0; i < JOB_SEGS; i++)
+    {
+        sg[i].len = i == JOB_SEGS - 1 ? last_len : job_seg_len[i];
+        seg[i] = host_alloc(sg[i].len);
+        memcpy(seg[i], in + off, sg[i].len);
+        sg[i].in = seg[i];
+        /* the middle segment runs in place */
+        sg[i].out = i == 1 ? seg[i] : host_alloc(sg[i].len);
+        off += sg[i].len;
+    }
+
+    memset(job, 0, sizeof(*job));
+    job->method = method;
+    job->way = way;
+    job->ctx.cipher = ctx;
+    job->sg = sg;
+    job->sg_num = JOB_SEGS;
+    ret = tls_crypto_job_run(job);
+
+    for (i = 0, off = 0; i < JOB_SEGS; i++)
+    {
+        memcpy(out + off, sg[i].out, sg[i].len);
+        off += sg[i].len;
+        if (sg[i].out != seg[i])
+            tls_mem_free(sg[i].out);
+        tls_mem_free(seg[i]);
+    }
+    return ret == ERR_CRY_OK && job->status == ERR_CRY_OK ? (int)off : -1;
+}
+
+static void check_job_aes(const char *name, CRYPTO_MODE mode, u8 *in, u8 *out, u8 *exp)
+{
+    static const u8 key[16] = "job aes key 0123";
+    /* the counter carries out of the low 32 bits in the second segment */
+    static const u8 iv[16] = {0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80,
+                              0x90, 0xa0, 0xb0, 0xc0, 0xff, 0xff, 0xff, 0x00};
+    struct tls_crypto_job job;
+    psCipherContext_t ctx;
+    u32 last = mode == CRYPTO_MODE_CTR ? 1001 : job_seg_len[JOB_SEGS - 1];
+    u8 next_iv[16];
+    int len, ok;
+
+    tls_crypto_aes_init(&ctx, iv, key, 16, mode);
+    len = job_cipher(&job, CRYPTO_METHOD_AES, CRYPTO_WAY_ENCRYPT, &ctx, in, out, last);
+    ok = len > 0;
+    if (ok)
+    {
+        ref_aes(key, iv, mode, CRYPTO_WAY_ENCRYPT, in, exp, len);
+        ok = memcmp(out, exp, len) == 0;
+    }
+    /* the job leaves the IV for the data that follows in the context, see check_job_ctr_iv for CTR */
+    if (ok && mode == CRYPTO_MODE_CBC)
+    {
+        memcpy(next_iv, out + len - 16, 16);
+        ok = memcmp(ctx.aes.IV, next_iv, 16) == 0;
+        tls_crypto_aes_init(&ctx, iv, key, 16, mode);
+        ok &= job_cipher(&job, CRYPTO_METHOD_AES, CRYPTO_WAY_DECRYPT, &ctx, exp, out, last) == len &&
+             memcmp(out, in, len) == 0 && memcmp(ctx.aes.IV, next_iv, 16) == 0;
+    }
+    check(name, ok);
+}
+
+static void check_job_ctr_iv(u8 *in, u8 *out)
+{
+    static const u8 key[16] = "job aes key 0123";
+    static const u8 iv[16] = {0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80,
+                              0x90, 0xa0, 0xb0, 0xc0, 0xff, 0xff, 0xff, 0x00};
+    struct tls_crypto_job job;
+    psCipherContext_t ctx;
+    u8 tail[16], exp[16];
+    int len;
+
+    /* the counter left in the context continues the key stream: encrypting 16 more bytes
+       with it matches the block after the job in one long CTR run */
+    tls_crypto_aes_init(&ctx, iv, key, 16, CRYPTO_MODE_CTR);
+    len = job_cipher(&job, CRYPTO_METHOD_AES, CRYPTO_WAY_ENCRYPT, &ctx, in, out,
+                     job_seg_len[JOB_SEGS - 1]);
+    if (len < 0)
+    {
+        check("job aes-ctr iv", 0);
+        return;
+    }
+    fill(tail, 16, 5);
+    memcpy(in + len, tail, 16);
+    ref_aes(key, iv, CRYPTO_MODE_CTR, CRYPTO_WAY_ENCRYPT, in, out, len + 16);
+    memcpy(exp, out + len, 16);
+    tls_crypto_aes_init(&ctx, ctx.aes.IV, key, 16, CRYPTO_MODE_CTR);
+    tls_crypto_aes_encrypt_decrypt(&ctx, tail, tail, 16, CRYPTO_WAY_ENCRYPT);
+    check("job aes-ctr iv", memcmp(tail, exp, 16) == 0);
+}
+
+static void check_job_3des(u8 *in, u8 *out, u8 *exp)
+{
+    static const u8 key[24] = "job 3des key 0123456789a";
+    static const u8 iv[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    struct tls_crypto_job job;
+    psCipherContext_t ctx;
+    u8 next_iv[8];
+    int len, ok;
+
+    tls_crypto_3des_init(&ctx, iv, key, 24, CRYPTO_MODE_CBC);
+    len = job_cipher(&job, CRYPTO_METHOD_3DES, CRYPTO_WAY_ENCRYPT, &ctx, in, out, 1008);
+    ok = len > 0;
+    if (ok)
+    {
+        memcpy(next_iv, ctx.des3.IV, 8);
+        tls_crypto_3des_init(&ctx, iv, key, 24, CRYPTO_MODE_CBC);
+        tls_crypto_3des_encrypt_decrypt(&ctx, in, exp, len, CRYPTO_WAY_ENCRYPT);
+        ok = memcmp(out, exp, len) == 0 && memcmp(next_iv, out + len - 8, 8) == 0;
+    }
+    check("job 3des-cbc", ok);
+}
+
+/* the key stream runs on over the segments, and starts again from the key with the next job */
+static void check_job_rc4(u8 *in, u8 *out, u8 *exp)
+{
+    static const u8 key[32] = "job rc4 key, two hundred and 56";
+    struct tls_crypto_job job;
+    psCipherContext_t ctx;
+    int len, ok;
+
+    tls_crypto_rc4_init(&ctx, key, 32);
+    len = job_cipher(&job, CRYPTO_METHOD_RC4, CRYPTO_WAY_ENCRYPT, &ctx, in, out, 1001);
+    ok = len > 0;
+    if (ok)
+    {
+        ref_rc4(key, 32, in, exp, len);
+        ok = memcmp(out, exp, len) == 0;
+        ok &= job_cipher(&job, CRYPTO_METHOD_RC4, CRYPTO_WAY_ENCRYPT, &ctx, in, out, 1001) == len &&
+              memcmp(out, exp, len) == 0;
+    }
+    check("job rc4", ok);
+}
+
+static void check_job_digest(const char *name, CRYPTO_METHOD method, u8 *in)
+{
+    struct tls_crypto_job job;
+    tls_crypto_sg_t sg[3];
+    psDigestContext_t md;
+    u8 hash[2][20];
+    int hlen = method == CRYPTO_METHOD_SHA1 ? 20 : 16;
+    int ok;
+
+    if (method == CRYPTO_METHOD_SHA1)
+        tls_crypto_sha1_init(&md);
+    else
+        tls_crypto_md5_init(&md);
+    sg[0].in = in;
+    sg[0].len = 640;
+    sg[1].in = in + 640;
+    sg[1].len = 65472;
+    sg[2].in = in + 640 + 65472;
+    sg[2].len = 64;
+    sg[0].out = sg[1].out = sg[2].out = NULL;
+    memset(&job, 0, sizeof(job));
+    job.method = method;
+    job.ctx.md = &md;
+    job.sg = sg;
+    job.sg_num = 3;
+    ok = tls_crypto_job_run(&job) == ERR_CRY_OK;
+
+    /* the final takes the tail that did not fill a block */
+    if (method == CRYPTO_METHOD_SHA1)
+    {
+        tls_crypto_sha1_update(&md, in + 66176, 100);
+        tls_crypto_sha1_final(&md, hash[0]);
+        tls_crypto_sha1_init(&md);
+        tls_crypto_sha1_update(&md, in, 66276);
+        tls_crypto_sha1_final(&md, hash[1]);
+    }
+    else
+    {
+        tls_crypto_md5_update(&md, in + 66176, 100);
+        tls_crypto_md5_final(&md, hash[0]);
+        tls_crypto_md5_init(&md);
+        tls_crypto_md5_update(&md, in, 66276);
+        tls_crypto_md5_final(&md, hash[1]);
+    }
+    ok &= memcmp(hash[0], hash[1], hlen) == 0;
+
+    /* bytes buffered in the context can not go through a job */
+    if (method == CRYPTO_METHOD_SHA1)
+        tls_crypto_sha1_update(&md, in, 10);
+    else
+        tls_crypto_md5_update(&md, in, 10);
+    job.sg_num = 1;
+    ok &= tls_crypto_job_submit(&job) != ERR_CRY_OK;
+    check(name, ok);
+}
+
+static void check_job_crc(u8 *in)
+{
+    struct tls_crypto_job job;
+    tls_crypto_sg_t sg[3];
+    psCrcContext_t crc;
+    u32 val[2];
+    int ok, i;
+
+    tls_crypto_crc_init(&crc, 0xFFFF, CRYPTO_CRC_TYPE_16_CCITT, INPUT_REFLECT);
+    for (i = 0; i < 3; i++)
+    {
+        sg[i].in = in + 1000 * i;
+        sg[i].out = NULL;
+        sg[i].len = 999 - i;
+    }
+    memset(&job, 0, sizeof(job));
+    job.method = CRYPTO_METHOD_CRC;
+    job.ctx.crc = &crc;
+    job.sg = sg;
+    job.sg_num = 3;
+    ok = tls_crypto_job_run(&job) == ERR_CRY_OK;
+    tls_crypto_crc_final(&crc, &val[0]);
+
+    tls_crypto_crc_init(&crc, 0xFFFF, CRYPTO_CRC_TYPE_16_CCITT, INPUT_REFLECT);
+    for (i = 0; i < 3; i++)
+        tls_crypto_crc_update(&crc, sg[i].in, sg[i].len);
+    tls_crypto_crc_final(&crc, &val[1]);
+    check("job crc16", ok && val[0] == val[1]);
+}
+
+/* jobs submitted while the engine is busy run in order from the interrupt */
+static void check_job_queue(u8 *in, u8 *out)
+{
+    static const u8 key[16] = "queue key 012345";
+    struct tls_crypto_job job[3];
+    tls_crypto_sg_t sg[3];
+    psCipherContext_t ctx[3];
+    u8 exp[3 * 4096];
+    u32 cpu_sr;
+    int i, ok = 1;
+
+    job_done = 0;
+    cpu_sr = tls_os_set_critical();
+    for (i = 0; i < 3; i++)
+    {
+        tls_crypto_aes_init(&ctx[i], key, key, 16, CRYPTO_MODE_CBC);
+        sg[i].in = in + 4096 * i;
+        sg[i].out = out + 4096 * i;
+        sg[i].len = 4096;
+        memset(&job[i], 0, sizeof(job[i]));
+        job[i].method = CRYPTO_METHOD_AES;
+        job[i].way = CRYPTO_WAY_ENCRYPT;
+        job[i].ctx.cipher = &ctx[i];
+        job[i].sg = &sg[i];
+        job[i].sg_num = 1;
+        job[i].cb = job_note;
+        job[i].arg = (void *)(uintptr_t)(i + 1);
+        ok &= tls_crypto_job_submit(&job[i]) == ERR_CRY_OK;
+    }
+    /* nothing completes with the interrupt masked */
+    ok &= job_done == 0 && job[0].status == CRYPTO_JOB_PENDING;
+    tls_os_release_critical(cpu_sr);
+
+    ok &= job_done == 3 && job_order[0] == 1 && job_order[1] == 2 && job_order[2] == 3;
+    for (i = 0; i < 3; i++)
+    {
+        ok &= job[i].status == ERR_CRY_OK;
+        ref_aes(key, key, CRYPTO_MODE_CBC, CRYPTO_WAY_ENCRYPT, in + 4096 * i, exp + 4096 * i, 4096);
+    }
+    ok &= memcmp(out, exp, sizeof(exp)) == 0;
+
+    /* the queue has released the engine */
+    tls_crypto_aes_init(&ctx[0], key, key, 16, CRYPTO_MODE_CBC);
+    tls_crypto_aes_encrypt_decrypt(&ctx[0], in, out, 4096, CRYPTO_WAY_ENCRYPT);
+    ok &= memcmp(out, exp, 4096) == 0;
+    check("job queue", ok);
+}
+
+static void check_jobs(void)
+{
+    u8 *in = host_alloc(LONG_LEN);
+    u8 *out = host_alloc(LONG_LEN);
+    u8 *exp = host_alloc(LONG_LEN);
+
+    fill(in, LONG_LEN, 90);
+    check_job_aes("job aes-cbc", CRYPTO_MODE_CBC, in, out, exp);
+    check_job_aes("job aes-ctr", CRYPTO_MODE_CTR, in, out, exp);
+    check_job_ctr_iv(in, out);
+    check_job_3des(in, out, exp);
+    check_job_rc4(in, out, exp);
+    check_job_digest("job sha1", CRYPTO_METHOD_SHA1, in);
+    check_job_digest("job md5", CRYPTO_METHOD_MD5, in);
+    check_job_crc(in);
+    check_job_queue(in, out);
+
+    tls_mem_free(in);
+    tls_mem_free(out);
+    tls_mem_free(exp);
+}
+
+/* ---------------------------------------------------------------- Montgomery */
+
+static int check_mont_one(u32 bits)
+{
+    mbedtls_mpi N, A, B, X, R;
+    int i, ok = 1;
+
+    mbedtls_mpi_init(&N);
+    mbedtls_mpi_init(&A);
+    mbedtls_mpi_init(&B);
+    mbedtls_mpi_init(&X);
+    mbedtls_mpi_init(&R);
+
+    mbedtls_mpi_fill_random(&N, bits / 8, host_rng, NULL);
+    mbedtls_mpi_set_bit(&N, bits - 1, 1);
+    mbedtls_mpi_set_bit(&N, 0, 1);
+    if (tls_crypto_mbedtls_mont_open(&N) != 0)
+        ok = 0;
+
+    for (i = 0; ok && i < 8; i++)
+    {
+        mbedtls_mpi_fill_random(&A, bits / 8, host_rng, NULL);
+        mbedtls_mpi_mod_mpi(&A, &A, &N);
+        if (i == 0)
+            mbedtls_mpi_lset(&B, 0);
+        else if (i == 1)
+            mbedtls_mpi_sub_int(&B, &N, 1);
+        else if (i & 1)
+            mbedtls_mpi_copy(&B, &A);
+        else
+        {
+            mbedtls_mpi_fill_random(&B, bits / 8, host_rng, NULL);
+            mbedtls_mpi_mod_mpi(&B, &B, &N);
+        }
+        /* the square passes the same operand twice */
+        if (tls_crypto_mbedtls_mont_mulmod(&X, &A, (i & 1) && i > 1 ? &A : &B) != 0)
+        {
+            ok = 0;
+            break;
+        }
+        mbedtls_mpi_mul_mpi(&R, &A, &B);
+        mbedtls_mpi_mod_mpi(&R, &R, &N);
+        ok &= mbedtls_mpi_cmp_mpi(&X, &R) == 0;
+    }
+    tls_crypto_mbedtls_mont_close();
+
+    mbedtls_mpi_free(&N);
+    mbedtls_mpi_free(&A);
+    mbedtls_mpi_free(&B);
+    mbedtls_mpi_free(&X);
+    mbedtls_mpi_free(&R);
+    return ok;
+}
+
+static void check_mont(void)
+{
+    extern int host_fls_locked;
+    mbedtls_mpi N;
+
+    /* mbedtls_internal_ecp_free() closes after a failed open too */
+    mbedtls_mpi_init(&N);
+    mbedtls_mpi_lset(&N, 1000);
+    check("mont open even modulus", tls_crypto_mbedtls_mont_open(&N) != 0);
+    tls_crypto_mbedtls_mont_close();
+    check("mont close unopened", host_fls_locked == 0);
+    mbedtls_mpi_free(&N);
+
+    check("mont mulmod 256", check_mont_one(256));
+    check("mont mulmod 1024", check_mont_one(1024));
+    check("mont mulmod 2048", check_mont_one(2048));
+}
+
+/* ---------------------------------------------------------------- mbedtls */
+
+/* a rejected key length must not leave the previous key in use */
+static int check_aes_bad_key(void)
+{
+    mbedtls_aes_context ctx;
+    u8 key[32] = {0}, in[16] = {0}, out[16];
+    int ok;
+
+    mbedtls_aes_init(&ctx);
+    ok = mbedtls_aes_setkey_enc(&ctx, key, 128) == 0 &&
+         mbedtls_aes_crypt_ecb(&ctx, MBEDTLS_AES_ENCRYPT, in, out) == 0 &&
+         mbedtls_aes_setkey_enc(&ctx, key, 200) != 0 &&
+         mbedtls_aes_crypt_ecb(&ctx, MBEDTLS_AES_ENCRYPT, in, out) != 0 &&
+         mbedtls_aes_setkey_enc(&ctx, key, 256) == 0 &&
+         mbedtls_aes_crypt_ecb(&ctx, MBEDTLS_AES_ENCRYPT, in, out) == 0;
+    mbedtls_aes_free(&ctx);
+    return ok;
+}
+
+static void check_mbedtls(void)
+{
+    check("mbedtls aes", mbedtls_aes_self_test(0) == 0);
+    check("mbedtls aes bad key", check_aes_bad_key());
+    /* no mbedtls_arc4_self_test(), its 64 bit keys are below what the engine takes */
+    check("mbedtls des", mbedtls_des_self_test(0) == 0);
+    check("mbedtls md5", mbedtls_md5_self_test(0) == 0);
+    check("mbedtls sha1", mbedtls_sha1_self_test(0) == 0);
+    check("mbedtls sha256", mbedtls_sha256_self_test(0) == 0);
+    check("mbedtls mpi", mbedtls_mpi_self_test(0) == 0);
+    check("mbedtls ecp", mbedtls_ecp_self_test(0) == 0);
+    check("mbedtls rsa", mbedtls_rsa_self_test(0) == 0);
+}
+
+/* ---------------------------------------------------------------- main */
+
+static void run_checks(void)
+{
+    tls_crypto_init();
+
+    check_drbg();
+    test_ret = crypt_conform_demo();
+    check_long_runs();
+    check_jobs();
+    check_mont();
+    check_mbedtls();
+}
+
+int main(void)
+{
+    void *stack;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    mallopt(M_MMAP_MAX, 0);
+    if (gpsec_model_init() != 0)
+        return 2;
+
+    stack = mmap(NULL, STACK_SIZE, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+    if (stack == MAP_FAILED)
+    {
+        perror("stack");
+        return 2;
+    }
+    getcontext(&test_uc);
+    test_uc.uc_stack.ss_sp = stack;
+    test_uc.uc_stack.ss_size = STACK_SIZE;
+    test_uc.uc_link = &main_uc;
+    makecontext(&test_uc, run_checks, 0);
+    swapcontext(&main_uc, &test_uc);
+
+    if (test_ret != WM_SUCCESS)
+        failures++;
+    printf("host: %u failed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,843 @@
+/*
+ * Software model of the GPSEC and RSA register blocks, for running the crypto engine
+ * wrappers of platform/common/crypto on a Linux host.
+ *
+ * The register page is mapped at its address on the chip and kept inaccessible. Every
+ * access the driver makes faults, the handler opens the page and single steps the
+ * instruction, and the trap after it closes the page again and looks at what changed:
+ * a start in HR_CRYPTO_SEC_CTRL or RSACON runs the operation programmed into the
+ * registers and then calls CRYPTION_IRQHandler() or RSA_F_IRQHandler() on the same
+ * thread, the way the interrupt preempts the driver on the single core of the chip.
+ * tls_os_set_critical() masks that interrupt. The TRNG raises its interrupt from a
+ * timer while it is enabled and unmasked, and moves on to the next number once
+ * HR_CRYPTO_RNG_RESULT has been read.
+ *
+ * What the model knows about the engine is the driver's view of it: register layout,
+ * SEC_CFG encoding, word and byte order, IV and CRC register semantics, the Montgomery
+ * products of the multiplier. It catches regressions in the wrappers (run splitting,
+ * IV and counter chaining, digest and CRC state, Montgomery setup, job queue) but not
+ * a wrong assumption about the silicon; the on-target t-cryptconf run covers that.
+ *
+ * x86-64 Linux only, the single step uses the trap flag and the page fault error code.
+ */
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <ucontext.h>
+
+#include "wm_type_def.h"
+#include "wm_crypto_hard.h"
+#include "mbedtls/aes.h"
+#include "gpsec_model.h"
+
+extern void CRYPTION_IRQHandler(void);
+extern void RSA_F_IRQHandler(void);
+
+#define REG(off)            (*(volatile u32 *)(MODEL_REG_BASE + (off)))
+#define GPSEC(addr)         REG((addr) - MODEL_REG_BASE)
+
+#define RSA_XBUF            0x000
+#define RSA_YBUF            0x100
+#define RSA_MBUF            0x200
+#define RSA_DBUF            0x300
+#define RSA_CON             0x400
+#define RSA_MC              0x404
+#define RSA_N               0x408
+#define RSA_MAX_WORDS       64
+
+#define SEC_CTRL_START      0x1
+#define SEC_CTRL_CRC_CLEAR  0x4
+#define SEC_STS_DONE        0x10000
+
+#define TRNG_EN             (1 << 0)
+#define TRNG_INT_MASK       (1 << 6)
+#define TRNG_TICK_US        50
+
+#define EFLAGS_TF           0x100
+#define PF_WRITE            0x2
+
+static volatile sig_atomic_t irq_masked;
+static volatile sig_atomic_t irq_pending;
+static volatile sig_atomic_t trng_tick;
+static volatile sig_atomic_t trng_consumed = 1;
+static volatile sig_atomic_t trng_timer_on;
+
+/* set between the fault and the trap of an access */
+static uintptr_t access_addr;
+static int access_blocked_alarm;
+
+static uint64_t trng_state = 0x9E3779B97F4A7C15ULL;
+
+static struct
+{
+    u8 s[256];
+    u8 i;
+    u8 j;
+} rc4;
+
+static void model_fault(const char *fmt, ...)
+{
+    va_list ap;
+
+    fprintf(stderr, "gpsec model: ");
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    fprintf(stderr, "\n");
+    abort();
+}
+
+static void page_open(void)
+{
+    mprotect((void *)MODEL_REG_BASE, MODEL_REG_SIZE, PROT_READ | PROT_WRITE);
+}
+
+static void page_close(void)
+{
+    mprotect((void *)MODEL_REG_BASE, MODEL_REG_SIZE, PROT_NONE);
+}
+
+static u8 *dma_addr(u32 reg)
+{
+    u32 addr = GPSEC(reg);
+
+    if (addr == 0)
+        model_fault("DMA address 0 in %08x", reg);
+    return (u8 *)(uintptr_t)addr;
+}
+
+static void reg_bytes(u8 *out, const u32 *offs, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++)
+        memcpy(out + 4 * i, (const void *)(MODEL_REG_BASE + offs[i]), 4);
+}
+
+static const u32 key_offs[8] = {0x610, 0x614, 0x618, 0x61C, 0x620, 0x624, 0x64C, 0x650};
+static const u32 iv_offs[4] = {0x628, 0x62C, 0x620, 0x624};
+
+/* ---------------------------------------------------------------- reference cores */
+
+static u32 rol32(u32 x, int n)
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+static void sha1_block(u32 st[5], const u8 *p)
+{
+    u32 w[80], a, b, c, d, e, f, k, t;
+    int i;
+
+    for (i = 0; i < 16; i++)
+        w[i] = ((u32)p[4 * i] << 24) | ((u32)p[4 * i + 1] << 16) | ((u32)p[4 * i + 2] << 8) | p[4 * i + 3];
+    for (; i < 80; i++)
+        w[i] = rol32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+    a = st[0]; b = st[1]; c = st[2]; d = st[3]; e = st[4];
+    for (i = 0; i < 80; i++)
+    {
+        if (i < 20)
+        {
+            f = (b & c) | (~b & d);
+            k = 0x5A827999;
+        }
+        else if (i < 40)
+        {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        }
+        else if (i < 60)
+        {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        }
+        else
+        {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
+        }
+        t = rol32(a, 5) + f + e + k + w[i];
+        e = d; d = c; c = rol32(b, 30); b = a; a = t;
+    }
+    st[0] += a; st[1] += b; st[2] += c; st[3] += d; st[4] += e;
+}
+
+static void md5_block(u32 st[4], const u8 *p)
+{
+    static const u32 k[64] = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+    static const int r[16] = {7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21};
+    u32 m[16], a, b, c, d, f, t;
+    int i, g;
+
+    for (i = 0; i < 16; i++)
+        m[i] = p[4 * i] | ((u32)p[4 * i + 1] << 8) | ((u32)p[4 * i + 2] << 16) | ((u32)p[4 * i + 3] << 24);
+
+    a = st[0]; b = st[1]; c = st[2]; d = st[3];
+    for (i = 0; i < 64; i++)
+    {
+        if (i < 16)
+        {
+            f = (b & c) | (~b & d);
+            g = i;
+        }
+        else if (i < 32)
+        {
+            f = (d & b) | (~d & c);
+            g = (5 * i + 1) & 15;
+        }
+        else if (i < 48)
+        {
+            f = b ^ c ^ d;
+            g = (3 * i + 5) & 15;
+        }
+        else
+        {
+            f = c ^ (b | ~d);
+            g = (7 * i) & 15;
+        }
+        t = d;
+        d = c;
+        c = b;
+        b = b + rol32(a + f + k[i] + m[g], r[(i / 16) * 4 + (i & 3)]);
+        a = t;
+    }
+    st[0] += a; st[1] += b; st[2] += c; st[3] += d;
+}
+
+/* FIPS 46-3, bit 1 is the most significant one */
+static const u8 des_ip[64] = {
+    58, 50, 42, 34, 26, 18, 10, 2, 60, 52, 44, 36, 28, 20, 12, 4,
+    62, 54, 46, 38, 30, 22, 14, 6, 64, 56, 48, 40, 32, 24, 16, 8,
+    57, 49, 41, 33, 25, 17, 9, 1, 59, 51, 43, 35, 27, 19, 11, 3,
+    61, 53, 45, 37, 29, 21, 13, 5, 63, 55, 47, 39, 31, 23, 15, 7};
+static const u8 des_fp[64] = {
+    40, 8, 48, 16, 56, 24, 64, 32, 39, 7, 47, 15, 55, 23, 63, 31,
+    38, 6, 46, 14, 54, 22, 62, 30, 37, 5, 45, 13, 53, 21, 61, 29,
+    36, 4, 44, 12, 52, 20, 60, 28, 35, 3, 43, 11, 51, 19, 59, 27,
+    34, 2, 42, 10, 50, 18, 58, 26, 33, 1, 41, 9, 49, 17, 57, 25};
+static const u8 des_e[48] = {
+    32, 1, 2, 3, 4, 5, 4, 5, 6, 7, 8, 9, 8, 9, 10, 11, 12, 13, 12, 13, 14, 15, 16, 17,
+    16, 17, 18, 19, 20, 21, 20, 21, 22, 23, 24, 25, 24, 25, 26, 27, 28, 29, 28, 29, 30, 31, 32, 1};
+static const u8 des_p[32] = {
+    16, 7, 20, 21, 29, 12, 28, 17, 1, 15, 23, 26, 5, 18, 31, 10,
+    2, 8, 24, 14, 32, 27, 3, 9, 19, 13, 30, 6, 22, 11, 4, 25};
+static const u8 des_pc1[56] = {
+    57, 49, 41, 33, 25, 17, 9, 1, 58, 50, 42, 34, 26, 18, 10, 2, 59, 51, 43, 35, 27, 19, 11, 3, 60, 52, 44, 36,
+    63, 55, 47, 39, 31, 23, 15, 7, 62, 54, 46, 38, 30, 22, 14, 6, 61, 53, 45, 37, 29, 21, 13, 5, 28, 20, 12, 4};
+static const u8 des_pc2[48] = {
+    14, 17, 11, 24, 1, 5, 3, 28, 15, 6, 21, 10, 23, 19, 12, 4, 26, 8, 16, 7, 27, 20, 13, 2,
+    41, 52, 31, 37, 47, 55, 30, 40, 51, 45, 33, 48, 44, 49, 39, 56, 34, 53, 46, 42, 50, 36, 29, 32};
+static const u8 des_shifts[16] = {1, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1};
+static const u8 des_sbox[8][64] = {
+    {14, 4, 13, 1, 2, 15, 11, 8, 3, 10, 6, 12, 5, 9, 0, 7, 0, 15, 7, 4, 14, 2, 13, 1, 10, 6, 12, 11, 9, 5, 3, 8,
+     4, 1, 14, 8, 13, 6, 2, 11, 15, 12, 9, 7, 3, 10, 5, 0, 15, 12, 8, 2, 4, 9, 1, 7, 5, 11, 3, 14, 10, 0, 6, 13},
+    {15, 1, 8, 14, 6, 11, 3, 4, 9, 7, 2, 13, 12, 0, 5, 10, 3, 13, 4, 7, 15, 2, 8, 14, 12, 0, 1, 10, 6, 9, 11, 5,
+     0, 14, 7, 11, 10, 4, 13, 1, 5, 8, 12, 6, 9, 3, 2, 15, 13, 8, 10, 1, 3, 15, 4, 2, 11, 6, 7, 12, 0, 5, 14, 9},
+    {10, 0, 9, 14, 6, 3, 15, 5, 1, 13, 12, 7, 11, 4, 2, 8, 13, 7, 0, 9, 3, 4, 6, 10, 2, 8, 5, 14, 12, 11, 15, 1,
+     13, 6, 4, 9, 8, 15, 3, 0, 11, 1, 2, 12, 5, 10, 14, 7, 1, 10, 13, 0, 6, 9, 8, 7, 4, 15, 14, 3, 11, 5, 2, 12},
+    {7, 13, 14, 3, 0, 6, 9, 10, 1, 2, 8, 5, 11, 12, 4, 15, 13, 8, 11, 5, 6, 15, 0, 3, 4, 7, 2, 12, 1, 10, 14, 9,
+     10, 6, 9, 0, 12, 11, 7, 13, 15, 1, 3, 14, 5, 2, 8, 4, 3, 15, 0, 6, 10, 1, 13, 8, 9, 4, 5, 11, 12, 7, 2, 14},
+    {2, 12, 4, 1, 7, 10, 11, 6, 8, 5, 3, 15, 13, 0, 14, 9, 14, 11, 2, 12, 4, 7, 13, 1, 5, 0, 15, 10, 3, 9, 8, 6,
+     4, 2, 1, 11, 10, 13, 7, 8, 15, 9, 12, 5, 6, 3, 0, 14, 11, 8, 12, 7, 1, 14, 2, 13, 6, 15, 0, 9, 10, 4, 5, 3},
+    {12, 1, 10, 15, 9, 2, 6, 8, 0, 13, 3, 4, 14, 7, 5, 11, 10, 15, 4, 2, 7, 12, 9, 5, 6, 1, 13, 14, 0, 11, 3, 8,
+     9, 14, 15, 5, 2, 8, 12, 3, 7, 0, 4, 10, 1, 13, 11, 6, 4, 3, 2, 12, 9, 5, 15, 10, 11, 14, 1, 7, 6, 0, 8, 13},
+    {4, 11, 2, 14, 15, 0, 8, 13, 3, 12, 9, 7, 5, 10, 6, 1, 13, 0, 11, 7, 4, 9, 1, 10, 14, 3, 5, 12, 2, 15, 8, 6,
+     1, 4, 11, 13, 12, 3, 7, 14, 10, 15, 6, 8, 0, 5, 9, 2, 6, 11, 13, 8, 1, 4, 10, 7, 9, 5, 0, 15, 14, 2, 3, 12},
+    {13, 2, 8, 4, 6, 15, 11, 1, 10, 9, 3, 14, 5, 0, 12, 7, 1, 15, 13, 8, 10, 3, 7, 4, 12, 5, 6, 11, 0, 14, 9, 2,
+     7, 11, 4, 1, 9, 12, 14, 2, 0, 6, 10, 13, 15, 3, 5, 8, 2, 1, 14, 7, 4, 10, 8, 13, 15, 12, 9, 0, 3, 5, 6, 11}};
+
+/* pick the bits listed in tab (1 based, from the top of an inbits wide value) */
+static uint64_t des_permute(uint64_t in, const u8 *tab, int n, int inbits)
+{
+    uint64_t out = 0;
+    int i;
+
+    for (i = 0; i < n; i++)
+        out = (out << 1) | ((in >> (inbits - tab[i])) & 1);
+    return out;
+}
+
+static void des_subkeys(const u8 *key, uint64_t sk[16])
+{
+    uint64_t k = 0, cd;
+    u32 c, d;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        k = (k << 8) | key[i];
+    cd = des_permute(k, des_pc1, 56, 64);
+    c = (u32)(cd >> 28) & 0xFFFFFFF;
+    d = (u32)cd & 0xFFFFFFF;
+    for (i = 0; i < 16; i++)
+    {
+        c = ((c << des_shifts[i]) | (c >> (28 - des_shifts[i]))) & 0xFFFFFFF;
+        d = ((d << des_shifts[i]) | (d >> (28 - des_shifts[i]))) & 0xFFFFFFF;
+        sk[i] = des_permute(((uint64_t)c << 28) | d, des_pc2, 48, 56);
+    }
+}
+
+static uint64_t des_block(uint64_t in, const uint64_t sk[16], int dec)
+{
+    uint64_t x = des_permute(in, des_ip, 64, 64), e;
+    u32 l = (u32)(x >> 32), r = (u32)x, f, t;
+    int i, j;
+
+    for (i = 0; i < 16; i++)
+    {
+        e = des_permute(r, des_e, 48, 32) ^ sk[dec ? 15 - i : i];
+        f = 0;
+        for (j = 0; j < 8; j++)
+        {
+            u32 six = (u32)(e >> (42 - 6 * j)) & 0x3F;
+            f = (f << 4) | des_sbox[j][((six & 0x20) | ((six & 1) << 4)) | ((six >> 1) & 0xF)];
+        }
+        f = (u32)des_permute(f, des_p, 32, 32);
+        t = r;
+        r = l ^ f;
+        l = t;
+    }
+    return des_permute(((uint64_t)r << 32) | l, des_fp, 64, 64);
+}
+
+static u32 reflect(u32 v, int bits)
+{
+    u32 r = 0;
+    int i;
+
+    for (i = 0; i < bits; i++)
+        if (v & (1u << i))
+            r |= 1u << (bits - 1 - i);
+    return r;
+}
+
+/* ---------------------------------------------------------------- GPSEC */
+
+static void gpsec_rc4(u32 cfg, const u8 *src, u8 *dst, u32 len)
+{
+    u8 key[32], t;
+    int keylen = (cfg & (1u << 31)) ? 32 : 16;
+    int i, j;
+
+    if (cfg & (1 << 25))
+    {
+        reg_bytes(key, key_offs, keylen / 4);
+        for (i = 0; i < 256; i++)
+            rc4.s[i] = i;
+        for (i = j = 0; i < 256; i++)
+        {
+            j = (j + rc4.s[i] + key[i % keylen]) & 0xFF;
+            t = rc4.s[i]; rc4.s[i] = rc4.s[j]; rc4.s[j] = t;
+        }
+        rc4.i = rc4.j = 0;
+    }
+    while (len--)
+    {
+        rc4.i++;
+        rc4.j += rc4.s[rc4.i];
+        t = rc4.s[rc4.i]; rc4.s[rc4.i] = rc4.s[rc4.j]; rc4.s[rc4.j] = t;
+        *dst++ = *src++ ^ rc4.s[(u8)(rc4.s[rc4.i] + rc4.s[rc4.j])];
+    }
+}
+
+static void gpsec_aes(u32 cfg, const u8 *src, u8 *dst, u32 len)
+{
+    mbedtls_aes_sw_context enc, dec;
+    u8 key[16], iv[16], blk[16], ks[16];
+    int way = (cfg >> 20) & 1;
+    int mode = (cfg >> 21) & 3;
+    u32 i, n;
+    int k;
+
+    if (mode == CRYPTO_MODE_CMAC)
+        model_fault("AES CMAC is not modelled");
+    if (mode != CRYPTO_MODE_CTR && len % 16)
+        model_fault("AES length %u is not a multiple of the block", len);
+
+    reg_bytes(key, key_offs, 4);
+    reg_bytes(iv, iv_offs, 4);
+    mbedtls_aes_sw_init(&enc);
+    mbedtls_aes_sw_init(&dec);
+    mbedtls_aes_sw_setkey_enc(&enc, key, 128);
+    mbedtls_aes_sw_setkey_dec(&dec, key, 128);
+
+    for (i = 0; i < len; i += 16)
+    {
+        n = len - i < 16 ? len - i : 16;
+        memcpy(blk, src + i, n);
+        if (mode == CRYPTO_MODE_CTR)
+        {
+            mbedtls_aes_sw_encrypt(&enc, iv, ks);
+            for (k = 0; k < (int)n; k++)
+                dst[i + k] = blk[k] ^ ks[k];
+            /* the counter is the whole block, big endian */
+            for (k = 15; k >= 0 && ++iv[k] == 0; k--)
+                ;
+        }
+        else if (way == CRYPTO_WAY_ENCRYPT)
+        {
+            if (mode == CRYPTO_MODE_CBC)
+                for (k = 0; k < 16; k++)
+                    blk[k] ^= iv[k];
+            mbedtls_aes_sw_encrypt(&enc, blk, dst + i);
+            if (mode == CRYPTO_MODE_CBC)
+                memcpy(iv, dst + i, 16);
+        }
+        else
+        {
+            mbedtls_aes_sw_decrypt(&dec, blk, dst + i);
+            if (mode == CRYPTO_MODE_CBC)
+            {
+                for (k = 0; k < 16; k++)
+                    dst[i + k] ^= iv[k];
+                memcpy(iv, blk, 16);
+            }
+        }
+    }
+    mbedtls_aes_sw_free(&enc);
+    mbedtls_aes_sw_free(&dec);
+}
+
+static uint64_t load64h(const u8 *p)
+{
+    uint64_t v = 0;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        v = (v << 8) | p[i];
+    return v;
+}
+
+static void store64h(uint64_t v, u8 *p)
+{
+    int i;
+
+    for (i = 7; i >= 0; i--, v >>= 8)
+        p[i] = (u8)v;
+}
+
+static void gpsec_des(u32 cfg, int triple, const u8 *src, u8 *dst, u32 len)
+{
+    uint64_t sk[3][16], iv, x, in;
+    u8 key[24], ivb[8];
+    int way = (cfg >> 20) & 1;
+    int mode = (cfg >> 21) & 3;
+    u32 i;
+
+    if (mode != CRYPTO_MODE_ECB && mode != CRYPTO_MODE_CBC)
+        model_fault("DES mode %d is not supported", mode);
+    if (len % 8)
+        model_fault("DES length %u is not a multiple of the block", len);
+
+    reg_bytes(key, key_offs, triple ? 6 : 2);
+    reg_bytes(ivb, iv_offs, 2);
+    des_subkeys(key, sk[0]);
+    if (triple)
+    {
+        des_subkeys(key + 8, sk[1]);
+        des_subkeys(key + 16, sk[2]);
+    }
+    iv = load64h(ivb);
+
+    for (i = 0; i < len; i += 8)
+    {
+        in = load64h(src + i);
+        if (way == CRYPTO_WAY_ENCRYPT)
+        {
+            x = mode == CRYPTO_MODE_CBC ? in ^ iv : in;
+            x = des_block(x, sk[0], 0);
+            if (triple)
+                x = des_block(des_block(x, sk[1], 1), sk[2], 0);
+            iv = x;
+        }
+        else
+        {
+            x = in;
+            if (triple)
+                x = des_block(des_block(x, sk[2], 1), sk[1], 0);
+            x = des_block(x, sk[0], 1);
+            if (mode == CRYPTO_MODE_CBC)
+                x ^= iv;
+            iv = in;
+        }
+        store64h(x, dst + i);
+    }
+}
+
+/* the key register holds the raw shift register, the result is reflected on the way out */
+static void gpsec_crc(u32 cfg, const u8 *src, u32 len)
+{
+    static const u32 poly[4] = {0x07, 0x8005, 0x1021, 0x04C11DB7};
+    static const int width[4] = {8, 16, 16, 32};
+    int type = (cfg >> 21) & 3;
+    int mode = (cfg >> 23) & 3;
+    u32 mask = width[type] == 32 ? 0xFFFFFFFF : (1u << width[type]) - 1;
+    u32 top = 1u << (width[type] - 1);
+    u32 crc = GPSEC(HR_CRYPTO_CRC_KEY) & mask;
+    u32 b;
+    int k;
+
+    while (len--)
+    {
+        b = *src++;
+        if (mode & INPUT_REFLECT)
+            b = reflect(b, 8);
+        crc ^= b << (width[type] - 8);
+        for (k = 0; k < 8; k++)
+            crc = ((crc & top) ? (crc << 1) ^ poly[type] : crc << 1) & mask;
+    }
+    GPSEC(HR_CRYPTO_CRC_RESULT) = (mode & OUTPUT_REFLECT) ? reflect(crc, width[type]) : crc;
+}
+
+static void gpsec_digest(int method, const u8 *src, u32 len)
+{
+    u32 st[5];
+    int n = method == CRYPTO_METHOD_SHA1 ? 5 : 4;
+    int i;
+
+    if (len != 64)
+        model_fault("digest run of %u bytes, the engine takes one block", len);
+    for (i = 0; i < n; i++)
+        st[i] = GPSEC(HR_CRYPTO_SHA1_DIGEST0 + 4 * i);
+    if (method == CRYPTO_METHOD_SHA1)
+        sha1_block(st, src);
+    else
+        md5_block(st, src);
+    for (i = 0; i < n; i++)
+        GPSEC(HR_CRYPTO_SHA1_DIGEST0 + 4 * i) = st[i];
+}
+
+static void gpsec_run(void)
+{
+    u32 cfg = GPSEC(HR_CRYPTO_SEC_CFG);
+    int method = (cfg >> 16) & 0x7;
+    u32 len = cfg & 0xFFFF;
+
+    if (len == 0)
+        model_fault("engine started with length 0, SEC_CFG %08x", cfg);
+
+    switch (method)
+    {
+    case CRYPTO_METHOD_RC4:
+        gpsec_rc4(cfg, dma_addr(HR_CRYPTO_SRC_ADDR), dma_addr(HR_CRYPTO_DEST_ADDR), len);
+        break;
+    case CRYPTO_METHOD_AES:
+        gpsec_aes(cfg, dma_addr(HR_CRYPTO_SRC_ADDR), dma_addr(HR_CRYPTO_DEST_ADDR), len);
+        break;
+    case CRYPTO_METHOD_DES:
+    case CRYPTO_METHOD_3DES:
+        gpsec_des(cfg, method == CRYPTO_METHOD_3DES, dma_addr(HR_CRYPTO_SRC_ADDR),
+                  dma_addr(HR_CRYPTO_DEST_ADDR), len);
+        break;
+    case CRYPTO_METHOD_CRC:
+        gpsec_crc(cfg, dma_addr(HR_CRYPTO_SRC_ADDR), len);
+        break;
+    case CRYPTO_METHOD_SHA1:
+    case CRYPTO_METHOD_MD5:
+        gpsec_digest(method, dma_addr(HR_CRYPTO_SRC_ADDR), len);
+        break;
+    default:
+        model_fault("engine started with method %d, SEC_CFG %08x", method, cfg);
+    }
+    GPSEC(HR_CRYPTO_SEC_STS) = SEC_STS_DONE | len;
+}
+
+/* ---------------------------------------------------------------- RSA multiplier */
+
+/* out = x * y / 2^(32 n) mod m, with mc = -1 / m mod 2^32 as the multiplier is given it */
+static void rsa_monmul(u32 *out, const u32 *x, const u32 *y, const u32 *m, u32 mc, int n)
+{
+    u32 t[RSA_MAX_WORDS + 2] = {0};
+    uint64_t s, c;
+    u32 u;
+    int i, j;
+
+    for (i = 0; i < n; i++)
+    {
+        c = 0;
+        for (j = 0; j < n; j++)
+        {
+            s = (uint64_t)t[j] + (uint64_t)x[j] * y[i] + c;
+            t[j] = (u32)s;
+            c = s >> 32;
+        }
+        s = (uint64_t)t[n] + c;
+        t[n] = (u32)s;
+        t[n + 1] = (u32)(s >> 32);
+
+        u = t[0] * mc;
+        s = (uint64_t)t[0] + (uint64_t)u * m[0];
+        c = s >> 32;
+        for (j = 1; j < n; j++)
+        {
+            s = (uint64_t)t[j] + (uint64_t)u * m[j] + c;
+            t[j - 1] = (u32)s;
+            c = s >> 32;
+        }
+        s = (uint64_t)t[n] + c;
+        t[n - 1] = (u32)s;
+        t[n] = t[n + 1] + (u32)(s >> 32);
+    }
+
+    /* operands up to 2^(32 n) leave t below 2^(32 n) + m */
+    for (;;)
+    {
+        if (t[n] == 0)
+        {
+            for (j = n - 1; j >= 0 && t[j] == m[j]; j--)
+                ;
+            if (j >= 0 && t[j] < m[j])
+                break;
+        }
+        for (j = 0, c = 0; j < n; j++)
+        {
+            s = (uint64_t)t[j] - m[j] - c;
+            t[j] = (u32)s;
+            c = (s >> 32) & 1;
+        }
+        t[n] -= (u32)c;
+    }
+    memcpy(out, t, n * sizeof(u32));
+}
+
+static void rsa_run(u32 con)
+{
+    u32 x[RSA_MAX_WORDS], y[RSA_MAX_WORDS], m[RSA_MAX_WORDS], r[RSA_MAX_WORDS];
+    u32 n = REG(RSA_N);
+    u32 src1, src2, dst;
+
+    if (n == 0 || n > RSA_MAX_WORDS)
+        model_fault("RSAN %u", n);
+
+    switch (con)
+    {
+    case 0x2c:
+        src1 = RSA_XBUF; src2 = RSA_XBUF; dst = RSA_DBUF;
+        break;
+    case 0x20:
+        src1 = RSA_DBUF; src2 = RSA_DBUF; dst = RSA_XBUF;
+        break;
+    case 0x24:
+        src1 = RSA_XBUF; src2 = RSA_YBUF; dst = RSA_DBUF;
+        break;
+    case 0x28:
+        src1 = RSA_YBUF; src2 = RSA_DBUF; dst = RSA_XBUF;
+        break;
+    default:
+        model_fault("RSACON %08x", con);
+        return;
+    }
+
+    memcpy(x, (const void *)(MODEL_REG_BASE + src1), n * sizeof(u32));
+    memcpy(y, (const void *)(MODEL_REG_BASE + src2), n * sizeof(u32));
+    memcpy(m, (const void *)(MODEL_REG_BASE + RSA_MBUF), n * sizeof(u32));
+    rsa_monmul(r, x, y, m, REG(RSA_MC), n);
+    memcpy((void *)(MODEL_REG_BASE + dst), r, n * sizeof(u32));
+}
+
+/* ---------------------------------------------------------------- TRNG */
+
+void gpsec_model_trng_seed(uint64_t seed)
+{
+    trng_state = seed ? seed : 1;
+    trng_consumed = 1;
+}
+
+/* xorshift64*, only the sequence matters here */
+u32 gpsec_model_trng_next(void)
+{
+    trng_state ^= trng_state >> 12;
+    trng_state ^= trng_state << 25;
+    trng_state ^= trng_state >> 27;
+    return (u32)((trng_state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+static int trng_running(void)
+{
+    u32 cr = GPSEC(HR_CRYPTO_TRNG_CR);
+
+    return (cr & TRNG_EN) && !(cr & TRNG_INT_MASK);
+}
+
+static void trng_timer(int on)
+{
+    struct itimerval it;
+
+    if (on == trng_timer_on)
+        return;
+    memset(&it, 0, sizeof(it));
+    if (on)
+        it.it_interval.tv_usec = it.it_value.tv_usec = TRNG_TICK_US;
+    setitimer(ITIMER_REAL, &it, NULL);
+    trng_timer_on = on;
+}
+
+/* ---------------------------------------------------------------- interrupts */
+
+/* run whatever the registers ask for and raise the interrupts, with the page open */
+static void model_service(void)
+{
+    u32 v;
+
+    if (irq_masked)
+    {
+        irq_pending = 1;
+        return;
+    }
+    irq_pending = 0;
+    irq_masked = 1;
+    for (;;)
+    {
+        v = GPSEC(HR_CRYPTO_SEC_CTRL);
+        if (v & SEC_CTRL_START)
+        {
+            GPSEC(HR_CRYPTO_SEC_CTRL) = v & ~(SEC_CTRL_START | SEC_CTRL_CRC_CLEAR);
+            gpsec_run();
+            CRYPTION_IRQHandler();
+            continue;
+        }
+        GPSEC(HR_CRYPTO_SEC_CTRL) = v & ~SEC_CTRL_CRC_CLEAR;
+
+        v = REG(RSA_CON);
+        if (v & 0x20)
+        {
+            REG(RSA_CON) = 0;
+            rsa_run(v);
+            RSA_F_IRQHandler();
+            continue;
+        }
+
+        if (trng_tick && trng_running())
+        {
+            /* the number stays until it is read, the interrupt repeats */
+            if (trng_consumed)
+            {
+                GPSEC(HR_CRYPTO_RNG_RESULT) = gpsec_model_trng_next();
+                trng_consumed = 0;
+            }
+            trng_tick = 0;
+            CRYPTION_IRQHandler();
+            continue;
+        }
+        trng_tick = 0;
+        break;
+    }
+    trng_timer(trng_running());
+    irq_masked = 0;
+}
+
+static void model_service_from_task(void)
+{
+    sigset_t set, old;
+
+    sigemptyset(&set);
+    sigaddset(&set, SIGALRM);
+    sigprocmask(SIG_BLOCK, &set, &old);
+    page_open();
+    model_service();
+    page_close();
+    sigprocmask(SIG_SETMASK, &old, NULL);
+}
+
+void gpsec_model_irq_disable(void)
+{
+    irq_masked++;
+}
+
+void gpsec_model_irq_enable(void)
+{
+    if (--irq_masked == 0 && irq_pending)
+        model_service_from_task();
+}
+
+static void on_alarm(int sig, siginfo_t *si, void *uc)
+{
+    trng_tick = 1;
+    if (irq_masked)
+    {
+        irq_pending = 1;
+        return;
+    }
+    page_open();
+    model_service();
+    page_close();
+}
+
+static void on_fault(int sig, siginfo_t *si, void *ctx)
+{
+    ucontext_t *uc = ctx;
+    uintptr_t addr = (uintptr_t)si->si_addr;
+
+    if (addr < MODEL_REG_BASE || addr >= MODEL_REG_BASE + MODEL_REG_SIZE)
+    {
+        signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+    access_addr = (uc->uc_mcontext.gregs[REG_ERR] & PF_WRITE) ? 0 : addr;
+    /* no timer interrupt while the page is open for the one instruction */
+    access_blocked_alarm = sigismember(&uc->uc_sigmask, SIGALRM);
+    sigaddset(&uc->uc_sigmask, SIGALRM);
+    uc->uc_mcontext.gregs[REG_EFL] |= EFLAGS_TF;
+    page_open();
+}
+
+static void on_trap(int sig, siginfo_t *si, void *ctx)
+{
+    ucontext_t *uc = ctx;
+
+    if (!(uc->uc_mcontext.gregs[REG_EFL] & EFLAGS_TF))
+    {
+        signal(SIGTRAP, SIG_DFL);
+        return;
+    }
+    uc->uc_mcontext.gregs[REG_EFL] &= ~EFLAGS_TF;
+    if (!access_blocked_alarm)
+        sigdelset(&uc->uc_sigmask, SIGALRM);
+
+    if (access_addr >= HR_CRYPTO_RNG_RESULT && access_addr < HR_CRYPTO_RNG_RESULT + 4)
+        trng_consumed = 1;
+    access_addr = 0;
+
+    model_service();
+    page_close();
+}
+
+int gpsec_model_init(void)
+{
+    struct sigaction sa;
+    void *page;
+
+    page = mmap((void *)MODEL_REG_BASE, MODEL_REG_SIZE, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (page != (void *)MODEL_REG_BASE)
+    {
+        perror("gpsec model: mmap of the register page");
+        return -1;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    sigaddset(&sa.sa_mask, SIGALRM);
+    sa.sa_sigaction = on_fault;
+    sigaction(SIGSEGV, &sa, NULL);
+    sa.sa_sigaction = on_trap;
+    sigaction(SIGTRAP, &sa, NULL);
+    sa.sa_sigaction = on_alarm;
+    sigaction(SIGALRM, &sa, NULL);
+
+    page_close();
+    return 0;
+}
@@ -0,0 +1,21 @@
+#ifndef GPSEC_MODEL_H
+#define GPSEC_MODEL_H
+
+#include <stdint.h>
+
+/* the GPSEC and RSA register blocks both live in the page at RSA_BASE_ADDRESS */
+#define MODEL_REG_BASE      0x40000000UL
+#define MODEL_REG_SIZE      0x1000
+
+/* map the register page and install the handlers that run the engine on register writes */
+int gpsec_model_init(void);
+
+/* restart the TRNG number sequence, so that a test can recompute what the driver was given */
+void gpsec_model_trng_seed(uint64_t seed);
+uint32_t gpsec_model_trng_next(void);
+
+/* interrupt masking, backs tls_os_set_critical() and tls_os_release_critical() */
+void gpsec_model_irq_disable(void);
+void gpsec_model_irq_enable(void);
+
+#endif
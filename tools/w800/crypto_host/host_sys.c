@@ -0,0 +1,198 @@
+/*
+ * The few OS, memory and driver calls the crypto wrappers make, for the host build.
+ * Everything runs on one thread, interrupts are the signal handlers of gpsec_model.c.
+ */
+#include <errno.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "wm_include.h"
+#include "wm_irq.h"
+#include "wm_pmu.h"
+#include "wm_internal_flash.h"
+#include "gpsec_model.h"
+
+/* a task waiting longer than this on one thread would wait forever */
+#define SEM_STUCK_SECONDS   10
+
+const unsigned int HZ = 1000;
+
+u32 tls_os_get_time(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u32)(ts.tv_sec * HZ + ts.tv_nsec / (1000000000 / HZ));
+}
+
+u32 tls_os_set_critical(void)
+{
+    gpsec_model_irq_disable();
+    return 0;
+}
+
+void tls_os_release_critical(u32 cpu_sr)
+{
+    gpsec_model_irq_enable();
+}
+
+tls_os_status_t tls_os_sem_create(tls_os_sem_t **sem, u32 cnt)
+{
+    sem_t *s = malloc(sizeof(*s));
+
+    if (s == NULL || sem_init(s, 0, cnt) != 0)
+    {
+        free(s);
+        return TLS_OS_ERROR;
+    }
+    *sem = s;
+    return TLS_OS_SUCCESS;
+}
+
+tls_os_status_t tls_os_sem_delete(tls_os_sem_t *sem)
+{
+    sem_destroy(sem);
+    free(sem);
+    return TLS_OS_SUCCESS;
+}
+
+/* wait_time in ticks, 0 waits forever; only an interrupt can post while we wait */
+tls_os_status_t tls_os_sem_acquire(tls_os_sem_t *sem, u32 wait_time)
+{
+    struct timespec ts;
+    int ret;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    if (wait_time)
+    {
+        ts.tv_sec += wait_time / HZ;
+        ts.tv_nsec += (long)(wait_time % HZ) * (1000000000 / HZ);
+        if (ts.tv_nsec >= 1000000000)
+        {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000;
+        }
+    }
+    else
+    {
+        ts.tv_sec += SEM_STUCK_SECONDS;
+    }
+
+    while ((ret = sem_timedwait(sem, &ts)) != 0 && errno == EINTR)
+        ;
+    if (ret == 0)
+        return TLS_OS_SUCCESS;
+    if (wait_time == 0)
+    {
+        fprintf(stderr, "host: semaphore %p never released\n", sem);
+        abort();
+    }
+    return TLS_OS_ERROR;
+}
+
+tls_os_status_t tls_os_sem_release(tls_os_sem_t *sem)
+{
+    return sem_post(sem) == 0 ? TLS_OS_SUCCESS : TLS_OS_ERROR;
+}
+
+/* the engine only takes 32 bit addresses */
+static void *mem_check(void *p)
+{
+    if ((uintptr_t)p > 0xFFFFFFFFUL)
+    {
+        fprintf(stderr, "host: allocation at %p is out of reach of the DMA\n", p);
+        abort();
+    }
+    return p;
+}
+
+void *mem_alloc_debug(u32 size)
+{
+    return mem_check(malloc(size));
+}
+
+void mem_free_debug(void *p)
+{
+    free(p);
+}
+
+void *mem_realloc_debug(void *mem_address, u32 size)
+{
+    return mem_check(realloc(mem_address, size));
+}
+
+void *mem_calloc_debug(size_t length, size_t size)
+{
+    return mem_check(calloc(length, size));
+}
+
+void tls_open_peripheral_clock(tls_peripheral_type_s devices)
+{
+}
+
+void tls_close_peripheral_clock(tls_peripheral_type_s devices)
+{
+}
+
+void tls_irq_enable(u8 vec_no)
+{
+}
+
+/* the RSA multiplier shares the flash lock, an unlock without its lock breaks flash access */
+int host_fls_locked;
+
+void tls_fls_sem_lock(void)
+{
+    host_fls_locked++;
+}
+
+void tls_fls_sem_unlock(void)
+{
+    if (--host_fls_locked < 0)
+    {
+        fprintf(stderr, "host: flash lock released without being taken\n");
+        abort();
+    }
+}
+
+void delay_cnt(int count)
+{
+}
+
+/* the demo reports cycles per byte, the host clock is the closest thing */
+void tls_sys_clk_get(tls_sys_clk *sysclk)
+{
+    char line[256];
+    double mhz = 0;
+    FILE *f;
+
+    f = fopen("/proc/cpuinfo", "r");
+    while (f && mhz == 0 && fgets(line, sizeof(line), f))
+        sscanf(line, "cpu MHz : %lf", &mhz);
+    if (f)
+        fclose(f);
+    if (mhz == 0)
+        mhz = 1000;
+
+    sysclk->cpuclk = (u32)mhz;
+    sysclk->apbclk = sysclk->cpuclk / 4;
+    sysclk->wlanclk = 160;
+}
+
+void mp_reverse(unsigned char *s, int len)
+{
+    int ix = 0, iy = len - 1;
+    unsigned char t;
+
+    while (ix < iy)
+    {
+        t = s[ix];
+        s[ix] = s[iy];
+        s[iy] = t;
+        ix++;
+        iy--;
+    }
+}
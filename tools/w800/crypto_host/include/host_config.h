@@ -0,0 +1,4 @@
+/* mbedtls user config of the host build, see MBEDTLS_USER_CONFIG_FILE in the Makefile */
+#undef  MBEDTLS_HAVE_ASM
+#define MBEDTLS_HAVE_INT32
+#define MBEDTLS_SELF_TEST
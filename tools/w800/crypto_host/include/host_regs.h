@@ -0,0 +1,31 @@
+#ifndef HOST_REGS_H
+#define HOST_REGS_H
+
+/*
+ * Forced into every file of the host build. M32() and the RSA register macros access
+ * unsigned long, which is 64 bit on the host: a store to HR_CRYPTO_IV1 would spill over
+ * IV0, one to RSACON over RSAMC. Give them the 32 bit width they have on the chip, after
+ * both headers that define M32() have been seen.
+ */
+#include "wm_regs.h"
+#include "wm_internal_flash.h"
+
+#undef  M32
+#define M32(adr)               (*((volatile unsigned int *) (unsigned long) (adr)))
+
+#undef  RSAXBUF
+#undef  RSAYBUF
+#undef  RSAMBUF
+#undef  RSADBUF
+#undef  RSACON
+#undef  RSAMC
+#undef  RSAN
+#define RSAXBUF                (*((volatile unsigned int *) (RSA_BASE_ADDRESS + 0x0 )))
+#define RSAYBUF                (*((volatile unsigned int *) (RSA_BASE_ADDRESS + 0x100 )))
+#define RSAMBUF                (*((volatile unsigned int *) (RSA_BASE_ADDRESS + 0x200 )))
+#define RSADBUF                (*((volatile unsigned int *) (RSA_BASE_ADDRESS + 0x300 )))
+#define RSACON                 (*((volatile unsigned int *) (RSA_BASE_ADDRESS + 0x400 )))
+#define RSAMC                  (*((volatile unsigned int *) (RSA_BASE_ADDRESS + 0x404 )))
+#define RSAN                   (*((volatile unsigned int *) (RSA_BASE_ADDRESS + 0x408 )))
+
+#endif
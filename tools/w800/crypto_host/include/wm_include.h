@@ -0,0 +1,22 @@
+#ifndef WM_INCLUDE_H
+#define WM_INCLUDE_H
+
+/*
+ * Stands in for include/wm_include.h in the host build: the real one pulls in lwIP
+ * and the whole SDK. Also takes the place of demo/wm_demo.h, whose guard is defined
+ * here, and turns the conformance demo on.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "wm_type_def.h"
+#include "wm_osal.h"
+#include "wm_mem.h"
+#include "wm_regs.h"
+#include "wm_cpu.h"
+
+#define __WM_DEMO_H__
+#define DEMO_CRYPT_CONFORM  1
+
+int crypt_conform_demo(void);
+
+#endif